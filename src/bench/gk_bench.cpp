@@ -0,0 +1,452 @@
+/**
+ **  _   _                 _
+ ** | | | |               | |
+ ** | |_| | ___ _ __ _ __ | |     ___   __ _
+ ** |  _  |/ _ \ '__| '_ \| |    / _ \ / _` |
+ ** | | | |  __/ |  | |_) | |___| (_) | (_| |
+ ** \_| |_/\___|_|  | .__/\_____/\___/ \__, |
+ **                 | |                 __/ |
+ **                 |_|                |___/
+ **
+ **   Thank you for using "HerpLog" for your herpetology management requirements!
+ **   Copyright (C) 2017-2018. GekkoFyre.
+ **
+ **
+ **   HerpLog is free software: you can redistribute it and/or modify
+ **   it under the terms of the GNU General Public License as published by
+ **   the Free Software Foundation, either version 3 of the License, or
+ **   (at your option) any later version.
+ **
+ **   HerpLog is distributed in the hope that it will be useful,
+ **   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **   GNU General Public License for more details.
+ **
+ **   You should have received a copy of the GNU General Public License
+ **   along with HerpLog.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ **
+ **   The latest source code updates can be obtained from [ 1 ] below at your
+ **   discretion. A web-browser or the 'git' application may be required.
+ **
+ **   [ 1 ] - https://github.com/GekkoFyre/HerpLog
+ **
+ ********************************************************************************/
+
+/**
+ * @file gk_bench.cpp
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @brief Times the hot paths of HerpLog against a synthetic database, which is generated anew from a seed upon every
+ * run, so that the results of one commit may be compared against those of another.
+ */
+
+#include "gk_bench.hpp"
+#include "./../gk_text_index.hpp"
+#include "./../gk_category_tree.hpp"
+#include "./../gk_flag_index.hpp"
+#include <QDateTime>
+#include <QDir>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <exception>
+#include <iostream>
+#include <limits>
+#include <numeric>
+
+using namespace GekkoFyre;
+namespace sys = boost::system;
+
+namespace {
+constexpr long int HERPLOG_BENCH_EPOCH = 1514764800L;                 // 2018-01-01T00:00:00Z
+constexpr long int HERPLOG_BENCH_SPAN = 2L * 365L * 24L * 60L * 60L;  // The records are spread over two years
+
+const char *const bench_words[] = {
+    "shed", "basking", "cricket", "dubia", "roach", "calcium", "dusted", "mealworm", "superworm", "misted", "humidity",
+    "hide", "substrate", "uvb", "lamp", "temperature", "warm", "cool", "side", "ate", "refused", "lethargic", "active",
+    "alert", "soaked", "bath", "stuck", "toe", "tail", "appetite", "good", "poor", "normal", "urate", "dry", "wet",
+    "weighed", "handled", "calm", "defensive", "brumating", "gravid", "laid", "clutch", "eggs", "incubator", "vet"
+};
+constexpr std::size_t bench_word_count = sizeof(bench_words) / sizeof(bench_words[0]);
+
+/**
+ * @brief bench_id creates a Unique ID in the same layout as GkDbWrite::create_uuid(), but from the seeded generator, so
+ * that each run generates the very same database.
+ */
+std::string bench_id(std::mt19937_64 &rng)
+{
+    const std::uint64_t hi = rng();
+    const std::uint64_t lo = rng();
+    char buf[40];
+    std::snprintf(buf, sizeof(buf), "%08X-%04X-%04X-%04X-%012llX", static_cast<unsigned int>(hi >> 32),
+                  static_cast<unsigned int>((hi >> 16) & 0xFFFF), static_cast<unsigned int>(hi & 0xFFFF),
+                  static_cast<unsigned int>(lo >> 48), static_cast<unsigned long long>(lo & 0xFFFFFFFFFFFFULL));
+    return std::string(buf);
+}
+}
+
+GkBench::GkBench(const GkBenchmark::GkBenchParams &bench_params, QObject *parent) : QObject(parent)
+{
+    params = bench_params;
+    archive_size = 0;
+
+    gkStrOp = std::make_shared<GkStringOp>(nullptr);
+    gkFileIo = std::make_shared<GkFileIo>(nullptr);
+    gkDbConn = std::make_unique<GkDbConn>(nullptr);
+}
+
+GkBench::~GkBench()
+{
+    close_db();
+    if (!work_dir.empty()) {
+        sys::error_code ec;
+        fs::remove_all(work_dir, ec);
+    }
+}
+
+/**
+ * @brief GkBench::run generates the synthetic database and times each of the hot paths against it, in the order that a
+ * user would come across them: inserting records, reading them back, saving the database and opening it up again, and
+ * lastly deleting a whole Licensee.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @return The timings of each benchmark.
+ */
+std::vector<GkBenchmark::GkBenchResult> GkBench::run()
+{
+    using namespace GkRecords;
+    if ((params.licensees == 0) || (params.species == 0) || (params.animals == 0) || (params.records == 0) ||
+            (params.iterations == 0)) {
+        throw std::invalid_argument(tr("Every parameter of the benchmark must be at least one!").toStdString());
+    }
+
+    std::vector<GkBenchmark::GkBenchResult> results;
+    const std::string run_name = "herplog-bench-" + gkStrOp->random_hash();
+    work_dir = fs::path(QDir::tempPath().toStdString()) / run_name;
+    const fs::path db_dir = work_dir / "db";
+    fs::create_directories(db_dir);
+    open_db(db_dir);
+
+    const std::vector<GkSubmit> records = generate();
+    std::vector<std::string> record_ids;
+    record_ids.reserve(records.size());
+    for (const auto &record: records) {
+        record_ids.push_back(record.record_id);
+    }
+
+    // Much the same as what HerpApp::submit_log_entry() does for each record
+    results.push_back(time("insert_log_entry", 1, records.size(), [&]() {
+        for (const auto &record: records) {
+            gkDbWrite->add_log_entry(record.record_id, record);
+        }
+    }));
+
+    const std::size_t iterations = params.iterations;
+    results.push_back(time("get_uuids", iterations, 1, [&]() {
+        gkDbRead->get_uuids();
+    }));
+
+    results.push_back(time("extract_records_all", iterations, 1, [&]() {
+        gkDbRead->extract_records(std::numeric_limits<long int>::min(), std::numeric_limits<long int>::max());
+    }));
+
+    results.push_back(time("extract_records_window", iterations, 1, [&]() {
+        gkDbRead->extract_records(HERPLOG_BENCH_EPOCH, HERPLOG_BENCH_EPOCH + (HERPLOG_BENCH_SPAN / 10));
+    }));
+
+    results.push_back(time("determine_min_date_time", iterations, 1, [&]() {
+        gkDbRead->determine_min_date_time(record_ids);
+    }));
+
+    results.push_back(time("determine_max_date_time", iterations, 1, [&]() {
+        gkDbRead->determine_max_date_time(record_ids);
+    }));
+
+    // Much the same as what the charts and the record browser do for whichever animal is selected
+    const std::string bench_animal = records.front().identifier.name_id;
+    results.push_back(time("animal_last_entries", iterations, 1, [&]() {
+        gkDbRead->scan_animal_index(bench_animal, std::numeric_limits<long int>::min(),
+                                    std::numeric_limits<long int>::max(), 50, true);
+    }));
+
+    results.push_back(time("animal_date_window", iterations, 1, [&]() {
+        gkDbRead->scan_animal_index(bench_animal, HERPLOG_BENCH_EPOCH, HERPLOG_BENCH_EPOCH + (HERPLOG_BENCH_SPAN / 10),
+                                    std::numeric_limits<std::size_t>::max());
+    }));
+
+    // Much the same as what HerpApp::refresh_caches() does upon opening a database
+    results.push_back(time("category_tree_build", iterations, 1, [&]() {
+        GkCategoryTree tree(gkDbRead, nullptr);
+        tree.build();
+    }));
+
+    // Much the same as what the completer of the `Name / ID#` QComboBoxes does upon each keystroke, typo included
+    GkCategoryTree name_tree(gkDbRead, nullptr);
+    name_tree.build();
+    const std::string name_query = "Anmal #" + std::to_string((params.animals + 1) / 2);
+    results.push_back(time("fuzzy_find_name", iterations, 1, [&]() {
+        name_tree.fuzzy_find(MiscRecordType::gkId, name_query, HERPLOG_COMPLETER_MATCHES);
+    }));
+
+    // Much the same as what `herplog lapses` does upon being run, reading the bitmaps rather than the records
+    GkFlagIndex flag_index(db_ptr, gkStrOp, nullptr);
+    results.push_back(time("flag_index_load", iterations, 1, [&]() {
+        flag_index.load();
+    }));
+
+    // The records of an animal over a couple of months that lacked vitamins, then the animals that went a week without water
+    results.push_back(time("flag_and_window", iterations, 1, [&]() {
+        flag_index.record_ids((flag_index.animal(bench_animal) &
+                               flag_index.date_range(HERPLOG_BENCH_EPOCH, HERPLOG_BENCH_EPOCH + (HERPLOG_BENCH_SPAN / 10)))
+                              .and_not(flag_index.flagged(GkFlagBits::HadVitamins)));
+    }));
+
+    results.push_back(time("flag_lapses", iterations, 1, [&]() {
+        flag_index.flag_lapses(GkFlagBits::HadHydration, 7L * 24L * 60L * 60L, HERPLOG_BENCH_EPOCH,
+                               HERPLOG_BENCH_EPOCH + HERPLOG_BENCH_SPAN);
+    }));
+
+    // Much the same as what the `Find` dialog does, from a rare word through to a phrase made up of common ones
+    GkTextIndex text_index(db_ptr, nullptr);
+    const std::vector<std::pair<std::string, std::string>> searches = {
+        { "search_term", "gravid" }, { "search_and", "gravid clutch" }, { "search_or", "vet OR brumating" },
+        { "search_prefix", "super*" }, { "search_phrase", "\"stuck shed\"" }
+    };
+
+    for (const auto &search: searches) {
+        results.push_back(time(search.first, iterations, 1, [&]() {
+            text_index.search(search.second);
+        }));
+    }
+
+    // Google LevelDB has to let go of the database before it can be compressed, just as when saving it
+    close_db();
+    const std::string archive_file = (work_dir / "bench.hdb").string();
+    std::size_t compressions = 0;
+    results.push_back(time("compress_files", iterations, 1, [&]() {
+        gkFileIo->compress_files(db_dir.string(), archive_file + "." + std::to_string(compressions++));
+    }));
+
+    sys::error_code ec;
+    archive_size = fs::file_size(archive_file + ".0", ec);
+
+    const std::string restore_name = run_name + "-restored";
+    std::string restored_dir;
+    results.push_back(time("decompress_file", iterations, 1, [&]() {
+        restored_dir = gkFileIo->decompress_file(archive_file + ".0", restore_name);
+    }));
+
+    // Carry on with the database that has been through a save and an open, which also proves the round-trip
+    try {
+        open_db(restored_dir);
+        const std::size_t restored_records = gkDbRead->get_uuids().size();
+        if (restored_records != records.size()) {
+            throw std::runtime_error(tr("Only %1 of the %2 records survived being saved and opened again!")
+                                             .arg(QString::number(restored_records))
+                                             .arg(QString::number(records.size())).toStdString());
+        }
+
+        // Deleting the first Licensee takes around 1/N of the database with it
+        const std::string licensee_id = records.front().licensee.licensee_id;
+        const GkCategories categories = gkDbWrite->find_cat_dependants(MiscRecordType::gkLicensee, licensee_id);
+        const GkCatDeletionTally tally = gkStrOp->tally_cat_deletions(categories, MiscRecordType::gkLicensee);
+        results.push_back(time("mass_del_cat", 1, static_cast<std::size_t>(tally.log_entries), [&]() {
+            gkDbWrite->mass_del_cat(MiscRecordType::gkLicensee, categories);
+        }));
+    } catch (...) {
+        close_db();
+        fs::remove_all(restored_dir, ec);
+        throw;
+    }
+
+    close_db();
+    fs::remove_all(restored_dir, ec);
+    return results;
+}
+
+/**
+ * @brief GkBench::to_json writes out the results of a run as JSON, along with everything needed to reproduce it.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param results As returned by GkBench::run().
+ * @param label Whatever the user wishes to tell this run apart by, such as the commit that it was built from.
+ * @return The JSON document.
+ */
+QString GkBench::to_json(const std::vector<GkBenchmark::GkBenchResult> &results, const QString &label)
+{
+    QJsonObject params_obj;
+    params_obj.insert("licensees", static_cast<double>(params.licensees));
+    params_obj.insert("species", static_cast<double>(params.species));
+    params_obj.insert("animals", static_cast<double>(params.animals));
+    params_obj.insert("records", static_cast<double>(params.records));
+    params_obj.insert("iterations", static_cast<double>(params.iterations));
+    params_obj.insert("seed", QString::number(params.seed)); // A double cannot hold every 64-bit seed
+
+    QJsonArray results_arr;
+    for (const auto &result: results) {
+        QJsonObject result_obj;
+        result_obj.insert("name", QString::fromStdString(result.name));
+        result_obj.insert("iterations", static_cast<double>(result.iterations));
+        result_obj.insert("operations", static_cast<double>(result.operations));
+        result_obj.insert("min_ms", result.min_ms);
+        result_obj.insert("median_ms", result.median_ms);
+        result_obj.insert("mean_ms", result.mean_ms);
+        result_obj.insert("max_ms", result.max_ms);
+        result_obj.insert("ops_per_sec", (result.median_ms > 0.0) ?
+                                         (static_cast<double>(result.operations) * 1000.0 / result.median_ms) : 0.0);
+        results_arr.append(result_obj);
+    }
+
+    QJsonObject root;
+    root.insert("benchmark", QString("herplog_bench"));
+    root.insert("label", label);
+    root.insert("timestamp", QDateTime::currentDateTimeUtc().toString(Qt::ISODate));
+    root.insert("params", params_obj);
+    root.insert("archive_bytes", static_cast<double>(archive_size));
+    root.insert("results", results_arr);
+
+    return QString::fromUtf8(QJsonDocument(root).toJson());
+}
+
+/**
+ * @brief GkBench::open_db opens up the Google LevelDB database within the given directory, in the same manner as
+ * HerpLog itself.
+ * @param db_dir Where the database is kept.
+ */
+void GkBench::open_db(const fs::path &db_dir)
+{
+    db_ptr = gkDbConn->open_database(db_dir.string());
+    gkDbRead = std::make_shared<GkDbRead>(db_ptr, gkStrOp, nullptr);
+    gkDbWrite = std::make_shared<GkDbWrite>(db_ptr, gkDbRead, gkStrOp, nullptr);
+    gkDbWrite->rebuild_indexes();
+    return;
+}
+
+/**
+ * @brief GkBench::close_db closes the database, if one is open.
+ */
+void GkBench::close_db()
+{
+    gkDbWrite.reset();
+    gkDbRead.reset();
+    db_ptr.db.reset();
+    return;
+}
+
+/**
+ * @brief GkBench::generate creates the records of the synthetic database. Each Animal belongs to one Species and each
+ * Species to one Licensee, and the notes vary in length much as they would when written up by hand, with many of them
+ * left empty altogether.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @return The records, in chronological order.
+ * @note Only the raw output of std::mt19937_64 is used, since the standard distributions are free to differ from one
+ * compiler to the next.
+ */
+std::vector<GkRecords::GkSubmit> GkBench::generate()
+{
+    using namespace GkRecords;
+    std::mt19937_64 rng(params.seed);
+
+    std::vector<GkLicensee> licensees(params.licensees);
+    for (std::size_t i = 0; i < licensees.size(); ++i) {
+        licensees[i].licensee_id = bench_id(rng);
+        licensees[i].licensee_name = "Licensee #" + std::to_string(i + 1);
+    }
+
+    std::vector<GkSpecies> species(params.species);
+    for (std::size_t i = 0; i < species.size(); ++i) {
+        species[i].species_id = bench_id(rng);
+        species[i].species_name = "Species #" + std::to_string(i + 1);
+    }
+
+    std::vector<GkId> animals(params.animals);
+    for (std::size_t i = 0; i < animals.size(); ++i) {
+        animals[i].name_id = bench_id(rng);
+        animals[i].identifier_str = "Animal #" + std::to_string(i + 1);
+    }
+
+    std::vector<GkSubmit> records(params.records);
+    const long int spacing = std::max(1L, HERPLOG_BENCH_SPAN / static_cast<long int>(params.records));
+    for (std::size_t i = 0; i < records.size(); ++i) {
+        const std::size_t animal = rng() % params.animals;
+        const std::size_t spec = animal % params.species;
+        GkSubmit &record = records[i];
+        record.record_id = bench_id(rng);
+        record.date_time = HERPLOG_BENCH_EPOCH + (static_cast<long int>(i) * spacing) + static_cast<long int>(rng() % spacing);
+        record.licensee = licensees[spec % params.licensees];
+        record.species = species[spec];
+        record.identifier = animals[animal];
+        record.further_notes = ((rng() % 10) < 7) ? notes(rng, 60) : "";
+        record.vitamin_notes = ((rng() % 10) < 4) ? notes(rng, 12) : "";
+        record.toilet_notes = ((rng() % 10) < 4) ? notes(rng, 12) : "";
+        record.temp_notes = ((rng() % 10) < 4) ? notes(rng, 12) : "";
+        record.weight_notes = ((rng() % 10) < 4) ? notes(rng, 12) : "";
+        record.hydration_notes = ((rng() % 10) < 4) ? notes(rng, 12) : "";
+        record.went_toilet = (rng() % 3) == 0;
+        record.had_hydration = (rng() % 2) == 0;
+        record.had_vitamins = (rng() % 4) == 0;
+        record.weight = static_cast<double>(50 + ((animal * 37) % 400)) + (static_cast<double>(rng() % 200) - 100.0) / 10.0;
+    }
+
+    return records;
+}
+
+/**
+ * @brief GkBench::notes strings together somewhere between one and `max_words` words of husbandry jargon.
+ */
+std::string GkBench::notes(std::mt19937_64 &rng, const std::size_t &max_words)
+{
+    const std::size_t words = 1 + (rng() % max_words);
+    std::string text;
+    for (std::size_t i = 0; i < words; ++i) {
+        if (i > 0) {
+            text.push_back(' ');
+        }
+
+        text.append(bench_words[rng() % bench_word_count]);
+    }
+
+    return text;
+}
+
+/**
+ * @brief GkBench::time runs a benchmark the given amount of times, and works out how long it took.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param name What to call the benchmark within the results.
+ * @param iterations How many times to run it.
+ * @param operations How many operations each run is made up of, for the sake of working out the throughput.
+ * @param func The benchmark itself.
+ * @return The timings.
+ */
+GkBenchmark::GkBenchResult GkBench::time(const std::string &name, const std::size_t &iterations,
+                                         const std::size_t &operations, const std::function<void()> &func)
+{
+    std::cerr << tr("Running %1...").arg(QString::fromStdString(name)).toStdString() << std::endl;
+
+    std::vector<double> timings;
+    timings.reserve(iterations);
+    for (std::size_t i = 0; i < iterations; ++i) {
+        const auto start = std::chrono::steady_clock::now();
+        func();
+        const auto finish = std::chrono::steady_clock::now();
+        timings.push_back(std::chrono::duration<double, std::milli>(finish - start).count());
+    }
+
+    std::sort(timings.begin(), timings.end());
+    GkBenchmark::GkBenchResult result;
+    result.name = name;
+    result.iterations = iterations;
+    result.operations = operations;
+    result.min_ms = timings.front();
+    result.max_ms = timings.back();
+    result.mean_ms = std::accumulate(timings.begin(), timings.end(), 0.0) / static_cast<double>(timings.size());
+    result.median_ms = (timings.size() % 2) ? timings[timings.size() / 2] :
+                       (timings[timings.size() / 2 - 1] + timings[timings.size() / 2]) / 2.0;
+    return result;
+}
@@ -0,0 +1,96 @@
+/**
+ **  _   _                 _
+ ** | | | |               | |
+ ** | |_| | ___ _ __ _ __ | |     ___   __ _
+ ** |  _  |/ _ \ '__| '_ \| |    / _ \ / _` |
+ ** | | | |  __/ |  | |_) | |___| (_) | (_| |
+ ** \_| |_/\___|_|  | .__/\_____/\___/ \__, |
+ **                 | |                 __/ |
+ **                 |_|                |___/
+ **
+ **   Thank you for using "HerpLog" for your herpetology management requirements!
+ **   Copyright (C) 2017-2018. GekkoFyre.
+ **
+ **
+ **   HerpLog is free software: you can redistribute it and/or modify
+ **   it under the terms of the GNU General Public License as published by
+ **   the Free Software Foundation, either version 3 of the License, or
+ **   (at your option) any later version.
+ **
+ **   HerpLog is distributed in the hope that it will be useful,
+ **   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **   GNU General Public License for more details.
+ **
+ **   You should have received a copy of the GNU General Public License
+ **   along with HerpLog.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ **
+ **   The latest source code updates can be obtained from [ 1 ] below at your
+ **   discretion. A web-browser or the 'git' application may be required.
+ **
+ **   [ 1 ] - https://github.com/GekkoFyre/HerpLog
+ **
+ ********************************************************************************/
+
+/**
+ * @file gk_bench.hpp
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @brief Times the hot paths of HerpLog against a synthetic database, which is generated anew from a seed upon every
+ * run, so that the results of one commit may be compared against those of another.
+ */
+
+#ifndef GK_BENCH_HPP
+#define GK_BENCH_HPP
+
+#include "./../options.hpp"
+#include "./../gk_db_conn.hpp"
+#include "./../gk_db_read.hpp"
+#include "./../gk_db_write.hpp"
+#include "./../gk_file_io.hpp"
+#include "./../gk_string_op.hpp"
+#include <boost/filesystem.hpp>
+#include <QtCore/QObject>
+#include <QString>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+#include <memory>
+
+namespace GekkoFyre {
+class GkBench;
+
+class GkBench : public QObject {
+    Q_OBJECT
+
+public:
+    explicit GkBench(const GkBenchmark::GkBenchParams &bench_params, QObject *parent = nullptr);
+    ~GkBench();
+
+    std::vector<GkBenchmark::GkBenchResult> run();
+    QString to_json(const std::vector<GkBenchmark::GkBenchResult> &results, const QString &label);
+
+private:
+    void open_db(const fs::path &db_dir);
+    void close_db();
+    std::vector<GkRecords::GkSubmit> generate();
+    std::string notes(std::mt19937_64 &rng, const std::size_t &max_words);
+    GkBenchmark::GkBenchResult time(const std::string &name, const std::size_t &iterations,
+                                    const std::size_t &operations, const std::function<void()> &func);
+
+    GkBenchmark::GkBenchParams params;
+    std::shared_ptr<GkStringOp> gkStrOp;
+    std::shared_ptr<GkFileIo> gkFileIo;
+    std::unique_ptr<GkDbConn> gkDbConn;
+    std::shared_ptr<GkDbRead> gkDbRead;
+    std::shared_ptr<GkDbWrite> gkDbWrite;
+    GkFile::FileDb db_ptr;
+
+    fs::path work_dir;          // Where the synthetic database and its HerpLog Database File are kept for the run
+    std::uintmax_t archive_size;
+};
+}
+
+#endif // GK_BENCH_HPP
@@ -0,0 +1,127 @@
+/**
+ **  _   _                 _
+ ** | | | |               | |
+ ** | |_| | ___ _ __ _ __ | |     ___   __ _
+ ** |  _  |/ _ \ '__| '_ \| |    / _ \ / _` |
+ ** | | | |  __/ |  | |_) | |___| (_) | (_| |
+ ** \_| |_/\___|_|  | .__/\_____/\___/ \__, |
+ **                 | |                 __/ |
+ **                 |_|                |___/
+ **
+ **   Thank you for using "HerpLog" for your herpetology management requirements!
+ **   Copyright (C) 2017-2018. GekkoFyre.
+ **
+ **
+ **   HerpLog is free software: you can redistribute it and/or modify
+ **   it under the terms of the GNU General Public License as published by
+ **   the Free Software Foundation, either version 3 of the License, or
+ **   (at your option) any later version.
+ **
+ **   HerpLog is distributed in the hope that it will be useful,
+ **   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **   GNU General Public License for more details.
+ **
+ **   You should have received a copy of the GNU General Public License
+ **   along with HerpLog.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ **
+ **   The latest source code updates can be obtained from [ 1 ] below at your
+ **   discretion. A web-browser or the 'git' application may be required.
+ **
+ **   [ 1 ] - https://github.com/GekkoFyre/HerpLog
+ **
+ ********************************************************************************/
+
+/**
+ * @file main.cpp
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @brief The entry point for `herplog_bench`, which times the hot paths of HerpLog against a synthetic database.
+ */
+
+#include "gk_bench.hpp"
+#include <QCoreApplication>
+#include <algorithm>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace GekkoFyre;
+
+namespace {
+/**
+ * @brief option_value finds the value that follows the given `--option` upon the command-line, if any.
+ */
+std::string option_value(const std::vector<std::string> &args, const std::string &option)
+{
+    auto it = std::find(args.begin(), args.end(), option);
+    if ((it != args.end()) && (std::next(it) != args.end())) {
+        return *std::next(it);
+    }
+
+    return "";
+}
+
+void usage(std::ostream &out)
+{
+    out << "Usage: herplog_bench [--records <n>] [--licensees <n>] [--species <n>] [--animals <n>]\n"
+           "                     [--iterations <n>] [--seed <n>] [--label <text>] [--out <results.json>]\n\n"
+           "Generates a synthetic database from the seed, times the hot paths of HerpLog against it, and writes the\n"
+           "results out as JSON (upon stdout, unless `--out` is given)." << std::endl;
+}
+}
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication a(argc, argv);
+    QCoreApplication::setApplicationName("herplog_bench");
+
+    const std::vector<std::string> args(argv + 1, argv + argc);
+    if (std::find(args.begin(), args.end(), "--help") != args.end()) {
+        usage(std::cout);
+        return 0;
+    }
+
+    try {
+        GkBenchmark::GkBenchParams params;
+        auto read_size = [&args](const std::string &option, std::size_t &value) {
+            const std::string str = option_value(args, option);
+            if (!str.empty()) {
+                value = std::stoul(str);
+            }
+        };
+
+        read_size("--records", params.records);
+        read_size("--licensees", params.licensees);
+        read_size("--species", params.species);
+        read_size("--animals", params.animals);
+        read_size("--iterations", params.iterations);
+        const std::string seed_str = option_value(args, "--seed");
+        if (!seed_str.empty()) {
+            params.seed = std::stoull(seed_str);
+        }
+
+        GkBench bench(params);
+        const QString json = bench.to_json(bench.run(), QString::fromStdString(option_value(args, "--label")));
+
+        const std::string out_file = option_value(args, "--out");
+        if (out_file.empty()) {
+            std::cout << json.toStdString();
+        } else {
+            std::ofstream out(out_file, std::ios::out | std::ios::trunc);
+            out << json.toStdString();
+            if (!out) {
+                throw std::runtime_error("Unable to write the results to \"" + out_file + "\"!");
+            }
+        }
+    } catch (const std::exception &e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        usage(std::cerr);
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,1246 @@
+/**
+ **  _   _                 _
+ ** | | | |               | |
+ ** | |_| | ___ _ __ _ __ | |     ___   __ _
+ ** |  _  |/ _ \ '__| '_ \| |    / _ \ / _` |
+ ** | | | |  __/ |  | |_) | |___| (_) | (_| |
+ ** \_| |_/\___|_|  | .__/\_____/\___/ \__, |
+ **                 | |                 __/ |
+ **                 |_|                |___/
+ **
+ **   Thank you for using "HerpLog" for your herpetology management requirements!
+ **   Copyright (C) 2017-2018. GekkoFyre.
+ **
+ **
+ **   HerpLog is free software: you can redistribute it and/or modify
+ **   it under the terms of the GNU General Public License as published by
+ **   the Free Software Foundation, either version 3 of the License, or
+ **   (at your option) any later version.
+ **
+ **   HerpLog is distributed in the hope that it will be useful,
+ **   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **   GNU General Public License for more details.
+ **
+ **   You should have received a copy of the GNU General Public License
+ **   along with HerpLog.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ **
+ **   The latest source code updates can be obtained from [ 1 ] below at your
+ **   discretion. A web-browser or the 'git' application may be required.
+ **
+ **   [ 1 ] - https://github.com/GekkoFyre/HerpLog
+ **
+ ********************************************************************************/
+
+/**
+ * @file gk_cli.cpp
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @brief The headless, command-line front-end to HerpLog, for the batch ingest, querying, exporting, verifying and
+ * compacting of HerpLog Database Files without the need for a display.
+ */
+
+#include "gk_cli.hpp"
+#include "./../gk_db_server.hpp"
+#include "./../gk_db_diagnostics.hpp"
+#include "./../gk_text_index.hpp"
+#include "./../gk_flag_index.hpp"
+#include "./../gk_aggregator.hpp"
+#include "./../gk_animal_stats.hpp"
+#include "./../gk_time_series.hpp"
+#include "./../gk_attachment_store.hpp"
+#include "./../gk_remote_db.hpp"
+#include "./../gk_db_merge.hpp"
+#include "./../gk_trace.hpp"
+#include "3rd_party/minicsv/minicsv.h"
+#include <leveldb/db.h>
+#include <QDateTime>
+#include <QDir>
+#include <signal.h>
+#include <algorithm>
+#include <cctype>
+#include <limits>
+#include <exception>
+#include <iostream>
+#include <unordered_set>
+
+using namespace GekkoFyre;
+using namespace mini;
+namespace sys = boost::system;
+
+namespace {
+constexpr std::size_t HERPLOG_CLI_SCAN_PAGE = 1024; // How many timestamp index entries to read at a time
+
+/**
+ * @brief option_value finds the value that follows the given `--option` upon the command-line, if any.
+ */
+std::string option_value(const std::vector<std::string> &args, const std::string &option)
+{
+    auto it = std::find(args.begin(), args.end(), option);
+    if ((it != args.end()) && (std::next(it) != args.end())) {
+        return *std::next(it);
+    }
+
+    return "";
+}
+}
+
+GkCli::GkCli(QObject *parent) : QObject(parent)
+{
+    gkStrOp = std::make_shared<GkStringOp>(nullptr);
+    gkFileIo = std::make_shared<GkFileIo>(nullptr);
+    gkDbConn = std::make_unique<GkDbConn>(nullptr);
+}
+
+GkCli::~GkCli()
+{
+    close_archive();
+}
+
+/**
+ * @brief GkCli::run carries out the command given upon the command-line, such as `herplog-cli verify my_lizards.hdb`.
+ * Any errors are reported upon `stderr`, as there is no one around to click upon a QMessageBox.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param args The command-line arguments, minus the name of the executable itself.
+ * @return The exit code for the process; zero upon success, one upon failure, and two if the command-line was invalid.
+ */
+int GkCli::run(const std::vector<std::string> &args)
+{
+    if (args.size() < 2) {
+        usage(std::cerr);
+        return 2;
+    }
+
+    const std::string &command = args[0];
+    const std::string trace_file = option_value(args, "--trace");
+    if (!trace_file.empty()) {
+        GkTrace::set_thread_name("herplog-cli");
+        GkTrace::set_enabled(true);
+    }
+
+    try {
+        const long int dateStart = parse_date_time(option_value(args, "--from"));
+        const std::string date_end_str = option_value(args, "--to");
+        const long int dateEnd = date_end_str.empty() ? std::numeric_limits<long int>::max() : parse_date_time(date_end_str);
+
+        int ret = 2;
+        if (command == "ingest" && args.size() >= 3) {
+            open_archive(args[1], true);
+            ret = ingest(args[2]);
+            if (ret == 0) {
+                save_archive();
+            }
+        } else if (command == "query") {
+            const std::string limit_str = option_value(args, "--limit");
+            open_archive(args[1], false);
+            ret = query(dateStart, dateEnd, option_value(args, "--animal"),
+                        limit_str.empty() ? std::numeric_limits<std::size_t>::max() : std::stoul(limit_str));
+        } else if (command == "find" && args.size() >= 3) {
+            const std::string limit_str = option_value(args, "--limit");
+            open_archive(args[1], false);
+            ret = find(args[2], limit_str.empty() ? std::numeric_limits<std::size_t>::max() : std::stoul(limit_str));
+        } else if (command == "lapses" && args.size() >= 4) {
+            open_archive(args[1], false);
+            ret = lapses(args[2], std::stol(args[3]) * 24L * 60L * 60L, dateStart, dateEnd);
+        } else if (command == "bands" && args.size() >= 3) {
+            const std::string weeks_str = option_value(args, "--weeks");
+            open_archive(args[1], false);
+            ret = bands(args[2], weeks_str.empty() ? 1 : std::stol(weeks_str),
+                        std::find(args.begin(), args.end(), "--underweight") != args.end(), dateStart, dateEnd);
+        } else if (command == "attention") {
+            open_archive(args[1], false);
+            ret = attention(std::find(args.begin(), args.end(), "--all") != args.end());
+        } else if (command == "alerts") {
+            const bool acknowledge = (std::find(args.begin(), args.end(), "--ack") != args.end());
+            open_archive(args[1], false);
+            ret = alerts(acknowledge);
+            if ((ret == 0) && acknowledge) {
+                save_archive();
+            }
+        } else if (command == "import-series" && args.size() >= 3) {
+            open_archive(args[1], false);
+            ret = import_series(args[2], option_value(args, "--subject"));
+            if (ret == 0) {
+                save_archive();
+            }
+        } else if (command == "series") {
+            const std::string every_str = option_value(args, "--every");
+            const bool named = (args.size() >= 3) && (args[2].compare(0, 2, "--") != 0);
+            open_archive(args[1], false);
+            ret = series(named ? args[2] : "", dateStart, dateEnd, every_str.empty() ? 0 : std::stol(every_str) * 60L);
+        } else if (command == "export" && args.size() >= 3) {
+            open_archive(args[1], false);
+            ret = export_csv(args[2], dateStart, dateEnd);
+        } else if (command == "report" && args.size() >= 3) {
+            const std::string group_str = option_value(args, "--by");
+            const std::string bucket_str = option_value(args, "--per");
+            GkReport::GkGroupBy group_by = GkReport::GkGroupBy::Species;
+            if (group_str == "licensee") {
+                group_by = GkReport::GkGroupBy::Licensee;
+            } else if (group_str == "animal") {
+                group_by = GkReport::GkGroupBy::Animal;
+            }
+
+            GkReport::GkBucketSize bucket_size = GkReport::GkBucketSize::Week;
+            if (bucket_str == "day") {
+                bucket_size = GkReport::GkBucketSize::Day;
+            } else if (bucket_str == "month") {
+                bucket_size = GkReport::GkBucketSize::Month;
+            }
+
+            if ((!group_str.empty() && (group_str != "licensee") && (group_str != "species") && (group_str != "animal")) ||
+                    (!bucket_str.empty() && (bucket_str != "day") && (bucket_str != "week") && (bucket_str != "month"))) {
+                usage(std::cerr);
+            } else {
+                open_archive(args[1], false);
+                ret = report(args[2], group_by, bucket_size, dateStart, dateEnd);
+            }
+        } else if (command == "verify") {
+            open_archive(args[1], false);
+            ret = verify();
+        } else if (command == "compact") {
+            open_archive(args[1], false);
+            ret = compact();
+            if (ret == 0) {
+                save_archive();
+            }
+        } else if ((command == "merge" || command == "sync") && args.size() >= 3) {
+            open_archive(args[1], false);
+            ret = merge(args[2], (command == "sync"));
+            if (ret == 0) {
+                save_archive();
+            }
+        } else if (command == "diagnostics") {
+            // Left exactly as found, since rebuilding the indexes would only skew the very figures being looked at
+            db_ptr = attach_archive(args[1], false, archive_temp_dir);
+            archive_file = args[1];
+            ret = diagnostics();
+        } else if (command == "serve") {
+            open_archive(args[1], false);
+            ret = serve();
+            if (ret == 0) {
+                save_archive();
+            }
+        } else {
+            usage(std::cerr);
+        }
+
+        close_archive();
+        if (!trace_file.empty()) {
+            GkTrace::write_chrome_trace(trace_file);
+        }
+
+        return ret;
+    } catch (const std::exception &e) {
+        std::cerr << tr("Error: %1").arg(e.what()).toStdString() << std::endl;
+    }
+
+    close_archive();
+    if (!trace_file.empty()) {
+        try {
+            GkTrace::write_chrome_trace(trace_file); // All the more useful when something went wrong
+        } catch (const std::exception &e) {
+            std::cerr << tr("Error: %1").arg(e.what()).toStdString() << std::endl;
+        }
+    }
+
+    return 1;
+}
+
+/**
+ * @brief GkCli::ingest reads log entries from a CSV file, in the same layout as written by GkCli::export_csv(), and
+ * submits each of them to the database. Licensees, Species and Animals are matched up by name with those that already
+ * exist, otherwise they are created anew.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param csv_file The CSV file to be read.
+ * @return The exit code for the process.
+ */
+int GkCli::ingest(const std::string &csv_file)
+{
+    using namespace GkRecords;
+    csv::ifstream is(csv_file);
+    if (!is.is_open()) {
+        throw std::runtime_error(tr("Unable to open \"%1\" for reading!").arg(QString::fromStdString(csv_file)).toStdString());
+    }
+
+    is.set_delimiter(',', "$$");
+    is.enable_trim_quote_on_str(true, '\"');
+
+    std::size_t line_no = 0, ingested = 0;
+    while (is.read_line()) {
+        ++line_no;
+        std::string date_time_str;
+        GkSubmit submit;
+        is >> date_time_str;
+        if (line_no == 1 && date_time_str == dateTime) {
+            continue; // Skip over the header
+        }
+
+        is >> submit.licensee.licensee_name >> submit.species.species_name >> submit.identifier.identifier_str
+           >> submit.weight >> submit.went_toilet >> submit.had_hydration >> submit.had_vitamins >> submit.further_notes
+           >> submit.vitamin_notes >> submit.toilet_notes >> submit.temp_notes >> submit.weight_notes
+           >> submit.hydration_notes;
+
+        if (submit.licensee.licensee_name.empty() || submit.species.species_name.empty() ||
+                submit.identifier.identifier_str.empty()) {
+            throw std::invalid_argument(tr("Line %1 of \"%2\" is missing a Licensee, Species, or Animal ID!")
+                                                .arg(QString::number(line_no)).arg(QString::fromStdString(csv_file))
+                                                .toStdString());
+        }
+
+        submit.date_time = static_cast<std::time_t>(parse_date_time(date_time_str));
+        submit.licensee.licensee_id = category_id(MiscRecordType::gkLicensee, submit.licensee.licensee_name);
+        submit.species.species_id = category_id(MiscRecordType::gkSpecies, submit.species.species_name);
+        submit.identifier.name_id = category_id(MiscRecordType::gkId, submit.identifier.identifier_str);
+
+        const std::string record_id = gkDbWrite->create_uuid();
+        submit.record_id = record_id;
+        gkDbWrite->add_log_entry(record_id, submit);
+        ++ingested;
+    }
+
+    std::cout << tr("Ingested %1 log entries.").arg(QString::number(ingested)).toStdString() << std::endl;
+    return 0;
+}
+
+/**
+ * @brief GkCli::query prints out, one per line, the log entries that fall within the given date range.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param dateStart The beginning of the date range, as UNIX Epoch Time.
+ * @param dateEnd The end of the date range, as UNIX Epoch Time.
+ * @param animal If not empty, only the log entries for the Animal by this name are printed.
+ * @param limit The maximum amount of log entries to print.
+ * @return The exit code for the process.
+ */
+int GkCli::query(const long int &dateStart, const long int &dateEnd, const std::string &animal, const std::size_t &limit)
+{
+    using namespace GkRecords;
+    std::size_t printed = 0;
+    const auto entries = animal.empty() ? scan_range(dateStart, dateEnd) : scan_animal_range(animal, dateStart, dateEnd,
+                                                                                              limit);
+    for (const auto &entry: entries) {
+        if (printed >= limit) {
+            break;
+        }
+
+        MiscUniqueIds ids;
+        if (!gkCategoryTree->record_categories(entry.record_id, ids)) {
+            continue;
+        }
+
+        const std::string animal_name = category_name(MiscRecordType::gkId, ids.name_id);
+
+        GkSubmit submit = gkDbRead->read_log_entry(entry.record_id);
+        std::cout << QDateTime::fromTime_t(static_cast<uint>(submit.date_time)).toString(Qt::ISODate).toStdString() << '\t'
+                  << category_name(MiscRecordType::gkLicensee, ids.licensee_id) << '\t'
+                  << category_name(MiscRecordType::gkSpecies, ids.species_id) << '\t'
+                  << animal_name << '\t' << submit.weight << '\t' << entry.record_id << std::endl;
+        ++printed;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief GkCli::find prints the log entries whose notes match the given query, in the same layout as GkCli::query().
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param search_query The query, as understood by GkTextIndex::search().
+ * @param limit The maximum amount of log entries to print.
+ * @return The exit code for the process.
+ */
+int GkCli::find(const std::string &search_query, const std::size_t &limit)
+{
+    using namespace GkRecords;
+    GkTextIndex text_index(db_ptr, nullptr);
+    std::size_t printed = 0;
+    for (const auto &record_id: text_index.search(search_query)) {
+        if (printed >= limit) {
+            break;
+        }
+
+        MiscUniqueIds ids;
+        if (!gkCategoryTree->record_categories(record_id, ids)) {
+            continue;
+        }
+
+        GkSubmit submit = gkDbRead->read_log_entry(record_id);
+        std::cout << QDateTime::fromTime_t(static_cast<uint>(submit.date_time)).toString(Qt::ISODate).toStdString() << '\t'
+                  << category_name(MiscRecordType::gkLicensee, ids.licensee_id) << '\t'
+                  << category_name(MiscRecordType::gkSpecies, ids.species_id) << '\t'
+                  << category_name(MiscRecordType::gkId, ids.name_id) << '\t' << submit.weight << '\t' << record_id
+                  << std::endl;
+        ++printed;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief GkCli::lapses prints each animal that went for at least the given amount of time without a husbandry flag
+ * being set upon any of its records, along with when that was, as found by the GkFlagIndex.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param flag_name One of `toilet`, `hydration` or `vitamins`.
+ * @param min_gap The shortest lapse that is worth printing, in seconds.
+ * @param dateStart The beginning of the date range, as UNIX Epoch Time.
+ * @param dateEnd The end of the date range, as UNIX Epoch Time.
+ * @return The exit code for the process.
+ */
+int GkCli::lapses(const std::string &flag_name, const long int &min_gap, const long int &dateStart,
+                  const long int &dateEnd)
+{
+    using namespace GkRecords;
+    GkFlagBits flag;
+    if (flag_name == "toilet") {
+        flag = GkFlagBits::WentToilet;
+    } else if (flag_name == "hydration") {
+        flag = GkFlagBits::HadHydration;
+    } else if (flag_name == "vitamins") {
+        flag = GkFlagBits::HadVitamins;
+    } else {
+        usage(std::cerr);
+        return 2;
+    }
+
+    GkFlagIndex flag_index(db_ptr, gkStrOp, nullptr);
+    flag_index.load();
+    for (const auto &lapse: flag_index.flag_lapses(flag, min_gap, dateStart, dateEnd)) {
+        std::cout << category_name(MiscRecordType::gkId, lapse.name_id) << '\t'
+                  << QDateTime::fromTime_t(static_cast<uint>(lapse.lapse_start)).toString(Qt::ISODate).toStdString() << '\t'
+                  << QDateTime::fromTime_t(static_cast<uint>(lapse.lapse_end)).toString(Qt::ISODate).toStdString() << '\t'
+                  << ((lapse.lapse_end - lapse.lapse_start) / (24L * 60L * 60L)) << '\t' << lapse.records << std::endl;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief GkCli::bands prints the 10th, 50th and 90th percentiles of the weights of a species over time, one band per
+ * line, as read from the species' quantile sketches. Otherwise, it prints each animal of the species whose latest weight
+ * within the date range falls within the bottom tenth of those measured during the same band.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param species The name of the Species in question.
+ * @param weeks How many weeks each band spans.
+ * @param underweight Whether to print the underweight animals rather than the bands themselves.
+ * @param dateStart The beginning of the date range, as UNIX Epoch Time.
+ * @param dateEnd The end of the date range, as UNIX Epoch Time.
+ * @return The exit code for the process.
+ * @see GkDbRead::weight_bands()
+ */
+int GkCli::bands(const std::string &species, const long int &weeks, const bool &underweight, const long int &dateStart,
+                 const long int &dateEnd)
+{
+    using namespace GkRecords;
+    const std::string species_id = category_id(MiscRecordType::gkSpecies, species);
+    gkDbWrite->repair_weight_sketches();
+    const auto weight_bands = gkDbRead->weight_bands(species_id, dateStart, dateEnd, weeks);
+    if (!underweight) {
+        for (const auto &band: weight_bands) {
+            std::cout << QDateTime::fromTime_t(static_cast<uint>(band.band_start)).toString(Qt::ISODate).toStdString() << '\t'
+                      << QDateTime::fromTime_t(static_cast<uint>(band.band_end)).toString(Qt::ISODate).toStdString() << '\t'
+                      << band.count << '\t' << band.p10 << '\t' << band.p50 << '\t' << band.p90 << '\t'
+                      << (band.rank_error * 100.0) << '%' << std::endl;
+        }
+
+        return 0;
+    }
+
+    const std::uint32_t species_idx = gkCategoryTree->find(MiscRecordType::gkSpecies, species_id);
+    if (species_idx == GkCategoryTree::npos) {
+        return 0;
+    }
+
+    for (const auto &animal_idx: gkCategoryTree->animals_of(species_idx)) {
+        const std::string name_id = gkCategoryTree->id(MiscRecordType::gkId, animal_idx);
+        const auto latest = gkDbRead->scan_animal_index(name_id, dateStart, dateEnd, 1, true);
+        if (latest.empty()) {
+            continue;
+        }
+
+        for (const auto &band: weight_bands) {
+            if ((latest.front().date_time < band.band_start) || (latest.front().date_time > band.band_end)) {
+                continue;
+            }
+
+            const double rank = gkDbRead->weight_sketch(species_id, band.band_start, band.band_end).rank(latest.front().weight);
+            if (rank < 0.1) {
+                std::cout << category_name(MiscRecordType::gkId, name_id) << '\t'
+                          << QDateTime::fromTime_t(static_cast<uint>(latest.front().date_time)).toString(Qt::ISODate).toStdString()
+                          << '\t' << latest.front().weight << '\t' << (rank * 100.0) << '%' << std::endl;
+            }
+
+            break;
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * @brief GkCli::attention prints the rolling statistics of each animal that needs attention, one per line, along with
+ * the reasons why, straight from the summaries that are kept for every animal.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param all Whether to print every animal, rather than only those that need attention.
+ * @return The exit code for the process.
+ * @see GkAnimalStats::attention()
+ */
+int GkCli::attention(const bool &all)
+{
+    using namespace GkRecords;
+    gkDbWrite->repair_animal_summaries();
+
+    const long int now = static_cast<long int>(QDateTime::currentDateTime().toTime_t());
+    for (const auto &summary: gkDbRead->read_animal_summaries()) {
+        const std::uint8_t reasons = GkAnimalStats::attention(summary, now);
+        if ((reasons == AttentionNone) && !all) {
+            continue;
+        }
+
+        std::string why;
+        const std::pair<GkAttention, const char *> reason_names[] = {
+            { AttentionWeightLoss, "weight-loss" }, { AttentionToilet, "toilet" }, { AttentionHydration, "hydration" },
+            { AttentionVitamins, "vitamins" }, { AttentionNotLogged, "not-logged" }
+        };
+
+        for (const auto &reason: reason_names) {
+            if ((reasons & reason.first) != 0) {
+                why.append(why.empty() ? "" : ",").append(reason.second);
+            }
+        }
+
+        std::cout << category_name(MiscRecordType::gkId, summary.name_id) << '\t'
+                  << QDateTime::fromTime_t(static_cast<uint>(summary.last_seen)).toString(Qt::ISODate).toStdString() << '\t'
+                  << summary.last_weight << '\t' << summary.weight_ewma << '\t'
+                  << (GkAnimalStats::weight_slope(summary) * 7.0) << '\t' << why << std::endl;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief GkCli::alerts prints the alerts that have yet to be acknowledged, one per line, in the order in which they
+ * were raised as the log entries were written.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param acknowledge Whether to take the alerts off the queue once they've been printed.
+ * @return The exit code for the process.
+ * @see GkAnimalStats::score()
+ */
+int GkCli::alerts(const bool &acknowledge)
+{
+    using namespace GkRecords;
+    std::vector<std::uint64_t> sequences;
+    for (const auto &alert: gkDbRead->read_alerts()) {
+        std::string what;
+        switch (alert.kind) {
+        case AlertWeightDrop:
+            what = "weight-drop";
+            break;
+        case AlertWeightGain:
+            what = "weight-gain";
+            break;
+        case AlertMissedToilet:
+            what = "toilet";
+            break;
+        case AlertMissedHydration:
+            what = "hydration";
+            break;
+        case AlertMissedVitamins:
+            what = "vitamins";
+            break;
+        }
+
+        std::cout << alert.sequence << '\t' << category_name(MiscRecordType::gkId, alert.name_id) << '\t'
+                  << QDateTime::fromTime_t(static_cast<uint>(alert.date_time)).toString(Qt::ISODate).toStdString() << '\t'
+                  << what << '\t' << alert.score << '\t' << alert.record_id << std::endl;
+        sequences.push_back(alert.sequence);
+    }
+
+    if (acknowledge) {
+        gkDbWrite->acknowledge_alerts(sequences);
+    }
+
+    return 0;
+}
+
+/**
+ * @brief GkCli::import_series brings in the readings of the enclosure probes from a CSV or line protocol file.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param readings_file The file to be imported.
+ * @param subject The enclosure or animal that the readings belong to, which is taken from the file's name if not given.
+ * @return The exit code for the process.
+ * @see GkTimeSeries::import_file()
+ */
+int GkCli::import_series(const std::string &readings_file, const std::string &subject)
+{
+    GkTimeSeries time_series(db_ptr, gkStrOp, nullptr);
+    const std::size_t imported = time_series.import_file(readings_file, subject.empty() ?
+                                                                            fs::path(readings_file).stem().string() :
+                                                                            subject);
+    std::cout << tr("Imported %1 readings.").arg(QString::number(imported)).toStdString() << std::endl;
+    return 0;
+}
+
+/**
+ * @brief GkCli::series prints the names of every time-series, or else the readings of a single series, one per line.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param series_name The series whose readings are to be printed, or an empty string to list the series.
+ * @param dateStart The beginning of the date range, as UNIX Epoch Time.
+ * @param dateEnd The end of the date range, as UNIX Epoch Time.
+ * @param bucket_seconds If non-zero, the readings are downsampled into buckets of this many seconds, printing the
+ * count, minimum, maximum and mean of each.
+ * @return The exit code for the process.
+ */
+int GkCli::series(const std::string &series_name, const long int &dateStart, const long int &dateEnd,
+                  const long int &bucket_seconds)
+{
+    GkTimeSeries time_series(db_ptr, gkStrOp, nullptr);
+    if (series_name.empty()) {
+        for (const auto &name: time_series.list_series()) {
+            std::cout << name << std::endl;
+        }
+
+        return 0;
+    }
+
+    const auto iso_date = [](const long int &date_time) {
+        return QDateTime::fromTime_t(static_cast<uint>(date_time)).toString(Qt::ISODate).toStdString();
+    };
+
+    if (bucket_seconds > 0) {
+        for (const auto &bucket: time_series.downsample(series_name, dateStart, dateEnd, bucket_seconds)) {
+            std::cout << iso_date(bucket.bucket) << '\t' << bucket.count << '\t' << bucket.minimum << '\t'
+                      << bucket.maximum << '\t' << bucket.mean << std::endl;
+        }
+    } else {
+        for (const auto &point: time_series.read_range(series_name, dateStart, dateEnd)) {
+            std::cout << iso_date(point.date_time) << '\t' << point.value << '\n';
+        }
+
+        std::cout.flush();
+    }
+
+    return 0;
+}
+
+/**
+ * @brief GkCli::export_csv writes out the log entries that fall within the given date range towards a CSV file, which
+ * can be read back in again by GkCli::ingest().
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param csv_file The CSV file to be written.
+ * @param dateStart The beginning of the date range, as UNIX Epoch Time.
+ * @param dateEnd The end of the date range, as UNIX Epoch Time.
+ * @return The exit code for the process.
+ */
+int GkCli::export_csv(const std::string &csv_file, const long int &dateStart, const long int &dateEnd)
+{
+    using namespace GkRecords;
+    csv::ofstream os(csv_file);
+    if (!os.is_open()) {
+        throw std::runtime_error(tr("Unable to open \"%1\" for writing!").arg(QString::fromStdString(csv_file)).toStdString());
+    }
+
+    os.set_delimiter(',', "$$");
+    os.enable_surround_quote_on_str(true, '\"');
+    os << dateTime << "licensee" << "species" << "animal" << weightMeasure << boolWentToilet << boolHadHydration
+       << boolHadVitamins << furtherNotes << vitaminNotes << toiletNotes << tempNotes << weightNotes << hydrationNotes
+       << NEWLINE;
+
+    std::size_t exported = 0;
+    for (const auto &entry: scan_range(dateStart, dateEnd)) {
+        MiscUniqueIds ids;
+        if (!gkCategoryTree->record_categories(entry.record_id, ids)) {
+            continue;
+        }
+
+        GkSubmit submit = gkDbRead->read_log_entry(entry.record_id);
+        os << std::to_string(submit.date_time) << category_name(MiscRecordType::gkLicensee, ids.licensee_id)
+           << category_name(MiscRecordType::gkSpecies, ids.species_id) << category_name(MiscRecordType::gkId, ids.name_id)
+           << submit.weight << submit.went_toilet << submit.had_hydration << submit.had_vitamins << submit.further_notes
+           << submit.vitamin_notes << submit.toilet_notes << submit.temp_notes << submit.weight_notes
+           << submit.hydration_notes << NEWLINE;
+        ++exported;
+    }
+
+    os.flush();
+    std::cout << tr("Exported %1 log entries.").arg(QString::number(exported)).toStdString() << std::endl;
+    return 0;
+}
+
+/**
+ * @brief GkCli::report writes out the counts, weights and husbandry flag rates of the log entries within the given date
+ * range towards a CSV file, summed up per Licensee, Species or Animal and per day, week or month.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param csv_file The CSV file to be written.
+ * @param group_by Whether to sum up the log entries by Licensee, Species or Animal.
+ * @param bucket_size Whether to sum up the log entries by the day, week or month.
+ * @param dateStart The beginning of the date range, as UNIX Epoch Time.
+ * @param dateEnd The end of the date range, as UNIX Epoch Time.
+ * @return The exit code for the process.
+ */
+int GkCli::report(const std::string &csv_file, const GkReport::GkGroupBy &group_by,
+                  const GkReport::GkBucketSize &bucket_size, const long int &dateStart, const long int &dateEnd)
+{
+    using namespace GkRecords;
+    GkAggregator aggregator(db_ptr, gkDbRead, gkStrOp, nullptr);
+    const GkReport::GkAggregateTable table = aggregator.aggregate(dateStart, dateEnd, bucket_size, group_by);
+
+    const MiscRecordType record_type = (group_by == GkReport::GkGroupBy::Licensee) ? MiscRecordType::gkLicensee :
+                                       ((group_by == GkReport::GkGroupBy::Species) ? MiscRecordType::gkSpecies :
+                                                                                      MiscRecordType::gkId);
+    std::vector<std::string> group_names;
+    group_names.reserve(table.group_ids.size());
+    for (const auto &group_id: table.group_ids) {
+        group_names.push_back(category_name(record_type, group_id));
+    }
+
+    GkAggregator::write_csv(table, group_names, csv_file);
+    std::cout << tr("Exported %1 rows.").arg(QString::number(table.cells.size())).toStdString() << std::endl;
+    return 0;
+}
+
+/**
+ * @brief GkCli::verify checks the HerpLog Database File for damage. The CRC32 Hashes of the archive have already been
+ * checked upon extraction, so what's left is every block within Google LevelDB, and that each record can be read in
+ * full and agrees with the timestamp index and the categories.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @return The exit code for the process; zero if no problems were found.
+ */
+int GkCli::verify()
+{
+    using namespace GkRecords;
+    std::size_t problems = 0;
+    auto report = [&problems](const QString &msg) {
+        std::cerr << msg.toStdString() << std::endl;
+        ++problems;
+    };
+
+    // Read every single block, so that Google LevelDB checks each of their checksums along the way
+    leveldb::ReadOptions read_opt;
+    read_opt.verify_checksums = true;
+    read_opt.fill_cache = false;
+    std::size_t keys = 0;
+    std::unique_ptr<leveldb::Iterator> it(db_ptr.db->NewIterator(read_opt));
+    for (it->SeekToFirst(); it->Valid(); it->Next()) {
+        ++keys;
+    }
+
+    if (!it->status().ok()) {
+        report(tr("Database is damaged: %1").arg(QString::fromStdString(it->status().ToString())));
+    }
+
+    it.reset();
+
+    std::unordered_set<std::string> known_ids[3];
+    const MiscRecordType cat_types[3] = { MiscRecordType::gkLicensee, MiscRecordType::gkSpecies, MiscRecordType::gkId };
+    for (int i = 0; i < 3; ++i) {
+        auto cat_key_vals = gkDbRead->get_cat_key_vals(cat_types[i]);
+        for (auto cat = cat_key_vals.begin(); cat != cat_key_vals.end(); ++cat) {
+            known_ids[i].insert(cat.key());
+        }
+    }
+
+    auto uuids = gkDbRead->get_uuids();
+    for (const auto &record: uuids) {
+        if (!known_ids[0].count(record.second.licensee_id) || !known_ids[1].count(record.second.species_id) ||
+                !known_ids[2].count(record.second.name_id)) {
+            report(tr("Record %1 refers to a category that does not exist.").arg(QString::fromStdString(record.first)));
+        }
+
+        try {
+            GkSubmit submit = gkDbRead->read_log_entry(record.first);
+            std::string value;
+            if (!db_ptr.db->Get(read_opt, gkStrOp->timestamp_index_key(submit.date_time, record.first), &value).ok()) {
+                report(tr("Record %1 is missing from the timestamp index.").arg(QString::fromStdString(record.first)));
+            }
+        } catch (const std::exception &e) {
+            report(tr("Record %1 cannot be read: %2").arg(QString::fromStdString(record.first)).arg(e.what()));
+        }
+    }
+
+    std::size_t indexed = 0;
+    for (const auto &entry: scan_range(std::numeric_limits<long int>::min(), std::numeric_limits<long int>::max())) {
+        ++indexed;
+        if (!uuids.count(entry.record_id)) {
+            report(tr("The timestamp index refers to record %1, which does not exist.")
+                           .arg(QString::fromStdString(entry.record_id)));
+        }
+    }
+
+    std::cout << tr("Checked %1 keys, %2 records and %3 index entries; %4 problem(s) found.")
+            .arg(QString::number(keys)).arg(QString::number(uuids.size())).arg(QString::number(indexed))
+            .arg(QString::number(problems)).toStdString() << std::endl;
+    return (problems == 0) ? 0 : 1;
+}
+
+/**
+ * @brief GkCli::compact has Google LevelDB rewrite the whole of its key range, discarding deleted and overwritten
+ * values so that the HerpLog Database File shrinks down accordingly once it has been saved.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @return The exit code for the process.
+ */
+int GkCli::compact()
+{
+    db_ptr.db->CompactRange(nullptr, nullptr);
+    return 0;
+}
+
+/**
+ * @brief GkCli::serve runs the HerpLog service for the database, so that any number of HerpLog processes upon this
+ * computer may work upon it at the same time. The service runs until it's told to stop with SIGINT or SIGTERM, at
+ * which point the database is saved back into its HerpLog Database File.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @return The exit code for the process.
+ * @see GkDbServer
+ */
+int GkCli::serve()
+{
+    // The signals are blocked before the service starts any of its threads, so that only sigwait() below ever sees them
+    sigset_t stop_signals;
+    sigemptyset(&stop_signals);
+    sigaddset(&stop_signals, SIGINT);
+    sigaddset(&stop_signals, SIGTERM);
+    pthread_sigmask(SIG_BLOCK, &stop_signals, nullptr);
+
+    const std::string socket_path = GkDbServer::socket_path_for(archive_file);
+    GkDbServer server(db_ptr);
+    server.start(socket_path);
+    std::cout << tr("Serving \"%1\" upon \"%2\". Press Ctrl+C to stop.").arg(QString::fromStdString(archive_file))
+            .arg(QString::fromStdString(socket_path)).toStdString() << std::endl;
+
+    int sig = 0;
+    sigwait(&stop_signals, &sig);
+    server.stop();
+
+    std::cout << tr("Stopped serving \"%1\".").arg(QString::fromStdString(archive_file)).toStdString() << std::endl;
+    return 0;
+}
+
+/**
+ * @brief GkCli::merge brings the log entries of another HerpLog Database File into the one that's open, and, if asked
+ * to sync, the other way around as well. Only the buckets of time whose digests differ are ever looked into, so two
+ * databases that are mostly the same are reconciled without having to read either of them in full.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param peer_file The other HerpLog Database File, which is only saved back to if `both_ways`.
+ * @param both_ways Whether to merge the open database into the other one as well.
+ * @return The exit code for the process.
+ * @see GkDbMerge
+ */
+int GkCli::merge(const std::string &peer_file, const bool &both_ways)
+{
+    sys::error_code ec;
+    if (fs::equivalent(archive_file, peer_file, ec)) {
+        throw std::invalid_argument(tr("A database cannot be merged with itself!").toStdString());
+    }
+
+    // Both databases may well have the same filename, given they're copies of one another from different computers
+    fs::path peer_temp_dir;
+    GkFile::FileDb peer_db = attach_archive(peer_file, false, peer_temp_dir,
+                                            fs::path(peer_file).stem().string() + "." + gkStrOp->random_hash());
+    auto release_peer = [&peer_db, &peer_temp_dir]() {
+        peer_db.db.reset();
+        if (!peer_temp_dir.empty()) {
+            sys::error_code ec;
+            fs::remove_all(peer_temp_dir, ec);
+        }
+    };
+
+    try {
+        auto peer_read = std::make_shared<GkDbRead>(peer_db, gkStrOp, nullptr);
+        auto peer_write = std::make_shared<GkDbWrite>(peer_db, peer_read, gkStrOp, nullptr);
+        peer_write->rebuild_indexes();
+
+        GkDbMerge into_archive(gkDbRead, gkDbWrite, peer_read, gkStrOp, nullptr);
+        print_merge_stats(archive_file, into_archive.merge());
+
+        if (both_ways) {
+            GkDbMerge into_peer(peer_read, peer_write, gkDbRead, gkStrOp, nullptr);
+            print_merge_stats(peer_file, into_peer.merge());
+        }
+
+        if (!archive_temp_dir.empty() && !peer_temp_dir.empty()) {
+            // The records only refer to their photos, so the photos themselves have to be carried across separately
+            GkAttachmentStore archive_attachments(db_ptr, archive_temp_dir, gkStrOp);
+            GkAttachmentStore peer_attachments(peer_db, peer_temp_dir, gkStrOp);
+            archive_attachments.copy_from(peer_attachments);
+            if (both_ways) {
+                peer_attachments.copy_from(archive_attachments);
+            }
+        }
+
+        peer_write.reset();
+        peer_read.reset();
+        peer_db.db.reset();
+        if (both_ways && !peer_temp_dir.empty()) {
+            store_archive(peer_temp_dir, peer_file);
+        }
+    } catch (...) {
+        release_peer();
+        throw;
+    }
+
+    release_peer();
+    return 0;
+}
+
+/**
+ * @brief GkCli::diagnostics prints the internals of LevelDB, the hit rate of its block cache and the footprint of the
+ * database upon the disk, as seen from `Help -> Diagnostics...` within the GUI.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @return The exit code for the process.
+ */
+int GkCli::diagnostics()
+{
+    GkDbDiagnostics gkDiagnostics(db_ptr);
+    std::cout << gkDiagnostics.to_text(gkDiagnostics.collect(archive_temp_dir, archive_file)).toStdString() << std::endl;
+    return 0;
+}
+
+/**
+ * @brief GkCli::print_merge_stats lets the user know what a merge had to look at, and what it changed.
+ * @param dest_file The HerpLog Database File that was merged into.
+ * @param stats As returned by GkDbMerge::merge().
+ */
+void GkCli::print_merge_stats(const std::string &dest_file, const GkRecords::GkMergeStats &stats)
+{
+    std::cout << tr("Merged into \"%1\": %2 of %3 bucket(s) differed, %4 record(s) compared; %5 imported, %6 replaced, "
+                    "%7 kept and %8 categories created.").arg(QString::fromStdString(dest_file))
+            .arg(QString::number(stats.buckets_differing)).arg(QString::number(stats.buckets_compared))
+            .arg(QString::number(stats.records_compared)).arg(QString::number(stats.records_imported))
+            .arg(QString::number(stats.records_replaced)).arg(QString::number(stats.records_kept))
+            .arg(QString::number(stats.categories_created)).toStdString() << std::endl;
+    return;
+}
+
+void GkCli::usage(std::ostream &out)
+{
+    out << tr("Usage: herplog-cli <command> <database.hdb> [arguments]\n\n"
+              "Commands:\n"
+              "  ingest <database.hdb> <records.csv>     Add the log entries from a CSV file, creating the database if needed\n"
+              "  query <database.hdb> [--from <date>] [--to <date>] [--animal <name>] [--limit <n>]\n"
+              "                                          Print the log entries within the given date range\n"
+              "  find <database.hdb> <query> [--limit <n>]\n"
+              "                                          Print the log entries whose notes match, e.g. 'regurg* OR \"stuck shed\"'\n"
+              "  lapses <database.hdb> <toilet|hydration|vitamins> <days> [--from <date>] [--to <date>]\n"
+              "                                          Print the animals that went at least that many days without it\n"
+              "  bands <database.hdb> <species> [--weeks <n>] [--underweight] [--from <date>] [--to <date>]\n"
+              "                                          Print the 10th/50th/90th percentile weights, or the animals below them\n"
+              "  attention <database.hdb> [--all]        Print the animals that need attention, and why\n"
+              "  alerts <database.hdb> [--ack]           Print the sudden weight changes and missed care spotted upon writing\n"
+              "  import-series <database.hdb> <readings.csv|readings.lp> [--subject <enclosure>]\n"
+              "                                          Add the temperature/humidity readings of the enclosure probes\n"
+              "  series <database.hdb> [<series>] [--from <date>] [--to <date>] [--every <minutes>]\n"
+              "                                          List the time-series, or print the readings of one of them\n"
+              "  export <database.hdb> <records.csv> [--from <date>] [--to <date>]\n"
+              "                                          Write the log entries within the given date range to a CSV file\n"
+              "  report <database.hdb> <report.csv> [--by licensee|species|animal] [--per day|week|month]\n"
+              "         [--from <date>] [--to <date>]   Write the counts, mean weights and flag rates to a CSV file\n"
+              "  verify <database.hdb>                   Check the database for damage\n"
+              "  compact <database.hdb>                  Reclaim the space taken up by deleted log entries\n"
+              "  serve <database.hdb>                    Share the database with every HerpLog upon this computer\n"
+              "  merge <database.hdb> <other.hdb>        Bring the log entries of another database into this one\n"
+              "  sync <database.hdb> <other.hdb>         Merge both databases into each other, so that they end up alike\n"
+              "  diagnostics <database.hdb>              Print the internals of LevelDB and the footprint of the database\n\n"
+              "Any command may be given `--trace <trace.json>`, to save a Chrome trace of where the time went.\n"
+              "Dates may either be given as UNIX Epoch Time or in ISO 8601 format (e.g. 2018-03-21T09:30:00).").toStdString()
+        << std::endl;
+}
+
+/**
+ * @brief GkCli::open_archive extracts the given HerpLog Database File into a temporary directory and opens up the
+ * Google LevelDB database within, in much the same manner as the GUI does upon opening a database. Should the HerpLog
+ * service be serving the database already, then it's connected to instead.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param hdb_file The HerpLog Database File to be opened.
+ * @param create_if_missing Whether to create a new, empty database if `hdb_file` does not exist yet.
+ * @see MainWindow::on_button_open_db_clicked()
+ */
+void GkCli::open_archive(const std::string &hdb_file, const bool &create_if_missing)
+{
+    db_ptr = attach_archive(hdb_file, create_if_missing, archive_temp_dir);
+    archive_file = hdb_file;
+
+    gkDbRead = std::make_shared<GkDbRead>(db_ptr, gkStrOp, nullptr);
+    gkDbWrite = std::make_shared<GkDbWrite>(db_ptr, gkDbRead, gkStrOp, nullptr);
+    gkCategoryTree = std::make_shared<GkCategoryTree>(gkDbRead, nullptr);
+
+    gkDbWrite->rebuild_indexes();
+    gkCategoryTree->build();
+
+    licensee_ids.clear();
+    species_ids.clear();
+    animal_ids.clear();
+
+    return;
+}
+
+/**
+ * @brief GkCli::attach_archive opens up the Google LevelDB database of a HerpLog Database File, either through the
+ * HerpLog service if it's serving the database already, or by extracting it into a temporary directory.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param hdb_file The HerpLog Database File to be opened.
+ * @param create_if_missing Whether to create a new, empty database if `hdb_file` does not exist yet.
+ * @param temp_dir Where the database was extracted towards, or left empty if it's being served.
+ * @param temp_name What to name the temporary directory, if not after the HerpLog Database File itself.
+ * @return The opened database.
+ */
+GkFile::FileDb GkCli::attach_archive(const std::string &hdb_file, const bool &create_if_missing, fs::path &temp_dir,
+                                     const std::string &temp_name)
+{
+    sys::error_code ec;
+    std::shared_ptr<leveldb::DB> remote_db = GkRemoteDb::connect(GkDbServer::socket_path_for(hdb_file));
+    if (remote_db != nullptr) {
+        // The HerpLog service already has the database open, so work upon it through the service instead
+        temp_dir.clear();
+        GkFile::FileDb file_db;
+        file_db.db = remote_db;
+        return file_db;
+    } else if (fs::exists(hdb_file, ec)) {
+        temp_dir = gkFileIo->decompress_file(hdb_file, temp_name);
+    } else if (create_if_missing) {
+        fs::path dirName = fs::path(hdb_file).filename();
+        while (!dirName.extension().empty()) {
+            dirName = dirName.stem();
+        }
+
+        temp_dir = fs::path(QDir::tempPath().toStdString() + fs::path::preferred_separator + dirName.string());
+        gkFileIo->checkExistingTempDir(temp_dir, false, true);
+    } else {
+        throw std::invalid_argument(tr("The database, \"%1\", does not exist!").arg(QString::fromStdString(hdb_file)).toStdString());
+    }
+
+    return gkDbConn->open_database(temp_dir.string());
+}
+
+/**
+ * @brief GkCli::save_archive closes the database and compresses it back into its HerpLog Database File, via a
+ * temporary file so that the original is left intact should anything go wrong.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @see HerpApp::on_action_Save_triggered()
+ */
+void GkCli::save_archive()
+{
+    const fs::path archive_temp_dir_str = archive_temp_dir;
+    const std::string archive_file_str = archive_file;
+
+    if (!archive_temp_dir.empty() && db_ptr.db) {
+        // Photos that no record refers to any longer would otherwise be carried along into the archive forever more
+        GkAttachmentStore(db_ptr, archive_temp_dir, gkStrOp).sweep();
+    }
+
+    // Google LevelDB has to let go of the database before it can be safely compressed
+    gkCategoryTree.reset();
+    gkDbWrite.reset();
+    gkDbRead.reset();
+    db_ptr.db.reset();
+
+    if (archive_temp_dir.empty()) {
+        return; // The database is being served, and the service saves it once it's shut down
+    }
+
+    store_archive(archive_temp_dir_str, archive_file_str);
+    return;
+}
+
+/**
+ * @brief GkCli::store_archive compresses an (already closed) database into its HerpLog Database File.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param temp_dir Where the database was extracted towards.
+ * @param hdb_file The HerpLog Database File to be written.
+ */
+void GkCli::store_archive(const fs::path &temp_dir, const std::string &hdb_file)
+{
+    sys::error_code ec;
+    std::string temp_file_name = std::string(hdb_file + "." + gkStrOp->random_hash());
+    gkFileIo->compress_files(temp_dir.string(), temp_file_name);
+    if (fs::exists(hdb_file, ec) && !fs::remove(hdb_file, ec)) {
+        throw std::runtime_error(ec.message());
+    }
+
+    fs::rename(temp_file_name, hdb_file, ec);
+    if (ec.value() > 0) {
+        throw std::runtime_error(ec.message());
+    }
+
+    return;
+}
+
+/**
+ * @brief GkCli::close_archive closes the database without saving it, and cleans up after its temporary directory.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ */
+void GkCli::close_archive()
+{
+    gkCategoryTree.reset();
+    gkDbWrite.reset();
+    gkDbRead.reset();
+    db_ptr.db.reset();
+
+    if (!archive_temp_dir.empty()) {
+        sys::error_code ec;
+        fs::remove_all(archive_temp_dir, ec);
+        archive_temp_dir.clear();
+    }
+
+    archive_file.clear();
+    return;
+}
+
+/**
+ * @brief GkCli::parse_date_time reads a Date/Time from the command-line or from a CSV file.
+ * @param value Either UNIX Epoch Time or an ISO 8601 Date/Time. An empty string is taken as the beginning of time.
+ * @return The Date/Time as UNIX Epoch Time.
+ */
+long int GkCli::parse_date_time(const std::string &value)
+{
+    if (value.empty()) {
+        return std::numeric_limits<long int>::min();
+    }
+
+    if (std::all_of(value.begin(), value.end(), [](const char &c) { return std::isdigit(static_cast<unsigned char>(c)) || c == '-'; })
+            && value.find('-', 1) == std::string::npos) {
+        return std::stol(value);
+    }
+
+    QDateTime date_time = QDateTime::fromString(QString::fromStdString(value), Qt::ISODate);
+    if (!date_time.isValid()) {
+        throw std::invalid_argument(tr("\"%1\" is not a valid Date/Time!").arg(QString::fromStdString(value)).toStdString());
+    }
+
+    return static_cast<long int>(date_time.toTime_t());
+}
+
+/**
+ * @brief GkCli::category_id finds the Unique ID of the Licensee, Species, or Animal with the given name, creating a new
+ * one if there is none by that name as of yet.
+ * @param record_type Whether it's a Licensee, Species, or Animal that's being looked for.
+ * @param name The name of the category in question.
+ * @return The Unique ID of the category.
+ */
+std::string GkCli::category_id(const GkRecords::MiscRecordType &record_type, const std::string &name)
+{
+    using namespace GkRecords;
+    std::unordered_map<std::string, std::string> *ids = nullptr;
+    switch (record_type) {
+        case MiscRecordType::gkLicensee:
+            ids = &licensee_ids;
+            break;
+        case MiscRecordType::gkSpecies:
+            ids = &species_ids;
+            break;
+        case MiscRecordType::gkId:
+            ids = &animal_ids;
+            break;
+        default:
+            throw std::invalid_argument(tr("Unable to read Unique Identifier from database!").toStdString());
+    }
+
+    if (ids->empty()) {
+        auto cat_key_vals = gkDbRead->get_cat_key_vals(record_type);
+        for (auto it = cat_key_vals.begin(); it != cat_key_vals.end(); ++it) {
+            ids->insert(std::make_pair(it.value(), it.key()));
+        }
+    }
+
+    auto found = ids->find(name);
+    if (found != ids->end()) {
+        return found->second;
+    }
+
+    const std::string id = gkDbWrite->create_uuid();
+    ids->insert(std::make_pair(name, id));
+    return id;
+}
+
+/**
+ * @brief GkCli::category_name looks up the name of a Licensee, Species, or Animal from its Unique ID.
+ */
+std::string GkCli::category_name(const GkRecords::MiscRecordType &record_type, const std::string &id)
+{
+    return gkCategoryTree->name(record_type, gkCategoryTree->find(record_type, id));
+}
+
+/**
+ * @brief GkCli::scan_animal_range reads the records of every Animal by the given name that fall within the given date
+ * range, from the (Animal, Date/Time) index, so that none of the other records ever need to be looked at.
+ * @param animal The name of the Animal(s) in question.
+ * @param dateStart The beginning of the date range, as UNIX Epoch Time.
+ * @param dateEnd The end of the date range, as UNIX Epoch Time.
+ * @param limit The maximum amount of records to read for each Animal.
+ * @return The records within the range, in chronological order.
+ */
+std::vector<GkRecords::GkIndexEntry> GkCli::scan_animal_range(const std::string &animal, const long int &dateStart,
+                                                              const long int &dateEnd, const std::size_t &limit)
+{
+    std::vector<GkRecords::GkIndexEntry> entries;
+    auto animal_names = gkDbRead->get_cat_key_vals(GkRecords::MiscRecordType::gkId);
+    for (auto it = animal_names.begin(); it != animal_names.end(); ++it) {
+        if (it.value() != animal) {
+            continue;
+        }
+
+        for (const auto &entry: gkDbRead->scan_animal_index(it.key(), dateStart, dateEnd, limit)) {
+            entries.push_back({ entry.date_time, entry.record_id });
+        }
+    }
+
+    std::sort(entries.begin(), entries.end(), [](const GkRecords::GkIndexEntry &lhs, const GkRecords::GkIndexEntry &rhs) {
+        return (lhs.date_time != rhs.date_time) ? (lhs.date_time < rhs.date_time) : (lhs.record_id < rhs.record_id);
+    });
+
+    return entries;
+}
+
+/**
+ * @brief GkCli::scan_range walks the timestamp index, a page at a time, for every record that falls within the given
+ * date range.
+ * @param dateStart The beginning of the date range, as UNIX Epoch Time.
+ * @param dateEnd The end of the date range, as UNIX Epoch Time.
+ * @return The entries of the timestamp index within the range, in chronological order.
+ */
+std::vector<GkRecords::GkIndexEntry> GkCli::scan_range(const long int &dateStart, const long int &dateEnd)
+{
+    std::vector<GkRecords::GkIndexEntry> entries;
+
+    // An index key with no Record ID sorts before that of every record made at the same Date/Time
+    std::string after_key = gkStrOp->timestamp_index_key(dateStart, "");
+    while (true) {
+        auto page = gkDbRead->scan_timestamp_index(after_key, HERPLOG_CLI_SCAN_PAGE, false);
+        for (const auto &entry: page) {
+            if (entry.date_time > dateEnd) {
+                return entries;
+            }
+
+            entries.push_back(entry);
+        }
+
+        if (page.size() < HERPLOG_CLI_SCAN_PAGE) {
+            break;
+        }
+
+        after_key = gkStrOp->timestamp_index_key(page.back().date_time, page.back().record_id);
+    }
+
+    return entries;
+}
@@ -0,0 +1,129 @@
+/**
+ **  _   _                 _
+ ** | | | |               | |
+ ** | |_| | ___ _ __ _ __ | |     ___   __ _
+ ** |  _  |/ _ \ '__| '_ \| |    / _ \ / _` |
+ ** | | | |  __/ |  | |_) | |___| (_) | (_| |
+ ** \_| |_/\___|_|  | .__/\_____/\___/ \__, |
+ **                 | |                 __/ |
+ **                 |_|                |___/
+ **
+ **   Thank you for using "HerpLog" for your herpetology management requirements!
+ **   Copyright (C) 2017-2018. GekkoFyre.
+ **
+ **
+ **   HerpLog is free software: you can redistribute it and/or modify
+ **   it under the terms of the GNU General Public License as published by
+ **   the Free Software Foundation, either version 3 of the License, or
+ **   (at your option) any later version.
+ **
+ **   HerpLog is distributed in the hope that it will be useful,
+ **   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **   GNU General Public License for more details.
+ **
+ **   You should have received a copy of the GNU General Public License
+ **   along with HerpLog.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ **
+ **   The latest source code updates can be obtained from [ 1 ] below at your
+ **   discretion. A web-browser or the 'git' application may be required.
+ **
+ **   [ 1 ] - https://github.com/GekkoFyre/HerpLog
+ **
+ ********************************************************************************/
+
+/**
+ * @file gk_cli.hpp
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @brief The headless, command-line front-end to HerpLog, for the batch ingest, querying, exporting, verifying and
+ * compacting of HerpLog Database Files without the need for a display.
+ */
+
+#ifndef GK_CLI_HPP
+#define GK_CLI_HPP
+
+#include "./../options.hpp"
+#include "./../gk_db_conn.hpp"
+#include "./../gk_db_read.hpp"
+#include "./../gk_db_write.hpp"
+#include "./../gk_file_io.hpp"
+#include "./../gk_string_op.hpp"
+#include "./../gk_category_tree.hpp"
+#include <boost/filesystem.hpp>
+#include <QtCore/QObject>
+#include <unordered_map>
+#include <string>
+#include <vector>
+#include <memory>
+#include <ostream>
+
+namespace GekkoFyre {
+class GkCli;
+
+class GkCli : public QObject {
+    Q_OBJECT
+
+public:
+    explicit GkCli(QObject *parent = nullptr);
+    ~GkCli();
+
+    int run(const std::vector<std::string> &args);
+
+private:
+    int ingest(const std::string &csv_file);
+    int query(const long int &dateStart, const long int &dateEnd, const std::string &animal, const std::size_t &limit);
+    int find(const std::string &search_query, const std::size_t &limit);
+    int lapses(const std::string &flag_name, const long int &min_gap, const long int &dateStart, const long int &dateEnd);
+    int bands(const std::string &species, const long int &weeks, const bool &underweight, const long int &dateStart,
+              const long int &dateEnd);
+    int attention(const bool &all);
+    int alerts(const bool &acknowledge);
+    int import_series(const std::string &readings_file, const std::string &subject);
+    int series(const std::string &series_name, const long int &dateStart, const long int &dateEnd,
+               const long int &bucket_seconds);
+    int export_csv(const std::string &csv_file, const long int &dateStart, const long int &dateEnd);
+    int report(const std::string &csv_file, const GkReport::GkGroupBy &group_by, const GkReport::GkBucketSize &bucket_size,
+               const long int &dateStart, const long int &dateEnd);
+    int verify();
+    int compact();
+    int serve();
+    int merge(const std::string &peer_file, const bool &both_ways);
+    int diagnostics();
+    void print_merge_stats(const std::string &dest_file, const GkRecords::GkMergeStats &stats);
+    void usage(std::ostream &out);
+
+    void open_archive(const std::string &hdb_file, const bool &create_if_missing);
+    GkFile::FileDb attach_archive(const std::string &hdb_file, const bool &create_if_missing, fs::path &temp_dir,
+                                  const std::string &temp_name = "");
+    void save_archive();
+    void store_archive(const fs::path &temp_dir, const std::string &hdb_file);
+    void close_archive();
+
+    long int parse_date_time(const std::string &value);
+    std::string category_id(const GkRecords::MiscRecordType &record_type, const std::string &name);
+    std::string category_name(const GkRecords::MiscRecordType &record_type, const std::string &id);
+    std::vector<GkRecords::GkIndexEntry> scan_range(const long int &dateStart, const long int &dateEnd);
+    std::vector<GkRecords::GkIndexEntry> scan_animal_range(const std::string &animal, const long int &dateStart,
+                                                           const long int &dateEnd, const std::size_t &limit);
+
+    std::shared_ptr<GkStringOp> gkStrOp;
+    std::shared_ptr<GkFileIo> gkFileIo;
+    std::unique_ptr<GkDbConn> gkDbConn;
+    std::shared_ptr<GkDbRead> gkDbRead;
+    std::shared_ptr<GkDbWrite> gkDbWrite;
+    std::shared_ptr<GkCategoryTree> gkCategoryTree;
+
+    GkFile::FileDb db_ptr;
+    std::string archive_file;  // The HerpLog Database File (i.e. `*.hdb`) that is being worked upon
+    fs::path archive_temp_dir; // Where the contents of the HerpLog Database File have been extracted towards
+
+    // <Key: Category Name, Value: Unique ID>, for each of `Licensee`, `Species`, and `Animal ID`, as used by the ingest
+    std::unordered_map<std::string, std::string> licensee_ids;
+    std::unordered_map<std::string, std::string> species_ids;
+    std::unordered_map<std::string, std::string> animal_ids;
+};
+}
+
+#endif // GK_CLI_HPP
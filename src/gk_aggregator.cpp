@@ -0,0 +1,399 @@
+/**
+ **  _   _                 _
+ ** | | | |               | |
+ ** | |_| | ___ _ __ _ __ | |     ___   __ _
+ ** |  _  |/ _ \ '__| '_ \| |    / _ \ / _` |
+ ** | | | |  __/ |  | |_) | |___| (_) | (_| |
+ ** \_| |_/\___|_|  | .__/\_____/\___/ \__, |
+ **                 | |                 __/ |
+ **                 |_|                |___/
+ **
+ **   Thank you for using "HerpLog" for your herpetology management requirements!
+ **   Copyright (C) 2017-2018. GekkoFyre.
+ **
+ **
+ **   HerpLog is free software: you can redistribute it and/or modify
+ **   it under the terms of the GNU General Public License as published by
+ **   the Free Software Foundation, either version 3 of the License, or
+ **   (at your option) any later version.
+ **
+ **   HerpLog is distributed in the hope that it will be useful,
+ **   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **   GNU General Public License for more details.
+ **
+ **   You should have received a copy of the GNU General Public License
+ **   along with HerpLog.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ **
+ **   The latest source code updates can be obtained from [ 1 ] below at your
+ **   discretion. A web-browser or the 'git' application may be required.
+ **
+ **   [ 1 ] - https://github.com/GekkoFyre/HerpLog
+ **
+ ********************************************************************************/
+
+/**
+ * @file gk_aggregator.cpp
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @brief Groups the records within a date range by Licensee, Species or Animal and by day, week or month, summing up
+ * their counts, weights and husbandry flags in parallel across partitions of the range.
+ */
+
+#include "gk_aggregator.hpp"
+#include "gk_trace.hpp"
+#include "3rd_party/minicsv/minicsv.h"
+#include <QDateTime>
+#include <QDate>
+#include <QTime>
+#include <algorithm>
+#include <exception>
+#include <stdexcept>
+#include <future>
+#include <limits>
+#include <thread>
+#include <map>
+
+using namespace GekkoFyre;
+using namespace mini;
+
+namespace {
+/**
+ * @brief start_of_bucket finds the local midnight at the start of the day, week (i.e. Monday) or month that the given
+ * Date/Time falls within.
+ */
+QDate start_of_bucket(const long int &date_time, const GkReport::GkBucketSize &bucket_size)
+{
+    const QDate date = QDateTime::fromMSecsSinceEpoch(static_cast<qint64>(date_time) * 1000).date();
+    switch (bucket_size) {
+    case GkReport::GkBucketSize::Week:
+        return date.addDays(1 - date.dayOfWeek());
+    case GkReport::GkBucketSize::Month:
+        return QDate(date.year(), date.month(), 1);
+    default:
+        return date;
+    }
+}
+
+QDate next_bucket(const QDate &date, const GkReport::GkBucketSize &bucket_size)
+{
+    switch (bucket_size) {
+    case GkReport::GkBucketSize::Week:
+        return date.addDays(7);
+    case GkReport::GkBucketSize::Month:
+        return date.addMonths(1);
+    default:
+        return date.addDays(1);
+    }
+}
+
+long int to_epoch(const QDate &date)
+{
+    return static_cast<long int>(QDateTime(date, QTime(0, 0)).toMSecsSinceEpoch() / 1000);
+}
+}
+
+GkAggregator::GkAggregator(const GkFile::FileDb &database, const std::shared_ptr<GkDbRead> &gk_db_read,
+                           const std::shared_ptr<GkStringOp> &gk_str_op, QObject *parent) : QObject(parent)
+{
+    db_conn = database;
+    gkDbRead = gk_db_read;
+    gkStrOp = gk_str_op;
+    executor = std::make_unique<GkExecutor>(std::max<std::size_t>(1, std::thread::hardware_concurrency()));
+}
+
+GkAggregator::~GkAggregator()
+{}
+
+/**
+ * @brief GkAggregator::aggregate sums up the records within the given date range, per bucket of time and per Licensee,
+ * Species or Animal. The range is split into partitions along the boundaries of the buckets, each of which is scanned
+ * upon a thread of its own, but all of them from the one snapshot so that they agree with each other.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param dateStart The beginning of the date range, as UNIX Epoch Time.
+ * @param dateEnd The end of the date range, as UNIX Epoch Time.
+ * @param bucket_size Whether to sum up the records by the day, week or month.
+ * @param group_by Whether to sum up the records by Licensee, Species or Animal.
+ * @param group_filter If not empty, only the records of the Licensee, Species or Animal with this Unique ID are summed.
+ * @return The sums of every (bucket, group) that has any records.
+ */
+GkReport::GkAggregateTable GkAggregator::aggregate(const long int &dateStart, const long int &dateEnd,
+                                                   const GkReport::GkBucketSize &bucket_size,
+                                                   const GkReport::GkGroupBy &group_by, const std::string &group_filter)
+{
+    GkTraceSpan span("GkAggregator::aggregate", "db");
+    using namespace GkReport;
+    GkAggregateTable table;
+    table.bucket_size = bucket_size;
+    table.group_by = group_by;
+
+    std::shared_ptr<const leveldb::Snapshot> snapshot(db_conn.db->GetSnapshot(), [this](const leveldb::Snapshot *s) {
+        db_conn.db->ReleaseSnapshot(s);
+    });
+
+    leveldb::ReadOptions read_opt;
+    read_opt.snapshot = snapshot.get();
+    read_opt.fill_cache = false; // Don't push the records that are being looked at out of the cache
+
+    // An open-ended range is narrowed down to the records themselves, lest there be millennia worth of buckets
+    long int range_start = dateStart;
+    long int range_end = dateEnd;
+    {
+        std::unique_ptr<leveldb::Iterator> it(db_conn.db->NewIterator(read_opt));
+        const std::string prefix(GkRecords::LEVELDB_INDEX_TIMESTAMP);
+        GkRecords::GkIndexEntry first, last;
+        it->Seek(prefix);
+        if (!it->Valid() || !gkStrOp->decode_timestamp_index_key(it->key().ToString(), first)) {
+            return table;
+        }
+
+        std::string prefix_end = prefix;
+        prefix_end.back() = static_cast<char>(prefix_end.back() + 1);
+        it->Seek(prefix_end);
+        if (it->Valid()) {
+            it->Prev();
+        } else {
+            it->SeekToLast();
+        }
+
+        if (!it->Valid() || !gkStrOp->decode_timestamp_index_key(it->key().ToString(), last)) {
+            return table;
+        }
+
+        range_start = std::max(range_start, first.date_time);
+        range_end = std::min(range_end, last.date_time);
+        if (range_start > range_end) {
+            return table;
+        }
+    }
+
+    std::unordered_map<std::string, std::uint32_t> group_lookup;
+    std::unordered_map<std::string, std::uint32_t> record_groups;
+    for (const auto &uuid: gkDbRead->get_uuids(snapshot.get())) {
+        const std::string &group_id = (group_by == GkGroupBy::Licensee) ? uuid.second.licensee_id :
+                                      ((group_by == GkGroupBy::Species) ? uuid.second.species_id : uuid.second.name_id);
+        if (!group_filter.empty() && (group_id != group_filter)) {
+            continue;
+        }
+
+        auto it = group_lookup.find(group_id);
+        if (it == group_lookup.end()) {
+            it = group_lookup.emplace(group_id, static_cast<std::uint32_t>(table.group_ids.size())).first;
+            table.group_ids.push_back(group_id);
+        }
+
+        record_groups.emplace(uuid.first, it->second);
+    }
+
+    const std::vector<long int> bounds = bucket_bounds(range_start, range_end, bucket_size);
+    const std::size_t buckets = bounds.size() - 1;
+    const std::size_t tasks = std::min(buckets, std::max<std::size_t>(1, std::thread::hardware_concurrency()) *
+                                       HERPLOG_AGGREGATE_TASKS_PER_THREAD);
+
+    std::vector<std::future<std::vector<GkAggregateCell>>> partials;
+    for (std::size_t task = 0; task < tasks; ++task) {
+        const std::size_t first_bucket = (buckets * task) / tasks;
+        const std::size_t last_bucket = (buckets * (task + 1)) / tasks;
+        partials.push_back(executor->submit([=, &read_opt, &bounds, &record_groups]() {
+            return scan_partition(read_opt, range_start, range_end, bounds, first_bucket, last_bucket, record_groups);
+        }));
+    }
+
+    // Every partition must be done with the snapshot before it's released, even if one of them has failed
+    std::exception_ptr error;
+    for (auto &partial: partials) {
+        try {
+            auto cells = partial.get();
+            table.cells.insert(table.cells.end(), cells.begin(), cells.end());
+        } catch (...) {
+            if (!error) {
+                error = std::current_exception();
+            }
+        }
+    }
+
+    if (error) {
+        std::rethrow_exception(error);
+    }
+
+    merge_cells(table.cells);
+    return table;
+}
+
+/**
+ * @brief GkAggregator::bucket_bounds works out where each bucket of time begins, in local time, from the one that holds
+ * `dateStart` through to the one that holds `dateEnd`.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @return The start of each bucket, followed by the end of the last, as UNIX Epoch Time.
+ */
+std::vector<long int> GkAggregator::bucket_bounds(const long int &dateStart, const long int &dateEnd,
+                                                  const GkReport::GkBucketSize &bucket_size)
+{
+    std::vector<long int> bounds;
+    QDate bucket = start_of_bucket(dateStart, bucket_size);
+    bounds.push_back(to_epoch(bucket));
+    do {
+        bucket = next_bucket(bucket, bucket_size);
+        bounds.push_back(to_epoch(bucket));
+    } while (bounds.back() <= dateEnd);
+
+    return bounds;
+}
+
+/**
+ * @brief GkAggregator::write_csv writes out the result of GkAggregator::aggregate() towards a CSV file, with the mean
+ * weight and the rate of each husbandry flag worked out from the sums.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param table The sums, as made by GkAggregator::aggregate().
+ * @param group_names The name of each of `table.group_ids`, in the same order.
+ * @param csv_file The CSV file to be written.
+ */
+void GkAggregator::write_csv(const GkReport::GkAggregateTable &table, const std::vector<std::string> &group_names,
+                             const std::string &csv_file)
+{
+    using namespace GkReport;
+    csv::ofstream os(csv_file);
+    if (!os.is_open()) {
+        throw std::runtime_error(tr("Unable to open \"%1\" for writing!").arg(QString::fromStdString(csv_file)).toStdString());
+    }
+
+    os.set_delimiter(',', "$$");
+    os.enable_surround_quote_on_str(true, '\"');
+    os << "period" << ((table.group_by == GkGroupBy::Licensee) ? "licensee" : ((table.group_by == GkGroupBy::Species) ?
+                                                                               "species" : "animal"))
+       << "records" << "weight_mean" << "weight_min" << "weight_max" << "went_toilet_rate" << "had_hydration_rate"
+       << "had_vitamins_rate" << NEWLINE;
+
+    for (const auto &cell: table.cells) {
+        const double count = static_cast<double>(cell.count);
+        os << QDateTime::fromMSecsSinceEpoch(static_cast<qint64>(cell.bucket) * 1000).date().toString(Qt::ISODate).toStdString()
+           << group_names.at(cell.group) << cell.count << (cell.weight_sum / count) << cell.weight_min << cell.weight_max
+           << (cell.went_toilet / count) << (cell.had_hydration / count) << (cell.had_vitamins / count) << NEWLINE;
+    }
+
+    os.flush();
+    return;
+}
+
+/**
+ * @brief GkAggregator::scan_partition sums up the records of the buckets from `first_bucket` up to, but not including,
+ * `last_bucket`, walking the timestamp index and reading just the weight and husbandry flags of each record.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param dateStart Records before this are left out, even if the first bucket begins earlier.
+ * @param dateEnd Records after this are left out, even if the last bucket ends later.
+ * @param groups Maps the Unique ID of each record onto its group, with those that have been filtered out left absent.
+ */
+std::vector<GkReport::GkAggregateCell> GkAggregator::scan_partition(
+        const leveldb::ReadOptions &read_opt, const long int &dateStart, const long int &dateEnd,
+        const std::vector<long int> &bounds, const std::size_t &first_bucket, const std::size_t &last_bucket,
+        const std::unordered_map<std::string, std::uint32_t> &groups)
+{
+    GkTraceSpan span("GkAggregator::scan_partition", "db");
+    using namespace GkRecords;
+    std::map<std::pair<std::size_t, std::uint32_t>, GkReport::GkAggregateCell> cells;
+
+    const std::string end_key = gkStrOp->timestamp_index_key(std::min(bounds[last_bucket], dateEnd + 1), "");
+    std::size_t bucket = first_bucket;
+    std::string value;
+    auto flag_set = [&](const std::string &record_id, const char *field) {
+        return db_conn.db->Get(read_opt, gkStrOp->multipart_key({ record_id, field }), &value).ok() && (value == "1");
+    };
+
+    std::unique_ptr<leveldb::Iterator> it(db_conn.db->NewIterator(read_opt));
+    for (it->Seek(gkStrOp->timestamp_index_key(std::max(bounds[first_bucket], dateStart), "")); it->Valid(); it->Next()) {
+        const std::string key = it->key().ToString();
+        if (key >= end_key) {
+            break;
+        }
+
+        GkIndexEntry entry;
+        if (!gkStrOp->decode_timestamp_index_key(key, entry)) {
+            continue;
+        }
+
+        auto group = groups.find(entry.record_id);
+        if (group == groups.end()) {
+            continue;
+        }
+
+        while (entry.date_time >= bounds[bucket + 1]) {
+            ++bucket; // The index is in chronological order, so the buckets only ever move forwards
+        }
+
+        auto cell = cells.find(std::make_pair(bucket, group->second));
+        if (cell == cells.end()) {
+            GkReport::GkAggregateCell empty;
+            empty.bucket = bounds[bucket];
+            empty.group = group->second;
+            empty.count = 0;
+            empty.weight_sum = 0.0;
+            empty.weight_min = std::numeric_limits<double>::max();
+            empty.weight_max = std::numeric_limits<double>::lowest();
+            empty.went_toilet = 0;
+            empty.had_hydration = 0;
+            empty.had_vitamins = 0;
+            cell = cells.emplace(std::make_pair(bucket, group->second), empty).first;
+        }
+
+        leveldb::Status s = db_conn.db->Get(read_opt, gkStrOp->multipart_key({ entry.record_id, weightMeasure }), &value);
+        if (!s.ok()) {
+            throw std::runtime_error(s.ToString());
+        }
+
+        const double weight = std::stod(value);
+        ++cell->second.count;
+        cell->second.weight_sum += weight;
+        cell->second.weight_min = std::min(cell->second.weight_min, weight);
+        cell->second.weight_max = std::max(cell->second.weight_max, weight);
+
+        cell->second.went_toilet += flag_set(entry.record_id, boolWentToilet) ? 1 : 0;
+        cell->second.had_hydration += flag_set(entry.record_id, boolHadHydration) ? 1 : 0;
+        cell->second.had_vitamins += flag_set(entry.record_id, boolHadVitamins) ? 1 : 0;
+    }
+
+    std::vector<GkReport::GkAggregateCell> output;
+    output.reserve(cells.size());
+    for (const auto &cell: cells) {
+        output.push_back(cell.second);
+    }
+
+    return output;
+}
+
+/**
+ * @brief GkAggregator::merge_cells puts the cells from every partition in order of bucket and then group, and combines
+ * any that are for the same (bucket, group) into one.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ */
+void GkAggregator::merge_cells(std::vector<GkReport::GkAggregateCell> &cells)
+{
+    using GkReport::GkAggregateCell;
+    std::sort(cells.begin(), cells.end(), [](const GkAggregateCell &lhs, const GkAggregateCell &rhs) {
+        return (lhs.bucket < rhs.bucket) || ((lhs.bucket == rhs.bucket) && (lhs.group < rhs.group));
+    });
+
+    std::size_t out = 0;
+    for (std::size_t i = 0; i < cells.size(); ++i) {
+        if ((out > 0) && (cells[out - 1].bucket == cells[i].bucket) && (cells[out - 1].group == cells[i].group)) {
+            GkAggregateCell &merged = cells[out - 1];
+            merged.count += cells[i].count;
+            merged.weight_sum += cells[i].weight_sum;
+            merged.weight_min = std::min(merged.weight_min, cells[i].weight_min);
+            merged.weight_max = std::max(merged.weight_max, cells[i].weight_max);
+            merged.went_toilet += cells[i].went_toilet;
+            merged.had_hydration += cells[i].had_hydration;
+            merged.had_vitamins += cells[i].had_vitamins;
+        } else {
+            cells[out++] = cells[i];
+        }
+    }
+
+    cells.resize(out);
+    return;
+}
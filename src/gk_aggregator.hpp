@@ -0,0 +1,92 @@
+/**
+ **  _   _                 _
+ ** | | | |               | |
+ ** | |_| | ___ _ __ _ __ | |     ___   __ _
+ ** |  _  |/ _ \ '__| '_ \| |    / _ \ / _` |
+ ** | | | |  __/ |  | |_) | |___| (_) | (_| |
+ ** \_| |_/\___|_|  | .__/\_____/\___/ \__, |
+ **                 | |                 __/ |
+ **                 |_|                |___/
+ **
+ **   Thank you for using "HerpLog" for your herpetology management requirements!
+ **   Copyright (C) 2017-2018. GekkoFyre.
+ **
+ **
+ **   HerpLog is free software: you can redistribute it and/or modify
+ **   it under the terms of the GNU General Public License as published by
+ **   the Free Software Foundation, either version 3 of the License, or
+ **   (at your option) any later version.
+ **
+ **   HerpLog is distributed in the hope that it will be useful,
+ **   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **   GNU General Public License for more details.
+ **
+ **   You should have received a copy of the GNU General Public License
+ **   along with HerpLog.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ **
+ **   The latest source code updates can be obtained from [ 1 ] below at your
+ **   discretion. A web-browser or the 'git' application may be required.
+ **
+ **   [ 1 ] - https://github.com/GekkoFyre/HerpLog
+ **
+ ********************************************************************************/
+
+/**
+ * @file gk_aggregator.hpp
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @brief Groups the records within a date range by Licensee, Species or Animal and by day, week or month, summing up
+ * their counts, weights and husbandry flags in parallel across partitions of the range.
+ */
+
+#ifndef GK_AGGREGATOR_HPP
+#define GK_AGGREGATOR_HPP
+
+#include "options.hpp"
+#include "gk_db_read.hpp"
+#include "gk_string_op.hpp"
+#include "gk_executor.hpp"
+#include <QtCore/QObject>
+#include <unordered_map>
+#include <string>
+#include <vector>
+#include <memory>
+
+namespace GekkoFyre {
+class GkAggregator;
+
+class GkAggregator : public QObject {
+    Q_OBJECT
+
+public:
+    explicit GkAggregator(const GkFile::FileDb &database, const std::shared_ptr<GkDbRead> &gk_db_read,
+                          const std::shared_ptr<GkStringOp> &gk_str_op, QObject *parent = nullptr);
+    ~GkAggregator();
+
+    GkReport::GkAggregateTable aggregate(const long int &dateStart, const long int &dateEnd,
+                                         const GkReport::GkBucketSize &bucket_size, const GkReport::GkGroupBy &group_by,
+                                         const std::string &group_filter = "");
+
+    static std::vector<long int> bucket_bounds(const long int &dateStart, const long int &dateEnd,
+                                               const GkReport::GkBucketSize &bucket_size);
+    static void write_csv(const GkReport::GkAggregateTable &table, const std::vector<std::string> &group_names,
+                          const std::string &csv_file);
+
+private:
+    std::vector<GkReport::GkAggregateCell> scan_partition(const leveldb::ReadOptions &read_opt, const long int &dateStart,
+                                                          const long int &dateEnd, const std::vector<long int> &bounds,
+                                                          const std::size_t &first_bucket,
+                                                          const std::size_t &last_bucket,
+                                                          const std::unordered_map<std::string, std::uint32_t> &groups);
+    static void merge_cells(std::vector<GkReport::GkAggregateCell> &cells);
+
+    GkFile::FileDb db_conn;
+    std::shared_ptr<GkDbRead> gkDbRead;
+    std::shared_ptr<GkStringOp> gkStrOp;
+    std::unique_ptr<GkExecutor> executor;
+};
+}
+
+#endif // GK_AGGREGATOR_HPP
@@ -0,0 +1,312 @@
+/**
+ **  _   _                 _
+ ** | | | |               | |
+ ** | |_| | ___ _ __ _ __ | |     ___   __ _
+ ** |  _  |/ _ \ '__| '_ \| |    / _ \ / _` |
+ ** | | | |  __/ |  | |_) | |___| (_) | (_| |
+ ** \_| |_/\___|_|  | .__/\_____/\___/ \__, |
+ **                 | |                 __/ |
+ **                 |_|                |___/
+ **
+ **   Thank you for using "HerpLog" for your herpetology management requirements!
+ **   Copyright (C) 2017-2018. GekkoFyre.
+ **
+ **
+ **   HerpLog is free software: you can redistribute it and/or modify
+ **   it under the terms of the GNU General Public License as published by
+ **   the Free Software Foundation, either version 3 of the License, or
+ **   (at your option) any later version.
+ **
+ **   HerpLog is distributed in the hope that it will be useful,
+ **   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **   GNU General Public License for more details.
+ **
+ **   You should have received a copy of the GNU General Public License
+ **   along with HerpLog.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ **
+ **   The latest source code updates can be obtained from [ 1 ] below at your
+ **   discretion. A web-browser or the 'git' application may be required.
+ **
+ **   [ 1 ] - https://github.com/GekkoFyre/HerpLog
+ **
+ ********************************************************************************/
+
+/**
+ * @file gk_animal_stats.cpp
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @brief Routines for keeping the rolling statistics of an animal up-to-date one record at a time, and for judging
+ * from them whether the animal needs attention.
+ */
+
+#include "gk_animal_stats.hpp"
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <utility>
+
+using namespace GekkoFyre;
+
+namespace {
+constexpr double SECONDS_PER_DAY = 24.0 * 60.0 * 60.0;
+
+/**
+ * @brief days_since_first works out the position of a record along the weight trend, in days since the animal's oldest
+ * record, so that the sums of squares stay small enough not to lose any precision.
+ */
+double days_since_first(const GkRecords::GkAnimalSummary &summary, const long int &date_time)
+{
+    return static_cast<double>(date_time - summary.first_seen) / SECONDS_PER_DAY;
+}
+}
+
+/**
+ * @brief GkAnimalStats::fold adds the newest record of an animal to its rolling statistics, in constant time. Any
+ * records that have slid out of the window of the weight trend must have been handed to GkAnimalStats::evict() first.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param summary The statistics of the animal, which may be zeroed out if this is its first record.
+ * @param date_time The Date/Time of the record, as UNIX Epoch Time, which must be no older than `summary.last_seen`.
+ * @param weight The weight of the animal, as measured in this record.
+ * @param flags The husbandry flags of the record, as per `GkRecords::GkFlagBits`.
+ */
+void GkAnimalStats::fold(GkRecords::GkAnimalSummary &summary, const long int &date_time, const double &weight,
+                         const std::uint8_t &flags)
+{
+    using namespace GkRecords;
+    if (summary.record_count == 0) {
+        summary.first_seen = date_time;
+        summary.window_start = date_time;
+        summary.weight_ewma = weight;
+    } else {
+        summary.weight_ewma += HERPLOG_SUMMARY_EWMA_ALPHA * (weight - summary.weight_ewma);
+
+        // The baseline of how much the weight changes from one record to the next, as per West's weighted variance
+        const double delta = weight - summary.last_weight;
+        if (summary.delta_count == 0) {
+            summary.delta_mean = delta;
+            summary.delta_var = 0.0;
+        } else {
+            const double diff = delta - summary.delta_mean;
+            const double increment = HERPLOG_ANOMALY_BASELINE_ALPHA * diff;
+            summary.delta_mean += increment;
+            summary.delta_var = (1.0 - HERPLOG_ANOMALY_BASELINE_ALPHA) * (summary.delta_var + (diff * increment));
+        }
+
+        ++summary.delta_count;
+    }
+
+    ++summary.record_count;
+    summary.last_seen = date_time;
+    summary.last_weight = weight;
+    if ((flags & GkFlagBits::WentToilet) != 0) {
+        summary.last_toilet = date_time;
+    }
+
+    if ((flags & GkFlagBits::HadHydration) != 0) {
+        summary.last_hydration = date_time;
+    }
+
+    if ((flags & GkFlagBits::HadVitamins) != 0) {
+        summary.last_vitamins = date_time;
+    }
+
+    const double t = days_since_first(summary, date_time);
+    summary.window_start = std::max(summary.window_start, date_time - HERPLOG_SUMMARY_WINDOW_SECONDS);
+    ++summary.window_count;
+    summary.window_sum_t += t;
+    summary.window_sum_w += weight;
+    summary.window_sum_tt += t * t;
+    summary.window_sum_tw += t * weight;
+    return;
+}
+
+/**
+ * @brief GkAnimalStats::score judges a new record against the rolling baseline of its animal, before the record gets
+ * folded into it, in constant time. A change in weight that lies too many standard deviations from the usual change
+ * raises an alert, as does a husbandry flag whose lapse has only just grown beyond `HERPLOG_ATTENTION_LAPSE_SECONDS`
+ * with this record, so that each lapse is only alerted upon the once.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param baseline The statistics of the animal, as they were before this record.
+ * @param record_id The Unique ID of the record.
+ * @param date_time The Date/Time of the record, as UNIX Epoch Time, which must be no older than `baseline.last_seen`.
+ * @param weight The weight of the animal, as measured in this record.
+ * @param flags The husbandry flags of the record, as per `GkRecords::GkFlagBits`.
+ * @return The alerts raised by the record, if any, which have yet to be given their sequence numbers.
+ */
+std::vector<GkRecords::GkAlert> GkAnimalStats::score(const GkRecords::GkAnimalSummary &baseline,
+                                                     const std::string &record_id, const long int &date_time,
+                                                     const double &weight, const std::uint8_t &flags)
+{
+    using namespace GkRecords;
+    std::vector<GkAlert> alerts;
+    if ((baseline.record_count == 0) || (date_time < baseline.last_seen)) {
+        return alerts;
+    }
+
+    const auto raise = [&](const GkAlertKind &kind, const double &score) {
+        alerts.push_back(GkAlert { 0, baseline.name_id, record_id, date_time, kind, score });
+    };
+
+    if (baseline.delta_count >= HERPLOG_ANOMALY_MIN_DELTAS) {
+        // Without a floor, an animal whose weight never changed would be alerted upon for the slightest of changes
+        const double deviation = std::max(std::sqrt(std::max(baseline.delta_var, 0.0)),
+                                          HERPLOG_ANOMALY_MIN_SD_FRACTION * std::abs(baseline.weight_ewma));
+        if (deviation > 0.0) {
+            const double z = ((weight - baseline.last_weight) - baseline.delta_mean) / deviation;
+            if (z <= -HERPLOG_ANOMALY_Z_THRESHOLD) {
+                raise(AlertWeightDrop, z);
+            } else if (z >= HERPLOG_ANOMALY_Z_THRESHOLD) {
+                raise(AlertWeightGain, z);
+            }
+        }
+    }
+
+    const std::pair<GkFlagBits, std::pair<long int, GkAlertKind>> care[] = {
+        { WentToilet, { baseline.last_toilet, AlertMissedToilet } },
+        { HadHydration, { baseline.last_hydration, AlertMissedHydration } },
+        { HadVitamins, { baseline.last_vitamins, AlertMissedVitamins } }
+    };
+
+    for (const auto &flag: care) {
+        if ((flags & flag.first) != 0) {
+            continue;
+        }
+
+        const long int last_set = (flag.second.first != 0) ? flag.second.first : baseline.first_seen;
+        if (((baseline.last_seen - last_set) <= HERPLOG_ATTENTION_LAPSE_SECONDS) &&
+                ((date_time - last_set) > HERPLOG_ATTENTION_LAPSE_SECONDS)) {
+            raise(flag.second.second, static_cast<double>(date_time - last_set) / SECONDS_PER_DAY);
+        }
+    }
+
+    return alerts;
+}
+
+/**
+ * @brief GkAnimalStats::evict takes a record that has slid out of the window back out of the sums of the weight trend.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ */
+void GkAnimalStats::evict(GkRecords::GkAnimalSummary &summary, const long int &date_time, const double &weight)
+{
+    if (summary.window_count == 0) {
+        return;
+    }
+
+    const double t = days_since_first(summary, date_time);
+    --summary.window_count;
+    if (summary.window_count == 0) {
+        summary.window_sum_t = summary.window_sum_w = summary.window_sum_tt = summary.window_sum_tw = 0.0;
+        return; // Rather than leave behind whatever rounding errors have built up
+    }
+
+    summary.window_sum_t -= t;
+    summary.window_sum_w -= weight;
+    summary.window_sum_tt -= t * t;
+    summary.window_sum_tw -= t * weight;
+    return;
+}
+
+/**
+ * @brief GkAnimalStats::summarise works out the rolling statistics of an animal from scratch, as when the indexes are
+ * rebuilt or a summary has gone stale, by folding in every one of its records in turn.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param name_id The Unique ID of the animal.
+ * @param entries The records of the animal, in chronological order.
+ * @param flags The husbandry flags of each of those records.
+ * @return The statistics, which will no longer be stale.
+ */
+GkRecords::GkAnimalSummary GkAnimalStats::summarise(const std::string &name_id,
+                                                    const std::vector<GkRecords::GkAnimalIndexEntry> &entries,
+                                                    const std::vector<std::uint8_t> &flags)
+{
+    GkRecords::GkAnimalSummary summary = {};
+    summary.name_id = name_id;
+
+    std::deque<std::pair<long int, double>> window;
+    for (std::size_t i = 0; i < entries.size(); ++i) {
+        const long int cutoff = entries[i].date_time - HERPLOG_SUMMARY_WINDOW_SECONDS;
+        while (!window.empty() && (window.front().first < cutoff)) {
+            evict(summary, window.front().first, window.front().second);
+            window.pop_front();
+        }
+
+        fold(summary, entries[i].date_time, entries[i].weight, (i < flags.size()) ? flags[i] : 0);
+        window.emplace_back(entries[i].date_time, entries[i].weight);
+    }
+
+    return summary;
+}
+
+/**
+ * @brief GkAnimalStats::weight_slope gives the slope of the least-squares line through the weights of the animal
+ * within the window, which is to say how quickly the animal has been gaining (or losing) weight of late.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @return The change in weight per day, or zero if there are too few records within the window to tell.
+ */
+double GkAnimalStats::weight_slope(const GkRecords::GkAnimalSummary &summary)
+{
+    if (summary.window_count < 2) {
+        return 0.0;
+    }
+
+    const double n = static_cast<double>(summary.window_count);
+    const double denominator = (n * summary.window_sum_tt) - (summary.window_sum_t * summary.window_sum_t);
+    if (denominator <= 1e-9) {
+        return 0.0; // The records were all logged at (nearly) the same time
+    }
+
+    return ((n * summary.window_sum_tw) - (summary.window_sum_t * summary.window_sum_w)) / denominator;
+}
+
+/**
+ * @brief GkAnimalStats::attention judges whether an animal needs looking after, going by its rolling statistics alone.
+ * A husbandry flag that has never been set only counts once the animal has been logged for longer than the lapse.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param summary The statistics of the animal.
+ * @param now The current Date/Time, as UNIX Epoch Time.
+ * @return The reasons why the animal needs attention, as per `GkRecords::GkAttention`.
+ */
+std::uint8_t GkAnimalStats::attention(const GkRecords::GkAnimalSummary &summary, const long int &now)
+{
+    using namespace GkRecords;
+    std::uint8_t reasons = AttentionNone;
+    if (summary.record_count == 0) {
+        return reasons;
+    }
+
+    if ((now - summary.last_seen) > HERPLOG_ATTENTION_LAPSE_SECONDS) {
+        reasons |= AttentionNotLogged;
+    }
+
+    const auto lapsed = [&summary, &now](const long int &last_set) {
+        return (now - ((last_set != 0) ? last_set : summary.first_seen)) > HERPLOG_ATTENTION_LAPSE_SECONDS;
+    };
+
+    if (lapsed(summary.last_toilet)) {
+        reasons |= AttentionToilet;
+    }
+
+    if (lapsed(summary.last_hydration)) {
+        reasons |= AttentionHydration;
+    }
+
+    if (lapsed(summary.last_vitamins)) {
+        reasons |= AttentionVitamins;
+    }
+
+    const double window_days = static_cast<double>(HERPLOG_SUMMARY_WINDOW_SECONDS) / SECONDS_PER_DAY;
+    if ((summary.window_count >= 3) && (summary.weight_ewma > 0.0) &&
+            ((weight_slope(summary) * window_days) < -(HERPLOG_ATTENTION_WEIGHT_LOSS * summary.weight_ewma))) {
+        reasons |= AttentionWeightLoss;
+    }
+
+    return reasons;
+}
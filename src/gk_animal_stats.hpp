@@ -0,0 +1,67 @@
+/**
+ **  _   _                 _
+ ** | | | |               | |
+ ** | |_| | ___ _ __ _ __ | |     ___   __ _
+ ** |  _  |/ _ \ '__| '_ \| |    / _ \ / _` |
+ ** | | | |  __/ |  | |_) | |___| (_) | (_| |
+ ** \_| |_/\___|_|  | .__/\_____/\___/ \__, |
+ **                 | |                 __/ |
+ **                 |_|                |___/
+ **
+ **   Thank you for using "HerpLog" for your herpetology management requirements!
+ **   Copyright (C) 2017-2018. GekkoFyre.
+ **
+ **
+ **   HerpLog is free software: you can redistribute it and/or modify
+ **   it under the terms of the GNU General Public License as published by
+ **   the Free Software Foundation, either version 3 of the License, or
+ **   (at your option) any later version.
+ **
+ **   HerpLog is distributed in the hope that it will be useful,
+ **   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **   GNU General Public License for more details.
+ **
+ **   You should have received a copy of the GNU General Public License
+ **   along with HerpLog.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ **
+ **   The latest source code updates can be obtained from [ 1 ] below at your
+ **   discretion. A web-browser or the 'git' application may be required.
+ **
+ **   [ 1 ] - https://github.com/GekkoFyre/HerpLog
+ **
+ ********************************************************************************/
+
+/**
+ * @file gk_animal_stats.hpp
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @brief Routines for keeping the rolling statistics of an animal up-to-date one record at a time, and for judging
+ * from them whether the animal needs attention.
+ */
+
+#ifndef GK_ANIMAL_STATS_HPP
+#define GK_ANIMAL_STATS_HPP
+
+#include "options.hpp"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace GekkoFyre {
+namespace GkAnimalStats {
+    void fold(GkRecords::GkAnimalSummary &summary, const long int &date_time, const double &weight,
+              const std::uint8_t &flags);
+    std::vector<GkRecords::GkAlert> score(const GkRecords::GkAnimalSummary &baseline, const std::string &record_id,
+                                          const long int &date_time, const double &weight, const std::uint8_t &flags);
+    void evict(GkRecords::GkAnimalSummary &summary, const long int &date_time, const double &weight);
+    GkRecords::GkAnimalSummary summarise(const std::string &name_id,
+                                         const std::vector<GkRecords::GkAnimalIndexEntry> &entries,
+                                         const std::vector<std::uint8_t> &flags);
+    double weight_slope(const GkRecords::GkAnimalSummary &summary);
+    std::uint8_t attention(const GkRecords::GkAnimalSummary &summary, const long int &now);
+}
+}
+
+#endif // GK_ANIMAL_STATS_HPP
@@ -0,0 +1,360 @@
+/**
+ **  _   _                 _
+ ** | | | |               | |
+ ** | |_| | ___ _ __ _ __ | |     ___   __ _
+ ** |  _  |/ _ \ '__| '_ \| |    / _ \ / _` |
+ ** | | | |  __/ |  | |_) | |___| (_) | (_| |
+ ** \_| |_/\___|_|  | .__/\_____/\___/ \__, |
+ **                 | |                 __/ |
+ **                 |_|                |___/
+ **
+ **   Thank you for using "HerpLog" for your herpetology management requirements!
+ **   Copyright (C) 2017-2018. GekkoFyre.
+ **
+ **
+ **   HerpLog is free software: you can redistribute it and/or modify
+ **   it under the terms of the GNU General Public License as published by
+ **   the Free Software Foundation, either version 3 of the License, or
+ **   (at your option) any later version.
+ **
+ **   HerpLog is distributed in the hope that it will be useful,
+ **   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **   GNU General Public License for more details.
+ **
+ **   You should have received a copy of the GNU General Public License
+ **   along with HerpLog.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ **
+ **   The latest source code updates can be obtained from [ 1 ] below at your
+ **   discretion. A web-browser or the 'git' application may be required.
+ **
+ **   [ 1 ] - https://github.com/GekkoFyre/HerpLog
+ **
+ ********************************************************************************/
+
+/**
+ * @file gk_attachment_store.cpp
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @brief Keeps the photos attached to log entries as files named by the SHA-256 hash of their contents, alongside the
+ * database rather than within it, so that the same photo is only ever kept the once.
+ */
+
+#include "gk_attachment_store.hpp"
+#include "gk_trace.hpp"
+#include <QCryptographicHash>
+#include <QString>
+#include <cctype>
+#include <exception>
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+
+using namespace GekkoFyre;
+
+GkAttachmentStore::GkAttachmentStore(const GkFile::FileDb &database, const fs::path &db_dir,
+                                     const std::shared_ptr<GkStringOp> &gk_str_op, QObject *parent) : QObject(parent)
+{
+    db_conn = database;
+    attachment_dir = db_dir / GkFile::attachment_dir;
+    gkStrOp = gk_str_op;
+}
+
+GkAttachmentStore::~GkAttachmentStore()
+{}
+
+/**
+ * @brief GkAttachmentStore::add_file copies a photo into the store, a chunk at a time so that not even the largest of
+ * photos has to be held in memory, whilst hashing it along the way. The copy only takes on the name of its hash once
+ * it's complete, so that a photo is never seen half-written, and is thrown away instead if the store already has it.
+ * The photo is then kept from being swept for the rest of the session, as the record that refers to it may not have
+ * been submitted as of yet.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param file_path The photo to be added.
+ * @return The SHA-256 hash of the photo, in hexadecimal, which is all that the record itself needs to keep.
+ * @see GkStringOp::encode_attachments()
+ */
+std::string GkAttachmentStore::add_file(const fs::path &file_path)
+{
+    GkTraceSpan span("GkAttachmentStore::add_file", "file");
+    std::ifstream in(file_path.string(), std::ios::in | std::ios::binary);
+    if (!fs::is_regular_file(file_path) || !in.is_open()) {
+        throw std::runtime_error(tr("Unable to open the photo, \"%1\", for attaching!")
+                                 .arg(QString::fromStdString(file_path.string())).toStdString());
+    }
+
+    fs::create_directories(attachment_dir);
+    const std::string incoming_name = std::string(GkFile::attachment_incoming) + gkStrOp->random_hash();
+    const fs::path incoming_path = attachment_dir / incoming_name;
+    {
+        std::lock_guard<std::mutex> locker(store_mutex);
+        incoming.insert(incoming_name);
+    }
+
+    try {
+        QCryptographicHash hasher(QCryptographicHash::Sha256);
+        {
+            std::ofstream out(incoming_path.string(), std::ios::out | std::ios::binary | std::ios::trunc);
+            std::vector<char> chunk(HERPLOG_ATTACHMENT_CHUNK_BYTES);
+            while (in && out) {
+                in.read(chunk.data(), static_cast<std::streamsize>(chunk.size()));
+                const std::streamsize bytes_read = in.gcount();
+                if (bytes_read <= 0) {
+                    break;
+                }
+
+                hasher.addData(chunk.data(), static_cast<int>(bytes_read));
+                out.write(chunk.data(), bytes_read);
+            }
+
+            out.flush();
+            if (in.bad() || !out) {
+                throw std::runtime_error(tr("Unable to copy the photo, \"%1\", into the database's attachments!")
+                                         .arg(QString::fromStdString(file_path.string())).toStdString());
+            }
+        }
+
+        const std::string hash = hasher.result().toHex().toStdString();
+        const fs::path dest_path = blob_path(hash);
+
+        std::lock_guard<std::mutex> locker(store_mutex);
+        if (fs::exists(dest_path)) {
+            fs::remove(incoming_path); // The very same photo has been attached before
+        } else {
+            fs::rename(incoming_path, dest_path);
+        }
+
+        incoming.erase(incoming_name);
+        pinned.insert(hash);
+        return hash;
+    } catch (...) {
+        boost::system::error_code ec;
+        fs::remove(incoming_path, ec);
+
+        std::lock_guard<std::mutex> locker(store_mutex);
+        incoming.erase(incoming_name);
+        throw;
+    }
+}
+
+/**
+ * @brief GkAttachmentStore::blob_path works out where a photo lives on the disk, whether or not it's there.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param hash The SHA-256 hash of the photo, in hexadecimal.
+ * @return The path to the photo.
+ */
+fs::path GkAttachmentStore::blob_path(const std::string &hash) const
+{
+    if (!valid_hash(hash)) {
+        throw std::invalid_argument(tr("\"%1\" is not the hash of an attachment!")
+                                    .arg(QString::fromStdString(hash)).toStdString());
+    }
+
+    return attachment_dir / hash;
+}
+
+/**
+ * @brief GkAttachmentStore::contains checks whether a photo is within the store, as a record that was merged in from
+ * elsewhere may well refer to a photo that was never copied across.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param hash The SHA-256 hash of the photo, in hexadecimal.
+ * @return Whether the photo is there or not.
+ */
+bool GkAttachmentStore::contains(const std::string &hash) const
+{
+    boost::system::error_code ec;
+    return valid_hash(hash) && fs::is_regular_file(attachment_dir / hash, ec);
+}
+
+/**
+ * @brief GkAttachmentStore::export_file copies a photo back out of the store, a chunk at a time, and checks it against
+ * its hash along the way. As the name of a photo is its hash, this is all that's needed to tell whether it's damaged.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param hash The SHA-256 hash of the photo, in hexadecimal.
+ * @param dest_path Where to copy the photo to, whereby anything already there is overwritten.
+ */
+void GkAttachmentStore::export_file(const std::string &hash, const fs::path &dest_path)
+{
+    GkTraceSpan span("GkAttachmentStore::export_file", "file");
+    std::ifstream in(blob_path(hash).string(), std::ios::in | std::ios::binary);
+    if (!in.is_open()) {
+        throw std::runtime_error(tr("The photo, \"%1\", is missing from the database's attachments!")
+                                 .arg(QString::fromStdString(hash)).toStdString());
+    }
+
+    QCryptographicHash hasher(QCryptographicHash::Sha256);
+    bool copied = false;
+    {
+        std::ofstream out(dest_path.string(), std::ios::out | std::ios::binary | std::ios::trunc);
+        std::vector<char> chunk(HERPLOG_ATTACHMENT_CHUNK_BYTES);
+        while (in && out) {
+            in.read(chunk.data(), static_cast<std::streamsize>(chunk.size()));
+            const std::streamsize bytes_read = in.gcount();
+            if (bytes_read <= 0) {
+                break;
+            }
+
+            hasher.addData(chunk.data(), static_cast<int>(bytes_read));
+            out.write(chunk.data(), bytes_read);
+        }
+
+        out.flush();
+        copied = (!in.bad() && out);
+    }
+
+    if (!copied || (hasher.result().toHex().toStdString() != hash)) {
+        boost::system::error_code ec;
+        fs::remove(dest_path, ec);
+        throw std::runtime_error(copied ? tr("The photo, \"%1\", is damaged!").arg(QString::fromStdString(hash)).toStdString() :
+                                          tr("Unable to copy the photo, \"%1\", to \"%2\"!").arg(QString::fromStdString(hash))
+                                          .arg(QString::fromStdString(dest_path.string())).toStdString());
+    }
+
+    return;
+}
+
+/**
+ * @brief GkAttachmentStore::ref_count looks up how many records refer to a photo.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param hash The SHA-256 hash of the photo, in hexadecimal.
+ * @return The amount of records, or zero if there are none.
+ * @see GkDbWrite::fold_attachment_refs()
+ */
+std::uint64_t GkAttachmentStore::ref_count(const std::string &hash)
+{
+    std::string value;
+    leveldb::Status s = db_conn.db->Get(leveldb::ReadOptions(), gkStrOp->attachment_ref_key(hash), &value);
+    if (!s.ok() && !s.IsNotFound()) {
+        throw std::runtime_error(s.ToString());
+    }
+
+    return gkStrOp->decode_u64(value);
+}
+
+/**
+ * @brief GkAttachmentStore::copy_from copies across whichever photos another store has that this one lacks, such as
+ * after its records have been merged in. As a photo is named after its hash, one that's already here needn't be looked
+ * at any further, and the photos are copied as they are, without ever being read in whole.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param source The store to copy the photos from.
+ * @return How many of the photos were copied.
+ * @see GkDbMerge
+ */
+std::size_t GkAttachmentStore::copy_from(const GkAttachmentStore &source)
+{
+    GkTraceSpan span("GkAttachmentStore::copy_from", "file");
+    boost::system::error_code ec;
+    if (!fs::is_directory(source.attachment_dir, ec)) {
+        return 0;
+    }
+
+    std::lock_guard<std::mutex> locker(store_mutex);
+    fs::create_directories(attachment_dir);
+
+    std::size_t copied = 0;
+    for (fs::directory_iterator it(source.attachment_dir), end; it != end; ++it) {
+        const std::string hash = it->path().filename().string();
+        if (!valid_hash(hash) || fs::exists(attachment_dir / hash)) {
+            continue;
+        }
+
+        // Just as with GkAttachmentStore::add_file(), the photo only takes on its name once it's been copied in whole
+        const fs::path incoming_path = attachment_dir / (std::string(GkFile::attachment_incoming) + gkStrOp->random_hash());
+        try {
+            fs::copy_file(it->path(), incoming_path, fs::copy_option::overwrite_if_exists);
+            fs::rename(incoming_path, attachment_dir / hash);
+            ++copied;
+        } catch (...) {
+            fs::remove(incoming_path, ec);
+            throw;
+        }
+    }
+
+    return copied;
+}
+
+/**
+ * @brief GkAttachmentStore::sweep removes the photos that no record refers to any longer, along with whatever was left
+ * behind by a copy that never finished, so that they aren't carried along into the archive every time it's saved.
+ * Photos that were added during this session are left be, as are files that don't belong to the store.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @return How many of the photos were removed.
+ */
+std::size_t GkAttachmentStore::sweep()
+{
+    GkTraceSpan span("GkAttachmentStore::sweep", "file");
+    std::lock_guard<std::mutex> locker(store_mutex);
+
+    boost::system::error_code ec;
+    if (!fs::is_directory(attachment_dir, ec)) {
+        return 0;
+    }
+
+    const std::string ref_prefix(GkRecords::LEVELDB_INDEX_ATTACHMENT_REF);
+    std::set<std::string> referenced;
+    {
+        leveldb::ReadOptions read_opt;
+        read_opt.fill_cache = false;
+        std::unique_ptr<leveldb::Iterator> it(db_conn.db->NewIterator(read_opt));
+        for (it->Seek(ref_prefix); it->Valid() && it->key().starts_with(ref_prefix); it->Next()) {
+            referenced.insert(it->key().ToString().substr(ref_prefix.size()));
+        }
+
+        if (!it->status().ok()) {
+            throw std::runtime_error(it->status().ToString());
+        }
+    }
+
+    const std::string incoming_prefix(GkFile::attachment_incoming);
+    std::vector<fs::path> unused;
+    std::size_t removed = 0;
+    for (fs::directory_iterator it(attachment_dir), end; it != end; ++it) {
+        const std::string name = it->path().filename().string();
+        if (name.compare(0, incoming_prefix.size(), incoming_prefix) == 0) {
+            if (incoming.find(name) == incoming.end()) {
+                unused.push_back(it->path());
+            }
+        } else if (valid_hash(name) && (referenced.find(name) == referenced.end()) &&
+                   (pinned.find(name) == pinned.end())) {
+            unused.push_back(it->path());
+            ++removed;
+        }
+    }
+
+    for (const auto &path: unused) {
+        fs::remove(path, ec);
+    }
+
+    return removed;
+}
+
+/**
+ * @brief GkAttachmentStore::valid_hash checks whether a string is a SHA-256 hash, as written out by the store, which
+ * also keeps a damaged record from ever pointing outside of the store.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param hash The string in question.
+ * @return Whether it's sixty-four lowercase hexadecimal digits.
+ */
+bool GkAttachmentStore::valid_hash(const std::string &hash)
+{
+    if (hash.size() != 64) {
+        return false;
+    }
+
+    for (const char &c: hash) {
+        if (!std::isdigit(static_cast<unsigned char>(c)) && ((c < 'a') || (c > 'f'))) {
+            return false;
+        }
+    }
+
+    return true;
+}
@@ -0,0 +1,90 @@
+/**
+ **  _   _                 _
+ ** | | | |               | |
+ ** | |_| | ___ _ __ _ __ | |     ___   __ _
+ ** |  _  |/ _ \ '__| '_ \| |    / _ \ / _` |
+ ** | | | |  __/ |  | |_) | |___| (_) | (_| |
+ ** \_| |_/\___|_|  | .__/\_____/\___/ \__, |
+ **                 | |                 __/ |
+ **                 |_|                |___/
+ **
+ **   Thank you for using "HerpLog" for your herpetology management requirements!
+ **   Copyright (C) 2017-2018. GekkoFyre.
+ **
+ **
+ **   HerpLog is free software: you can redistribute it and/or modify
+ **   it under the terms of the GNU General Public License as published by
+ **   the Free Software Foundation, either version 3 of the License, or
+ **   (at your option) any later version.
+ **
+ **   HerpLog is distributed in the hope that it will be useful,
+ **   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **   GNU General Public License for more details.
+ **
+ **   You should have received a copy of the GNU General Public License
+ **   along with HerpLog.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ **
+ **   The latest source code updates can be obtained from [ 1 ] below at your
+ **   discretion. A web-browser or the 'git' application may be required.
+ **
+ **   [ 1 ] - https://github.com/GekkoFyre/HerpLog
+ **
+ ********************************************************************************/
+
+/**
+ * @file gk_attachment_store.hpp
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @brief Keeps the photos attached to log entries as files named by the SHA-256 hash of their contents, alongside the
+ * database rather than within it, so that the same photo is only ever kept the once.
+ */
+
+#ifndef GK_ATTACHMENT_STORE_HPP
+#define GK_ATTACHMENT_STORE_HPP
+
+#include "options.hpp"
+#include "gk_string_op.hpp"
+#include <boost/filesystem.hpp>
+#include <leveldb/db.h>
+#include <QtCore/QObject>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+
+namespace GekkoFyre {
+class GkAttachmentStore;
+
+class GkAttachmentStore : public QObject {
+    Q_OBJECT
+
+public:
+    explicit GkAttachmentStore(const GkFile::FileDb &database, const fs::path &db_dir,
+                               const std::shared_ptr<GkStringOp> &gk_str_op, QObject *parent = nullptr);
+    ~GkAttachmentStore();
+
+    std::string add_file(const fs::path &file_path);
+    fs::path blob_path(const std::string &hash) const;
+    bool contains(const std::string &hash) const;
+    void export_file(const std::string &hash, const fs::path &dest_path);
+    std::uint64_t ref_count(const std::string &hash);
+    std::size_t copy_from(const GkAttachmentStore &source);
+    std::size_t sweep();
+
+    static bool valid_hash(const std::string &hash);
+
+private:
+    GkFile::FileDb db_conn;
+    fs::path attachment_dir;
+    std::shared_ptr<GkStringOp> gkStrOp;
+
+    std::mutex store_mutex;
+    std::set<std::string> pinned;   // Photos added during this session, which may not have been submitted as of yet
+    std::set<std::string> incoming; // Copies that are still underway, and so mustn't be swept
+};
+}
+
+#endif // GK_ATTACHMENT_STORE_HPP
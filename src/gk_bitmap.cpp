@@ -0,0 +1,633 @@
+/**
+ **  _   _                 _
+ ** | | | |               | |
+ ** | |_| | ___ _ __ _ __ | |     ___   __ _
+ ** |  _  |/ _ \ '__| '_ \| |    / _ \ / _` |
+ ** | | | |  __/ |  | |_) | |___| (_) | (_| |
+ ** \_| |_/\___|_|  | .__/\_____/\___/ \__, |
+ **                 | |                 __/ |
+ **                 |_|                |___/
+ **
+ **   Thank you for using "HerpLog" for your herpetology management requirements!
+ **   Copyright (C) 2017-2018. GekkoFyre.
+ **
+ **
+ **   HerpLog is free software: you can redistribute it and/or modify
+ **   it under the terms of the GNU General Public License as published by
+ **   the Free Software Foundation, either version 3 of the License, or
+ **   (at your option) any later version.
+ **
+ **   HerpLog is distributed in the hope that it will be useful,
+ **   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **   GNU General Public License for more details.
+ **
+ **   You should have received a copy of the GNU General Public License
+ **   along with HerpLog.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ **
+ **   The latest source code updates can be obtained from [ 1 ] below at your
+ **   discretion. A web-browser or the 'git' application may be required.
+ **
+ **   [ 1 ] - https://github.com/GekkoFyre/HerpLog
+ **
+ ********************************************************************************/
+
+/**
+ * @file gk_bitmap.cpp
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @brief A compressed bitmap of 32-bit integers, laid out in the manner of a Roaring bitmap, whereby each run of 65,536
+ * values is held as either a sorted array or a plain bitset, whichever is the smaller.
+ */
+
+#include "gk_bitmap.hpp"
+#include <algorithm>
+#include <iterator>
+
+using namespace GekkoFyre;
+
+namespace {
+constexpr std::size_t BITSET_WORDS = 65536 / 64;
+}
+
+GkBitmap::GkBitmap()
+{}
+
+GkBitmap::~GkBitmap()
+{}
+
+/**
+ * @brief GkBitmap::range creates a bitmap of every value from `first` up to, but not including, `last`, such as the
+ * ordinals of the records that fall within a range of dates.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ */
+GkBitmap GkBitmap::range(const std::uint32_t &first, const std::uint32_t &last)
+{
+    GkBitmap bitmap;
+    std::uint64_t value = first;
+    while (value < last) {
+        const std::uint64_t container_end = std::min<std::uint64_t>(((value >> 16) + 1) << 16, last);
+        GkContainer container;
+        container.key = static_cast<std::uint16_t>(value >> 16);
+        container.cardinality = static_cast<std::uint32_t>(container_end - value);
+        container.bits.assign(BITSET_WORDS, 0);
+        for (std::uint64_t low = value & 0xFFFF; low < (value & 0xFFFF) + container.cardinality; ++low) {
+            if (((low & 63) == 0) && (low + 64 <= (value & 0xFFFF) + container.cardinality)) {
+                container.bits[low >> 6] = ~0ULL; // A whole word at a time, where possible
+                low += 63;
+                continue;
+            }
+
+            container.bits[low >> 6] |= (1ULL << (low & 63));
+        }
+
+        normalise(container);
+        bitmap.containers.push_back(std::move(container));
+        value = container_end;
+    }
+
+    return bitmap;
+}
+
+void GkBitmap::add(const std::uint32_t &value)
+{
+    const std::uint16_t key = static_cast<std::uint16_t>(value >> 16);
+    const std::uint16_t low = static_cast<std::uint16_t>(value & 0xFFFF);
+    auto it = find_container(key);
+    if ((it == containers.end()) || (it->key != key)) {
+        GkContainer container;
+        container.key = key;
+        container.cardinality = 0;
+        it = containers.insert(it, std::move(container));
+    }
+
+    if (it->is_bitset()) {
+        std::uint64_t &word = it->bits[low >> 6];
+        const std::uint64_t mask = 1ULL << (low & 63);
+        if ((word & mask) == 0) {
+            word |= mask;
+            ++it->cardinality;
+        }
+
+        return;
+    }
+
+    auto pos = std::lower_bound(it->array.begin(), it->array.end(), low);
+    if ((pos == it->array.end()) || (*pos != low)) {
+        it->array.insert(pos, low);
+        ++it->cardinality;
+        normalise(*it);
+    }
+
+    return;
+}
+
+void GkBitmap::remove(const std::uint32_t &value)
+{
+    const std::uint16_t key = static_cast<std::uint16_t>(value >> 16);
+    const std::uint16_t low = static_cast<std::uint16_t>(value & 0xFFFF);
+    auto it = find_container(key);
+    if ((it == containers.end()) || (it->key != key)) {
+        return;
+    }
+
+    if (it->is_bitset()) {
+        std::uint64_t &word = it->bits[low >> 6];
+        const std::uint64_t mask = 1ULL << (low & 63);
+        if ((word & mask) != 0) {
+            word &= ~mask;
+            --it->cardinality;
+        }
+    } else {
+        auto pos = std::lower_bound(it->array.begin(), it->array.end(), low);
+        if ((pos != it->array.end()) && (*pos == low)) {
+            it->array.erase(pos);
+            --it->cardinality;
+        }
+    }
+
+    if (it->cardinality == 0) {
+        containers.erase(it);
+    } else {
+        normalise(*it);
+    }
+
+    return;
+}
+
+bool GkBitmap::contains(const std::uint32_t &value) const
+{
+    const std::uint16_t key = static_cast<std::uint16_t>(value >> 16);
+    const std::uint16_t low = static_cast<std::uint16_t>(value & 0xFFFF);
+    auto it = find_container(key);
+    if ((it == containers.end()) || (it->key != key)) {
+        return false;
+    }
+
+    if (it->is_bitset()) {
+        return (it->bits[low >> 6] & (1ULL << (low & 63))) != 0;
+    }
+
+    return std::binary_search(it->array.begin(), it->array.end(), low);
+}
+
+std::uint64_t GkBitmap::cardinality() const
+{
+    std::uint64_t count = 0;
+    for (const auto &container: containers) {
+        count += container.cardinality;
+    }
+
+    return count;
+}
+
+bool GkBitmap::empty() const
+{
+    return containers.empty();
+}
+
+/**
+ * @brief GkBitmap::minimum finds the smallest value within the bitmap, which must not be empty.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ */
+std::uint32_t GkBitmap::minimum() const
+{
+    const GkContainer &container = containers.front();
+    const std::uint32_t high = static_cast<std::uint32_t>(container.key) << 16;
+    if (!container.is_bitset()) {
+        return high | container.array.front();
+    }
+
+    for (std::size_t word = 0; word < container.bits.size(); ++word) {
+        const std::uint64_t bits = container.bits[word];
+        if (bits != 0) {
+            return high | static_cast<std::uint32_t>((word << 6) + popcount((bits & (~bits + 1)) - 1));
+        }
+    }
+
+    return high;
+}
+
+/**
+ * @brief GkBitmap::maximum finds the largest value within the bitmap, which must not be empty.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ */
+std::uint32_t GkBitmap::maximum() const
+{
+    const GkContainer &container = containers.back();
+    const std::uint32_t high = static_cast<std::uint32_t>(container.key) << 16;
+    if (!container.is_bitset()) {
+        return high | container.array.back();
+    }
+
+    for (std::size_t word = container.bits.size(); word-- > 0;) {
+        std::uint64_t bits = container.bits[word];
+        if (bits != 0) {
+            std::uint32_t top = 63;
+            while ((bits & (1ULL << top)) == 0) {
+                --top;
+            }
+
+            return high | static_cast<std::uint32_t>((word << 6) + top);
+        }
+    }
+
+    return high;
+}
+
+/**
+ * @brief GkBitmap::memory_bytes works out roughly how much memory the values of the bitmap take up, for diagnostics.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ */
+std::size_t GkBitmap::memory_bytes() const
+{
+    std::size_t bytes = containers.capacity() * sizeof(GkContainer);
+    for (const auto &container: containers) {
+        bytes += (container.array.capacity() * sizeof(std::uint16_t)) + (container.bits.capacity() * sizeof(std::uint64_t));
+    }
+
+    return bytes;
+}
+
+/**
+ * @brief GkBitmap::serialise lays the bitmap out as a string, for keeping within the database. Each container is written
+ * as its key and cardinality, followed by either its array or its bitset (going by the cardinality), all big-endian.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @see GkBitmap::deserialise()
+ */
+std::string GkBitmap::serialise() const
+{
+    std::string out;
+    for (const auto &container: containers) {
+        out.push_back(static_cast<char>(container.key >> 8));
+        out.push_back(static_cast<char>(container.key & 0xFF));
+        for (int shift = 24; shift >= 0; shift -= 8) {
+            out.push_back(static_cast<char>((container.cardinality >> shift) & 0xFF));
+        }
+
+        if (container.is_bitset()) {
+            for (const auto &word: container.bits) {
+                for (int shift = 56; shift >= 0; shift -= 8) {
+                    out.push_back(static_cast<char>((word >> shift) & 0xFF));
+                }
+            }
+        } else {
+            for (const auto &low: container.array) {
+                out.push_back(static_cast<char>(low >> 8));
+                out.push_back(static_cast<char>(low & 0xFF));
+            }
+        }
+    }
+
+    return out;
+}
+
+/**
+ * @brief GkBitmap::deserialise does the opposite of GkBitmap::serialise().
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param value The bitmap, as it was kept within the database.
+ * @param bitmap The decoded bitmap, which is left untouched if `value` turns out to be damaged.
+ * @return Whether `value` made for a valid bitmap or not.
+ */
+bool GkBitmap::deserialise(const std::string &value, GkBitmap &bitmap)
+{
+    const auto get = [&value](std::size_t &pos, const std::size_t &bytes) {
+        std::uint64_t result = 0;
+        for (std::size_t i = 0; i < bytes; ++i) {
+            result = (result << 8) | static_cast<unsigned char>(value[pos++]);
+        }
+
+        return result;
+    };
+
+    GkBitmap decoded;
+    std::size_t pos = 0;
+    while (pos < value.size()) {
+        if ((value.size() - pos) < 6) {
+            return false;
+        }
+
+        GkContainer container;
+        container.key = static_cast<std::uint16_t>(get(pos, 2));
+        container.cardinality = static_cast<std::uint32_t>(get(pos, 4));
+        if ((container.cardinality == 0) || (container.cardinality > 65536) ||
+                (!decoded.containers.empty() && (decoded.containers.back().key >= container.key))) {
+            return false;
+        }
+
+        if (container.cardinality > HERPLOG_BITMAP_ARRAY_MAX) {
+            if ((value.size() - pos) < (BITSET_WORDS * 8)) {
+                return false;
+            }
+
+            std::uint32_t count = 0;
+            container.bits.resize(BITSET_WORDS);
+            for (auto &word: container.bits) {
+                word = get(pos, 8);
+                count += popcount(word);
+            }
+
+            if (count != container.cardinality) {
+                return false;
+            }
+        } else {
+            if (((value.size() - pos) / 2) < container.cardinality) {
+                return false;
+            }
+
+            container.array.reserve(container.cardinality);
+            for (std::uint32_t i = 0; i < container.cardinality; ++i) {
+                const std::uint16_t low = static_cast<std::uint16_t>(get(pos, 2));
+                if (!container.array.empty() && (container.array.back() >= low)) {
+                    return false; // The values must be strictly ascending
+                }
+
+                container.array.push_back(low);
+            }
+        }
+
+        decoded.containers.push_back(std::move(container));
+    }
+
+    bitmap = std::move(decoded);
+    return true;
+}
+
+/**
+ * @brief GkBitmap::operator& keeps only the values that are within both bitmaps, such as the records of an animal that
+ * also had their vitamins.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ */
+GkBitmap GkBitmap::operator&(const GkBitmap &other) const
+{
+    GkBitmap output;
+    auto lhs = containers.begin();
+    auto rhs = other.containers.begin();
+    while ((lhs != containers.end()) && (rhs != other.containers.end())) {
+        if (lhs->key < rhs->key) {
+            ++lhs;
+        } else if (rhs->key < lhs->key) {
+            ++rhs;
+        } else {
+            GkContainer container = intersect(*lhs, *rhs);
+            if (container.cardinality > 0) {
+                output.containers.push_back(std::move(container));
+            }
+
+            ++lhs;
+            ++rhs;
+        }
+    }
+
+    return output;
+}
+
+/**
+ * @brief GkBitmap::operator| keeps the values that are within either bitmap.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ */
+GkBitmap GkBitmap::operator|(const GkBitmap &other) const
+{
+    GkBitmap output;
+    auto lhs = containers.begin();
+    auto rhs = other.containers.begin();
+    while ((lhs != containers.end()) || (rhs != other.containers.end())) {
+        if ((rhs == other.containers.end()) || ((lhs != containers.end()) && (lhs->key < rhs->key))) {
+            output.containers.push_back(*lhs++);
+        } else if ((lhs == containers.end()) || (rhs->key < lhs->key)) {
+            output.containers.push_back(*rhs++);
+        } else {
+            output.containers.push_back(unite(*lhs++, *rhs++));
+        }
+    }
+
+    return output;
+}
+
+/**
+ * @brief GkBitmap::and_not keeps the values of this bitmap that aren't within the other, such as the records of an
+ * animal that did *not* have any hydration.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ */
+GkBitmap GkBitmap::and_not(const GkBitmap &other) const
+{
+    GkBitmap output;
+    auto rhs = other.containers.begin();
+    for (const auto &lhs: containers) {
+        while ((rhs != other.containers.end()) && (rhs->key < lhs.key)) {
+            ++rhs;
+        }
+
+        if ((rhs == other.containers.end()) || (rhs->key != lhs.key)) {
+            output.containers.push_back(lhs);
+            continue;
+        }
+
+        GkContainer container = subtract(lhs, *rhs);
+        if (container.cardinality > 0) {
+            output.containers.push_back(std::move(container));
+        }
+    }
+
+    return output;
+}
+
+std::vector<std::uint32_t> GkBitmap::values() const
+{
+    std::vector<std::uint32_t> output;
+    output.reserve(static_cast<std::size_t>(cardinality()));
+    for_each([&output](const std::uint32_t &value) { output.push_back(value); });
+    return output;
+}
+
+std::vector<GkBitmap::GkContainer>::iterator GkBitmap::find_container(const std::uint16_t &key)
+{
+    return std::lower_bound(containers.begin(), containers.end(), key, [](const GkContainer &lhs, const std::uint16_t &rhs) {
+        return lhs.key < rhs;
+    });
+}
+
+std::vector<GkBitmap::GkContainer>::const_iterator GkBitmap::find_container(const std::uint16_t &key) const
+{
+    return std::lower_bound(containers.begin(), containers.end(), key, [](const GkContainer &lhs, const std::uint16_t &rhs) {
+        return lhs.key < rhs;
+    });
+}
+
+void GkBitmap::to_bitset(GkContainer &container)
+{
+    container.bits.assign(BITSET_WORDS, 0);
+    for (const auto &low: container.array) {
+        container.bits[low >> 6] |= (1ULL << (low & 63));
+    }
+
+    std::vector<std::uint16_t>().swap(container.array);
+    return;
+}
+
+void GkBitmap::to_array(GkContainer &container)
+{
+    container.array.clear();
+    container.array.reserve(container.cardinality);
+    for (std::size_t word = 0; word < container.bits.size(); ++word) {
+        std::uint64_t bits = container.bits[word];
+        while (bits != 0) {
+            const std::uint64_t lowest = bits & (~bits + 1);
+            container.array.push_back(static_cast<std::uint16_t>((word << 6) + popcount(lowest - 1)));
+            bits ^= lowest;
+        }
+    }
+
+    std::vector<std::uint64_t>().swap(container.bits);
+    return;
+}
+
+/**
+ * @brief GkBitmap::normalise switches a container over to whichever layout is the smaller for its cardinality, being a
+ * sorted array for up to `HERPLOG_BITMAP_ARRAY_MAX` values and a bitset beyond that.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ */
+void GkBitmap::normalise(GkContainer &container)
+{
+    if (container.is_bitset() && (container.cardinality <= HERPLOG_BITMAP_ARRAY_MAX)) {
+        to_array(container);
+    } else if (!container.is_bitset() && (container.cardinality > HERPLOG_BITMAP_ARRAY_MAX)) {
+        to_bitset(container);
+    }
+
+    return;
+}
+
+GkBitmap::GkContainer GkBitmap::intersect(const GkContainer &lhs, const GkContainer &rhs)
+{
+    GkContainer output;
+    output.key = lhs.key;
+    output.cardinality = 0;
+    if (lhs.is_bitset() && rhs.is_bitset()) {
+        output.bits.resize(BITSET_WORDS);
+        for (std::size_t word = 0; word < BITSET_WORDS; ++word) {
+            output.bits[word] = lhs.bits[word] & rhs.bits[word];
+            output.cardinality += popcount(output.bits[word]);
+        }
+
+        normalise(output);
+    } else if (lhs.is_bitset() || rhs.is_bitset()) {
+        const GkContainer &array = lhs.is_bitset() ? rhs : lhs;
+        const GkContainer &bitset = lhs.is_bitset() ? lhs : rhs;
+        for (const auto &low: array.array) {
+            if ((bitset.bits[low >> 6] & (1ULL << (low & 63))) != 0) {
+                output.array.push_back(low);
+            }
+        }
+
+        output.cardinality = static_cast<std::uint32_t>(output.array.size());
+    } else {
+        std::set_intersection(lhs.array.begin(), lhs.array.end(), rhs.array.begin(), rhs.array.end(),
+                              std::back_inserter(output.array));
+        output.cardinality = static_cast<std::uint32_t>(output.array.size());
+    }
+
+    return output;
+}
+
+GkBitmap::GkContainer GkBitmap::unite(const GkContainer &lhs, const GkContainer &rhs)
+{
+    GkContainer output;
+    output.key = lhs.key;
+    output.cardinality = 0;
+    if (!lhs.is_bitset() && !rhs.is_bitset()) {
+        std::set_union(lhs.array.begin(), lhs.array.end(), rhs.array.begin(), rhs.array.end(),
+                       std::back_inserter(output.array));
+        output.cardinality = static_cast<std::uint32_t>(output.array.size());
+        normalise(output);
+        return output;
+    }
+
+    output.bits.assign(BITSET_WORDS, 0);
+    for (const GkContainer *input: { &lhs, &rhs }) {
+        if (input->is_bitset()) {
+            for (std::size_t word = 0; word < BITSET_WORDS; ++word) {
+                output.bits[word] |= input->bits[word];
+            }
+        } else {
+            for (const auto &low: input->array) {
+                output.bits[low >> 6] |= (1ULL << (low & 63));
+            }
+        }
+    }
+
+    for (const auto &word: output.bits) {
+        output.cardinality += popcount(word);
+    }
+
+    return output;
+}
+
+GkBitmap::GkContainer GkBitmap::subtract(const GkContainer &lhs, const GkContainer &rhs)
+{
+    GkContainer output;
+    output.key = lhs.key;
+    output.cardinality = 0;
+    if (!lhs.is_bitset()) {
+        for (const auto &low: lhs.array) {
+            const bool in_rhs = rhs.is_bitset() ? ((rhs.bits[low >> 6] & (1ULL << (low & 63))) != 0) :
+                                                  std::binary_search(rhs.array.begin(), rhs.array.end(), low);
+            if (!in_rhs) {
+                output.array.push_back(low);
+            }
+        }
+
+        output.cardinality = static_cast<std::uint32_t>(output.array.size());
+        return output;
+    }
+
+    output.bits = lhs.bits;
+    if (rhs.is_bitset()) {
+        for (std::size_t word = 0; word < BITSET_WORDS; ++word) {
+            output.bits[word] &= ~rhs.bits[word];
+        }
+    } else {
+        for (const auto &low: rhs.array) {
+            output.bits[low >> 6] &= ~(1ULL << (low & 63));
+        }
+    }
+
+    for (const auto &word: output.bits) {
+        output.cardinality += popcount(word);
+    }
+
+    normalise(output);
+    return output;
+}
+
+/**
+ * @brief GkBitmap::popcount counts the bits that are set, which modern compilers turn into a single instruction where
+ * the processor has one.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ */
+std::uint32_t GkBitmap::popcount(std::uint64_t bits)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<std::uint32_t>(__builtin_popcountll(bits));
+#else
+    std::uint32_t count = 0;
+    while (bits != 0) {
+        bits &= bits - 1;
+        ++count;
+    }
+
+    return count;
+#endif
+}
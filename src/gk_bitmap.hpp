@@ -0,0 +1,133 @@
+/**
+ **  _   _                 _
+ ** | | | |               | |
+ ** | |_| | ___ _ __ _ __ | |     ___   __ _
+ ** |  _  |/ _ \ '__| '_ \| |    / _ \ / _` |
+ ** | | | |  __/ |  | |_) | |___| (_) | (_| |
+ ** \_| |_/\___|_|  | .__/\_____/\___/ \__, |
+ **                 | |                 __/ |
+ **                 |_|                |___/
+ **
+ **   Thank you for using "HerpLog" for your herpetology management requirements!
+ **   Copyright (C) 2017-2018. GekkoFyre.
+ **
+ **
+ **   HerpLog is free software: you can redistribute it and/or modify
+ **   it under the terms of the GNU General Public License as published by
+ **   the Free Software Foundation, either version 3 of the License, or
+ **   (at your option) any later version.
+ **
+ **   HerpLog is distributed in the hope that it will be useful,
+ **   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **   GNU General Public License for more details.
+ **
+ **   You should have received a copy of the GNU General Public License
+ **   along with HerpLog.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ **
+ **   The latest source code updates can be obtained from [ 1 ] below at your
+ **   discretion. A web-browser or the 'git' application may be required.
+ **
+ **   [ 1 ] - https://github.com/GekkoFyre/HerpLog
+ **
+ ********************************************************************************/
+
+/**
+ * @file gk_bitmap.hpp
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @brief A compressed bitmap of 32-bit integers, laid out in the manner of a Roaring bitmap, whereby each run of 65,536
+ * values is held as either a sorted array or a plain bitset, whichever is the smaller.
+ */
+
+#ifndef GK_BITMAP_HPP
+#define GK_BITMAP_HPP
+
+#include "options.hpp"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace GekkoFyre {
+class GkBitmap;
+
+class GkBitmap {
+
+public:
+    GkBitmap();
+    ~GkBitmap();
+
+    static GkBitmap range(const std::uint32_t &first, const std::uint32_t &last);
+
+    void add(const std::uint32_t &value);
+    void remove(const std::uint32_t &value);
+    bool contains(const std::uint32_t &value) const;
+    std::uint64_t cardinality() const;
+    bool empty() const;
+    std::uint32_t minimum() const;
+    std::uint32_t maximum() const;
+    std::size_t memory_bytes() const;
+    std::string serialise() const;
+    static bool deserialise(const std::string &value, GkBitmap &bitmap);
+
+    GkBitmap operator&(const GkBitmap &other) const;
+    GkBitmap operator|(const GkBitmap &other) const;
+    GkBitmap and_not(const GkBitmap &other) const;
+    std::vector<std::uint32_t> values() const;
+
+    /**
+     * @brief GkBitmap::for_each hands every value within the bitmap over to `func`, in ascending order.
+     * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+     * @date 2026-10-18
+     */
+    template<typename Func>
+    void for_each(Func func) const
+    {
+        for (const auto &container: containers) {
+            const std::uint32_t high = static_cast<std::uint32_t>(container.key) << 16;
+            if (!container.is_bitset()) {
+                for (const auto &low: container.array) {
+                    func(high | low);
+                }
+
+                continue;
+            }
+
+            for (std::size_t word = 0; word < container.bits.size(); ++word) {
+                std::uint64_t bits = container.bits[word];
+                while (bits != 0) {
+                    const std::uint64_t lowest = bits & (~bits + 1);
+                    func(high | static_cast<std::uint32_t>((word << 6) + popcount(lowest - 1)));
+                    bits ^= lowest;
+                }
+            }
+        }
+    }
+
+private:
+    // The values of the bitmap that share their upper 16-bits, held as whichever of the two layouts is smaller
+    struct GkContainer {
+        std::uint16_t key;                  // The upper 16-bits, shared by every value within the container
+        std::vector<std::uint16_t> array;   // The lower 16-bits of each value, in ascending order, unless it's a bitset
+        std::vector<std::uint64_t> bits;    // 65,536 bits, or empty if the container is an array
+        std::uint32_t cardinality;          // How many values the container holds
+
+        bool is_bitset() const { return !bits.empty(); }
+    };
+
+    std::vector<GkContainer> containers; // Sorted by their key
+
+    std::vector<GkContainer>::iterator find_container(const std::uint16_t &key);
+    std::vector<GkContainer>::const_iterator find_container(const std::uint16_t &key) const;
+    static void to_bitset(GkContainer &container);
+    static void to_array(GkContainer &container);
+    static void normalise(GkContainer &container);
+    static GkContainer intersect(const GkContainer &lhs, const GkContainer &rhs);
+    static GkContainer unite(const GkContainer &lhs, const GkContainer &rhs);
+    static GkContainer subtract(const GkContainer &lhs, const GkContainer &rhs);
+    static std::uint32_t popcount(std::uint64_t bits);
+};
+}
+
+#endif // GK_BITMAP_HPP
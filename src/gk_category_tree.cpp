@@ -0,0 +1,520 @@
+/**
+ **  _   _                 _
+ ** | | | |               | |
+ ** | |_| | ___ _ __ _ __ | |     ___   __ _
+ ** |  _  |/ _ \ '__| '_ \| |    / _ \ / _` |
+ ** | | | |  __/ |  | |_) | |___| (_) | (_| |
+ ** \_| |_/\___|_|  | .__/\_____/\___/ \__, |
+ **                 | |                 __/ |
+ **                 |_|                |___/
+ **
+ **   Thank you for using "HerpLog" for your herpetology management requirements!
+ **   Copyright (C) 2017-2018. GekkoFyre.
+ **
+ **
+ **   HerpLog is free software: you can redistribute it and/or modify
+ **   it under the terms of the GNU General Public License as published by
+ **   the Free Software Foundation, either version 3 of the License, or
+ **   (at your option) any later version.
+ **
+ **   HerpLog is distributed in the hope that it will be useful,
+ **   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **   GNU General Public License for more details.
+ **
+ **   You should have received a copy of the GNU General Public License
+ **   along with HerpLog.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ **
+ **   The latest source code updates can be obtained from [ 1 ] below at your
+ **   discretion. A web-browser or the 'git' application may be required.
+ **
+ **   [ 1 ] - https://github.com/GekkoFyre/HerpLog
+ **
+ ********************************************************************************/
+
+/**
+ * @file gk_category_tree.cpp
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @brief An in-memory tree of every Licensee, Species, and Animal that has records filed under them, for use by the
+ * QComboBoxes that cascade from one to the next.
+ */
+
+#include "gk_category_tree.hpp"
+#include "gk_trace.hpp"
+#include <algorithm>
+#include <exception>
+#include <utility>
+
+using namespace GekkoFyre;
+
+namespace {
+/**
+ * @brief edge_key packs the indices of a parent and child node into a single key, for counting the records that link
+ * the two together.
+ */
+std::uint64_t edge_key(const std::uint32_t &parent_idx, const std::uint32_t &child_idx)
+{
+    return (static_cast<std::uint64_t>(parent_idx) << 32) | static_cast<std::uint64_t>(child_idx);
+}
+}
+
+constexpr std::uint32_t GkCategoryTree::npos;
+
+GkCategoryTree::GkCategoryTree(const std::shared_ptr<GkDbRead> &gk_db_read, QObject *parent) : QObject(parent)
+{
+    gkDbRead = gk_db_read;
+    shape_revision = 0;
+    built = false;
+}
+
+GkCategoryTree::~GkCategoryTree()
+{}
+
+/**
+ * @brief GkCategoryTree::build reads the names of every category along with the category IDs of every record, and
+ * assembles the tree from them in a single pass.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ */
+void GkCategoryTree::build()
+{
+    GkTraceSpan span("GkCategoryTree::build", "cache");
+    using namespace GkRecords;
+    auto uuid_cache = gkDbRead->get_uuids();
+    auto licensee_dict = gkDbRead->get_cat_key_vals(MiscRecordType::gkLicensee);
+    auto species_dict = gkDbRead->get_cat_key_vals(MiscRecordType::gkSpecies);
+    auto animal_dict = gkDbRead->get_cat_key_vals(MiscRecordType::gkId);
+
+    std::lock_guard<std::mutex> locker(tree_mutex);
+    licensee_tier = GkCategoryLevel();
+    species_tier = GkCategoryLevel();
+    animal_tier = GkCategoryLevel();
+    licensee_names.clear();
+    species_names.clear();
+    animal_names.clear();
+    roots.clear();
+    species_refs.clear();
+    animal_refs.clear();
+    records.clear();
+    records.reserve(uuid_cache.size());
+    ++shape_revision;
+
+    for (auto it = licensee_dict.begin(); it != licensee_dict.end(); ++it) {
+        intern(licensee_tier, licensee_names, it.key(), it.value());
+    }
+
+    for (auto it = species_dict.begin(); it != species_dict.end(); ++it) {
+        intern(species_tier, species_names, it.key(), it.value());
+    }
+
+    for (auto it = animal_dict.begin(); it != animal_dict.end(); ++it) {
+        intern(animal_tier, animal_names, it.key(), it.value());
+    }
+
+    for (const auto &uuid: uuid_cache) {
+        if (uuid.first.empty()) {
+            continue;
+        }
+
+        attach(uuid.first, intern(licensee_tier, licensee_names, uuid.second.licensee_id, ""),
+               intern(species_tier, species_names, uuid.second.species_id, ""),
+               intern(animal_tier, animal_names, uuid.second.name_id, ""));
+    }
+
+    built = true;
+    return;
+}
+
+/**
+ * @brief GkCategoryTree::clear throws away the tree, so that the next user of it will have to rebuild it from scratch.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ */
+void GkCategoryTree::clear()
+{
+    std::lock_guard<std::mutex> locker(tree_mutex);
+    licensee_tier = GkRecords::GkCategoryLevel();
+    species_tier = GkRecords::GkCategoryLevel();
+    animal_tier = GkRecords::GkCategoryLevel();
+    licensee_names.clear();
+    species_names.clear();
+    animal_names.clear();
+    roots.clear();
+    species_refs.clear();
+    animal_refs.clear();
+    records.clear();
+    ++shape_revision;
+    built = false;
+
+    return;
+}
+
+bool GkCategoryTree::is_built()
+{
+    std::lock_guard<std::mutex> locker(tree_mutex);
+    return built;
+}
+
+std::size_t GkCategoryTree::record_count()
+{
+    std::lock_guard<std::mutex> locker(tree_mutex);
+    return records.size();
+}
+
+/**
+ * @brief GkCategoryTree::revision tells apart the shapes of the tree, so that a caller can find out whether a record
+ * that it has just inserted or removed brought a category along with it.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @return A number that changes whenever a category is linked into, or unlinked from, the tree.
+ */
+std::uint64_t GkCategoryTree::revision()
+{
+    std::lock_guard<std::mutex> locker(tree_mutex);
+    return shape_revision;
+}
+
+/**
+ * @brief GkCategoryTree::insert files a newly submitted record under its categories, creating any of them that are new.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param record_id The Unique ID of the record that has just been written to the database.
+ * @param submit The data that was written to the database for the record.
+ * @return Whether the record was added, as opposed to already being present within the tree.
+ */
+bool GkCategoryTree::insert(const std::string &record_id, const GkRecords::GkSubmit &submit)
+{
+    std::lock_guard<std::mutex> locker(tree_mutex);
+    if (!built || record_id.empty() || (records.find(record_id) != records.end())) {
+        return false;
+    }
+
+    attach(record_id, intern(licensee_tier, licensee_names, submit.licensee.licensee_id, submit.licensee.licensee_name),
+           intern(species_tier, species_names, submit.species.species_id, submit.species.species_name),
+           intern(animal_tier, animal_names, submit.identifier.name_id, submit.identifier.identifier_str));
+
+    return true;
+}
+
+/**
+ * @brief GkCategoryTree::remove takes a deleted record out of the tree, along with any categories that no longer have
+ * any records filed under them.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param record_id The Unique ID of the record that has been deleted from the database.
+ * @return Whether the record was present within the tree at all.
+ */
+bool GkCategoryTree::remove(const std::string &record_id)
+{
+    std::lock_guard<std::mutex> locker(tree_mutex);
+    auto it = records.find(record_id);
+    if (it == records.end()) {
+        return false;
+    }
+
+    const auto licensee_idx = it->second[0];
+    const auto species_idx = it->second[1];
+    const auto animal_idx = it->second[2];
+    records.erase(it);
+
+    auto species_edge = species_refs.find(edge_key(licensee_idx, species_idx));
+    if ((species_edge != species_refs.end()) && (--species_edge->second == 0)) {
+        species_refs.erase(species_edge);
+        unlink(licensee_tier.nodes[licensee_idx].children, species_idx);
+    }
+
+    auto animal_edge = animal_refs.find(edge_key(species_idx, animal_idx));
+    if ((animal_edge != animal_refs.end()) && (--animal_edge->second == 0)) {
+        animal_refs.erase(animal_edge);
+        unlink(species_tier.nodes[species_idx].children, animal_idx);
+    }
+
+    --species_tier.nodes[species_idx].record_count;
+    --animal_tier.nodes[animal_idx].record_count;
+    if (--licensee_tier.nodes[licensee_idx].record_count == 0) {
+        unlink(roots, licensee_idx);
+    }
+
+    return true;
+}
+
+/**
+ * @brief GkCategoryTree::licensees lists every Licensee that has records filed under it, sorted by name.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ */
+std::vector<std::uint32_t> GkCategoryTree::licensees()
+{
+    std::lock_guard<std::mutex> locker(tree_mutex);
+    return roots;
+}
+
+/**
+ * @brief GkCategoryTree::species_of lists the Species that have records filed under the given Licensee, sorted by name.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param licensee_idx The node of the Licensee in question, or `npos` for none at all.
+ */
+std::vector<std::uint32_t> GkCategoryTree::species_of(const std::uint32_t &licensee_idx)
+{
+    std::lock_guard<std::mutex> locker(tree_mutex);
+    if (licensee_idx >= licensee_tier.nodes.size()) {
+        return std::vector<std::uint32_t>();
+    }
+
+    return licensee_tier.nodes[licensee_idx].children;
+}
+
+/**
+ * @brief GkCategoryTree::animals_of lists the Animals that have records filed under the given Species, sorted by name.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param species_idx The node of the Species in question, or `npos` for none at all.
+ */
+std::vector<std::uint32_t> GkCategoryTree::animals_of(const std::uint32_t &species_idx)
+{
+    std::lock_guard<std::mutex> locker(tree_mutex);
+    if (species_idx >= species_tier.nodes.size()) {
+        return std::vector<std::uint32_t>();
+    }
+
+    return species_tier.nodes[species_idx].children;
+}
+
+/**
+ * @brief GkCategoryTree::find looks up the node of a category by its Unique ID.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @return The index of the node, or `npos` if there is no such category.
+ */
+std::uint32_t GkCategoryTree::find(const GkRecords::MiscRecordType &record_type, const std::string &id)
+{
+    std::lock_guard<std::mutex> locker(tree_mutex);
+    const auto &tier = level(record_type);
+    auto it = tier.lookup.find(id);
+    if (it == tier.lookup.end()) {
+        return npos;
+    }
+
+    return it->second;
+}
+
+std::string GkCategoryTree::id(const GkRecords::MiscRecordType &record_type, const std::uint32_t &idx)
+{
+    std::lock_guard<std::mutex> locker(tree_mutex);
+    const auto &tier = level(record_type);
+    if (idx >= tier.nodes.size()) {
+        return "";
+    }
+
+    return tier.nodes[idx].id;
+}
+
+std::string GkCategoryTree::name(const GkRecords::MiscRecordType &record_type, const std::uint32_t &idx)
+{
+    std::lock_guard<std::mutex> locker(tree_mutex);
+    const auto &tier = level(record_type);
+    if (idx >= tier.nodes.size()) {
+        return "";
+    }
+
+    return tier.nodes[idx].name;
+}
+
+/**
+ * @brief GkCategoryTree::parent finds the Licensee that a Species was last filed under, or the Species that an Animal
+ * was, so that a category found by name can be selected along with those above it.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @return The index of the parent node, or `npos` if there is none.
+ */
+std::uint32_t GkCategoryTree::parent(const GkRecords::MiscRecordType &record_type, const std::uint32_t &idx)
+{
+    std::lock_guard<std::mutex> locker(tree_mutex);
+    const auto &tier = level(record_type);
+    if (idx >= tier.nodes.size()) {
+        return npos;
+    }
+
+    return tier.nodes[idx].parent;
+}
+
+/**
+ * @brief GkCategoryTree::fuzzy_find looks up the categories whose names most resemble the given query, typos and all,
+ * leaving out any that no longer have records filed under them.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param record_type Whether to look amongst the Licensees, Species, or Animals.
+ * @param query Whatever the user has typed so far.
+ * @param limit How many of the best matches to return.
+ * @return The best matches, the best of which comes first.
+ * @see GkTrigramIndex::search()
+ */
+std::vector<GkRecords::GkNameMatch> GkCategoryTree::fuzzy_find(const GkRecords::MiscRecordType &record_type,
+                                                               const std::string &query, const std::size_t &limit)
+{
+    GkTraceSpan span("GkCategoryTree::fuzzy_find", "cache");
+    std::lock_guard<std::mutex> locker(tree_mutex);
+    const auto &tier = level(record_type);
+    return name_index(record_type).search(query, limit, [&tier](const std::uint32_t &idx) {
+        return (idx < tier.nodes.size()) && (tier.nodes[idx].record_count > 0);
+    });
+}
+
+/**
+ * @brief GkCategoryTree::record_categories finds out which Licensee, Species, and Animal a record is filed under.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param record_id The Unique ID of the record in question.
+ * @param ids The Unique IDs of the categories, if the record was found.
+ * @return Whether the record was found within the tree.
+ */
+bool GkCategoryTree::record_categories(const std::string &record_id, GkRecords::MiscUniqueIds &ids)
+{
+    std::lock_guard<std::mutex> locker(tree_mutex);
+    auto it = records.find(record_id);
+    if (it == records.end()) {
+        return false;
+    }
+
+    ids.licensee_id = licensee_tier.nodes[it->second[0]].id;
+    ids.species_id = species_tier.nodes[it->second[1]].id;
+    ids.name_id = animal_tier.nodes[it->second[2]].id;
+    return true;
+}
+
+std::vector<std::string> GkCategoryTree::record_ids()
+{
+    std::lock_guard<std::mutex> locker(tree_mutex);
+    std::vector<std::string> output;
+    output.reserve(records.size());
+    for (const auto &record: records) {
+        output.push_back(record.first);
+    }
+
+    return output;
+}
+
+GkRecords::GkCategoryLevel &GkCategoryTree::level(const GkRecords::MiscRecordType &record_type)
+{
+    switch (record_type) {
+        case GkRecords::MiscRecordType::gkLicensee:
+            return licensee_tier;
+        case GkRecords::MiscRecordType::gkSpecies:
+            return species_tier;
+        case GkRecords::MiscRecordType::gkId:
+            return animal_tier;
+        default:
+            throw std::invalid_argument(tr("Invalid category type given to the category tree!").toStdString());
+    }
+}
+
+GkTrigramIndex &GkCategoryTree::name_index(const GkRecords::MiscRecordType &record_type)
+{
+    switch (record_type) {
+        case GkRecords::MiscRecordType::gkLicensee:
+            return licensee_names;
+        case GkRecords::MiscRecordType::gkSpecies:
+            return species_names;
+        case GkRecords::MiscRecordType::gkId:
+            return animal_names;
+        default:
+            throw std::invalid_argument(tr("Invalid category type given to the category tree!").toStdString());
+    }
+}
+
+/**
+ * @brief GkCategoryTree::intern returns the node of a category, creating it if it has not been seen before. Nodes are
+ * never erased, so that any indices handed out remain valid for as long as the tree does, and their names are indexed
+ * by trigram as soon as they become known.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ */
+std::uint32_t GkCategoryTree::intern(GkRecords::GkCategoryLevel &tier, GkTrigramIndex &names, const std::string &id,
+                                     const std::string &name)
+{
+    auto it = tier.lookup.find(id);
+    if (it != tier.lookup.end()) {
+        if (tier.nodes[it->second].name.empty() && !name.empty()) {
+            tier.nodes[it->second].name = name;
+            names.insert(it->second, name);
+        }
+
+        return it->second;
+    }
+
+    GkRecords::GkCategoryNode node;
+    node.id = id;
+    node.name = name;
+    node.parent = npos;
+    node.record_count = 0;
+
+    const auto idx = static_cast<std::uint32_t>(tier.nodes.size());
+    tier.nodes.push_back(std::move(node));
+    tier.lookup.emplace(id, idx);
+    if (!name.empty()) {
+        names.insert(idx, name);
+    }
+
+    return idx;
+}
+
+/**
+ * @brief GkCategoryTree::link inserts a node amongst its siblings, keeping them sorted by name for the QComboBoxes.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ */
+void GkCategoryTree::link(std::vector<std::uint32_t> &siblings, const GkRecords::GkCategoryLevel &tier,
+                          const std::uint32_t &idx)
+{
+    auto pos = std::upper_bound(siblings.begin(), siblings.end(), idx,
+                                [&tier](const std::uint32_t &lhs, const std::uint32_t &rhs) {
+        return tier.nodes[lhs].name < tier.nodes[rhs].name;
+    });
+
+    siblings.insert(pos, idx);
+    ++shape_revision;
+    return;
+}
+
+void GkCategoryTree::unlink(std::vector<std::uint32_t> &siblings, const std::uint32_t &idx)
+{
+    auto it = std::find(siblings.begin(), siblings.end(), idx);
+    if (it != siblings.end()) {
+        siblings.erase(it);
+        ++shape_revision;
+    }
+
+    return;
+}
+
+/**
+ * @brief GkCategoryTree::attach files a record under the given nodes, linking each of them into the tree should this be
+ * the first record to join them together.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ */
+void GkCategoryTree::attach(const std::string &record_id, const std::uint32_t &licensee_idx,
+                            const std::uint32_t &species_idx, const std::uint32_t &animal_idx)
+{
+    if (licensee_tier.nodes[licensee_idx].record_count++ == 0) {
+        link(roots, licensee_tier, licensee_idx);
+    }
+
+    if (species_refs[edge_key(licensee_idx, species_idx)]++ == 0) {
+        link(licensee_tier.nodes[licensee_idx].children, species_tier, species_idx);
+        species_tier.nodes[species_idx].parent = licensee_idx;
+    }
+
+    if (animal_refs[edge_key(species_idx, animal_idx)]++ == 0) {
+        link(species_tier.nodes[species_idx].children, animal_tier, animal_idx);
+        animal_tier.nodes[animal_idx].parent = species_idx;
+    }
+
+    ++species_tier.nodes[species_idx].record_count;
+    ++animal_tier.nodes[animal_idx].record_count;
+    records[record_id] = {{ licensee_idx, species_idx, animal_idx }};
+    return;
+}
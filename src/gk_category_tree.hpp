@@ -0,0 +1,122 @@
+/**
+ **  _   _                 _
+ ** | | | |               | |
+ ** | |_| | ___ _ __ _ __ | |     ___   __ _
+ ** |  _  |/ _ \ '__| '_ \| |    / _ \ / _` |
+ ** | | | |  __/ |  | |_) | |___| (_) | (_| |
+ ** \_| |_/\___|_|  | .__/\_____/\___/ \__, |
+ **                 | |                 __/ |
+ **                 |_|                |___/
+ **
+ **   Thank you for using "HerpLog" for your herpetology management requirements!
+ **   Copyright (C) 2017-2018. GekkoFyre.
+ **
+ **
+ **   HerpLog is free software: you can redistribute it and/or modify
+ **   it under the terms of the GNU General Public License as published by
+ **   the Free Software Foundation, either version 3 of the License, or
+ **   (at your option) any later version.
+ **
+ **   HerpLog is distributed in the hope that it will be useful,
+ **   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **   GNU General Public License for more details.
+ **
+ **   You should have received a copy of the GNU General Public License
+ **   along with HerpLog.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ **
+ **   The latest source code updates can be obtained from [ 1 ] below at your
+ **   discretion. A web-browser or the 'git' application may be required.
+ **
+ **   [ 1 ] - https://github.com/GekkoFyre/HerpLog
+ **
+ ********************************************************************************/
+
+/**
+ * @file gk_category_tree.hpp
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @brief An in-memory tree of every Licensee, Species, and Animal that has records filed under them, for use by the
+ * QComboBoxes that cascade from one to the next.
+ */
+
+#ifndef GK_CATEGORY_TREE_HPP
+#define GK_CATEGORY_TREE_HPP
+
+#include "options.hpp"
+#include "gk_db_read.hpp"
+#include "gk_trigram_index.hpp"
+#include <QtCore/QObject>
+#include <string>
+#include <vector>
+#include <array>
+#include <mutex>
+#include <memory>
+#include <unordered_map>
+#include <limits>
+
+namespace GekkoFyre {
+class GkCategoryTree;
+
+class GkCategoryTree : public QObject {
+    Q_OBJECT
+
+public:
+    explicit GkCategoryTree(const std::shared_ptr<GkDbRead> &gk_db_read, QObject *parent = nullptr);
+    ~GkCategoryTree();
+
+    static constexpr std::uint32_t npos = std::numeric_limits<std::uint32_t>::max();
+
+    void build();
+    void clear();
+    bool is_built();
+    std::size_t record_count();
+    std::uint64_t revision();
+
+    bool insert(const std::string &record_id, const GkRecords::GkSubmit &submit);
+    bool remove(const std::string &record_id);
+
+    std::vector<std::uint32_t> licensees();
+    std::vector<std::uint32_t> species_of(const std::uint32_t &licensee_idx);
+    std::vector<std::uint32_t> animals_of(const std::uint32_t &species_idx);
+
+    std::uint32_t find(const GkRecords::MiscRecordType &record_type, const std::string &id);
+    std::string id(const GkRecords::MiscRecordType &record_type, const std::uint32_t &idx);
+    std::string name(const GkRecords::MiscRecordType &record_type, const std::uint32_t &idx);
+    std::uint32_t parent(const GkRecords::MiscRecordType &record_type, const std::uint32_t &idx);
+    std::vector<GkRecords::GkNameMatch> fuzzy_find(const GkRecords::MiscRecordType &record_type, const std::string &query,
+                                                   const std::size_t &limit);
+    bool record_categories(const std::string &record_id, GkRecords::MiscUniqueIds &ids);
+    std::vector<std::string> record_ids();
+
+private:
+    GkRecords::GkCategoryLevel &level(const GkRecords::MiscRecordType &record_type);
+    GkTrigramIndex &name_index(const GkRecords::MiscRecordType &record_type);
+    std::uint32_t intern(GkRecords::GkCategoryLevel &tier, GkTrigramIndex &names, const std::string &id,
+                         const std::string &name);
+    void link(std::vector<std::uint32_t> &siblings, const GkRecords::GkCategoryLevel &tier, const std::uint32_t &idx);
+    void unlink(std::vector<std::uint32_t> &siblings, const std::uint32_t &idx);
+    void attach(const std::string &record_id, const std::uint32_t &licensee_idx, const std::uint32_t &species_idx,
+                const std::uint32_t &animal_idx);
+
+    std::shared_ptr<GkDbRead> gkDbRead;
+
+    GkRecords::GkCategoryLevel licensee_tier;
+    GkRecords::GkCategoryLevel species_tier;
+    GkRecords::GkCategoryLevel animal_tier;
+    GkTrigramIndex licensee_names;
+    GkTrigramIndex species_names;
+    GkTrigramIndex animal_names;
+    std::vector<std::uint32_t> roots;                                     // The Licensees, sorted by name
+    std::unordered_map<std::uint64_t, std::uint32_t> species_refs;        // <Key: Licensee -> Species, Value: Records>
+    std::unordered_map<std::uint64_t, std::uint32_t> animal_refs;         // <Key: Species -> Animal, Value: Records>
+    std::unordered_map<std::string, std::array<std::uint32_t, 3>> records; // <Key: Record ID, Value: Licensee, Species, Animal>
+    std::uint64_t shape_revision; // Bumped whenever a category is linked into, or unlinked from, the tree
+    bool built;
+
+    std::mutex tree_mutex;
+};
+}
+
+#endif // GK_CATEGORY_TREE_HPP
@@ -0,0 +1,305 @@
+/**
+ **  _   _                 _
+ ** | | | |               | |
+ ** | |_| | ___ _ __ _ __ | |     ___   __ _
+ ** |  _  |/ _ \ '__| '_ \| |    / _ \ / _` |
+ ** | | | |  __/ |  | |_) | |___| (_) | (_| |
+ ** \_| |_/\___|_|  | .__/\_____/\___/ \__, |
+ **                 | |                 __/ |
+ **                 |_|                |___/
+ **
+ **   Thank you for using "HerpLog" for your herpetology management requirements!
+ **   Copyright (C) 2017-2018. GekkoFyre.
+ **
+ **
+ **   HerpLog is free software: you can redistribute it and/or modify
+ **   it under the terms of the GNU General Public License as published by
+ **   the Free Software Foundation, either version 3 of the License, or
+ **   (at your option) any later version.
+ **
+ **   HerpLog is distributed in the hope that it will be useful,
+ **   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **   GNU General Public License for more details.
+ **
+ **   You should have received a copy of the GNU General Public License
+ **   along with HerpLog.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ **
+ **   The latest source code updates can be obtained from [ 1 ] below at your
+ **   discretion. A web-browser or the 'git' application may be required.
+ **
+ **   [ 1 ] - https://github.com/GekkoFyre/HerpLog
+ **
+ ********************************************************************************/
+
+/**
+ * @file gk_change_feed.cpp
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @brief Publishes every change that gets committed to the Google LevelDB database, numbered in sequence, so that any
+ * caches, models, etc. can keep themselves up to date without having to rescan the database. When the database is
+ * being served, the changes committed by the other HerpLog processes are relayed as well.
+ */
+
+#include "gk_change_feed.hpp"
+#include "gk_remote_db.hpp"
+#include "gk_trace.hpp"
+#include <leveldb/db.h>
+#include <algorithm>
+#include <exception>
+
+using namespace GekkoFyre;
+
+/**
+ * @brief GkChangeFeed::GkChangeFeed carries on numbering from wherever the last session left off, and should the
+ * database be served, starts listening for the changes that any other HerpLog processes commit.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param gk_db_conn The database that the changes are being committed to.
+ */
+GkChangeFeed::GkChangeFeed(const GkFile::FileDb &gk_db_conn, QObject *parent) : QObject(parent), relay_stopping(false)
+{
+    qRegisterMetaType<GkRecords::GkChange>("GkRecords::GkChange");
+    qRegisterMetaType<std::vector<GkRecords::GkChange>>("std::vector<GkRecords::GkChange>");
+
+    db_conn = gk_db_conn;
+    stamped_sequence = 0;
+
+    std::string value;
+    leveldb::ReadOptions read_opt;
+    leveldb::Status s = db_conn.db->Get(read_opt, GkRecords::LEVELDB_FEED_SEQUENCE, &value);
+    if (s.ok() && !value.empty()) {
+        stamped_sequence = std::stoull(value);
+    }
+
+    published_sequence = stamped_sequence;
+
+    GkRemoteDb *remote_db = GkRemoteDb::from(db_conn);
+    if (remote_db != nullptr) {
+        try {
+            relay_db = GkRemoteDb::connect(remote_db->path());
+        } catch (const std::exception &e) {
+            Q_UNUSED(e); // Without a connection of our own, only the changes made by this process get published
+        }
+
+        if (relay_db != nullptr) {
+            relay_thread = std::thread(&GkChangeFeed::relay_loop, this);
+        }
+    }
+}
+
+GkChangeFeed::~GkChangeFeed()
+{
+    relay_stopping = true;
+    if (relay_db != nullptr) {
+        static_cast<GkRemoteDb *>(relay_db.get())->disconnect();
+    }
+
+    if (relay_thread.joinable()) {
+        relay_thread.join();
+    }
+}
+
+std::uint64_t GkChangeFeed::last_sequence()
+{
+    std::lock_guard<std::mutex> locker(feed_mutex);
+    return published_sequence;
+}
+
+/**
+ * @brief GkChangeFeed::catch_up hands over every change that has been published since the given sequence number, for
+ * any subscriber that has just (re)connected to `changes_committed()`.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param after_sequence The last sequence number that the subscriber has seen.
+ * @param changes_out The changes that the subscriber has missed, oldest first.
+ * @return Whether the backlog still reaches back that far. If not, the subscriber will have to rescan the database.
+ */
+bool GkChangeFeed::catch_up(const std::uint64_t &after_sequence, std::vector<GkRecords::GkChange> &changes_out)
+{
+    std::lock_guard<std::mutex> locker(feed_mutex);
+    changes_out.clear();
+    if (after_sequence >= published_sequence) {
+        return true;
+    }
+
+    // Sequence numbers that were handed out to a failed write never get published, so gaps are to be expected
+    if (backlog.empty() || (backlog.front().sequence > after_sequence + 1)) {
+        return false;
+    }
+
+    for (const auto &change: backlog) {
+        if (change.sequence > after_sequence) {
+            changes_out.push_back(change);
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @brief GkChangeFeed::follow works out which of the changes delivered by `changes_committed()` a subscriber has yet
+ * to see, catching up on any that it missed in between.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param seen_sequence The last sequence number that the subscriber has seen, which is moved along accordingly.
+ * @param changes The changes as they were delivered by `changes_committed()`.
+ * @param changes_out The changes that the subscriber has yet to apply, oldest first.
+ * @return Whether every change in between could be accounted for. If not, such as when they were made by another
+ * process sharing the database through the service, the subscriber will have to rescan the database.
+ */
+bool GkChangeFeed::follow(std::uint64_t &seen_sequence, const std::vector<GkRecords::GkChange> &changes,
+                          std::vector<GkRecords::GkChange> &changes_out)
+{
+    changes_out.clear();
+    if (changes.empty() || (changes.back().sequence <= seen_sequence)) {
+        return true; // These were already applied by an earlier call that had to catch up
+    }
+
+    if (changes.front().sequence <= seen_sequence + 1) {
+        for (const auto &change: changes) {
+            if (change.sequence > seen_sequence) {
+                changes_out.push_back(change);
+            }
+        }
+
+        seen_sequence = changes.back().sequence;
+        return true;
+    }
+
+    if (catch_up(seen_sequence, changes_out) && !changes_out.empty() &&
+        (changes_out.front().sequence == seen_sequence + 1)) {
+        seen_sequence = changes_out.back().sequence;
+        return true;
+    }
+
+    changes_out.clear();
+    seen_sequence = std::max(last_sequence(), changes.back().sequence);
+    return false;
+}
+
+/**
+ * @brief GkChangeFeed::stamp numbers the changes that are about to be committed, and puts the last of those numbers
+ * into the very same WriteBatch, so the sequence carries on from there should HerpLog be restarted.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param changes The changes that the WriteBatch makes.
+ * @param batch The WriteBatch that is about to be committed.
+ * @note The caller must hold the database lock (and the service's write lease, if the database is being served) from
+ * now until the WriteBatch has been committed and then published, otherwise the changes could end up being published
+ * out of order.
+ */
+void GkChangeFeed::stamp(std::vector<GkRecords::GkChange> &changes, leveldb::WriteBatch &batch)
+{
+    if (changes.empty()) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> locker(feed_mutex);
+    if (GkRemoteDb::from(db_conn) != nullptr) {
+        // Other HerpLog processes commit to a served database too, so carry on from wherever the last of them left off
+        std::string value;
+        leveldb::Status s = db_conn.db->Get(leveldb::ReadOptions(), GkRecords::LEVELDB_FEED_SEQUENCE, &value);
+        if (s.ok() && !value.empty()) {
+            stamped_sequence = std::max<std::uint64_t>(stamped_sequence, std::stoull(value));
+        }
+    }
+
+    for (auto &change: changes) {
+        change.sequence = ++stamped_sequence;
+    }
+
+    batch.Put(GkRecords::LEVELDB_FEED_SEQUENCE, std::to_string(stamped_sequence));
+    return;
+}
+
+/**
+ * @brief GkChangeFeed::publish lets any subscribers know about the given changes, once they have been committed. When
+ * the database is being served, the changes are passed along to the service first, and then whatever the other HerpLog
+ * processes had committed beforehand is published ahead of them.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param changes The changes that have been committed, as numbered by GkChangeFeed::stamp().
+ * @note As with GkChangeFeed::stamp(), the caller must still hold the service's write lease, whereby nobody else can
+ * have committed anything after these changes in the meantime.
+ * @see GkChangeFeed::changes_committed()
+ */
+void GkChangeFeed::publish(const std::vector<GkRecords::GkChange> &changes)
+{
+    if (changes.empty()) {
+        return;
+    }
+
+    GkRemoteDb *remote_db = GkRemoteDb::from(db_conn);
+    if (remote_db != nullptr) {
+        std::vector<GkRecords::GkChange> missed;
+        if (remote_db->publish(changes).ok() && remote_db->changes_since(last_sequence(), 0, missed).ok()) {
+            relay(missed);
+        }
+    }
+
+    relay(changes); // Anything that has already been relayed is skipped over
+    return;
+}
+
+/**
+ * @brief GkChangeFeed::relay adds those of the given changes that are newer than any published so far onto the
+ * backlog, and then lets the subscribers know about them.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param changes The changes to be published, oldest first.
+ * @see GkChangeFeed::changes_committed()
+ */
+void GkChangeFeed::relay(const std::vector<GkRecords::GkChange> &changes)
+{
+    std::lock_guard<std::mutex> relay_locker(relay_mutex);
+    std::vector<GkRecords::GkChange> fresh;
+    {
+        std::lock_guard<std::mutex> locker(feed_mutex);
+        for (const auto &change: changes) {
+            if (change.sequence > published_sequence) {
+                backlog.push_back(change);
+                fresh.push_back(change);
+                published_sequence = change.sequence;
+            }
+        }
+
+        while (backlog.size() > HERPLOG_CHANGE_FEED_BACKLOG) {
+            backlog.pop_front();
+        }
+    }
+
+    if (!fresh.empty()) {
+        emit changes_committed(fresh);
+    }
+
+    return;
+}
+
+/**
+ * @brief GkChangeFeed::relay_loop waits upon the service for the changes committed by any other HerpLog processes,
+ * for as long as the database is being served, and relays them onto our own subscribers.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ */
+void GkChangeFeed::relay_loop()
+{
+    GkTrace::set_thread_name("GkChangeFeed relay");
+    GkRemoteDb *remote_db = static_cast<GkRemoteDb *>(relay_db.get());
+    while (!relay_stopping) {
+        std::vector<GkRecords::GkChange> changes;
+        try {
+            if (!remote_db->changes_since(last_sequence(), HERPLOG_SERVICE_FEED_WAIT_MS, changes).ok()) {
+                break; // The service has gone away, or we are being destroyed
+            }
+        } catch (const std::exception &e) {
+            Q_UNUSED(e);
+            break;
+        }
+
+        relay(changes);
+    }
+
+    return;
+}
@@ -0,0 +1,104 @@
+/**
+ **  _   _                 _
+ ** | | | |               | |
+ ** | |_| | ___ _ __ _ __ | |     ___   __ _
+ ** |  _  |/ _ \ '__| '_ \| |    / _ \ / _` |
+ ** | | | |  __/ |  | |_) | |___| (_) | (_| |
+ ** \_| |_/\___|_|  | .__/\_____/\___/ \__, |
+ **                 | |                 __/ |
+ **                 |_|                |___/
+ **
+ **   Thank you for using "HerpLog" for your herpetology management requirements!
+ **   Copyright (C) 2017-2018. GekkoFyre.
+ **
+ **
+ **   HerpLog is free software: you can redistribute it and/or modify
+ **   it under the terms of the GNU General Public License as published by
+ **   the Free Software Foundation, either version 3 of the License, or
+ **   (at your option) any later version.
+ **
+ **   HerpLog is distributed in the hope that it will be useful,
+ **   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **   GNU General Public License for more details.
+ **
+ **   You should have received a copy of the GNU General Public License
+ **   along with HerpLog.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ **
+ **   The latest source code updates can be obtained from [ 1 ] below at your
+ **   discretion. A web-browser or the 'git' application may be required.
+ **
+ **   [ 1 ] - https://github.com/GekkoFyre/HerpLog
+ **
+ ********************************************************************************/
+
+/**
+ * @file gk_change_feed.hpp
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @brief Publishes every change that gets committed to the Google LevelDB database, numbered in sequence, so that any
+ * caches, models, etc. can keep themselves up to date without having to rescan the database. When the database is
+ * being served, the changes committed by the other HerpLog processes are relayed as well.
+ */
+
+#ifndef GK_CHANGE_FEED_HPP
+#define GK_CHANGE_FEED_HPP
+
+#include "options.hpp"
+#include <QtCore/QObject>
+#include <QtCore/QMetaType>
+#include <leveldb/write_batch.h>
+#include <string>
+#include <vector>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <atomic>
+#include <memory>
+#include <cstdint>
+
+namespace GekkoFyre {
+class GkChangeFeed;
+
+class GkChangeFeed : public QObject {
+    Q_OBJECT
+
+public:
+    explicit GkChangeFeed(const GkFile::FileDb &gk_db_conn, QObject *parent = nullptr);
+    ~GkChangeFeed();
+
+    std::uint64_t last_sequence();
+    bool catch_up(const std::uint64_t &after_sequence, std::vector<GkRecords::GkChange> &changes_out);
+    bool follow(std::uint64_t &seen_sequence, const std::vector<GkRecords::GkChange> &changes,
+                std::vector<GkRecords::GkChange> &changes_out);
+
+    void stamp(std::vector<GkRecords::GkChange> &changes, leveldb::WriteBatch &batch);
+    void publish(const std::vector<GkRecords::GkChange> &changes);
+
+signals:
+    void changes_committed(const std::vector<GkRecords::GkChange> &changes);
+
+private:
+    void relay(const std::vector<GkRecords::GkChange> &changes);
+    void relay_loop();
+
+    GkFile::FileDb db_conn;
+
+    std::deque<GkRecords::GkChange> backlog; // The most recently committed changes, oldest first
+    std::uint64_t stamped_sequence;          // The last sequence number to have been handed out
+    std::uint64_t published_sequence;        // The last sequence number to have been committed and published
+
+    std::mutex feed_mutex;
+
+    std::shared_ptr<leveldb::DB> relay_db; // A connection of its own to the service, for waiting upon other processes
+    std::thread relay_thread;
+    std::atomic<bool> relay_stopping;
+    std::mutex relay_mutex;               // Keeps the changes in order, whichever thread happens to be relaying them
+};
+}
+
+Q_DECLARE_METATYPE(GekkoFyre::GkRecords::GkChange)
+Q_DECLARE_METATYPE(std::vector<GekkoFyre::GkRecords::GkChange>)
+
+#endif // GK_CHANGE_FEED_HPP
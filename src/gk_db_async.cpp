@@ -0,0 +1,96 @@
+/**
+ **  _   _                 _
+ ** | | | |               | |
+ ** | |_| | ___ _ __ _ __ | |     ___   __ _
+ ** |  _  |/ _ \ '__| '_ \| |    / _ \ / _` |
+ ** | | | |  __/ |  | |_) | |___| (_) | (_| |
+ ** \_| |_/\___|_|  | .__/\_____/\___/ \__, |
+ **                 | |                 __/ |
+ **                 |_|                |___/
+ **
+ **   Thank you for using "HerpLog" for your herpetology management requirements!
+ **   Copyright (C) 2017-2018. GekkoFyre.
+ **
+ **
+ **   HerpLog is free software: you can redistribute it and/or modify
+ **   it under the terms of the GNU General Public License as published by
+ **   the Free Software Foundation, either version 3 of the License, or
+ **   (at your option) any later version.
+ **
+ **   HerpLog is distributed in the hope that it will be useful,
+ **   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **   GNU General Public License for more details.
+ **
+ **   You should have received a copy of the GNU General Public License
+ **   along with HerpLog.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ **
+ **   The latest source code updates can be obtained from [ 1 ] below at your
+ **   discretion. A web-browser or the 'git' application may be required.
+ **
+ **   [ 1 ] - https://github.com/GekkoFyre/HerpLog
+ **
+ ********************************************************************************/
+
+/**
+ * @file gk_db_async.cpp
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @brief An asynchronous facade over GkDbRead and GkDbWrite, which runs every database operation upon a dedicated
+ * worker thread so that the user interface never has to wait upon Google LevelDB.
+ */
+
+#include "gk_db_async.hpp"
+#include <utility>
+
+using namespace GekkoFyre;
+
+/**
+ * @brief GkDbAsync::GkDbAsync starts up the dedicated database thread. There is only the one, so that writes are always
+ * applied in the order that they were requested, and so that GkDbWrite's read-modify-write cycles never overlap.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param gk_db_read The reading side of the database.
+ * @param gk_db_write The writing side of the database, whose signals will now be emitted from the database thread.
+ */
+GkDbAsync::GkDbAsync(const std::shared_ptr<GkDbRead> &gk_db_read, const std::shared_ptr<GkDbWrite> &gk_db_write,
+                     QObject *parent) : QObject(parent)
+{
+    // Needed so that the signals emitted upon the database thread can be queued up for the GUI thread
+    qRegisterMetaType<std::function<void()>>("std::function<void()>");
+    qRegisterMetaType<std::string>("std::string");
+    qRegisterMetaType<GkRecords::GkSubmit>("GkRecords::GkSubmit");
+
+    gkDbRead = gk_db_read;
+    gkDbWrite = gk_db_write;
+    executor = std::make_unique<GkExecutor>(1);
+
+    QObject::connect(this, &GkDbAsync::job_finished, this, &GkDbAsync::run_on_done, Qt::QueuedConnection);
+}
+
+GkDbAsync::~GkDbAsync()
+{
+    executor.reset(); // Let any outstanding writes finish before the database is closed
+}
+
+/**
+ * @brief GkDbAsync::wait_for_idle blocks the caller until every database operation requested so far has completed,
+ * such as before the database gets compressed and saved to disk.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ */
+void GkDbAsync::wait_for_idle()
+{
+    executor->wait_for_idle();
+    return;
+}
+
+void GkDbAsync::run_on_done(const std::function<void()> &on_done)
+{
+    if (on_done) {
+        on_done();
+    }
+
+    return;
+}
@@ -0,0 +1,112 @@
+/**
+ **  _   _                 _
+ ** | | | |               | |
+ ** | |_| | ___ _ __ _ __ | |     ___   __ _
+ ** |  _  |/ _ \ '__| '_ \| |    / _ \ / _` |
+ ** | | | |  __/ |  | |_) | |___| (_) | (_| |
+ ** \_| |_/\___|_|  | .__/\_____/\___/ \__, |
+ **                 | |                 __/ |
+ **                 |_|                |___/
+ **
+ **   Thank you for using "HerpLog" for your herpetology management requirements!
+ **   Copyright (C) 2017-2018. GekkoFyre.
+ **
+ **
+ **   HerpLog is free software: you can redistribute it and/or modify
+ **   it under the terms of the GNU General Public License as published by
+ **   the Free Software Foundation, either version 3 of the License, or
+ **   (at your option) any later version.
+ **
+ **   HerpLog is distributed in the hope that it will be useful,
+ **   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **   GNU General Public License for more details.
+ **
+ **   You should have received a copy of the GNU General Public License
+ **   along with HerpLog.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ **
+ **   The latest source code updates can be obtained from [ 1 ] below at your
+ **   discretion. A web-browser or the 'git' application may be required.
+ **
+ **   [ 1 ] - https://github.com/GekkoFyre/HerpLog
+ **
+ ********************************************************************************/
+
+/**
+ * @file gk_db_async.hpp
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @brief An asynchronous facade over GkDbRead and GkDbWrite, which runs every database operation upon a dedicated
+ * worker thread so that the user interface never has to wait upon Google LevelDB.
+ */
+
+#ifndef GK_DB_ASYNC_HPP
+#define GK_DB_ASYNC_HPP
+
+#include "options.hpp"
+#include "gk_db_read.hpp"
+#include "gk_db_write.hpp"
+#include "gk_executor.hpp"
+#include <QtCore/QObject>
+#include <QtCore/QMetaType>
+#include <QString>
+#include <functional>
+#include <exception>
+#include <memory>
+#include <string>
+
+namespace GekkoFyre {
+class GkDbAsync;
+
+class GkDbAsync : public QObject {
+    Q_OBJECT
+
+public:
+    explicit GkDbAsync(const std::shared_ptr<GkDbRead> &gk_db_read, const std::shared_ptr<GkDbWrite> &gk_db_write,
+                       QObject *parent = nullptr);
+    ~GkDbAsync();
+
+    void wait_for_idle();
+
+    /**
+     * @brief GkDbAsync::dispatch runs the given job upon the database thread and then hands its result over to
+     * `on_done`, which is always invoked upon the thread that this object lives within (i.e. the GUI thread). Should
+     * the job throw, `on_done` is skipped and GkDbAsync::db_error() is emitted instead.
+     * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+     * @date 2026-10-18
+     * @param task The job itself, which is free to make use of GkDbRead/GkDbWrite.
+     * @param on_done What to do with the result once it's available.
+     */
+    template <typename Fn, typename Done>
+    void dispatch(Fn task, Done on_done)
+    {
+        executor->submit([this, task, on_done]() {
+            try {
+                auto result = task();
+                emit job_finished([on_done, result]() { on_done(result); });
+            } catch (const std::exception &e) {
+                emit db_error(QString::fromStdString(e.what()));
+            }
+        });
+    }
+
+signals:
+    void db_error(const QString &error_msg);
+    void job_finished(const std::function<void()> &on_done);
+
+private slots:
+    void run_on_done(const std::function<void()> &on_done);
+
+private:
+    std::shared_ptr<GkDbRead> gkDbRead;
+    std::shared_ptr<GkDbWrite> gkDbWrite;
+    std::unique_ptr<GkExecutor> executor;
+};
+}
+
+Q_DECLARE_METATYPE(std::function<void()>)
+Q_DECLARE_METATYPE(std::string)
+Q_DECLARE_METATYPE(GekkoFyre::GkRecords::GkSubmit)
+
+#endif // GK_DB_ASYNC_HPP
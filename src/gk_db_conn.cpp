@@ -49,7 +49,6 @@
 #include <boost/crc.hpp>
 #include <zipper.h>
 #include <unzipper.h>
-#include <QMessageBox>
 #include <QDir>
 #include <ios>
 #include <memory>
@@ -68,6 +67,87 @@ GkDbConn::GkDbConn(QObject *parent) : QObject(parent) {}
 
 GkDbConn::~GkDbConn() {}
 
+GkCountingCache::GkCountingCache(const std::size_t &capacity)
+    : lru(leveldb::NewLRUCache(capacity)), lru_capacity(capacity), hit_count(0), miss_count(0)
+{}
+
+GkCountingCache::~GkCountingCache() {}
+
+leveldb::Cache::Handle *GkCountingCache::Insert(const leveldb::Slice &key, void *value, size_t charge,
+                                                void (*deleter)(const leveldb::Slice &, void *))
+{
+    return lru->Insert(key, value, charge, deleter);
+}
+
+/**
+ * @brief GkCountingCache::Lookup is called by LevelDB for every block before it goes to the disk for it, so whether
+ * anything was found is counted as a hit or a miss of the block cache.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ */
+leveldb::Cache::Handle *GkCountingCache::Lookup(const leveldb::Slice &key)
+{
+    Handle *handle = lru->Lookup(key);
+    if (handle != nullptr) {
+        hit_count.fetch_add(1, std::memory_order_relaxed);
+    } else {
+        miss_count.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    return handle;
+}
+
+void GkCountingCache::Release(Handle *handle)
+{
+    lru->Release(handle);
+}
+
+void *GkCountingCache::Value(Handle *handle)
+{
+    return lru->Value(handle);
+}
+
+void GkCountingCache::Erase(const leveldb::Slice &key)
+{
+    lru->Erase(key);
+}
+
+uint64_t GkCountingCache::NewId()
+{
+    return lru->NewId();
+}
+
+void GkCountingCache::Prune()
+{
+    lru->Prune();
+}
+
+size_t GkCountingCache::TotalCharge() const
+{
+    return lru->TotalCharge();
+}
+
+std::uint64_t GkCountingCache::hits() const
+{
+    return hit_count.load(std::memory_order_relaxed);
+}
+
+std::uint64_t GkCountingCache::misses() const
+{
+    return miss_count.load(std::memory_order_relaxed);
+}
+
+std::size_t GkCountingCache::capacity() const
+{
+    return lru_capacity;
+}
+
+void GkCountingCache::reset_counters()
+{
+    hit_count.store(0, std::memory_order_relaxed);
+    miss_count.store(0, std::memory_order_relaxed);
+}
+
 /**
  * @brief GkDb::open_database creates a database connection within the applications memory from the database files on
  * the local storage of the users computer, ready to be used for inserting/modifying/deleting records.
@@ -81,7 +161,8 @@ GkFile::FileDb GkDbConn::open_database(const std::string &dbFile)
     leveldb::Status s;
     GkFile::FileDb db_struct;
     db_struct.options.create_if_missing = true;
-    std::shared_ptr<leveldb::Cache>(db_struct.options.block_cache).reset(leveldb::NewLRUCache(LEVELDB_CFG_CACHE_SIZE));
+    db_struct.block_cache = std::make_shared<GkCountingCache>(LEVELDB_CFG_CACHE_SIZE);
+    db_struct.options.block_cache = db_struct.block_cache.get();
     db_struct.options.compression = leveldb::CompressionType::kSnappyCompression;
     if (!dbFile.empty()) {
         sys::error_code ec;
@@ -90,11 +171,14 @@ GkFile::FileDb GkDbConn::open_database(const std::string &dbFile)
 
         leveldb::DB *raw_db_ptr;
         s = leveldb::DB::Open(db_struct.options, dbFile, &raw_db_ptr);
-        db_struct.db.reset(raw_db_ptr);
         if (!s.ok()) {
             throw std::runtime_error(s.ToString());
         }
 
+        // The block cache must outlive the database, whichever copy of the connection happens to be the last to let go
+        std::shared_ptr<GkCountingCache> block_cache = db_struct.block_cache;
+        db_struct.db.reset(raw_db_ptr, [block_cache](leveldb::DB *db_ptr) { delete db_ptr; });
+
         if (fs::exists(dbFile, ec) && fs::is_directory(dbFile) && !doesExist) {
             std::cout << tr("Database object created. Status: ").toStdString() << s.ToString() << std::endl;
         }
@@ -46,12 +46,48 @@
 
 #include "options.hpp"
 #include <boost/filesystem.hpp>
+#include <leveldb/cache.h>
 #include <QtCore/QObject>
+#include <atomic>
+#include <memory>
 #include <string>
 #include <vector>
 
 namespace GekkoFyre {
 class GkDbConn;
+class GkCountingCache;
+
+/**
+ * @brief GkCountingCache wraps the LRU block cache that LevelDB is handed, so that the diagnostics panel can report
+ * on how often a block was already sitting in memory rather than having to be read back from the disk.
+ */
+class GkCountingCache : public leveldb::Cache {
+
+public:
+    explicit GkCountingCache(const std::size_t &capacity);
+    ~GkCountingCache() override;
+
+    Handle *Insert(const leveldb::Slice &key, void *value, size_t charge,
+                   void (*deleter)(const leveldb::Slice &key, void *value)) override;
+    Handle *Lookup(const leveldb::Slice &key) override;
+    void Release(Handle *handle) override;
+    void *Value(Handle *handle) override;
+    void Erase(const leveldb::Slice &key) override;
+    uint64_t NewId() override;
+    void Prune() override;
+    size_t TotalCharge() const override;
+
+    std::uint64_t hits() const;
+    std::uint64_t misses() const;
+    std::size_t capacity() const;
+    void reset_counters();
+
+private:
+    std::unique_ptr<leveldb::Cache> lru;
+    std::size_t lru_capacity;
+    std::atomic<std::uint64_t> hit_count;
+    std::atomic<std::uint64_t> miss_count;
+};
 
 class GkDbConn : public QObject {
 Q_OBJECT
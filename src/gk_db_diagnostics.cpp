@@ -0,0 +1,272 @@
+/**
+ **  _   _                 _
+ ** | | | |               | |
+ ** | |_| | ___ _ __ _ __ | |     ___   __ _
+ ** |  _  |/ _ \ '__| '_ \| |    / _ \ / _` |
+ ** | | | |  __/ |  | |_) | |___| (_) | (_| |
+ ** \_| |_/\___|_|  | .__/\_____/\___/ \__, |
+ **                 | |                 __/ |
+ **                 |_|                |___/
+ **
+ **   Thank you for using "HerpLog" for your herpetology management requirements!
+ **   Copyright (C) 2017-2018. GekkoFyre.
+ **
+ **
+ **   HerpLog is free software: you can redistribute it and/or modify
+ **   it under the terms of the GNU General Public License as published by
+ **   the Free Software Foundation, either version 3 of the License, or
+ **   (at your option) any later version.
+ **
+ **   HerpLog is distributed in the hope that it will be useful,
+ **   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **   GNU General Public License for more details.
+ **
+ **   You should have received a copy of the GNU General Public License
+ **   along with HerpLog.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ **
+ **   The latest source code updates can be obtained from [ 1 ] below at your
+ **   discretion. A web-browser or the 'git' application may be required.
+ **
+ **   [ 1 ] - https://github.com/GekkoFyre/HerpLog
+ **
+ ********************************************************************************/
+
+/**
+ * @file gk_db_diagnostics.cpp
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @brief Gathers up the internals of LevelDB, the hit rate of its block cache and the footprint of a database upon the
+ * disk, for whenever somebody needs to know just why their copy of HerpLog is being slow.
+ */
+
+#include "gk_db_diagnostics.hpp"
+#include "gk_db_conn.hpp"
+#include "gk_remote_db.hpp"
+#include "gk_trace.hpp"
+#include <leveldb/db.h>
+#include <boost/exception/all.hpp>
+#include <algorithm>
+#include <exception>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+using namespace GekkoFyre;
+namespace sys = boost::system;
+
+GkDbDiagnostics::GkDbDiagnostics(const GkFile::FileDb &database, QObject *parent) : QObject(parent)
+{
+    db_conn = database;
+}
+
+GkDbDiagnostics::~GkDbDiagnostics()
+{}
+
+/**
+ * @brief GkDbDiagnostics::collect takes a snapshot of how the database is faring right now. Nothing here is exact, as
+ * LevelDB only ever estimates the sizes of its key ranges, but it's more than enough to tell where the bytes have gone.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param temp_dir Where the database has been extracted to, whilst it is being worked upon.
+ * @param archive_file The archive that the database was last saved to, if any.
+ * @return The figures, ready to be shown to the user with `to_text()`.
+ */
+GkDiagnostics::GkDbReport GkDbDiagnostics::collect(const fs::path &temp_dir, const std::string &archive_file)
+{
+    GkTraceSpan span("GkDbDiagnostics::collect", "db");
+    if (db_conn.db == nullptr) {
+        throw std::runtime_error(tr("There is no database open to diagnose!").toStdString());
+    }
+
+    GkDiagnostics::GkDbReport report;
+    report.remote = (GkRemoteDb::from(db_conn) != nullptr);
+    if (!db_conn.db->GetProperty("leveldb.stats", &report.leveldb_stats)) {
+        report.leveldb_stats.clear();
+    }
+
+    if (!db_conn.db->GetProperty("leveldb.sstables", &report.leveldb_sstables)) {
+        report.leveldb_sstables.clear();
+    }
+
+    //
+    // The families of keys, as they are laid out within the database. Record IDs are upper-case hexadecimal, hence
+    // why every record field falls between "0" and "G".
+    //
+    const std::vector<std::pair<std::string, std::string>> prefixes = {
+        { tr("Category dictionaries").toStdString(), "store_" },
+        { tr("Date/Time index").toStdString(), GkRecords::LEVELDB_INDEX_TIMESTAMP },
+        { tr("Record hash index").toStdString(), GkRecords::LEVELDB_INDEX_RECORD_HASH },
+        { tr("Bucket digest index").toStdString(), GkRecords::LEVELDB_INDEX_BUCKET_DIGEST },
+        { tr("Full-text index").toStdString(), GkRecords::LEVELDB_INDEX_TEXT },
+        { tr("Animal/Date index").toStdString(), GkRecords::LEVELDB_INDEX_ANIMAL },
+        { tr("Weight sketch index").toStdString(), GkRecords::LEVELDB_INDEX_WEIGHT_SKETCH },
+        { tr("Stale weight sketches").toStdString(), GkRecords::LEVELDB_INDEX_WEIGHT_STALE },
+        { tr("Animal summaries").toStdString(), GkRecords::LEVELDB_INDEX_ANIMAL_SUMMARY },
+        { tr("Attachment references").toStdString(), GkRecords::LEVELDB_INDEX_ATTACHMENT_REF },
+        { tr("Flag index rows").toStdString(), GkRecords::LEVELDB_INDEX_FLAG_ROW },
+        { tr("Flag index ordinals").toStdString(), GkRecords::LEVELDB_INDEX_FLAG_RECORD },
+        { tr("Flag index bitmaps").toStdString(), GkRecords::LEVELDB_INDEX_FLAG_BITMAP },
+        { tr("Alert queue").toStdString(), GkRecords::LEVELDB_ALERT_QUEUE },
+        { tr("Time-series chunks").toStdString(), GkRecords::LEVELDB_SERIES_CHUNK }
+    };
+
+    report.families.push_back({ tr("Records").toStdString(), "0", "G", 0 });
+    for (const auto &prefix: prefixes) {
+        report.families.push_back({ prefix.first, prefix.second, prefix_limit(prefix.second), 0 });
+    }
+
+    report.families.push_back({ tr("Everything").toStdString(), std::string(), std::string(1, '\xff'), 0 });
+
+    std::vector<leveldb::Range> ranges;
+    for (const auto &family: report.families) {
+        ranges.push_back(leveldb::Range(family.start, family.limit));
+    }
+
+    std::vector<uint64_t> sizes(ranges.size(), 0);
+    db_conn.db->GetApproximateSizes(ranges.data(), static_cast<int>(ranges.size()), sizes.data());
+    for (std::size_t i = 0; i < sizes.size(); ++i) {
+        report.families[i].approx_bytes = sizes[i];
+    }
+
+    //
+    // The lists of Unique IDs are each kept under a prefix, with a key of their own per Unique ID
+    //
+    const std::vector<std::string> blob_keys = { GkRecords::LEVELDB_STORE_RECORD_PREFIX, GkRecords::LEVELDB_STORE_LICENSEE_PREFIX,
+                                                 GkRecords::LEVELDB_STORE_SPECIES_PREFIX, GkRecords::LEVELDB_STORE_NAME_PREFIX };
+    leveldb::ReadOptions read_opt;
+    read_opt.fill_cache = false; // Looking shouldn't change what is being looked at
+    for (const auto &key: blob_keys) {
+        GkDiagnostics::GkBlobSize blob;
+        blob.key = key;
+        blob.bytes = 0;
+        blob.entries = 0;
+        std::unique_ptr<leveldb::Iterator> it(db_conn.db->NewIterator(read_opt));
+        for (it->Seek(key); it->Valid() && it->key().starts_with(key); it->Next()) {
+            blob.bytes += it->key().size() + it->value().size();
+            ++blob.entries;
+        }
+
+        if (!it->status().ok()) {
+            throw std::runtime_error(it->status().ToString());
+        }
+
+        report.blobs.push_back(blob);
+    }
+
+    report.cache_counted = (db_conn.block_cache != nullptr && !report.remote);
+    report.cache_hits = report.cache_counted ? db_conn.block_cache->hits() : 0;
+    report.cache_misses = report.cache_counted ? db_conn.block_cache->misses() : 0;
+    report.cache_capacity = report.cache_counted ? db_conn.block_cache->capacity() : 0;
+
+    report.temp_dir_bytes = 0;
+    report.temp_dir_files = 0;
+    sys::error_code ec;
+    if (!temp_dir.empty() && fs::is_directory(temp_dir, ec)) {
+        for (fs::recursive_directory_iterator it(temp_dir, ec), end; !ec && it != end; it.increment(ec)) {
+            if (fs::is_regular_file(it->path(), ec)) {
+                const uintmax_t file_size = fs::file_size(it->path(), ec);
+                if (!ec) {
+                    report.temp_dir_bytes += file_size;
+                    ++report.temp_dir_files;
+                }
+            }
+        }
+    }
+
+    report.archive_bytes = 0;
+    if (!archive_file.empty() && fs::is_regular_file(archive_file, ec)) {
+        const uintmax_t file_size = fs::file_size(archive_file, ec);
+        report.archive_bytes = ec ? 0 : file_size;
+    }
+
+    return report;
+}
+
+/**
+ * @brief GkDbDiagnostics::to_text lays out a report as plain text, so that it can be shown within a dialog, printed to
+ * a terminal or pasted into a bug report all the same.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ */
+QString GkDbDiagnostics::to_text(const GkDiagnostics::GkDbReport &report)
+{
+    QString text;
+    text += tr("Database: %1\n\n").arg(report.remote ? tr("served by another process") : tr("opened locally"));
+
+    text += tr("Block cache\n");
+    if (report.cache_counted) {
+        const std::uint64_t lookups = report.cache_hits + report.cache_misses;
+        text += tr("  Capacity:  %1\n").arg(human_bytes(report.cache_capacity));
+        text += tr("  Hits:      %1\n").arg(report.cache_hits);
+        text += tr("  Misses:    %1\n").arg(report.cache_misses);
+        text += tr("  Hit rate:  %1\n").arg(lookups == 0 ? tr("n/a") :
+                                            QString("%1%").arg(100.0 * report.cache_hits / lookups, 0, 'f', 1));
+    } else {
+        text += tr("  n/a (the cache belongs to the process serving the database)\n");
+    }
+
+    text += tr("\nApproximate size on disk, by family of keys\n");
+    for (const auto &family: report.families) {
+        text += QString("  %1 %2\n").arg(QString::fromStdString(family.name), -24).arg(human_bytes(family.approx_bytes));
+    }
+
+    text += tr("\nLists of Unique IDs\n");
+    for (const auto &blob: report.blobs) {
+        text += tr("  %1 %2 (%3 entries)\n").arg(QString::fromStdString(blob.key), -24).arg(human_bytes(blob.bytes))
+                .arg(blob.entries);
+    }
+
+    text += tr("\nFiles\n");
+    text += tr("  Temporary directory:  %1 across %2 files\n").arg(human_bytes(report.temp_dir_bytes))
+            .arg(report.temp_dir_files);
+    if (report.archive_bytes > 0) {
+        text += tr("  Archive:              %1\n").arg(human_bytes(report.archive_bytes));
+        if (report.temp_dir_bytes > 0) {
+            text += tr("  Compression ratio:    %1 : 1\n")
+                    .arg(static_cast<double>(report.temp_dir_bytes) / report.archive_bytes, 0, 'f', 2);
+        }
+    } else {
+        text += tr("  Archive:              n/a (not saved yet)\n");
+    }
+
+    text += tr("\nleveldb.stats\n%1\n").arg(report.leveldb_stats.empty() ? tr("n/a") :
+                                              QString::fromStdString(report.leveldb_stats));
+    text += tr("leveldb.sstables\n%1\n").arg(report.leveldb_sstables.empty() ? tr("n/a") :
+                                               QString::fromStdString(report.leveldb_sstables));
+
+    return text;
+}
+
+/**
+ * @brief GkDbDiagnostics::prefix_limit works out the first key that comes after every key with the given prefix.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ */
+std::string GkDbDiagnostics::prefix_limit(const std::string &prefix)
+{
+    std::string limit = prefix;
+    while (!limit.empty() && static_cast<unsigned char>(limit.back()) == 0xff) {
+        limit.pop_back();
+    }
+
+    if (!limit.empty()) {
+        limit.back() = static_cast<char>(static_cast<unsigned char>(limit.back()) + 1);
+    }
+
+    return limit;
+}
+
+QString GkDbDiagnostics::human_bytes(const std::uint64_t &bytes)
+{
+    const char *units[] = { "B", "KiB", "MiB", "GiB", "TiB" };
+    double value = static_cast<double>(bytes);
+    int unit = 0;
+    while (value >= 1024.0 && unit < 4) {
+        value /= 1024.0;
+        ++unit;
+    }
+
+    return unit == 0 ? QString("%1 B").arg(bytes) : QString("%1 %2").arg(value, 0, 'f', 1).arg(units[unit]);
+}
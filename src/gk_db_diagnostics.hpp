@@ -0,0 +1,73 @@
+/**
+ **  _   _                 _
+ ** | | | |               | |
+ ** | |_| | ___ _ __ _ __ | |     ___   __ _
+ ** |  _  |/ _ \ '__| '_ \| |    / _ \ / _` |
+ ** | | | |  __/ |  | |_) | |___| (_) | (_| |
+ ** \_| |_/\___|_|  | .__/\_____/\___/ \__, |
+ **                 | |                 __/ |
+ **                 |_|                |___/
+ **
+ **   Thank you for using "HerpLog" for your herpetology management requirements!
+ **   Copyright (C) 2017-2018. GekkoFyre.
+ **
+ **
+ **   HerpLog is free software: you can redistribute it and/or modify
+ **   it under the terms of the GNU General Public License as published by
+ **   the Free Software Foundation, either version 3 of the License, or
+ **   (at your option) any later version.
+ **
+ **   HerpLog is distributed in the hope that it will be useful,
+ **   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **   GNU General Public License for more details.
+ **
+ **   You should have received a copy of the GNU General Public License
+ **   along with HerpLog.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ **
+ **   The latest source code updates can be obtained from [ 1 ] below at your
+ **   discretion. A web-browser or the 'git' application may be required.
+ **
+ **   [ 1 ] - https://github.com/GekkoFyre/HerpLog
+ **
+ ********************************************************************************/
+
+/**
+ * @file gk_db_diagnostics.hpp
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @brief Gathers up the internals of LevelDB, the hit rate of its block cache and the footprint of a database upon the
+ * disk, for whenever somebody needs to know just why their copy of HerpLog is being slow.
+ */
+
+#ifndef GK_DB_DIAGNOSTICS_HPP
+#define GK_DB_DIAGNOSTICS_HPP
+
+#include "options.hpp"
+#include <QtCore/QObject>
+#include <QString>
+#include <string>
+
+namespace GekkoFyre {
+class GkDbDiagnostics;
+
+class GkDbDiagnostics : public QObject {
+    Q_OBJECT
+
+public:
+    explicit GkDbDiagnostics(const GkFile::FileDb &database, QObject *parent = nullptr);
+    ~GkDbDiagnostics();
+
+    GkDiagnostics::GkDbReport collect(const fs::path &temp_dir, const std::string &archive_file);
+    QString to_text(const GkDiagnostics::GkDbReport &report);
+
+private:
+    GkFile::FileDb db_conn;
+
+    std::string prefix_limit(const std::string &prefix);
+    QString human_bytes(const std::uint64_t &bytes);
+};
+}
+
+#endif // GK_DB_DIAGNOSTICS_HPP
@@ -0,0 +1,233 @@
+/**
+ **  _   _                 _
+ ** | | | |               | |
+ ** | |_| | ___ _ __ _ __ | |     ___   __ _
+ ** |  _  |/ _ \ '__| '_ \| |    / _ \ / _` |
+ ** | | | |  __/ |  | |_) | |___| (_) | (_| |
+ ** \_| |_/\___|_|  | .__/\_____/\___/ \__, |
+ **                 | |                 __/ |
+ **                 |_|                |___/
+ **
+ **   Thank you for using "HerpLog" for your herpetology management requirements!
+ **   Copyright (C) 2017-2018. GekkoFyre.
+ **
+ **
+ **   HerpLog is free software: you can redistribute it and/or modify
+ **   it under the terms of the GNU General Public License as published by
+ **   the Free Software Foundation, either version 3 of the License, or
+ **   (at your option) any later version.
+ **
+ **   HerpLog is distributed in the hope that it will be useful,
+ **   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **   GNU General Public License for more details.
+ **
+ **   You should have received a copy of the GNU General Public License
+ **   along with HerpLog.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ **
+ **   The latest source code updates can be obtained from [ 1 ] below at your
+ **   discretion. A web-browser or the 'git' application may be required.
+ **
+ **   [ 1 ] - https://github.com/GekkoFyre/HerpLog
+ **
+ ********************************************************************************/
+
+/**
+ * @file gk_db_merge.cpp
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @brief Merges the log entries of one HerpLog database into another, by comparing the digests of each bucket of time
+ * and then the hashes of each record, so that only the records which differ ever have to be read.
+ */
+
+#include "gk_db_merge.hpp"
+#include "gk_trace.hpp"
+#include <exception>
+#include <stdexcept>
+#include <map>
+
+using namespace GekkoFyre;
+
+GkDbMerge::GkDbMerge(const std::shared_ptr<GkDbRead> &dest_db_read, const std::shared_ptr<GkDbWrite> &dest_db_write,
+                     const std::shared_ptr<GkDbRead> &src_db_read, const std::shared_ptr<GkStringOp> &gk_str_op,
+                     QObject *parent) : QObject(parent)
+{
+    destDbRead = dest_db_read;
+    destDbWrite = dest_db_write;
+    srcDbRead = src_db_read;
+    gkStrOp = gk_str_op;
+    categories_loaded = false;
+}
+
+GkDbMerge::~GkDbMerge()
+{}
+
+/**
+ * @brief GkDbMerge::merge brings every log entry of the source database over into the destination. The digests of each
+ * bucket of time are compared first, and only where those differ are the hashes of the records within compared, so two
+ * databases that are mostly the same cost little more than a scan of their digests. Conflicting copies of the same
+ * record are settled by their Date/Time, with the newer one winning out.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @return What was compared and what was changed.
+ * @note Both databases must have had GkDbWrite::rebuild_indexes() run upon them beforehand. Nothing is ever deleted
+ * from the destination, as a record missing from the source may just as well be a record that it never had.
+ */
+GkRecords::GkMergeStats GkDbMerge::merge()
+{
+    GkTraceSpan span("GkDbMerge::merge", "db");
+    using namespace GkRecords;
+    GkMergeStats stats;
+
+    const auto src_digests = srcDbRead->read_bucket_digests();
+    const auto dest_digests = destDbRead->read_bucket_digests();
+    stats.buckets_compared = src_digests.size();
+
+    for (const auto &bucket: src_digests) {
+        auto dest_bucket = dest_digests.find(bucket.first);
+        if ((dest_bucket != dest_digests.end()) && (dest_bucket->second.digest == bucket.second.digest) &&
+                (dest_bucket->second.count == bucket.second.count)) {
+            continue; // Both databases hold the very same records within this bucket
+        }
+
+        ++stats.buckets_differing;
+        const auto src_leaves = srcDbRead->read_record_hashes(bucket.first);
+        const auto dest_leaves = (dest_bucket != dest_digests.end()) ? destDbRead->read_record_hashes(bucket.first) :
+                                 std::map<std::string, std::uint64_t>();
+
+        for (const auto &leaf: src_leaves) {
+            ++stats.records_compared;
+            auto dest_leaf = dest_leaves.find(leaf.first);
+            if ((dest_leaf != dest_leaves.end()) && (dest_leaf->second == leaf.second)) {
+                continue;
+            }
+
+            merge_record(leaf.first, leaf.second, (dest_leaf != dest_leaves.end()) ? dest_leaf->second : 0, stats);
+        }
+    }
+
+    return stats;
+}
+
+/**
+ * @brief GkDbMerge::merge_record copies a single record from the source database over into the destination, either
+ * because the destination lacks it or because the two copies differ and the source's is the newer.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param record_id The Unique ID of the record.
+ * @param src_leaf The leaf hash of the source's copy.
+ * @param dest_leaf The leaf hash of the destination's copy, if it falls within the same bucket, otherwise zero.
+ * @param stats Where to tally up what was done.
+ */
+void GkDbMerge::merge_record(const std::string &record_id, const std::uint64_t &src_leaf, const std::uint64_t &dest_leaf,
+                             GkRecords::GkMergeStats &stats)
+{
+    using namespace GkRecords;
+    load_categories();
+
+    auto ids = src_uuids.find(record_id);
+    if (ids == src_uuids.end()) {
+        throw std::runtime_error(tr("Record %1 is within the index of the source database, but not within its list of "
+                                    "records!").arg(QString::fromStdString(record_id)).toStdString());
+    }
+
+    GkSubmit submit = srcDbRead->read_log_entry(record_id);
+
+    bool existing = false;
+    long int dest_date_time = 0;
+    try {
+        dest_date_time = std::stol(destDbRead->read_item_db(record_id, dateTime));
+        existing = true;
+    } catch (const std::exception &e) {
+        Q_UNUSED(e); // The destination has never seen this record before
+    }
+
+    if (existing) {
+        // The newer copy wins; should both be as new as each other, then the larger hash does, so that merging either
+        // way around always settles upon the same copy
+        const bool src_newer = (submit.date_time > dest_date_time) ||
+                ((submit.date_time == dest_date_time) && (src_leaf > dest_leaf));
+        if (!src_newer) {
+            ++stats.records_kept;
+            return;
+        }
+
+        destDbWrite->del_log_entry(record_id);
+        ++stats.records_replaced;
+    } else {
+        ++stats.records_imported;
+    }
+
+    submit.licensee.licensee_name = src_names[0][ids->second.licensee_id];
+    submit.species.species_name = src_names[1][ids->second.species_id];
+    submit.identifier.identifier_str = src_names[2][ids->second.name_id];
+    submit.licensee.licensee_id = map_category(0, ids->second.licensee_id, stats);
+    submit.species.species_id = map_category(1, ids->second.species_id, stats);
+    submit.identifier.name_id = map_category(2, ids->second.name_id, stats);
+    destDbWrite->add_log_entry(record_id, submit);
+
+    return;
+}
+
+/**
+ * @brief GkDbMerge::load_categories reads the Licensees, Species and Animals of both databases, along with the list of
+ * records of the source, but only once there is at least one record that actually needs copying.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ */
+void GkDbMerge::load_categories()
+{
+    if (categories_loaded) {
+        return;
+    }
+
+    using namespace GkRecords;
+    const MiscRecordType cat_types[3] = { MiscRecordType::gkLicensee, MiscRecordType::gkSpecies, MiscRecordType::gkId };
+    for (int i = 0; i < 3; ++i) {
+        auto src_key_vals = srcDbRead->get_cat_key_vals(cat_types[i]);
+        for (auto cat = src_key_vals.begin(); cat != src_key_vals.end(); ++cat) {
+            src_names[i][cat.key()] = cat.value();
+        }
+
+        auto dest_key_vals = destDbRead->get_cat_key_vals(cat_types[i]);
+        for (auto cat = dest_key_vals.begin(); cat != dest_key_vals.end(); ++cat) {
+            dest_names[i][cat.key()] = cat.value();
+            dest_ids[i].emplace(cat.value(), cat.key());
+        }
+    }
+
+    src_uuids = srcDbRead->get_uuids();
+    categories_loaded = true;
+    return;
+}
+
+/**
+ * @brief GkDbMerge::map_category finds the destination's Unique ID for a Licensee, Species or Animal of the source. The
+ * two databases will have given the same category a different Unique ID each, so they are matched up by name instead.
+ * A category that the destination lacks keeps its Unique ID, unless that happens to be taken by some other category.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param tier Whether this is a Licensee (0), Species (1), or Animal (2).
+ * @param src_id The Unique ID of the category within the source database.
+ * @param stats Where to tally up any categories that had to be created.
+ * @return The Unique ID to file the record under within the destination database.
+ */
+std::string GkDbMerge::map_category(const int &tier, const std::string &src_id, GkRecords::GkMergeStats &stats)
+{
+    const std::string &name = src_names[tier][src_id];
+    auto existing = dest_ids[tier].find(name);
+    if (existing != dest_ids[tier].end()) {
+        return existing->second;
+    }
+
+    std::string dest_id = src_id;
+    if (dest_id.empty() || dest_names[tier].count(dest_id)) {
+        dest_id = destDbWrite->create_uuid();
+    }
+
+    dest_names[tier][dest_id] = name;
+    dest_ids[tier][name] = dest_id;
+    ++stats.categories_created;
+    return dest_id;
+}
@@ -0,0 +1,91 @@
+/**
+ **  _   _                 _
+ ** | | | |               | |
+ ** | |_| | ___ _ __ _ __ | |     ___   __ _
+ ** |  _  |/ _ \ '__| '_ \| |    / _ \ / _` |
+ ** | | | |  __/ |  | |_) | |___| (_) | (_| |
+ ** \_| |_/\___|_|  | .__/\_____/\___/ \__, |
+ **                 | |                 __/ |
+ **                 |_|                |___/
+ **
+ **   Thank you for using "HerpLog" for your herpetology management requirements!
+ **   Copyright (C) 2017-2018. GekkoFyre.
+ **
+ **
+ **   HerpLog is free software: you can redistribute it and/or modify
+ **   it under the terms of the GNU General Public License as published by
+ **   the Free Software Foundation, either version 3 of the License, or
+ **   (at your option) any later version.
+ **
+ **   HerpLog is distributed in the hope that it will be useful,
+ **   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **   GNU General Public License for more details.
+ **
+ **   You should have received a copy of the GNU General Public License
+ **   along with HerpLog.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ **
+ **   The latest source code updates can be obtained from [ 1 ] below at your
+ **   discretion. A web-browser or the 'git' application may be required.
+ **
+ **   [ 1 ] - https://github.com/GekkoFyre/HerpLog
+ **
+ ********************************************************************************/
+
+/**
+ * @file gk_db_merge.hpp
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @brief Merges the log entries of one HerpLog database into another, by comparing the digests of each bucket of time
+ * and then the hashes of each record, so that only the records which differ ever have to be read.
+ */
+
+#ifndef GK_DB_MERGE_HPP
+#define GK_DB_MERGE_HPP
+
+#include "options.hpp"
+#include "gk_string_op.hpp"
+#include "gk_db_read.hpp"
+#include "gk_db_write.hpp"
+#include <QtCore/QObject>
+#include <unordered_map>
+#include <string>
+#include <memory>
+#include <cstdint>
+
+namespace GekkoFyre {
+class GkDbMerge;
+
+class GkDbMerge : public QObject {
+    Q_OBJECT
+
+public:
+    explicit GkDbMerge(const std::shared_ptr<GkDbRead> &dest_db_read, const std::shared_ptr<GkDbWrite> &dest_db_write,
+                       const std::shared_ptr<GkDbRead> &src_db_read, const std::shared_ptr<GkStringOp> &gk_str_op,
+                       QObject *parent = nullptr);
+    ~GkDbMerge();
+
+    GkRecords::GkMergeStats merge();
+
+private:
+    void merge_record(const std::string &record_id, const std::uint64_t &src_leaf, const std::uint64_t &dest_leaf,
+                      GkRecords::GkMergeStats &stats);
+    void load_categories();
+    std::string map_category(const int &tier, const std::string &src_id, GkRecords::GkMergeStats &stats);
+
+    std::shared_ptr<GkStringOp> gkStrOp;
+    std::shared_ptr<GkDbRead> destDbRead;
+    std::shared_ptr<GkDbWrite> destDbWrite;
+    std::shared_ptr<GkDbRead> srcDbRead;
+
+    // Indexed by tier, being the Licensees, Species and Animals in that order
+    std::unordered_map<std::string, std::string> src_names[3];   // <Key: Source Unique ID, Value: Name>
+    std::unordered_map<std::string, std::string> dest_names[3];  // <Key: Destination Unique ID, Value: Name>
+    std::unordered_map<std::string, std::string> dest_ids[3];    // <Key: Name, Value: Destination Unique ID>
+    std::unordered_map<std::string, GkRecords::MiscUniqueIds> src_uuids;
+    bool categories_loaded;
+};
+}
+
+#endif // GK_DB_MERGE_HPP
@@ -0,0 +1,424 @@
+/**
+ **  _   _                 _
+ ** | | | |               | |
+ ** | |_| | ___ _ __ _ __ | |     ___   __ _
+ ** |  _  |/ _ \ '__| '_ \| |    / _ \ / _` |
+ ** | | | |  __/ |  | |_) | |___| (_) | (_| |
+ ** \_| |_/\___|_|  | .__/\_____/\___/ \__, |
+ **                 | |                 __/ |
+ **                 |_|                |___/
+ **
+ **   Thank you for using "HerpLog" for your herpetology management requirements!
+ **   Copyright (C) 2017-2018. GekkoFyre.
+ **
+ **
+ **   HerpLog is free software: you can redistribute it and/or modify
+ **   it under the terms of the GNU General Public License as published by
+ **   the Free Software Foundation, either version 3 of the License, or
+ **   (at your option) any later version.
+ **
+ **   HerpLog is distributed in the hope that it will be useful,
+ **   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **   GNU General Public License for more details.
+ **
+ **   You should have received a copy of the GNU General Public License
+ **   along with HerpLog.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ **
+ **   The latest source code updates can be obtained from [ 1 ] below at your
+ **   discretion. A web-browser or the 'git' application may be required.
+ **
+ **   [ 1 ] - https://github.com/GekkoFyre/HerpLog
+ **
+ ********************************************************************************/
+
+/**
+ * @file gk_db_protocol.cpp
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @brief The wire format that is spoken between the HerpLog service and its clients, over a Unix domain socket. Each
+ * message is a frame made up of a big-endian, 32-bit length followed by that many bytes; integers within are varints
+ * and strings are length-prefixed.
+ */
+
+#include "gk_db_protocol.hpp"
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#include <exception>
+#include <stdexcept>
+
+using namespace GekkoFyre;
+
+namespace {
+/**
+ * @brief The GkBatchEncoder class writes out each of the operations within a WriteBatch, as it's iterated over.
+ */
+class GkBatchEncoder : public leveldb::WriteBatch::Handler {
+
+public:
+    void Put(const leveldb::Slice &key, const leveldb::Slice &value) override
+    {
+        ops.put_u8(1).put_string(key).put_string(value);
+        ++count;
+    }
+
+    void Delete(const leveldb::Slice &key) override
+    {
+        ops.put_u8(0).put_string(key);
+        ++count;
+    }
+
+    GkWireWriter ops;
+    std::uint64_t count = 0;
+};
+}
+
+GkWireWriter &GkWireWriter::put_u8(const std::uint8_t &value)
+{
+    buffer.push_back(static_cast<char>(value));
+    return *this;
+}
+
+GkWireWriter &GkWireWriter::put_varint(std::uint64_t value)
+{
+    while (value >= 0x80) {
+        buffer.push_back(static_cast<char>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+
+    buffer.push_back(static_cast<char>(value));
+    return *this;
+}
+
+GkWireWriter &GkWireWriter::put_string(const leveldb::Slice &value)
+{
+    put_varint(value.size());
+    buffer.append(value.data(), value.size());
+    return *this;
+}
+
+/**
+ * @brief GkWireWriter::put_batch writes out a WriteBatch as the number of operations within it, followed by each
+ * operation in turn; a `1` with a key and value for a put, or a `0` with a key for a delete.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param batch The WriteBatch to be written out.
+ */
+GkWireWriter &GkWireWriter::put_batch(const leveldb::WriteBatch &batch)
+{
+    GkBatchEncoder encoder;
+    leveldb::Status s = batch.Iterate(&encoder);
+    if (!s.ok()) {
+        throw std::runtime_error(s.ToString());
+    }
+
+    put_varint(encoder.count);
+    buffer.append(encoder.ops.data());
+    return *this;
+}
+
+/**
+ * @brief GkWireWriter::put_changes writes out the changes from a GkChangeFeed as their number, followed by each change
+ * in turn. The record that comes along with a `RecordInserted` is written out field by field, with its weight being
+ * sent as the bits of the double itself so that nothing is lost to rounding.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param changes The changes to be written out.
+ */
+GkWireWriter &GkWireWriter::put_changes(const std::vector<GkRecords::GkChange> &changes)
+{
+    using namespace GkRecords;
+    put_varint(changes.size());
+    for (const auto &change: changes) {
+        put_varint(change.sequence).put_u8(static_cast<std::uint8_t>(change.type)).put_string(change.id)
+                .put_u8(static_cast<std::uint8_t>(change.category)).put_string(change.name);
+        if (change.type != GkChangeType::RecordInserted) {
+            continue;
+        }
+
+        const GkSubmit &record = change.record;
+        std::uint64_t weight_bits = 0;
+        std::memcpy(&weight_bits, &record.weight, sizeof(weight_bits));
+        put_string(record.record_id).put_varint(static_cast<std::uint64_t>(record.date_time))
+                .put_string(record.licensee.licensee_id).put_string(record.licensee.licensee_name)
+                .put_string(record.species.species_id).put_string(record.species.species_name)
+                .put_string(record.identifier.name_id).put_string(record.identifier.identifier_str)
+                .put_string(record.further_notes).put_string(record.vitamin_notes).put_string(record.toilet_notes)
+                .put_string(record.temp_notes).put_string(record.weight_notes).put_string(record.hydration_notes)
+                .put_u8(record.went_toilet ? 1 : 0).put_u8(record.had_hydration ? 1 : 0)
+                .put_u8(record.had_vitamins ? 1 : 0).put_varint(weight_bits).put_varint(record.attachments.size());
+        for (const auto &attachment: record.attachments) {
+            put_string(attachment);
+        }
+    }
+
+    return *this;
+}
+
+const std::string &GkWireWriter::data() const
+{
+    return buffer;
+}
+
+GkWireReader::GkWireReader(const std::string &data) : buffer(data), pos(0)
+{}
+
+std::uint8_t GkWireReader::get_u8()
+{
+    if (pos >= buffer.size()) {
+        throw std::runtime_error("The message from the HerpLog service has been cut short!");
+    }
+
+    return static_cast<std::uint8_t>(buffer[pos++]);
+}
+
+std::uint64_t GkWireReader::get_varint()
+{
+    std::uint64_t value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+        const std::uint8_t byte = get_u8();
+        value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) {
+            return value;
+        }
+    }
+
+    throw std::runtime_error("The message from the HerpLog service holds an invalid number!");
+}
+
+std::string GkWireReader::get_string()
+{
+    const std::uint64_t len = get_varint();
+    if (len > buffer.size() - pos) {
+        throw std::runtime_error("The message from the HerpLog service has been cut short!");
+    }
+
+    std::string value = buffer.substr(pos, static_cast<std::size_t>(len));
+    pos += static_cast<std::size_t>(len);
+    return value;
+}
+
+/**
+ * @brief GkWireReader::get_batch does the opposite of GkWireWriter::put_batch().
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param batch The WriteBatch to be filled in.
+ */
+void GkWireReader::get_batch(leveldb::WriteBatch &batch)
+{
+    const std::uint64_t count = get_varint();
+    for (std::uint64_t i = 0; i < count; ++i) {
+        if (get_u8() == 1) {
+            const std::string key = get_string();
+            batch.Put(key, get_string());
+        } else {
+            batch.Delete(get_string());
+        }
+    }
+
+    return;
+}
+
+/**
+ * @brief GkWireReader::get_changes does the opposite of GkWireWriter::put_changes().
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param changes The changes that were read, which are added onto the end.
+ */
+void GkWireReader::get_changes(std::vector<GkRecords::GkChange> &changes)
+{
+    using namespace GkRecords;
+    const std::uint64_t count = get_varint();
+    for (std::uint64_t i = 0; i < count; ++i) {
+        GkChange change;
+        change.sequence = get_varint();
+        change.type = static_cast<GkChangeType>(get_u8());
+        change.id = get_string();
+        change.category = static_cast<MiscRecordType>(get_u8());
+        change.name = get_string();
+        if (change.type == GkChangeType::RecordInserted) {
+            GkSubmit &record = change.record;
+            record.record_id = get_string();
+            record.date_time = static_cast<std::time_t>(get_varint());
+            record.licensee.licensee_id = get_string();
+            record.licensee.licensee_name = get_string();
+            record.species.species_id = get_string();
+            record.species.species_name = get_string();
+            record.identifier.name_id = get_string();
+            record.identifier.identifier_str = get_string();
+            record.further_notes = get_string();
+            record.vitamin_notes = get_string();
+            record.toilet_notes = get_string();
+            record.temp_notes = get_string();
+            record.weight_notes = get_string();
+            record.hydration_notes = get_string();
+            record.went_toilet = (get_u8() != 0);
+            record.had_hydration = (get_u8() != 0);
+            record.had_vitamins = (get_u8() != 0);
+            const std::uint64_t weight_bits = get_varint();
+            std::memcpy(&record.weight, &weight_bits, sizeof(record.weight));
+            const std::uint64_t attachment_count = get_varint();
+            for (std::uint64_t j = 0; j < attachment_count; ++j) {
+                record.attachments.push_back(get_string());
+            }
+        }
+
+        changes.push_back(change);
+    }
+
+    return;
+}
+
+bool GkWireReader::at_end() const
+{
+    return pos >= buffer.size();
+}
+
+GkSocket::GkSocket(const int &fd) : sock_fd(fd)
+{}
+
+GkSocket::GkSocket(GkSocket &&other) : sock_fd(other.sock_fd)
+{
+    other.sock_fd = -1;
+}
+
+GkSocket &GkSocket::operator=(GkSocket &&other)
+{
+    if (this != &other) {
+        close();
+        sock_fd = other.sock_fd;
+        other.sock_fd = -1;
+    }
+
+    return *this;
+}
+
+GkSocket::~GkSocket()
+{
+    close();
+}
+
+/**
+ * @brief GkSocket::connect_to connects to the HerpLog service that's listening upon the given Unix domain socket.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param socket_path The path to the socket upon the local filesystem.
+ * @return The connected socket, which is not open if nothing could be connected to.
+ */
+GkSocket GkSocket::connect_to(const std::string &socket_path)
+{
+    sockaddr_un addr;
+    std::memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    if (socket_path.size() >= sizeof(addr.sun_path)) {
+        throw std::invalid_argument("The path to the HerpLog service's socket is too long!");
+    }
+
+    std::strncpy(addr.sun_path, socket_path.c_str(), sizeof(addr.sun_path) - 1);
+    GkSocket sock(::socket(AF_UNIX, SOCK_STREAM, 0));
+    if (sock.is_open() && (::connect(sock.fd(), reinterpret_cast<sockaddr *>(&addr), sizeof(addr)) != 0)) {
+        sock.close();
+    }
+
+    return sock;
+}
+
+bool GkSocket::is_open() const
+{
+    return sock_fd >= 0;
+}
+
+int GkSocket::fd() const
+{
+    return sock_fd;
+}
+
+void GkSocket::close()
+{
+    if (sock_fd >= 0) {
+        ::close(sock_fd);
+        sock_fd = -1;
+    }
+
+    return;
+}
+
+/**
+ * @brief GkSocket::shutdown wakes up any thread that's blocked upon reading from the socket, without closing the file
+ * descriptor out from underneath it.
+ */
+void GkSocket::shutdown()
+{
+    if (sock_fd >= 0) {
+        ::shutdown(sock_fd, SHUT_RDWR);
+    }
+
+    return;
+}
+
+bool GkSocket::send_frame(const std::string &payload)
+{
+    if (payload.size() > HERPLOG_SERVICE_MAX_FRAME) {
+        return false;
+    }
+
+    const std::uint32_t len = static_cast<std::uint32_t>(payload.size());
+    const char header[4] = { static_cast<char>(len >> 24), static_cast<char>(len >> 16), static_cast<char>(len >> 8),
+                             static_cast<char>(len) };
+    return write_all(header, sizeof(header)) && write_all(payload.data(), payload.size());
+}
+
+bool GkSocket::recv_frame(std::string &payload)
+{
+    unsigned char header[4];
+    if (!read_all(reinterpret_cast<char *>(header), sizeof(header))) {
+        return false;
+    }
+
+    const std::uint32_t len = (static_cast<std::uint32_t>(header[0]) << 24) | (static_cast<std::uint32_t>(header[1]) << 16) |
+                              (static_cast<std::uint32_t>(header[2]) << 8) | static_cast<std::uint32_t>(header[3]);
+    if (len > HERPLOG_SERVICE_MAX_FRAME) {
+        return false;
+    }
+
+    payload.resize(len);
+    return (len == 0) || read_all(&payload[0], len);
+}
+
+bool GkSocket::write_all(const char *data, std::size_t len)
+{
+    while (len > 0) {
+        const ssize_t sent = ::send(sock_fd, data, len, MSG_NOSIGNAL);
+        if (sent < 0 && errno == EINTR) {
+            continue;
+        } else if (sent <= 0) {
+            return false;
+        }
+
+        data += sent;
+        len -= static_cast<std::size_t>(sent);
+    }
+
+    return true;
+}
+
+bool GkSocket::read_all(char *data, std::size_t len)
+{
+    while (len > 0) {
+        const ssize_t got = ::recv(sock_fd, data, len, 0);
+        if (got < 0 && errno == EINTR) {
+            continue;
+        } else if (got <= 0) {
+            return false;
+        }
+
+        data += got;
+        len -= static_cast<std::size_t>(got);
+    }
+
+    return true;
+}
@@ -0,0 +1,121 @@
+/**
+ **  _   _                 _
+ ** | | | |               | |
+ ** | |_| | ___ _ __ _ __ | |     ___   __ _
+ ** |  _  |/ _ \ '__| '_ \| |    / _ \ / _` |
+ ** | | | |  __/ |  | |_) | |___| (_) | (_| |
+ ** \_| |_/\___|_|  | .__/\_____/\___/ \__, |
+ **                 | |                 __/ |
+ **                 |_|                |___/
+ **
+ **   Thank you for using "HerpLog" for your herpetology management requirements!
+ **   Copyright (C) 2017-2018. GekkoFyre.
+ **
+ **
+ **   HerpLog is free software: you can redistribute it and/or modify
+ **   it under the terms of the GNU General Public License as published by
+ **   the Free Software Foundation, either version 3 of the License, or
+ **   (at your option) any later version.
+ **
+ **   HerpLog is distributed in the hope that it will be useful,
+ **   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **   GNU General Public License for more details.
+ **
+ **   You should have received a copy of the GNU General Public License
+ **   along with HerpLog.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ **
+ **   The latest source code updates can be obtained from [ 1 ] below at your
+ **   discretion. A web-browser or the 'git' application may be required.
+ **
+ **   [ 1 ] - https://github.com/GekkoFyre/HerpLog
+ **
+ ********************************************************************************/
+
+/**
+ * @file gk_db_protocol.hpp
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @brief The wire format that is spoken between the HerpLog service and its clients, over a Unix domain socket. Each
+ * message is a frame made up of a big-endian, 32-bit length followed by that many bytes; integers within are varints
+ * and strings are length-prefixed.
+ */
+
+#ifndef GK_DB_PROTOCOL_HPP
+#define GK_DB_PROTOCOL_HPP
+
+#include "options.hpp"
+#include <leveldb/slice.h>
+#include <leveldb/write_batch.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace GekkoFyre {
+class GkWireWriter;
+class GkWireReader;
+class GkSocket;
+
+class GkWireWriter {
+
+public:
+    GkWireWriter &put_u8(const std::uint8_t &value);
+    GkWireWriter &put_varint(std::uint64_t value);
+    GkWireWriter &put_string(const leveldb::Slice &value);
+    GkWireWriter &put_batch(const leveldb::WriteBatch &batch);
+    GkWireWriter &put_changes(const std::vector<GkRecords::GkChange> &changes);
+
+    const std::string &data() const;
+
+private:
+    std::string buffer;
+};
+
+class GkWireReader {
+
+public:
+    explicit GkWireReader(const std::string &data);
+
+    std::uint8_t get_u8();
+    std::uint64_t get_varint();
+    std::string get_string();
+    void get_batch(leveldb::WriteBatch &batch);
+    void get_changes(std::vector<GkRecords::GkChange> &changes);
+    bool at_end() const;
+
+private:
+    const std::string &buffer;
+    std::size_t pos;
+};
+
+class GkSocket {
+
+public:
+    explicit GkSocket(const int &fd = -1);
+    ~GkSocket();
+
+    GkSocket(const GkSocket &) = delete;
+    GkSocket &operator=(const GkSocket &) = delete;
+
+    static GkSocket connect_to(const std::string &socket_path);
+    GkSocket(GkSocket &&other);
+    GkSocket &operator=(GkSocket &&other);
+
+    bool is_open() const;
+    int fd() const;
+    void close();
+    void shutdown();
+
+    bool send_frame(const std::string &payload);
+    bool recv_frame(std::string &payload);
+
+private:
+    bool write_all(const char *data, std::size_t len);
+    bool read_all(char *data, std::size_t len);
+
+    int sock_fd;
+};
+}
+
+#endif // GK_DB_PROTOCOL_HPP
@@ -42,11 +42,12 @@
  */
 
 #include "gk_db_read.hpp"
-#include "3rd_party/minicsv/minicsv.h"
-#include <QMessageBox>
+#include "gk_trace.hpp"
+#include <stdexcept>
+#include <limits>
+#include <algorithm>
 
 using namespace GekkoFyre;
-using namespace mini;
 GkDbRead::GkDbRead(const GekkoFyre::GkFile::FileDb &gk_db_conn, const std::shared_ptr<GekkoFyre::GkStringOp> &gk_str_op,
                               QObject *parent)
 {
@@ -67,6 +68,7 @@ GkDbRead::~GkDbRead()
  */
 std::string GkDbRead::read_item_db(const std::string &record_id, const std::string &key)
 {
+    GkTraceSpan span("GkDbRead::read_item_db", "db");
     std::string read_data;
     leveldb::ReadOptions read_opt;
     leveldb::Status s;
@@ -88,6 +90,7 @@ std::string GkDbRead::read_item_db(const std::string &record_id, const std::stri
 
 long int GkDbRead::determine_min_date_time(const std::vector<std::string> &record_ids)
 {
+    GkTraceSpan span("GkDbRead::determine_min_date_time", "db");
     std::lock_guard<std::mutex> locker(analyze_mutex);
     if (!record_ids.empty()) {
         std::vector<std::string> dates_str_vec;
@@ -113,6 +116,7 @@ long int GkDbRead::determine_min_date_time(const std::vector<std::string> &recor
 
 long int GkDbRead::determine_max_date_time(const std::vector<std::string> &record_ids)
 {
+    GkTraceSpan span("GkDbRead::determine_max_date_time", "db");
     std::lock_guard<std::mutex> locker(analyze_mutex);
     if (!record_ids.empty()) {
         std::vector<std::string> dates_str_vec;
@@ -140,94 +144,127 @@ long int GkDbRead::determine_max_date_time(const std::vector<std::string> &recor
  * @brief GkDbRead::get_uuids will obtain all the Unique Identifiers for each record that's in the database.
  * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
  * @date 2018-02-21
+ * @param snapshot If given, the Unique Identifiers are read as of this snapshot rather than as of right now.
  * @return The information that was retrieved from the database.
  */
-std::unordered_map<std::string, GkRecords::MiscUniqueIds> GkDbRead::get_uuids()
+std::unordered_map<std::string, GkRecords::MiscUniqueIds> GkDbRead::get_uuids(const leveldb::Snapshot *snapshot)
 {
+    GkTraceSpan span("GkDbRead::get_uuids", "db");
     leveldb::ReadOptions read_opt;
     read_opt.verify_checksums = true;
+    read_opt.snapshot = snapshot;
 
-    std::string csv_read_data;
-    std::lock_guard<std::mutex> locker(db_mutex);
-    db_conn.db->Get(read_opt, GkRecords::LEVELDB_STORE_RECORD_ID, &csv_read_data);
-
+    const std::string prefix(GkRecords::LEVELDB_STORE_RECORD_PREFIX);
     std::unordered_map<std::string, GkRecords::MiscUniqueIds> cache;
-    if (!csv_read_data.empty()) {
-        try {
-            csv::istringstream iss(csv_read_data);
-            iss.set_delimiter(',', "$$");
-            std::string record_id;
-            GkRecords::MiscUniqueIds unique_ids;
-            while (iss.read_line()) {
-                iss >> record_id >> unique_ids.licensee_id >> unique_ids.species_id >> unique_ids.name_id;
-
-                if ((!record_id.empty()) && (!unique_ids.licensee_id.empty()) && (!unique_ids.species_id.empty()) &&
-                        (!unique_ids.name_id.empty())) {
-                    cache.insert(std::make_pair(record_id, unique_ids));
-                } else {
-                    throw std::invalid_argument(tr("An error had occurred whilst obtaining information about stored-keys from the database!").toStdString());
-                }
-            }
-        } catch (const std::exception &e) {
-            QMessageBox::warning(nullptr, tr("Error!"), e.what(), QMessageBox::Ok);
+    std::lock_guard<std::mutex> locker(db_mutex);
+    std::unique_ptr<leveldb::Iterator> it(db_conn.db->NewIterator(read_opt));
+    for (it->Seek(prefix); it->Valid() && it->key().starts_with(prefix); it->Next()) {
+        GkRecords::MiscUniqueIds unique_ids;
+        if (!gkStrOp->decode_unique_ids(it->value().ToString(), unique_ids)) {
+            throw std::invalid_argument(tr("An error had occurred whilst obtaining information about stored-keys from the database!").toStdString());
         }
+
+        cache.insert(std::make_pair(it->key().ToString().substr(prefix.size()), unique_ids));
+    }
+
+    if (!it->status().ok()) {
+        throw std::runtime_error(it->status().ToString());
     }
 
     return cache;
 }
 
+/**
+ * @brief GkDbRead::get_uuid looks up the Unique IDs of the categories of just the one record.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param record_id The Unique ID of the record.
+ * @param unique_ids The Unique IDs of the record's Licensee, Species and Name/ID, if it exists.
+ * @return Whether there is such a record within the database.
+ */
+bool GkDbRead::get_uuid(const std::string &record_id, GkRecords::MiscUniqueIds &unique_ids)
+{
+    GkTraceSpan span("GkDbRead::get_uuid", "db");
+    leveldb::ReadOptions read_opt;
+    read_opt.verify_checksums = true;
+
+    std::string value;
+    std::lock_guard<std::mutex> locker(db_mutex);
+    leveldb::Status s = db_conn.db->Get(read_opt, gkStrOp->unique_id_key(record_id), &value);
+    if (s.IsNotFound()) {
+        return false;
+    } else if (!s.ok()) {
+        throw std::runtime_error(s.ToString());
+    }
+
+    if (!gkStrOp->decode_unique_ids(value, unique_ids)) {
+        throw std::invalid_argument(tr("An error had occurred whilst obtaining information about stored-keys from the database!").toStdString());
+    }
+
+    return true;
+}
+
 /**
  * @brief GkDbRead::get_cat_key_vals will obtain all the Unique Identifiers from the database for the given key, IF it's related
  * to GkRecords::GkSpecies or GkRecords::GkId ONLY.
  * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
  * @date 2018-02-21
- * @param record_type Whether to get data from `store_species_id` or `store_name_id` within the Google LevelDB database.
+ * @param record_type Whether to get the Licensees, Species or Names/IDs from within the Google LevelDB database.
  * @return The information that was retrieved from the database; <Key: Species ID/Name ID, Value: Species Name/Name Value>
  */
 QMultiMap<std::string, std::string> GkDbRead::get_cat_key_vals(const GkRecords::MiscRecordType &record_type)
 {
+    GkTraceSpan span("GkDbRead::get_cat_key_vals", "db");
     try {
         leveldb::ReadOptions read_opt;
         read_opt.verify_checksums = true;
 
-        std::string csv_read_data;
-        std::lock_guard<std::mutex> locker(db_mutex);
-
+        const std::string prefix = gkStrOp->cat_prefix(record_type);
         QMultiMap<std::string, std::string> cache;
-
-        switch (record_type) {
-            case GkRecords::MiscRecordType::gkLicensee:
-                db_conn.db->Get(read_opt, GkRecords::LEVELDB_STORE_LICENSEE_ID, &csv_read_data);
-                break;
-            case GkRecords::MiscRecordType::gkSpecies:
-                db_conn.db->Get(read_opt, GkRecords::LEVELDB_STORE_SPECIES_ID, &csv_read_data);
-                break;
-            case GkRecords::MiscRecordType::gkId:
-                db_conn.db->Get(read_opt, GkRecords::LEVELDB_STORE_NAME_ID, &csv_read_data);
-                break;
-            default:
-                throw std::invalid_argument(tr("Unable to read Unique Identifier from database!").toStdString());
+        std::lock_guard<std::mutex> locker(db_mutex);
+        std::unique_ptr<leveldb::Iterator> it(db_conn.db->NewIterator(read_opt));
+        for (it->Seek(prefix); it->Valid() && it->key().starts_with(prefix); it->Next()) {
+            cache.insertMulti(it->key().ToString().substr(prefix.size()), it->value().ToString());
         }
 
-        if (!csv_read_data.empty()) {
-            csv::istringstream iss(csv_read_data);
-            iss.set_delimiter(',', "$$");
-            std::string id, name;
-
-            while (iss.read_line()) {
-                iss >> id >> name;
-                cache.insertMulti(id, name);
-            }
+        if (!it->status().ok()) {
+            throw std::runtime_error(it->status().ToString());
         }
 
         return cache;
     } catch (const std::exception &e) {
-        QMessageBox::warning(nullptr, tr("Error!"), tr("Unable to read Unique Identifier from database! Error:\n\n%1").arg(e.what()), QMessageBox::Ok);
+        throw std::runtime_error(tr("Unable to read Unique Identifier from database! Error:\n\n%1").arg(e.what()).toStdString());
     }
 
     return QMultiMap<std::string, std::string>();
 }
 
+/**
+ * @brief GkDbRead::get_cat_name looks up the name of just the one Licensee, Species, or Name/ID sub-record.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param record_type Whether the sub-record is a Licensee, Species, or Name/ID.
+ * @param cat_id The Unique ID of the sub-record.
+ * @param name The name of the sub-record, if it exists.
+ * @return Whether there is such a sub-record within the database.
+ */
+bool GkDbRead::get_cat_name(const GkRecords::MiscRecordType &record_type, const std::string &cat_id, std::string &name)
+{
+    GkTraceSpan span("GkDbRead::get_cat_name", "db");
+    leveldb::ReadOptions read_opt;
+    read_opt.verify_checksums = true;
+
+    std::lock_guard<std::mutex> locker(db_mutex);
+    leveldb::Status s = db_conn.db->Get(read_opt, gkStrOp->cat_key(record_type, cat_id), &name);
+    if (s.IsNotFound()) {
+        return false;
+    } else if (!s.ok()) {
+        throw std::runtime_error(s.ToString());
+    }
+
+    return true;
+}
+
 /**
  * @brief GkDbRead::extract_records will extract whatever category-related Record IDs that lay within a given date range,
  * depending on when they were `submitted` to the Google LevelDB database (i.e. the Date/Time that was specified by the
@@ -240,6 +277,7 @@ QMultiMap<std::string, std::string> GkDbRead::get_cat_key_vals(const GkRecords::
  */
 std::list<std::string> GkDbRead::extract_records(const long int &dateStart, const long int &dateEnd)
 {
+    GkTraceSpan span("GkDbRead::extract_records", "db");
     // Extract all the possible Record IDs from the database
     std::lock_guard<std::mutex> locker(analyze_mutex);
     auto record_id_cache = get_uuids();
@@ -278,3 +316,561 @@ std::list<std::string> GkDbRead::extract_records(const long int &dateStart, cons
 
     return std::list<std::string>();
 }
+
+/**
+ * @brief GkDbRead::extract_animal_records is much the same as GkDbRead::extract_records(), but for the records of a
+ * single animal, which are read straight from the (Animal, Date/Time) index.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param name_id The Unique ID of the animal in question, or empty for the records of every animal.
+ * @param dateStart The beginning of the date range, as UNIX Epoch Time.
+ * @param dateEnd The end of the date range, as UNIX Epoch Time.
+ * @return The Record IDs that lay within the given date range, in chronological order.
+ */
+std::list<std::string> GkDbRead::extract_animal_records(const std::string &name_id, const long int &dateStart,
+                                                        const long int &dateEnd)
+{
+    if (name_id.empty()) {
+        return extract_records(dateStart, dateEnd);
+    }
+
+    std::list<std::string> output;
+    for (const auto &entry: scan_animal_index(name_id, dateStart, dateEnd, std::numeric_limits<std::size_t>::max())) {
+        output.push_back(entry.record_id);
+    }
+
+    return output;
+}
+
+/**
+ * @brief GkDbRead::read_log_entry reads every field of a single log entry from the database. Only the Unique IDs of the
+ * categories are known to the record itself, so the names of those are left for the caller to fill in.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param record_id The Unique ID of the record in question.
+ * @return The log entry.
+ */
+GkRecords::GkSubmit GkDbRead::read_log_entry(const std::string &record_id)
+{
+    GkTraceSpan span("GkDbRead::read_log_entry", "db");
+    using namespace GkRecords;
+    GkSubmit submit;
+    submit.record_id = record_id;
+    submit.date_time = std::stol(read_item_db(record_id, dateTime));
+    submit.further_notes = read_item_db(record_id, furtherNotes);
+    submit.vitamin_notes = read_item_db(record_id, vitaminNotes);
+    submit.toilet_notes = read_item_db(record_id, toiletNotes);
+    submit.temp_notes = read_item_db(record_id, tempNotes);
+    submit.weight_notes = read_item_db(record_id, weightNotes);
+    submit.hydration_notes = read_item_db(record_id, hydrationNotes);
+    submit.went_toilet = (read_item_db(record_id, boolWentToilet) == "1");
+    submit.had_hydration = (read_item_db(record_id, boolHadHydration) == "1");
+    submit.had_vitamins = (read_item_db(record_id, boolHadVitamins) == "1");
+    submit.weight = std::stod(read_item_db(record_id, weightMeasure));
+    submit.attachments = read_attachments(record_id);
+
+    return submit;
+}
+
+/**
+ * @brief GkDbRead::read_attachments reads the hashes of the photos attached to a log entry. Only the records that have
+ * photos carry this field at all, so unlike with GkDbRead::read_item_db(), its absence isn't a sign of damage.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param record_id The Unique ID of the record in question.
+ * @return The SHA-256 hashes of the photos, if any.
+ * @see GkAttachmentStore
+ */
+std::vector<std::string> GkDbRead::read_attachments(const std::string &record_id)
+{
+    std::string attachments;
+    std::lock_guard<std::mutex> locker(db_mutex);
+    leveldb::Status s = db_conn.db->Get(leveldb::ReadOptions(),
+                                        gkStrOp->multipart_key({record_id, GkRecords::attachmentRefs}), &attachments);
+    if (!s.ok() && !s.IsNotFound()) {
+        throw std::runtime_error(s.ToString());
+    }
+
+    return gkStrOp->decode_attachments(attachments);
+}
+
+/**
+ * @brief GkDbRead::scan_timestamp_index reads a page of the timestamp index, in either chronological or reverse
+ * chronological order, without ever having to look at the records themselves.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param after_key The index key of the last entry from the previous page, or empty to start from the beginning (or the
+ * end, if `descending`).
+ * @param limit The maximum amount of entries to return.
+ * @param descending Whether to walk the index from the newest record to the oldest instead.
+ * @return The entries of the page, in the requested order.
+ * @see GkStringOp::timestamp_index_key()
+ */
+std::vector<GkRecords::GkIndexEntry> GkDbRead::scan_timestamp_index(const std::string &after_key, const std::size_t &limit,
+                                                                    const bool &descending)
+{
+    GkTraceSpan span("GkDbRead::scan_timestamp_index", "db");
+    const std::string prefix(GkRecords::LEVELDB_INDEX_TIMESTAMP);
+    std::string prefix_end = prefix;
+    prefix_end.back() = static_cast<char>(prefix_end.back() + 1); // The first possible key after the index
+
+    leveldb::ReadOptions read_opt;
+    read_opt.fill_cache = false; // Don't push the records that are being looked at out of the cache
+
+    std::vector<GkRecords::GkIndexEntry> page;
+    page.reserve(limit);
+
+    std::lock_guard<std::mutex> locker(db_mutex);
+    std::unique_ptr<leveldb::Iterator> it(db_conn.db->NewIterator(read_opt));
+    if (!descending) {
+        it->Seek(after_key.empty() ? prefix : after_key);
+        if (it->Valid() && !after_key.empty() && (it->key().ToString() == after_key)) {
+            it->Next();
+        }
+    } else {
+        it->Seek(after_key.empty() ? prefix_end : after_key);
+        if (it->Valid()) {
+            it->Prev(); // Whatever we landed upon is either after the index, or the previous page's last entry
+        } else {
+            it->SeekToLast();
+        }
+    }
+
+    GkRecords::GkIndexEntry entry;
+    while (it->Valid() && (page.size() < limit)) {
+        if (!gkStrOp->decode_timestamp_index_key(it->key().ToString(), entry)) {
+            break; // We've walked off the end of the index
+        }
+
+        page.push_back(entry);
+        if (descending) {
+            it->Prev();
+        } else {
+            it->Next();
+        }
+    }
+
+    if (!it->status().ok()) {
+        throw std::runtime_error(it->status().ToString());
+    }
+
+    return page;
+}
+
+/**
+ * @brief GkDbRead::scan_animal_index reads the records of a single animal that fall within the given date range, along
+ * with their weights, from the (Animal, Date/Time) index. It takes but one seek to land upon the first of them, after
+ * which only the animal's own entries are ever looked at, however many other records the database holds.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param name_id The Unique ID of the animal in question.
+ * @param dateStart The beginning of the date range, as UNIX Epoch Time.
+ * @param dateEnd The end of the date range, as UNIX Epoch Time.
+ * @param limit The maximum amount of entries to return.
+ * @param descending Whether to start from the newest record of the range instead, as for the last N entries.
+ * @return The entries, in the requested order.
+ * @see GkStringOp::animal_index_key()
+ */
+std::vector<GkRecords::GkAnimalIndexEntry> GkDbRead::scan_animal_index(const std::string &name_id,
+                                                                       const long int &dateStart,
+                                                                       const long int &dateEnd,
+                                                                       const std::size_t &limit,
+                                                                       const bool &descending)
+{
+    GkTraceSpan span("GkDbRead::scan_animal_index", "db");
+    const std::string prefix = gkStrOp->animal_index_prefix(name_id);
+
+    leveldb::ReadOptions read_opt;
+    read_opt.fill_cache = false; // Don't push the records that are being looked at out of the cache
+
+    std::vector<GkRecords::GkAnimalIndexEntry> entries;
+    if ((limit == 0) || (dateStart > dateEnd)) {
+        return entries;
+    }
+
+    std::lock_guard<std::mutex> locker(db_mutex);
+    std::unique_ptr<leveldb::Iterator> it(db_conn.db->NewIterator(read_opt));
+    if (!descending) {
+        it->Seek(gkStrOp->animal_index_key(name_id, dateStart, ""));
+    } else {
+        // Record IDs never contain 0xFF, so this lies after every entry at `dateEnd`
+        it->Seek(gkStrOp->animal_index_key(name_id, dateEnd, std::string(1, '\xff')));
+        if (it->Valid()) {
+            it->Prev();
+        } else {
+            it->SeekToLast();
+        }
+    }
+
+    GkRecords::GkAnimalIndexEntry entry;
+    while (it->Valid() && it->key().starts_with(prefix) && (entries.size() < limit)) {
+        if (!gkStrOp->decode_animal_index_entry(it->key().ToString(), it->value().ToString(), prefix.size(), entry)) {
+            break;
+        }
+
+        if (descending ? (entry.date_time < dateStart) : (entry.date_time > dateEnd)) {
+            break;
+        }
+
+        entries.push_back(entry);
+        if (descending) {
+            it->Prev();
+        } else {
+            it->Next();
+        }
+    }
+
+    if (!it->status().ok()) {
+        throw std::runtime_error(it->status().ToString());
+    }
+
+    return entries;
+}
+
+/**
+ * @brief GkDbRead::read_bucket_digests reads the digest of every bucket of time within the database, which is all that
+ * needs to be compared to tell whether two databases hold the same records.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @return The digests, keyed by their bucket.
+ * @see GkStringOp::merge_bucket()
+ */
+std::map<long int, GkRecords::GkBucketDigest> GkDbRead::read_bucket_digests()
+{
+    GkTraceSpan span("GkDbRead::read_bucket_digests", "db");
+    const std::string prefix(GkRecords::LEVELDB_INDEX_BUCKET_DIGEST);
+    leveldb::ReadOptions read_opt;
+    read_opt.fill_cache = false;
+
+    std::map<long int, GkRecords::GkBucketDigest> digests;
+    std::lock_guard<std::mutex> locker(db_mutex);
+    std::unique_ptr<leveldb::Iterator> it(db_conn.db->NewIterator(read_opt));
+    for (it->Seek(prefix); it->Valid() && it->key().starts_with(prefix); it->Next()) {
+        long int bucket = 0;
+        if (gkStrOp->decode_bucket_digest_key(it->key().ToString(), bucket)) {
+            const std::string value = it->value().ToString();
+            digests[bucket] = { gkStrOp->decode_u64(value, 0), gkStrOp->decode_u64(value, 8) };
+        }
+    }
+
+    if (!it->status().ok()) {
+        throw std::runtime_error(it->status().ToString());
+    }
+
+    return digests;
+}
+
+/**
+ * @brief GkDbRead::read_record_hashes reads the leaf hash of every record within a single bucket of time, so that the
+ * records which differ between two databases can be found without reading any of the records themselves.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param bucket The bucket of time in question.
+ * @return The leaf hashes, keyed by their Record IDs.
+ * @see GkStringOp::record_leaf()
+ */
+std::map<std::string, std::uint64_t> GkDbRead::read_record_hashes(const long int &bucket)
+{
+    GkTraceSpan span("GkDbRead::read_record_hashes", "db");
+    const std::string prefix = gkStrOp->record_hash_key(bucket, "");
+    leveldb::ReadOptions read_opt;
+    read_opt.fill_cache = false;
+
+    std::map<std::string, std::uint64_t> hashes;
+    std::lock_guard<std::mutex> locker(db_mutex);
+    std::unique_ptr<leveldb::Iterator> it(db_conn.db->NewIterator(read_opt));
+    for (it->Seek(prefix); it->Valid() && it->key().starts_with(prefix); it->Next()) {
+        hashes[it->key().ToString().substr(prefix.size())] = gkStrOp->decode_u64(it->value().ToString());
+    }
+
+    if (!it->status().ok()) {
+        throw std::runtime_error(it->status().ToString());
+    }
+
+    return hashes;
+}
+
+/**
+ * @brief GkDbRead::weight_sketch merges the quantile sketches of a species' weights over the given date range into one,
+ * for finding out where a single weight stands amongst those of the species as a whole.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param species_id The Unique ID of the species in question.
+ * @param dateStart The beginning of the date range, as UNIX Epoch Time.
+ * @param dateEnd The end of the date range, as UNIX Epoch Time.
+ * @return The merged sketch, which covers every bucket of time that overlaps with the date range.
+ * @see GkQuantileSketch::rank()
+ */
+GkQuantileSketch GkDbRead::weight_sketch(const std::string &species_id, const long int &dateStart,
+                                         const long int &dateEnd)
+{
+    GkTraceSpan span("GkDbRead::weight_sketch", "db");
+    GkQuantileSketch merged;
+    for (const auto &sketch: read_weight_sketches(species_id, dateStart, dateEnd)) {
+        merged.merge(sketch.second);
+    }
+
+    return merged;
+}
+
+/**
+ * @brief GkDbRead::weight_bands works out the 10th, 50th and 90th percentiles of a species' weights over time, whereby
+ * any animal that keeps to the bottom of the band is likely to be underweight. The weights are never sorted, as each
+ * band is merged together from the quantile sketches of the weekly buckets that it spans.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param species_id The Unique ID of the species in question.
+ * @param dateStart The beginning of the date range, as UNIX Epoch Time.
+ * @param dateEnd The end of the date range, as UNIX Epoch Time.
+ * @param buckets_per_band How many weekly buckets each band spans, whereby the bands line up with the UNIX Epoch.
+ * @return The bands in chronological order, leaving out any during which no weights were measured.
+ * @see GkDbWrite::fold_weight_sketch()
+ */
+std::vector<GkRecords::GkWeightBand> GkDbRead::weight_bands(const std::string &species_id, const long int &dateStart,
+                                                            const long int &dateEnd, const long int &buckets_per_band)
+{
+    GkTraceSpan span("GkDbRead::weight_bands", "db");
+    const long int per_band = std::max(buckets_per_band, 1L);
+
+    std::vector<GkRecords::GkWeightBand> bands;
+    GkQuantileSketch merged;
+    long int current_band = 0;
+    const auto finish_band = [&]() {
+        if (merged.empty()) {
+            return;
+        }
+
+        GkRecords::GkWeightBand band;
+        band.band_start = current_band * per_band * HERPLOG_MERGE_BUCKET_SECONDS;
+        band.band_end = band.band_start + (per_band * HERPLOG_MERGE_BUCKET_SECONDS) - 1;
+        band.count = merged.count();
+        band.p10 = merged.quantile(0.1);
+        band.p50 = merged.quantile(0.5);
+        band.p90 = merged.quantile(0.9);
+        band.rank_error = merged.rank_error();
+        bands.push_back(band);
+        merged = GkQuantileSketch();
+    };
+
+    for (const auto &sketch: read_weight_sketches(species_id, dateStart, dateEnd)) {
+        long int band = sketch.first / per_band;
+        if ((sketch.first % per_band) < 0) {
+            --band;
+        }
+
+        if (band != current_band) {
+            finish_band();
+            current_band = band;
+        }
+
+        merged.merge(sketch.second);
+    }
+
+    finish_band();
+    return bands;
+}
+
+/**
+ * @brief GkDbRead::read_animal_summaries reads the rolling statistics of every animal, which takes but a single scan
+ * over a few hundred bytes per animal, no matter how many records each of them has.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @return The statistics, in no particular order. Those that are stale are still returned, as they're close enough to
+ * show until GkDbWrite::repair_animal_summaries() gets around to them.
+ * @see GkDbWrite::fold_animal_summary()
+ */
+std::vector<GkRecords::GkAnimalSummary> GkDbRead::read_animal_summaries()
+{
+    GkTraceSpan span("GkDbRead::read_animal_summaries", "db");
+    const std::string prefix(GkRecords::LEVELDB_INDEX_ANIMAL_SUMMARY);
+    leveldb::ReadOptions read_opt;
+
+    std::vector<GkRecords::GkAnimalSummary> summaries;
+    std::lock_guard<std::mutex> locker(db_mutex);
+    std::unique_ptr<leveldb::Iterator> it(db_conn.db->NewIterator(read_opt));
+    for (it->Seek(prefix); it->Valid() && it->key().starts_with(prefix); it->Next()) {
+        GkRecords::GkAnimalSummary summary;
+        if (gkStrOp->decode_animal_summary(it->key().ToString(), it->value().ToString(), summary)) {
+            summaries.push_back(summary);
+        }
+    }
+
+    if (!it->status().ok()) {
+        throw std::runtime_error(it->status().ToString());
+    }
+
+    return summaries;
+}
+
+/**
+ * @brief GkDbRead::read_alerts reads the alerts that have yet to be acknowledged.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @return The alerts, in the order in which they were raised.
+ * @see GkDbWrite::queue_alerts(), GkDbWrite::acknowledge_alerts()
+ */
+std::vector<GkRecords::GkAlert> GkDbRead::read_alerts()
+{
+    GkTraceSpan span("GkDbRead::read_alerts", "db");
+    const std::string prefix(GkRecords::LEVELDB_ALERT_QUEUE);
+    leveldb::ReadOptions read_opt;
+
+    std::vector<GkRecords::GkAlert> alerts;
+    std::lock_guard<std::mutex> locker(db_mutex);
+    std::unique_ptr<leveldb::Iterator> it(db_conn.db->NewIterator(read_opt));
+    for (it->Seek(prefix); it->Valid() && it->key().starts_with(prefix); it->Next()) {
+        GkRecords::GkAlert alert;
+        if (gkStrOp->decode_alert(it->key().ToString(), it->value().ToString(), alert)) {
+            alerts.push_back(alert);
+        }
+    }
+
+    if (!it->status().ok()) {
+        throw std::runtime_error(it->status().ToString());
+    }
+
+    return alerts;
+}
+
+/**
+ * @brief GkDbRead::read_weight_sketches reads the quantile sketches of a species' weights, one for each bucket of time
+ * that overlaps with the given date range. Any bucket that has had a record deleted from it since its sketch was last
+ * made has its sketch made anew from the records left within it, until GkDbWrite::repair_weight_sketches() gets around
+ * to writing it back.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @return The sketches in chronological order, alongside their buckets.
+ * @see GkStringOp::weight_sketch_key()
+ */
+std::vector<std::pair<long int, GkQuantileSketch>> GkDbRead::read_weight_sketches(const std::string &species_id,
+                                                                                  const long int &dateStart,
+                                                                                  const long int &dateEnd)
+{
+    const std::string prefix = gkStrOp->weight_sketch_prefix(species_id);
+    const long int first_bucket = gkStrOp->merge_bucket(dateStart);
+    const long int last_bucket = gkStrOp->merge_bucket(dateEnd);
+    leveldb::ReadOptions read_opt;
+    read_opt.fill_cache = false;
+
+    std::map<long int, GkQuantileSketch> sketches;
+    std::vector<long int> stale_buckets;
+    if (dateStart > dateEnd) {
+        return std::vector<std::pair<long int, GkQuantileSketch>>();
+    }
+
+    {
+        std::lock_guard<std::mutex> locker(db_mutex);
+        std::unique_ptr<leveldb::Iterator> it(db_conn.db->NewIterator(read_opt));
+        for (it->Seek(gkStrOp->weight_sketch_key(species_id, first_bucket));
+             it->Valid() && it->key().starts_with(prefix); it->Next()) {
+            long int bucket = 0;
+            if (!gkStrOp->decode_weight_sketch_key(it->key().ToString(), prefix.size(), bucket) || (bucket > last_bucket)) {
+                break;
+            }
+
+            GkQuantileSketch sketch;
+            if (!GkQuantileSketch::deserialise(it->value().ToString(), sketch)) {
+                throw std::runtime_error(tr("The weight sketches of this database are damaged! Please rebuild its indexes.")
+                                                 .toStdString());
+            }
+
+            sketches.emplace(bucket, std::move(sketch));
+        }
+
+        if (!it->status().ok()) {
+            throw std::runtime_error(it->status().ToString());
+        }
+
+        std::string stale_prefix(GkRecords::LEVELDB_INDEX_WEIGHT_STALE);
+        stale_prefix.append(species_id);
+        stale_prefix.push_back('\0');
+        for (it->Seek(gkStrOp->stale_weight_sketch_key(species_id, first_bucket));
+             it->Valid() && it->key().starts_with(stale_prefix); it->Next()) {
+            std::string stale_species;
+            long int bucket = 0;
+            if (!gkStrOp->decode_stale_weight_sketch_key(it->key().ToString(), stale_species, bucket) ||
+                    (bucket > last_bucket)) {
+                break;
+            }
+
+            stale_buckets.push_back(bucket);
+        }
+
+        if (!it->status().ok()) {
+            throw std::runtime_error(it->status().ToString());
+        }
+    }
+
+    for (const auto &bucket: stale_buckets) {
+        GkQuantileSketch sketch = make_weight_sketch(species_id, bucket);
+        if (sketch.empty()) {
+            sketches.erase(bucket);
+        } else {
+            sketches[bucket] = std::move(sketch);
+        }
+    }
+
+    return std::vector<std::pair<long int, GkQuantileSketch>>(std::make_move_iterator(sketches.begin()),
+                                                              std::make_move_iterator(sketches.end()));
+}
+
+/**
+ * @brief GkDbRead::make_weight_sketch makes the quantile sketch of a species' weights for a single bucket of time,
+ * straight from the records within that bucket, as found through their leaf hashes.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param species_id The Unique ID of the species.
+ * @param bucket The bucket of time in question, as given by GkStringOp::merge_bucket().
+ * @return The sketch, which is empty should there be no records of the species left within the bucket.
+ */
+GkQuantileSketch GkDbRead::make_weight_sketch(const std::string &species_id, const long int &bucket)
+{
+    GkTraceSpan span("GkDbRead::make_weight_sketch", "db");
+    GkQuantileSketch sketch;
+    for (const auto &record: read_record_hashes(bucket)) {
+        GkRecords::MiscUniqueIds unique_ids;
+        if (!get_uuid(record.first, unique_ids) || (unique_ids.species_id != species_id)) {
+            continue;
+        }
+
+        try {
+            sketch.insert(std::stod(read_item_db(record.first, GkRecords::weightMeasure)));
+        } catch (const std::exception &e) {
+            Q_UNUSED(e); // A record without a (valid) weight has nothing to add to the sketch
+        }
+    }
+
+    return sketch;
+}
+
+/**
+ * @brief GkDbRead::read_stale_weight_sketches finds every quantile sketch that has had a record deleted from its bucket
+ * since it was last made.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @return The Unique IDs of the species alongside the buckets of time, in no particular order.
+ * @see GkDbWrite::repair_weight_sketches()
+ */
+std::vector<std::pair<std::string, long int>> GkDbRead::read_stale_weight_sketches()
+{
+    GkTraceSpan span("GkDbRead::read_stale_weight_sketches", "db");
+    const std::string prefix(GkRecords::LEVELDB_INDEX_WEIGHT_STALE);
+    leveldb::ReadOptions read_opt;
+
+    std::vector<std::pair<std::string, long int>> stale;
+    std::lock_guard<std::mutex> locker(db_mutex);
+    std::unique_ptr<leveldb::Iterator> it(db_conn.db->NewIterator(read_opt));
+    for (it->Seek(prefix); it->Valid() && it->key().starts_with(prefix); it->Next()) {
+        std::string species_id;
+        long int bucket = 0;
+        if (gkStrOp->decode_stale_weight_sketch_key(it->key().ToString(), species_id, bucket)) {
+            stale.emplace_back(species_id, bucket);
+        }
+    }
+
+    if (!it->status().ok()) {
+        throw std::runtime_error(it->status().ToString());
+    }
+
+    return stale;
+}
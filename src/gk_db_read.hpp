@@ -46,6 +46,7 @@
 
 #include "options.hpp"
 #include "gk_string_op.hpp"
+#include "gk_quantile_sketch.hpp"
 #include <QtCore/QObject>
 #include <QMultiMap>
 #include <string>
@@ -55,6 +56,8 @@
 #include <utility>
 #include <unordered_map>
 #include <list>
+#include <map>
+#include <cstdint>
 
 namespace GekkoFyre {
 class GkDbRead;
@@ -69,11 +72,35 @@ public:
 
     long int determine_min_date_time(const std::vector<std::string> &record_ids);
     long int determine_max_date_time(const std::vector<std::string> &record_ids);
-    std::unordered_map<std::string, GkRecords::MiscUniqueIds> get_uuids();
+    std::unordered_map<std::string, GkRecords::MiscUniqueIds> get_uuids(const leveldb::Snapshot *snapshot = nullptr);
+    bool get_uuid(const std::string &record_id, GkRecords::MiscUniqueIds &unique_ids);
     QMultiMap<std::string, std::string> get_cat_key_vals(const GkRecords::MiscRecordType &record_type);
+    bool get_cat_name(const GkRecords::MiscRecordType &record_type, const std::string &cat_id, std::string &name);
     std::list<std::string> extract_records(const long int &dateStart, const long int &dateEnd);
+    std::list<std::string> extract_animal_records(const std::string &name_id, const long int &dateStart,
+                                                  const long int &dateEnd);
+    GkRecords::GkSubmit read_log_entry(const std::string &record_id);
+    std::vector<std::string> read_attachments(const std::string &record_id);
+    std::vector<GkRecords::GkIndexEntry> scan_timestamp_index(const std::string &after_key, const std::size_t &limit,
+                                                              const bool &descending);
+    std::vector<GkRecords::GkAnimalIndexEntry> scan_animal_index(const std::string &name_id, const long int &dateStart,
+                                                                 const long int &dateEnd, const std::size_t &limit,
+                                                                 const bool &descending = false);
+    std::map<long int, GkRecords::GkBucketDigest> read_bucket_digests();
+    std::map<std::string, std::uint64_t> read_record_hashes(const long int &bucket);
+    GkQuantileSketch weight_sketch(const std::string &species_id, const long int &dateStart, const long int &dateEnd);
+    GkQuantileSketch make_weight_sketch(const std::string &species_id, const long int &bucket);
+    std::vector<std::pair<std::string, long int>> read_stale_weight_sketches();
+    std::vector<GkRecords::GkWeightBand> weight_bands(const std::string &species_id, const long int &dateStart,
+                                                      const long int &dateEnd, const long int &buckets_per_band = 1);
+    std::vector<GkRecords::GkAnimalSummary> read_animal_summaries();
+    std::vector<GkRecords::GkAlert> read_alerts();
 
 private:
+    std::vector<std::pair<long int, GkQuantileSketch>> read_weight_sketches(const std::string &species_id,
+                                                                            const long int &dateStart,
+                                                                            const long int &dateEnd);
+
     std::shared_ptr<GkStringOp> gkStrOp;
     GkFile::FileDb db_conn;
 
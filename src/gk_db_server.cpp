@@ -0,0 +1,675 @@
+/**
+ **  _   _                 _
+ ** | | | |               | |
+ ** | |_| | ___ _ __ _ __ | |     ___   __ _
+ ** |  _  |/ _ \ '__| '_ \| |    / _ \ / _` |
+ ** | | | |  __/ |  | |_) | |___| (_) | (_| |
+ ** \_| |_/\___|_|  | .__/\_____/\___/ \__, |
+ **                 | |                 __/ |
+ **                 |_|                |___/
+ **
+ **   Thank you for using "HerpLog" for your herpetology management requirements!
+ **   Copyright (C) 2017-2018. GekkoFyre.
+ **
+ **
+ **   HerpLog is free software: you can redistribute it and/or modify
+ **   it under the terms of the GNU General Public License as published by
+ **   the Free Software Foundation, either version 3 of the License, or
+ **   (at your option) any later version.
+ **
+ **   HerpLog is distributed in the hope that it will be useful,
+ **   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **   GNU General Public License for more details.
+ **
+ **   You should have received a copy of the GNU General Public License
+ **   along with HerpLog.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ **
+ **   The latest source code updates can be obtained from [ 1 ] below at your
+ **   discretion. A web-browser or the 'git' application may be required.
+ **
+ **   [ 1 ] - https://github.com/GekkoFyre/HerpLog
+ **
+ ********************************************************************************/
+
+/**
+ * @file gk_db_server.cpp
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @brief The HerpLog service, which owns a Google LevelDB database on behalf of several HerpLog processes at once and
+ * serves them over a Unix domain socket. Reads are answered concurrently, each upon their client's own thread, while
+ * writes are serialised through a single writer that commits them in groups.
+ */
+
+#include "gk_db_server.hpp"
+#include "gk_trace.hpp"
+#include <boost/filesystem.hpp>
+#include <QDir>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <chrono>
+#include <cstring>
+#include <exception>
+#include <functional>
+#include <iomanip>
+#include <sstream>
+#include <vector>
+
+using namespace GekkoFyre;
+using namespace GkService;
+
+namespace {
+/**
+ * @brief The GkBatchMerger class appends each of the operations within one WriteBatch onto another, so that a group of
+ * client writes can be committed (and synced) all at once.
+ */
+class GkBatchMerger : public leveldb::WriteBatch::Handler {
+
+public:
+    explicit GkBatchMerger(leveldb::WriteBatch &merged) : target(merged) {}
+
+    void Put(const leveldb::Slice &key, const leveldb::Slice &value) override { target.Put(key, value); }
+    void Delete(const leveldb::Slice &key) override { target.Delete(key); }
+
+private:
+    leveldb::WriteBatch &target;
+};
+
+std::string failure(const std::string &message)
+{
+    GkWireWriter response;
+    response.put_u8(GkStatus::Failed).put_string(message);
+    return response.data();
+}
+
+std::string status_response(const leveldb::Status &s)
+{
+    if (s.ok()) {
+        return std::string(1, static_cast<char>(GkStatus::Ok));
+    } else if (s.IsNotFound()) {
+        return std::string(1, static_cast<char>(GkStatus::NotFound));
+    }
+
+    return failure(s.ToString());
+}
+}
+
+GkDbServer::GkDbServer(const GkFile::FileDb &gk_db_conn) : stopping(false), next_client_id(1), lease_holder(0)
+{
+    db_conn = gk_db_conn;
+}
+
+GkDbServer::~GkDbServer()
+{
+    stop();
+}
+
+/**
+ * @brief GkDbServer::socket_path_for works out where the service for the given HerpLog Database File listens, so that
+ * every HerpLog process on this computer agrees upon the very same socket without having to be told.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param db_file The HerpLog Database File (i.e. `*.hdb`) that is being served.
+ * @return The path to the socket, within the temporary directory.
+ */
+std::string GkDbServer::socket_path_for(const std::string &db_file)
+{
+    // The full path of the database is hashed, as Unix domain sockets have a rather short limit upon their length
+    const std::string abs_path = fs::absolute(fs::path(db_file)).string();
+    std::ostringstream oss;
+    oss << QDir::tempPath().toStdString() << fs::path::preferred_separator << "herplog-" << std::hex << std::setw(16)
+        << std::setfill('0') << std::hash<std::string>()(abs_path) << ".sock";
+    return oss.str();
+}
+
+/**
+ * @brief GkDbServer::start begins listening for clients upon the given socket, along with starting up the writer.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param socket_path Where to listen, as given by GkDbServer::socket_path_for().
+ * @note A socket that's left over from a service that did not shut down cleanly is replaced, but one that is still
+ * being listened upon is not.
+ */
+void GkDbServer::start(const std::string &socket_path)
+{
+    if (GkSocket::connect_to(socket_path).is_open()) {
+        throw std::runtime_error("This database is already being served by another HerpLog service!");
+    }
+
+    ::unlink(socket_path.c_str());
+
+    sockaddr_un addr;
+    std::memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    if (socket_path.size() >= sizeof(addr.sun_path)) {
+        throw std::invalid_argument("The path to the HerpLog service's socket is too long!");
+    }
+
+    std::strncpy(addr.sun_path, socket_path.c_str(), sizeof(addr.sun_path) - 1);
+    GkSocket sock(::socket(AF_UNIX, SOCK_STREAM, 0));
+    if (!sock.is_open() || (::bind(sock.fd(), reinterpret_cast<sockaddr *>(&addr), sizeof(addr)) != 0) ||
+            (::listen(sock.fd(), SOMAXCONN) != 0)) {
+        throw std::runtime_error(std::string("Unable to listen upon the HerpLog service's socket: ") + std::strerror(errno));
+    }
+
+    // Every keeper at the facility may be logged in as a different user, so those within the same group are let in too
+    ::chmod(socket_path.c_str(), S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP);
+
+    listener = std::move(sock);
+    listen_path = socket_path;
+    stopping = false;
+    writer_thread = std::thread(&GkDbServer::writer_loop, this);
+    accept_thread = std::thread(&GkDbServer::accept_loop, this);
+
+    return;
+}
+
+/**
+ * @brief GkDbServer::stop disconnects every client, commits whatever writes are still outstanding, and stops listening.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ */
+void GkDbServer::stop()
+{
+    if (!listener.is_open()) {
+        return;
+    }
+
+    stopping = true;
+    listener.shutdown(); // Wakes up accept()
+    if (accept_thread.joinable()) {
+        accept_thread.join();
+    }
+
+    {
+        std::lock_guard<std::mutex> locker(clients_mutex);
+        for (const auto &client: clients) {
+            client->socket.shutdown();
+        }
+    }
+
+    lease_cv.notify_all();
+    feed_cv.notify_all();
+    reap_clients(true);
+
+    writes_cv.notify_all();
+    if (writer_thread.joinable()) {
+        writer_thread.join();
+    }
+
+    listener.close();
+    ::unlink(listen_path.c_str());
+    return;
+}
+
+std::size_t GkDbServer::client_count()
+{
+    std::lock_guard<std::mutex> locker(clients_mutex);
+    std::size_t count = 0;
+    for (const auto &client: clients) {
+        if (!client->finished) {
+            ++count;
+        }
+    }
+
+    return count;
+}
+
+void GkDbServer::accept_loop()
+{
+    while (!stopping) {
+        const int fd = ::accept(listener.fd(), nullptr, nullptr);
+        if (fd < 0) {
+            if (errno == EINTR || errno == ECONNABORTED) {
+                continue;
+            }
+
+            break;
+        }
+
+        auto client = std::make_shared<GkClient>();
+        client->socket = GkSocket(fd);
+        client->next_snapshot_id = 1;
+        client->finished = false;
+
+        reap_clients(false);
+        std::lock_guard<std::mutex> locker(clients_mutex);
+        client->id = next_client_id++;
+        clients.push_back(client);
+        client->thread = std::thread(&GkDbServer::serve_client, this, client);
+    }
+
+    return;
+}
+
+/**
+ * @brief GkDbServer::serve_client answers the requests of a single client, one after the other, until it disconnects.
+ * Whatever snapshots and lease the client still holds at that point are let go of.
+ */
+void GkDbServer::serve_client(const std::shared_ptr<GkClient> &client)
+{
+    GkTrace::set_thread_name("GkDbServer client");
+    std::string request;
+    while (!stopping && client->socket.recv_frame(request)) {
+        std::string response;
+        try {
+            response = handle_request(*client, request);
+        } catch (const std::exception &e) {
+            response = failure(e.what());
+        }
+
+        if (!client->socket.send_frame(response)) {
+            break;
+        }
+    }
+
+    for (const auto &snapshot: client->snapshots) {
+        db_conn.db->ReleaseSnapshot(snapshot.second);
+    }
+
+    client->snapshots.clear();
+    release_lease(*client);
+    client->finished = true;
+    return;
+}
+
+std::string GkDbServer::handle_request(GkClient &client, const std::string &request)
+{
+    GkWireReader in(request);
+    GkWireWriter out;
+    out.put_u8(GkStatus::Ok);
+
+    auto read_options = [&client, &in]() {
+        leveldb::ReadOptions read_opt;
+        const std::uint64_t snapshot_id = in.get_varint();
+        if (snapshot_id != 0) {
+            auto it = client.snapshots.find(snapshot_id);
+            if (it == client.snapshots.end()) {
+                throw std::invalid_argument("Unknown snapshot!");
+            }
+
+            read_opt.snapshot = it->second;
+        }
+
+        return read_opt;
+    };
+
+    switch (in.get_u8()) {
+        case GkOpcode::Hello:
+            if (in.get_varint() != HERPLOG_SERVICE_PROTOCOL_VERSION) {
+                return failure("This version of HerpLog cannot talk to the service, as it speaks a different protocol!");
+            }
+
+            out.put_varint(HERPLOG_SERVICE_PROTOCOL_VERSION);
+            break;
+        case GkOpcode::Get:
+        {
+            leveldb::ReadOptions read_opt = read_options();
+            read_opt.verify_checksums = (in.get_u8() != 0);
+            std::string value;
+            leveldb::Status s = db_conn.db->Get(read_opt, in.get_string(), &value);
+            if (!s.ok()) {
+                return status_response(s);
+            }
+
+            out.put_string(value);
+        }
+
+            break;
+        case GkOpcode::Write:
+        {
+            const bool sync = (in.get_u8() != 0);
+            leveldb::WriteBatch batch;
+            in.get_batch(batch);
+            leveldb::Status s = submit_write(batch, sync);
+            if (!s.ok()) {
+                return status_response(s);
+            }
+        }
+
+            break;
+        case GkOpcode::Scan:
+        {
+            leveldb::ReadOptions read_opt = read_options();
+            read_opt.fill_cache = (in.get_u8() != 0);
+            const std::uint8_t mode = in.get_u8();
+            const std::string key = in.get_string();
+            const std::uint64_t limit = std::min<std::uint64_t>(in.get_varint(), HERPLOG_SERVICE_SCAN_PAGE_MAX);
+
+            std::unique_ptr<leveldb::Iterator> it(db_conn.db->NewIterator(read_opt));
+            bool forward = true;
+            switch (mode) {
+                case GkScanMode::First:
+                    it->SeekToFirst();
+                    break;
+                case GkScanMode::Last:
+                    it->SeekToLast();
+                    forward = false;
+                    break;
+                case GkScanMode::AtOrAfter:
+                    it->Seek(key);
+                    break;
+                case GkScanMode::After:
+                    it->Seek(key);
+                    if (it->Valid() && it->key() == leveldb::Slice(key)) {
+                        it->Next();
+                    }
+
+                    break;
+                case GkScanMode::Before:
+                    it->Seek(key);
+                    if (it->Valid()) {
+                        it->Prev();
+                    } else {
+                        it->SeekToLast();
+                    }
+
+                    forward = false;
+                    break;
+                default:
+                    return failure("Unknown scan!");
+            }
+
+            std::vector<std::pair<std::string, std::string>> entries;
+            while (it->Valid() && (entries.size() < limit)) {
+                entries.emplace_back(it->key().ToString(), it->value().ToString());
+                if (forward) {
+                    it->Next();
+                } else {
+                    it->Prev();
+                }
+            }
+
+            if (!it->status().ok()) {
+                return status_response(it->status());
+            }
+
+            out.put_varint(entries.size());
+            for (const auto &entry: entries) {
+                out.put_string(entry.first).put_string(entry.second);
+            }
+        }
+
+            break;
+        case GkOpcode::SnapshotAcquire:
+        {
+            const std::uint64_t snapshot_id = client.next_snapshot_id++;
+            client.snapshots[snapshot_id] = db_conn.db->GetSnapshot();
+            out.put_varint(snapshot_id);
+        }
+
+            break;
+        case GkOpcode::SnapshotRelease:
+        {
+            auto it = client.snapshots.find(in.get_varint());
+            if (it != client.snapshots.end()) {
+                db_conn.db->ReleaseSnapshot(it->second);
+                client.snapshots.erase(it);
+            }
+        }
+
+            break;
+        case GkOpcode::LeaseAcquire:
+            acquire_lease(client);
+            if (stopping) {
+                return failure("The HerpLog service is shutting down!");
+            }
+
+            break;
+        case GkOpcode::LeaseRelease:
+            release_lease(client);
+            break;
+        case GkOpcode::Property:
+        {
+            std::string value;
+            if (!db_conn.db->GetProperty(in.get_string(), &value)) {
+                return status_response(leveldb::Status::NotFound(leveldb::Slice()));
+            }
+
+            out.put_string(value);
+        }
+
+            break;
+        case GkOpcode::ApproximateSizes:
+        {
+            const std::uint64_t n = in.get_varint();
+            std::vector<std::string> bounds;
+            for (std::uint64_t i = 0; i < n * 2; ++i) {
+                bounds.push_back(in.get_string());
+            }
+
+            std::vector<leveldb::Range> ranges;
+            for (std::size_t i = 0; i < bounds.size(); i += 2) {
+                ranges.emplace_back(bounds[i], bounds[i + 1]);
+            }
+
+            std::vector<std::uint64_t> sizes(ranges.size());
+            db_conn.db->GetApproximateSizes(ranges.data(), static_cast<int>(ranges.size()), sizes.data());
+            for (const auto &size: sizes) {
+                out.put_varint(size);
+            }
+        }
+
+            break;
+        case GkOpcode::Compact:
+        {
+            const bool has_begin = (in.get_u8() != 0);
+            const std::string begin = in.get_string();
+            const bool has_end = (in.get_u8() != 0);
+            const std::string end = in.get_string();
+            const leveldb::Slice begin_slice(begin), end_slice(end);
+            db_conn.db->CompactRange(has_begin ? &begin_slice : nullptr, has_end ? &end_slice : nullptr);
+        }
+
+            break;
+        case GkOpcode::Publish:
+        {
+            std::vector<GkRecords::GkChange> changes;
+            in.get_changes(changes);
+            publish_changes(changes);
+        }
+
+            break;
+        case GkOpcode::FeedSince:
+        {
+            const std::uint64_t after_sequence = in.get_varint();
+            const std::uint64_t wait_ms = std::min<std::uint64_t>(in.get_varint(), HERPLOG_SERVICE_FEED_WAIT_MS);
+            std::vector<GkRecords::GkChange> changes;
+            changes_since(after_sequence, static_cast<int>(wait_ms), changes);
+            out.put_changes(changes);
+        }
+
+            break;
+        default:
+            return failure("Unknown request!");
+    }
+
+    return out.data();
+}
+
+/**
+ * @brief GkDbServer::submit_write hands a client's WriteBatch over to the writer, and waits until it has been committed.
+ * @return The outcome of the (group) commit that the WriteBatch ended up being a part of.
+ */
+leveldb::Status GkDbServer::submit_write(leveldb::WriteBatch &batch, const bool &sync)
+{
+    auto pending = std::make_shared<GkPendingWrite>();
+    std::swap(pending->batch, batch);
+    pending->sync = sync;
+    std::future<leveldb::Status> done = pending->done.get_future();
+
+    {
+        std::lock_guard<std::mutex> locker(writes_mutex);
+        writes.push_back(pending);
+    }
+
+    writes_cv.notify_one();
+    return done.get();
+}
+
+/**
+ * @brief GkDbServer::writer_loop commits the writes of every client, strictly in the order they arrived. Whatever has
+ * queued up whilst the previous commit was being synced to disk gets merged into a single WriteBatch, so that a crowd
+ * of clients only pays for the one sync between them.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ */
+void GkDbServer::writer_loop()
+{
+    GkTrace::set_thread_name("GkDbServer writer");
+    while (true) {
+        std::vector<std::shared_ptr<GkPendingWrite>> group;
+        {
+            std::unique_lock<std::mutex> locker(writes_mutex);
+            writes_cv.wait(locker, [this]() { return stopping || !writes.empty(); });
+            if (writes.empty()) {
+                return; // Only ever stop once everything that was queued up has been committed
+            }
+
+            while (!writes.empty() && (group.size() < HERPLOG_SERVICE_GROUP_COMMIT_MAX)) {
+                group.push_back(writes.front());
+                writes.pop_front();
+            }
+        }
+
+        GkTrace::counter("GkDbServer::group_commit", static_cast<double>(group.size()));
+        GkTraceSpan span("GkDbServer::group_commit", "db");
+
+        leveldb::WriteBatch merged;
+        leveldb::WriteOptions write_options;
+        write_options.sync = false;
+
+        GkBatchMerger merger(merged);
+        leveldb::Status s;
+        for (const auto &pending: group) {
+            write_options.sync = write_options.sync || pending->sync;
+            s = pending->batch.Iterate(&merger);
+            if (!s.ok()) {
+                break;
+            }
+        }
+
+        if (s.ok()) {
+            s = db_conn.db->Write(write_options, &merged);
+        }
+
+        for (const auto &pending: group) {
+            pending->done.set_value(s);
+        }
+    }
+}
+
+/**
+ * @brief GkDbServer::acquire_lease waits until the given client is the only one that may read-modify-write the
+ * database, such as when GkDbWrite folds a record into the shared aggregates. Plain reads and writes are never held up
+ * by the lease.
+ */
+void GkDbServer::acquire_lease(const GkClient &client)
+{
+    std::unique_lock<std::mutex> locker(lease_mutex);
+    lease_cv.wait(locker, [this, &client]() { return stopping || (lease_holder == 0) || (lease_holder == client.id); });
+    if (!stopping) {
+        lease_holder = client.id;
+    }
+
+    return;
+}
+
+void GkDbServer::release_lease(const GkClient &client)
+{
+    {
+        std::lock_guard<std::mutex> locker(lease_mutex);
+        if (lease_holder != client.id) {
+            return;
+        }
+
+        lease_holder = 0;
+    }
+
+    lease_cv.notify_all();
+    return;
+}
+
+/**
+ * @brief GkDbServer::publish_changes keeps hold of the changes that a client has just committed, and wakes up any of
+ * the other clients that are waiting upon them. The write lease has the clients publish in the order of their sequence
+ * numbers, so anything that would go backwards is a duplicate and is dropped.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param changes The changes that have been committed, as numbered by the client's GkChangeFeed.
+ */
+void GkDbServer::publish_changes(const std::vector<GkRecords::GkChange> &changes)
+{
+    {
+        std::lock_guard<std::mutex> locker(feed_mutex);
+        for (const auto &change: changes) {
+            if (feed_backlog.empty() || (change.sequence > feed_backlog.back().sequence)) {
+                feed_backlog.push_back(change);
+            }
+        }
+
+        while (feed_backlog.size() > HERPLOG_CHANGE_FEED_BACKLOG) {
+            feed_backlog.pop_front();
+        }
+    }
+
+    feed_cv.notify_all();
+    return;
+}
+
+/**
+ * @brief GkDbServer::changes_since hands over whatever changes have been published after the given sequence number,
+ * waiting a while for some to turn up should there be none as of yet.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param after_sequence The last sequence number that the client has seen.
+ * @param wait_ms How long to wait for any changes, if at all.
+ * @param changes_out The changes that the client has yet to see, oldest first.
+ */
+void GkDbServer::changes_since(const std::uint64_t &after_sequence, const int &wait_ms,
+                               std::vector<GkRecords::GkChange> &changes_out)
+{
+    std::unique_lock<std::mutex> locker(feed_mutex);
+    feed_cv.wait_for(locker, std::chrono::milliseconds(wait_ms), [this, &after_sequence]() {
+        return stopping || (!feed_backlog.empty() && (feed_backlog.back().sequence > after_sequence));
+    });
+
+    for (const auto &change: feed_backlog) {
+        if (change.sequence > after_sequence) {
+            changes_out.push_back(change);
+        }
+    }
+
+    return;
+}
+
+/**
+ * @brief GkDbServer::reap_clients joins the threads of those clients that have disconnected.
+ * @param all Whether to wait upon every client, rather than just those that have finished already.
+ */
+void GkDbServer::reap_clients(const bool &all)
+{
+    std::list<std::shared_ptr<GkClient>> reaped;
+    {
+        std::lock_guard<std::mutex> locker(clients_mutex);
+        for (auto it = clients.begin(); it != clients.end();) {
+            if (all || (*it)->finished) {
+                reaped.push_back(*it);
+                it = clients.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    for (const auto &client: reaped) {
+        if (client->thread.joinable()) {
+            client->thread.join();
+        }
+    }
+
+    return;
+}
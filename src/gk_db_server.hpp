@@ -0,0 +1,136 @@
+/**
+ **  _   _                 _
+ ** | | | |               | |
+ ** | |_| | ___ _ __ _ __ | |     ___   __ _
+ ** |  _  |/ _ \ '__| '_ \| |    / _ \ / _` |
+ ** | | | |  __/ |  | |_) | |___| (_) | (_| |
+ ** \_| |_/\___|_|  | .__/\_____/\___/ \__, |
+ **                 | |                 __/ |
+ **                 |_|                |___/
+ **
+ **   Thank you for using "HerpLog" for your herpetology management requirements!
+ **   Copyright (C) 2017-2018. GekkoFyre.
+ **
+ **
+ **   HerpLog is free software: you can redistribute it and/or modify
+ **   it under the terms of the GNU General Public License as published by
+ **   the Free Software Foundation, either version 3 of the License, or
+ **   (at your option) any later version.
+ **
+ **   HerpLog is distributed in the hope that it will be useful,
+ **   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **   GNU General Public License for more details.
+ **
+ **   You should have received a copy of the GNU General Public License
+ **   along with HerpLog.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ **
+ **   The latest source code updates can be obtained from [ 1 ] below at your
+ **   discretion. A web-browser or the 'git' application may be required.
+ **
+ **   [ 1 ] - https://github.com/GekkoFyre/HerpLog
+ **
+ ********************************************************************************/
+
+/**
+ * @file gk_db_server.hpp
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @brief The HerpLog service, which owns a Google LevelDB database on behalf of several HerpLog processes at once and
+ * serves them over a Unix domain socket. Reads are answered concurrently, each upon their client's own thread, while
+ * writes are serialised through a single writer that commits them in groups. The changes that each client publishes
+ * are passed along to all of the others.
+ */
+
+#ifndef GK_DB_SERVER_HPP
+#define GK_DB_SERVER_HPP
+
+#include "options.hpp"
+#include "gk_db_protocol.hpp"
+#include <leveldb/db.h>
+#include <leveldb/write_batch.h>
+#include <condition_variable>
+#include <unordered_map>
+#include <future>
+#include <thread>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+#include <mutex>
+#include <deque>
+#include <list>
+
+namespace GekkoFyre {
+class GkDbServer;
+
+class GkDbServer {
+
+public:
+    explicit GkDbServer(const GkFile::FileDb &gk_db_conn);
+    ~GkDbServer();
+
+    GkDbServer(const GkDbServer &) = delete;
+    GkDbServer &operator=(const GkDbServer &) = delete;
+
+    static std::string socket_path_for(const std::string &db_file);
+
+    void start(const std::string &socket_path);
+    void stop();
+    std::size_t client_count();
+
+private:
+    struct GkClient {
+        GkSocket socket;
+        std::uint64_t id;
+        std::thread thread;
+        std::unordered_map<std::uint64_t, const leveldb::Snapshot *> snapshots; // Only ever touched by `thread`
+        std::uint64_t next_snapshot_id;
+        std::atomic<bool> finished;
+    };
+
+    struct GkPendingWrite {
+        leveldb::WriteBatch batch;
+        bool sync;
+        std::promise<leveldb::Status> done;
+    };
+
+    void accept_loop();
+    void serve_client(const std::shared_ptr<GkClient> &client);
+    std::string handle_request(GkClient &client, const std::string &request);
+    leveldb::Status submit_write(leveldb::WriteBatch &batch, const bool &sync);
+    void writer_loop();
+    void acquire_lease(const GkClient &client);
+    void release_lease(const GkClient &client);
+    void publish_changes(const std::vector<GkRecords::GkChange> &changes);
+    void changes_since(const std::uint64_t &after_sequence, const int &wait_ms,
+                       std::vector<GkRecords::GkChange> &changes_out);
+    void reap_clients(const bool &all);
+
+    GkFile::FileDb db_conn;
+    GkSocket listener;
+    std::string listen_path;
+    std::thread accept_thread;
+    std::thread writer_thread;
+    std::atomic<bool> stopping;
+
+    std::list<std::shared_ptr<GkClient>> clients;
+    std::uint64_t next_client_id;
+    std::mutex clients_mutex;
+
+    std::deque<std::shared_ptr<GkPendingWrite>> writes;
+    std::mutex writes_mutex;
+    std::condition_variable writes_cv;
+
+    std::uint64_t lease_holder; // The client that may currently read-modify-write the database, or zero for nobody
+    std::mutex lease_mutex;
+    std::condition_variable lease_cv;
+
+    std::deque<GkRecords::GkChange> feed_backlog; // The most recently published changes of every client, oldest first
+    std::mutex feed_mutex;
+    std::condition_variable feed_cv;
+};
+}
+
+#endif // GK_DB_SERVER_HPP
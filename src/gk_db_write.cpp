@@ -42,6 +42,13 @@
  */
 
 #include "gk_db_write.hpp"
+#include "gk_trace.hpp"
+#include "gk_remote_db.hpp"
+#include "gk_text_index.hpp"
+#include "gk_quantile_sketch.hpp"
+#include "gk_animal_stats.hpp"
+#include "gk_flag_index.hpp"
+#include "gk_bitmap.hpp"
 #include "3rd_party/minicsv/minicsv.h"
 #include <boost/exception/all.hpp>
 #include <boost/uuid/uuid_generators.hpp>
@@ -51,7 +58,6 @@
 #include <leveldb/db.h>
 #include <leveldb/write_batch.h>
 #include <leveldb/cache.h>
-#include <QMessageBox>
 #include <QVector>
 #include <QMap>
 #include <random>
@@ -59,21 +65,743 @@
 #include <sstream>
 #include <utility>
 #include <algorithm>
+#include <iterator>
 #include <vector>
+#include <map>
+#include <set>
+#include <limits>
+#include <tuple>
+#include <unordered_map>
 
 using namespace GekkoFyre;
 using namespace mini;
+
+namespace {
+GkRecords::GkChange make_change(const GkRecords::GkChangeType &type, const std::string &id,
+                                const GkRecords::MiscRecordType &category = GkRecords::MiscRecordType::None,
+                                const std::string &name = "")
+{
+    GkRecords::GkChange change;
+    change.sequence = 0;
+    change.type = type;
+    change.id = id;
+    change.category = category;
+    change.name = name;
+    return change;
+}
+
+/**
+ * @brief The GkWriteLease class holds onto the HerpLog service's write lease for as long as it's in scope, so that no
+ * other HerpLog process can slip a write in between our reading of one of the shared aggregates (the bucket digests,
+ * sketches, summaries, flag index, photo reference counts and the change feed's sequence) and our writing of it back.
+ * A record's own keys need no such protection, so it should be taken as late as possible. When the database is one of
+ * our own, it does nothing at all.
+ */
+class GkWriteLease {
+
+public:
+    explicit GkWriteLease(const GkFile::FileDb &db_conn) : remote_db(GkRemoteDb::from(db_conn))
+    {
+        if (remote_db != nullptr) {
+            remote_db->acquire_lease();
+        }
+    }
+
+    ~GkWriteLease()
+    {
+        if (remote_db != nullptr) {
+            remote_db->release_lease();
+        }
+    }
+
+private:
+    GkRemoteDb *remote_db;
+};
+}
+
 GkDbWrite::GkDbWrite(const GkFile::FileDb &gk_db_conn, const std::shared_ptr<GkDbRead> &gk_db_read,
                      const std::shared_ptr<GkStringOp> &gk_str_op, QObject *parent) : QObject(parent)
 {
+    // Needed so that `alerts_raised()` can be queued up for the GUI thread when emitted upon the database thread
+    qRegisterMetaType<std::vector<GkRecords::GkAlert>>("std::vector<GkRecords::GkAlert>");
+
     db_conn = gk_db_conn;
     gkDbRead = gk_db_read;
     gkStrOp = gk_str_op;
+    gkChangeFeed = std::make_shared<GkChangeFeed>(db_conn, nullptr);
+    indexes_stale = false;
 }
 
 GkDbWrite::~GkDbWrite()
 {}
 
+/**
+ * @brief GkDbWrite::change_feed is where anything that needs to know about the changes being made to the database can
+ * subscribe to them.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ */
+std::shared_ptr<GkChangeFeed> GkDbWrite::change_feed() const
+{
+    return gkChangeFeed;
+}
+
+/**
+ * @brief GkDbWrite::commit writes the given WriteBatch to the Google LevelDB database, and once it has been committed,
+ * publishes the changes that it made upon the change feed.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param batch The WriteBatch to be committed.
+ * @param changes The changes that the WriteBatch makes, if any are of interest to the subscribers.
+ * @note Subscribers are let know whilst the database is still locked, so any that are connected directly (rather than
+ * queued) must not write to the database from within their slots.
+ * @see GkChangeFeed::changes_committed()
+ */
+void GkDbWrite::commit(leveldb::WriteBatch &batch, std::vector<GkRecords::GkChange> changes)
+{
+    GkTraceSpan span("GkDbWrite::commit", "db");
+    leveldb::WriteOptions write_options;
+    write_options.sync = true;
+
+    {
+        // The change feed's sequence is shared with any other HerpLog processes, so it too is read under the lease
+        GkWriteLease lease(db_conn);
+        std::lock_guard<std::mutex> locker(db_mutex);
+        gkChangeFeed->stamp(changes, batch);
+        leveldb::Status s;
+        s = db_conn.db->Write(write_options, &batch);
+        if (!s.ok()) {
+            throw std::runtime_error(s.ToString());
+        }
+
+        gkChangeFeed->publish(changes);
+    }
+
+    if (indexes_stale) {
+        // Whatever could not be folded into the indexes within the batch itself is put right before returning, rather
+        // than being left wrong until the next time that the database is opened
+        indexes_stale = false;
+        rebuild_indexes(true);
+    }
+
+    return;
+}
+
+/**
+ * @brief GkDbWrite::stale_indexes is the fallback for whenever a write cannot be folded into the indexes within its own
+ * WriteBatch, such as when an index entry it relies upon is damaged. The indexes are then rebuilt as soon as the batch
+ * has been committed, and should HerpLog be closed before then, the next time that the database is opened.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param batch The WriteBatch that could not be folded into the indexes.
+ * @see GkDbWrite::commit(), GkDbWrite::rebuild_indexes()
+ */
+void GkDbWrite::stale_indexes(leveldb::WriteBatch &batch)
+{
+    batch.Delete(GkRecords::LEVELDB_INDEX_VERSION);
+    indexes_stale = true;
+    return;
+}
+
+/**
+ * @brief GkDbWrite::fold_record_hash adds a record's leaf hash to (or takes it away from) the digest of its bucket, and
+ * (un)files the leaf hash itself, so that GkDbMerge can tell which buckets and records differ between two databases.
+ * As the digest is just an XOR of the leaves, the order in which the records come and go makes no difference.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param batch The WriteBatch that the record itself is being written or deleted within.
+ * @param bucket The bucket of time that the record falls within.
+ * @param record_id The Unique ID of the record.
+ * @param leaf The leaf hash of the record, as given by GkStringOp::record_leaf().
+ * @param inserted Whether the record is being inserted, rather than deleted.
+ * @see GkStringOp::merge_bucket()
+ */
+void GkDbWrite::fold_record_hash(leveldb::WriteBatch &batch, const long int &bucket, const std::string &record_id,
+                                 const std::uint64_t &leaf, const bool &inserted)
+{
+    const std::string digest_key = gkStrOp->bucket_digest_key(bucket);
+    std::string value;
+    leveldb::Status s;
+    s = db_conn.db->Get(leveldb::ReadOptions(), digest_key, &value);
+    if (!s.ok() && !s.IsNotFound()) {
+        throw std::runtime_error(s.ToString());
+    }
+
+    const std::uint64_t digest = gkStrOp->decode_u64(value, 0) ^ leaf;
+    std::uint64_t count = gkStrOp->decode_u64(value, 8);
+    if (inserted) {
+        ++count;
+        batch.Put(gkStrOp->record_hash_key(bucket, record_id), gkStrOp->encode_u64(leaf));
+    } else {
+        count = (count > 0) ? (count - 1) : 0;
+        batch.Delete(gkStrOp->record_hash_key(bucket, record_id));
+    }
+
+    if (count == 0) {
+        batch.Delete(digest_key);
+    } else {
+        batch.Put(digest_key, gkStrOp->encode_u64(digest) + gkStrOp->encode_u64(count));
+    }
+
+    return;
+}
+
+/**
+ * @brief GkDbWrite::fold_record_hash swaps a record's old leaf hash for its new one, within both the digest of its
+ * bucket and the record's own entry, for when one of its fields has been edited in place.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param batch The WriteBatch that the edit itself is being written within.
+ * @param bucket The bucket of time that the record falls within, both before and after the edit.
+ * @param record_id The Unique ID of the record.
+ * @param old_leaf The leaf hash of the record as it was, as filed under GkStringOp::record_hash_key().
+ * @param new_leaf The leaf hash of the record as it is now.
+ */
+void GkDbWrite::fold_record_hash(leveldb::WriteBatch &batch, const long int &bucket, const std::string &record_id,
+                                 const std::uint64_t &old_leaf, const std::uint64_t &new_leaf)
+{
+    const std::string digest_key = gkStrOp->bucket_digest_key(bucket);
+    std::string value;
+    leveldb::Status s;
+    s = db_conn.db->Get(leveldb::ReadOptions(), digest_key, &value);
+    if (s.IsNotFound()) {
+        stale_indexes(batch); // The record's bucket has gone missing, so have the indexes rebuilt
+        return;
+    } else if (!s.ok()) {
+        throw std::runtime_error(s.ToString());
+    }
+
+    const std::uint64_t digest = gkStrOp->decode_u64(value, 0) ^ old_leaf ^ new_leaf;
+    batch.Put(gkStrOp->record_hash_key(bucket, record_id), gkStrOp->encode_u64(new_leaf));
+    batch.Put(digest_key, gkStrOp->encode_u64(digest) + gkStrOp->encode_u64(gkStrOp->decode_u64(value, 8)));
+    return;
+}
+
+/**
+ * @brief GkDbWrite::fold_weight_sketch adds a newly measured weight to the quantile sketch of its species, for the
+ * bucket of time that the record falls within.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param batch The WriteBatch that the record itself is being written within.
+ * @param species_id The Unique ID of the species that the record is filed under.
+ * @param bucket The bucket of time that the record falls within.
+ * @param weight The weight of the lizard, as measured in this record.
+ * @see GkDbRead::weight_bands()
+ */
+void GkDbWrite::fold_weight_sketch(leveldb::WriteBatch &batch, const std::string &species_id, const long int &bucket,
+                                   const double &weight)
+{
+    const std::string sketch_key = gkStrOp->weight_sketch_key(species_id, bucket);
+    std::string value;
+    leveldb::Status s;
+    s = db_conn.db->Get(leveldb::ReadOptions(), sketch_key, &value);
+    if (!s.ok() && !s.IsNotFound()) {
+        throw std::runtime_error(s.ToString());
+    }
+
+    GkQuantileSketch sketch;
+    if (s.ok() && !GkQuantileSketch::deserialise(value, sketch)) {
+        stale_indexes(batch); // The sketch is damaged, so have the indexes rebuilt
+        return;
+    }
+
+    sketch.insert(weight);
+    batch.Put(sketch_key, sketch.serialise());
+    return;
+}
+
+/**
+ * @brief GkDbWrite::unfold_weight_sketch takes a record's weight away from the quantile sketch of its species. A sketch
+ * cannot forget a value once it has been summed up into it, so the sketch of the bucket is only marked as stale here,
+ * and made anew from the rest of the species' records within that bucket whenever it's next read or repaired.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param batch The WriteBatch that the record itself is being deleted within.
+ * @param species_id The Unique ID of the species that the record is filed under.
+ * @param bucket The bucket of time that the record falls within.
+ * @see GkDbRead::make_weight_sketch(), GkDbWrite::repair_weight_sketches()
+ */
+void GkDbWrite::unfold_weight_sketch(leveldb::WriteBatch &batch, const std::string &species_id, const long int &bucket)
+{
+    batch.Put(gkStrOp->stale_weight_sketch_key(species_id, bucket), "");
+    return;
+}
+
+/**
+ * @brief GkDbWrite::fold_animal_summary adds a new record to the rolling statistics of its animal. Only the records that
+ * have slid out of the 30-day window of the weight trend are read back, each of them but once, so this takes constant
+ * time on average. A record that is older than the animal's newest one cannot be folded in this way, and so the summary
+ * is flagged as stale for GkDbWrite::repair_animal_summaries() to take care of. The record is scored against the
+ * summary before being folded into it, as long as it arrived in order.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param batch The WriteBatch that the record itself is being written within.
+ * @param record_id The Unique ID of the record.
+ * @param name_id The Unique ID of the animal that the record is filed under.
+ * @param submit The data of the log entry itself.
+ * @return The alerts raised by the record, if any.
+ * @see GkAnimalStats::fold(), GkAnimalStats::score()
+ */
+std::vector<GkRecords::GkAlert> GkDbWrite::fold_animal_summary(leveldb::WriteBatch &batch, const std::string &record_id,
+                                                               const std::string &name_id,
+                                                               const GkRecords::GkSubmit &submit)
+{
+    using namespace GkRecords;
+    const std::string summary_key = gkStrOp->animal_summary_key(name_id);
+    std::string value;
+    leveldb::Status s;
+    s = db_conn.db->Get(leveldb::ReadOptions(), summary_key, &value);
+    if (!s.ok() && !s.IsNotFound()) {
+        throw std::runtime_error(s.ToString());
+    }
+
+    GkAnimalSummary summary = {};
+    summary.name_id = name_id;
+    if (s.ok() && !gkStrOp->decode_animal_summary(summary_key, value, summary)) {
+        stale_indexes(batch); // The summary is damaged, so have the indexes rebuilt
+        return {};
+    }
+
+    std::vector<GkAlert> alerts;
+    const std::uint8_t flags = (submit.went_toilet ? WentToilet : 0) | (submit.had_hydration ? HadHydration : 0) |
+                               (submit.had_vitamins ? HadVitamins : 0);
+    if ((summary.record_count > 0) && (submit.date_time < summary.last_seen)) {
+        ++summary.record_count;
+        summary.first_seen = std::min(summary.first_seen, submit.date_time);
+        summary.stale = true;
+    } else {
+        const long int cutoff = submit.date_time - HERPLOG_SUMMARY_WINDOW_SECONDS;
+        if ((summary.window_count > 0) && (summary.window_start < cutoff)) {
+            for (const auto &entry: gkDbRead->scan_animal_index(name_id, summary.window_start, cutoff - 1,
+                                                                std::numeric_limits<std::size_t>::max())) {
+                GkAnimalStats::evict(summary, entry.date_time, entry.weight);
+            }
+        }
+
+        if (!summary.stale) {
+            alerts = GkAnimalStats::score(summary, record_id, submit.date_time, submit.weight, flags);
+        }
+
+        GkAnimalStats::fold(summary, submit.date_time, submit.weight, flags);
+    }
+
+    batch.Put(summary_key, gkStrOp->encode_animal_summary(summary));
+    return alerts;
+}
+
+/**
+ * @brief GkDbWrite::queue_alerts files the given alerts away within the database, where they wait until acknowledged,
+ * numbering each of them from the sequence kept under `LEVELDB_ALERT_SEQUENCE`.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param batch The WriteBatch that the record which raised the alerts is being written within.
+ * @param alerts The alerts to be queued, which are given their sequence numbers in turn.
+ * @see GkDbRead::read_alerts(), GkDbWrite::acknowledge_alerts()
+ */
+void GkDbWrite::queue_alerts(leveldb::WriteBatch &batch, std::vector<GkRecords::GkAlert> &alerts)
+{
+    std::string value;
+    leveldb::Status s;
+    s = db_conn.db->Get(leveldb::ReadOptions(), GkRecords::LEVELDB_ALERT_SEQUENCE, &value);
+    if (!s.ok() && !s.IsNotFound()) {
+        throw std::runtime_error(s.ToString());
+    }
+
+    std::uint64_t sequence = (s.ok() && value.size() == sizeof(std::uint64_t)) ? gkStrOp->decode_u64(value) : 0;
+    for (auto &alert: alerts) {
+        alert.sequence = ++sequence;
+        batch.Put(gkStrOp->alert_key(alert.sequence), gkStrOp->encode_alert(alert));
+    }
+
+    batch.Put(GkRecords::LEVELDB_ALERT_SEQUENCE, gkStrOp->encode_u64(sequence));
+    return;
+}
+
+/**
+ * @brief GkDbWrite::stale_animal_summary flags the rolling statistics of an animal as stale, as a record cannot be
+ * taken back out of a moving average once it's been folded in.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param batch The WriteBatch that the record itself is being deleted within.
+ * @param name_id The Unique ID of the animal that the record is filed under.
+ * @see GkDbWrite::repair_animal_summaries()
+ */
+void GkDbWrite::stale_animal_summary(leveldb::WriteBatch &batch, const std::string &name_id)
+{
+    const std::string summary_key = gkStrOp->animal_summary_key(name_id);
+    std::string value;
+    GkRecords::GkAnimalSummary summary;
+    if (db_conn.db->Get(leveldb::ReadOptions(), summary_key, &value).ok() &&
+            gkStrOp->decode_animal_summary(summary_key, value, summary)) {
+        summary.stale = true;
+        batch.Put(summary_key, gkStrOp->encode_animal_summary(summary));
+    }
+
+    return;
+}
+
+/**
+ * @brief GkDbWrite::fold_attachment_refs counts a record's photos towards (or back out of) the amount of records that
+ * refer to each of them, so that GkAttachmentStore::sweep() knows which photos are no longer needed. A photo that the
+ * same record happens to refer to more than once is only counted the once.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param batch The WriteBatch that the record itself is being written or deleted within.
+ * @param hashes The SHA-256 hashes of the record's photos.
+ * @param inserted Whether the record is being written, rather than deleted.
+ */
+void GkDbWrite::fold_attachment_refs(leveldb::WriteBatch &batch, const std::vector<std::string> &hashes,
+                                     const bool &inserted)
+{
+    for (const auto &hash: std::set<std::string>(hashes.begin(), hashes.end())) {
+        const std::string ref_key = gkStrOp->attachment_ref_key(hash);
+        std::string value;
+        std::uint64_t refs = 0;
+        if (db_conn.db->Get(leveldb::ReadOptions(), ref_key, &value).ok()) {
+            if (value.size() != 8) {
+                stale_indexes(batch); // Damaged, so have the indexes rebuilt
+                continue;
+            }
+
+            refs = gkStrOp->decode_u64(value);
+        }
+
+        if (inserted) {
+            ++refs;
+        } else if (refs > 0) {
+            --refs;
+        }
+
+        if (refs > 0) {
+            batch.Put(ref_key, gkStrOp->encode_u64(refs));
+        } else {
+            batch.Delete(ref_key);
+        }
+    }
+
+    return;
+}
+
+/**
+ * @brief GkDbWrite::fold_flag_index gives a new record the next ordinal within the flag index, and sets its bit within
+ * the bitmap of every record, those of its flags, and that of its animal. Only the one container of each bitmap that the
+ * ordinal falls within is rewritten. The ordinals stay in order of Date/Time for as long as the records arrive that way.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param batch The WriteBatch that the record itself is being written within.
+ * @param record_id The Unique ID of the record.
+ * @param submit The data of the log entry itself.
+ * @see GkFlagIndex::load()
+ */
+void GkDbWrite::fold_flag_index(leveldb::WriteBatch &batch, const std::string &record_id,
+                                const GkRecords::GkSubmit &submit)
+{
+    using namespace GkRecords;
+    std::string value;
+    leveldb::Status s;
+    s = db_conn.db->Get(leveldb::ReadOptions(), LEVELDB_INDEX_FLAG_META, &value);
+    if (!s.ok() && !s.IsNotFound()) {
+        throw std::runtime_error(s.ToString());
+    }
+
+    GkFlagIndexMeta meta = { 0, 0, 0 };
+    if ((s.ok() && !gkStrOp->decode_flag_meta(value, meta)) ||
+            (meta.next_ordinal > std::numeric_limits<std::uint32_t>::max()) ||
+            db_conn.db->Get(leveldb::ReadOptions(), gkStrOp->flag_record_key(record_id), &value).ok()) {
+        stale_indexes(batch); // Damaged, out of ordinals or written twice, so have the indexes rebuilt
+        return;
+    }
+
+    GkFlagRow row;
+    row.ordinal = static_cast<std::uint32_t>(meta.next_ordinal++);
+    row.record_id = record_id;
+    row.name_id = submit.identifier.name_id;
+    row.date_time = submit.date_time;
+    row.flags = (submit.went_toilet ? WentToilet : 0) | (submit.had_hydration ? HadHydration : 0) |
+                (submit.had_vitamins ? HadVitamins : 0);
+    if ((meta.sorted_count == row.ordinal) && ((row.ordinal == 0) || (meta.last_sorted <= row.date_time))) {
+        meta.sorted_count = meta.next_ordinal;
+        meta.last_sorted = row.date_time;
+    }
+
+    for (const auto &bitmap: GkFlagIndex::bitmaps(row.flags, row.name_id)) {
+        if (!fold_flag_bitmap(batch, bitmap, row.ordinal, true)) {
+            stale_indexes(batch);
+        }
+    }
+
+    batch.Put(gkStrOp->flag_row_key(row.ordinal), gkStrOp->encode_flag_row(row));
+    batch.Put(gkStrOp->flag_record_key(record_id), gkStrOp->encode_u64(row.ordinal));
+    batch.Put(LEVELDB_INDEX_FLAG_META, gkStrOp->encode_flag_meta(meta));
+    return;
+}
+
+/**
+ * @brief GkDbWrite::unfold_flag_index clears a deleted record's bits from the flag index. Its ordinal is never given
+ * out again, at least not until the indexes are next rebuilt.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param batch The WriteBatch that the record itself is being deleted within.
+ * @param record_id The Unique ID of the record.
+ */
+void GkDbWrite::unfold_flag_index(leveldb::WriteBatch &batch, const std::string &record_id)
+{
+    const std::string record_key = gkStrOp->flag_record_key(record_id);
+    std::string value;
+    if (!db_conn.db->Get(leveldb::ReadOptions(), record_key, &value).ok()) {
+        return; // The record was never indexed to begin with
+    }
+
+    GkRecords::GkFlagRow row;
+    const std::string row_key = gkStrOp->flag_row_key(static_cast<std::uint32_t>(gkStrOp->decode_u64(value)));
+    batch.Delete(record_key);
+    if ((value.size() != 8) || !db_conn.db->Get(leveldb::ReadOptions(), row_key, &value).ok() ||
+            !gkStrOp->decode_flag_row(row_key, value, row) || (row.record_id != record_id)) {
+        stale_indexes(batch); // Damaged, so have the indexes rebuilt
+        return;
+    }
+
+    for (const auto &bitmap: GkFlagIndex::bitmaps(row.flags, row.name_id)) {
+        if (!fold_flag_bitmap(batch, bitmap, row.ordinal, false)) {
+            stale_indexes(batch);
+        }
+    }
+
+    batch.Delete(row_key);
+    return;
+}
+
+/**
+ * @brief GkDbWrite::fold_flag_bitmap sets (or clears) an ordinal's bit within the container of the given bitmap that it
+ * falls within.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param batch The WriteBatch that the record itself is being written or deleted within.
+ * @param bitmap The name of the bitmap, as given by GkFlagIndex::bitmaps().
+ * @param ordinal The ordinal of the record.
+ * @param inserted Whether the record is being written, rather than deleted.
+ * @return Whether the container was intact, or else it has been left as it was.
+ */
+bool GkDbWrite::fold_flag_bitmap(leveldb::WriteBatch &batch, const std::string &bitmap, const std::uint32_t &ordinal,
+                                 const bool &inserted)
+{
+    const std::string chunk_key = gkStrOp->flag_bitmap_key(bitmap, static_cast<std::uint16_t>(ordinal >> 16));
+    std::string value;
+    leveldb::Status s;
+    s = db_conn.db->Get(leveldb::ReadOptions(), chunk_key, &value);
+    if (!s.ok() && !s.IsNotFound()) {
+        throw std::runtime_error(s.ToString());
+    }
+
+    GkBitmap chunk;
+    if (s.ok() && !GkBitmap::deserialise(value, chunk)) {
+        return false;
+    }
+
+    if (inserted) {
+        chunk.add(ordinal);
+    } else {
+        chunk.remove(ordinal);
+    }
+
+    if (chunk.empty()) {
+        batch.Delete(chunk_key);
+    } else {
+        batch.Put(chunk_key, chunk.serialise());
+    }
+
+    return true;
+}
+
+/**
+ * @brief GkDbWrite::fold_item_edit brings the indexes of a record up-to-date with the edit of just the one of its fields,
+ * within the same WriteBatch as the edit itself. The record's leaf hash is swapped within the digest of its bucket (or
+ * moved across to another bucket), and only those other indexes that are laid out by the edited field are touched.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param batch The WriteBatch that the edit itself is being written within.
+ * @param record_id The Unique ID of the record being edited.
+ * @param key The field being edited.
+ * @param value The new value of the field.
+ */
+void GkDbWrite::fold_item_edit(leveldb::WriteBatch &batch, const std::string &record_id, const std::string &key,
+                               const std::string &value)
+{
+    using namespace GkRecords;
+    MiscUniqueIds ids;
+    if (!gkDbRead->get_uuid(record_id, ids)) {
+        return; // Not a log entry, so it has no place within any of the indexes
+    }
+
+    GkSubmit before;
+    try {
+        before = gkDbRead->read_log_entry(record_id);
+    } catch (const std::exception &e) {
+        Q_UNUSED(e);
+        stale_indexes(batch); // The record was damaged, so it's best left to the indexes being rebuilt
+        return;
+    }
+
+    gkDbRead->get_cat_name(MiscRecordType::gkLicensee, ids.licensee_id, before.licensee.licensee_name);
+    gkDbRead->get_cat_name(MiscRecordType::gkSpecies, ids.species_id, before.species.species_name);
+    gkDbRead->get_cat_name(MiscRecordType::gkId, ids.name_id, before.identifier.identifier_str);
+
+    GkSubmit after = before;
+    std::uint8_t flag = 0;
+    try {
+        if (key == furtherNotes) {
+            after.further_notes = value;
+        } else if (key == vitaminNotes) {
+            after.vitamin_notes = value;
+        } else if (key == toiletNotes) {
+            after.toilet_notes = value;
+        } else if (key == tempNotes) {
+            after.temp_notes = value;
+        } else if (key == weightNotes) {
+            after.weight_notes = value;
+        } else if (key == hydrationNotes) {
+            after.hydration_notes = value;
+        } else if (key == boolWentToilet) {
+            after.went_toilet = (value == "1");
+            flag = WentToilet;
+        } else if (key == boolHadHydration) {
+            after.had_hydration = (value == "1");
+            flag = HadHydration;
+        } else if (key == boolHadVitamins) {
+            after.had_vitamins = (value == "1");
+            flag = HadVitamins;
+        } else if (key == dateTime) {
+            after.date_time = std::stol(value);
+        } else if (key == weightMeasure) {
+            after.weight = std::stod(value);
+        } else if (key == attachmentRefs) {
+            after.attachments = gkStrOp->decode_attachments(value);
+        } else {
+            return; // Not a field that any of the indexes know about
+        }
+    } catch (const std::exception &e) {
+        Q_UNUSED(e);
+        stale_indexes(batch); // The record can no longer be read back whole, so have it unindexed
+        return;
+    }
+
+    const long int old_bucket = gkStrOp->merge_bucket(before.date_time);
+    const long int new_bucket = gkStrOp->merge_bucket(after.date_time);
+    const std::uint64_t new_leaf = gkStrOp->record_leaf(record_id, gkStrOp->record_hash(after));
+    std::string leaf;
+    if (db_conn.db->Get(leveldb::ReadOptions(), gkStrOp->record_hash_key(old_bucket, record_id), &leaf).ok()) {
+        if (old_bucket == new_bucket) {
+            fold_record_hash(batch, old_bucket, record_id, gkStrOp->decode_u64(leaf), new_leaf);
+        } else {
+            fold_record_hash(batch, old_bucket, record_id, gkStrOp->decode_u64(leaf), false);
+            fold_record_hash(batch, new_bucket, record_id, new_leaf, true);
+        }
+    }
+
+    if ((key == dateTime) || (key == weightMeasure)) {
+        batch.Delete(gkStrOp->timestamp_index_key(before.date_time, record_id));
+        batch.Put(gkStrOp->timestamp_index_key(after.date_time, record_id), "");
+        batch.Delete(gkStrOp->animal_index_key(ids.name_id, before.date_time, record_id));
+        batch.Put(gkStrOp->animal_index_key(ids.name_id, after.date_time, record_id), gkStrOp->encode_weight(after.weight));
+        unfold_weight_sketch(batch, ids.species_id, old_bucket);
+        if (new_bucket != old_bucket) {
+            unfold_weight_sketch(batch, ids.species_id, new_bucket);
+        }
+
+        stale_animal_summary(batch, ids.name_id);
+        if (key == dateTime) {
+            refile_flag_row(batch, record_id, after.date_time);
+        }
+
+        return;
+    }
+
+    if (key == attachmentRefs) {
+        // Only the photos that were either added or taken away have their references counted anew
+        const std::set<std::string> old_hashes(before.attachments.begin(), before.attachments.end());
+        const std::set<std::string> new_hashes(after.attachments.begin(), after.attachments.end());
+        std::vector<std::string> removed;
+        std::vector<std::string> added;
+        std::set_difference(old_hashes.begin(), old_hashes.end(), new_hashes.begin(), new_hashes.end(),
+                            std::back_inserter(removed));
+        std::set_difference(new_hashes.begin(), new_hashes.end(), old_hashes.begin(), old_hashes.end(),
+                            std::back_inserter(added));
+        fold_attachment_refs(batch, removed, false);
+        fold_attachment_refs(batch, added, true);
+        return;
+    }
+
+    if (flag == 0) {
+        for (const auto &posting: GkTextIndex::postings(record_id, before)) {
+            batch.Delete(posting.first);
+        }
+
+        for (const auto &posting: GkTextIndex::postings(record_id, after)) {
+            batch.Put(posting.first, posting.second);
+        }
+
+        return;
+    }
+
+    std::string ordinal;
+    GkFlagRow row;
+    if (db_conn.db->Get(leveldb::ReadOptions(), gkStrOp->flag_record_key(record_id), &ordinal).ok()) {
+        const std::string row_key = gkStrOp->flag_row_key(static_cast<std::uint32_t>(gkStrOp->decode_u64(ordinal)));
+        std::string row_value;
+        if ((ordinal.size() != 8) || !db_conn.db->Get(leveldb::ReadOptions(), row_key, &row_value).ok() ||
+                !gkStrOp->decode_flag_row(row_key, row_value, row) ||
+                !fold_flag_bitmap(batch, GkFlagIndex::bitmap_name(static_cast<GkFlagBits>(flag)), row.ordinal,
+                                  (value == "1"))) {
+            stale_indexes(batch); // Damaged, so have the indexes rebuilt
+        } else {
+            row.flags = static_cast<std::uint8_t>((value == "1") ? (row.flags | flag) : (row.flags & ~flag));
+            batch.Put(row_key, gkStrOp->encode_flag_row(row));
+        }
+    }
+
+    stale_animal_summary(batch, ids.name_id); // The times at which the flags were last set may have moved
+    return;
+}
+
+/**
+ * @brief GkDbWrite::refile_flag_row gives a record's row within the flag index its new Date/Time, whilst keeping the
+ * same ordinal. Should the row fall amongst those whose ordinals are in order of Date/Time, then the in-order run is cut
+ * short just before it, as the new Date/Time may well have put it out of order.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param batch The WriteBatch that the edit itself is being written within.
+ * @param record_id The Unique ID of the record.
+ * @param date_time The new Date/Time of the record.
+ */
+void GkDbWrite::refile_flag_row(leveldb::WriteBatch &batch, const std::string &record_id, const long int &date_time)
+{
+    using namespace GkRecords;
+    std::string value;
+    if (!db_conn.db->Get(leveldb::ReadOptions(), gkStrOp->flag_record_key(record_id), &value).ok()) {
+        return; // The record was never indexed to begin with
+    }
+
+    GkFlagRow row;
+    GkFlagIndexMeta meta;
+    const std::string row_key = gkStrOp->flag_row_key(static_cast<std::uint32_t>(gkStrOp->decode_u64(value)));
+    if ((value.size() != 8) || !db_conn.db->Get(leveldb::ReadOptions(), row_key, &value).ok() ||
+            !gkStrOp->decode_flag_row(row_key, value, row) ||
+            !db_conn.db->Get(leveldb::ReadOptions(), LEVELDB_INDEX_FLAG_META, &value).ok() ||
+            !gkStrOp->decode_flag_meta(value, meta)) {
+        stale_indexes(batch); // Damaged, so have the indexes rebuilt
+        return;
+    }
+
+    row.date_time = date_time;
+    batch.Put(row_key, gkStrOp->encode_flag_row(row));
+    if (row.ordinal < meta.sorted_count) {
+        meta.sorted_count = row.ordinal;
+        batch.Put(LEVELDB_INDEX_FLAG_META, gkStrOp->encode_flag_meta(meta));
+    }
+
+    return;
+}
+
 /**
  *@brief GkDbWrite::add_item_db will add a single item to the Google LevelDB database, after first deleting any
  * pre-existing items of the same key.
@@ -85,26 +813,89 @@ GkDbWrite::~GkDbWrite()
  */
 void GkDbWrite::add_item_db(const std::string &record_id, const std::string &key, std::string value)
 {
+    GkWriteLease lease(db_conn);
+
     if (value.empty()) {
         value = "";
     }
 
-    leveldb::WriteOptions write_options;
-    write_options.sync = true;
     leveldb::WriteBatch batch;
-    std::lock_guard<std::mutex> locker(db_mutex);
     std::string key_joined = gkStrOp->multipart_key({record_id, key});
     batch.Delete(key_joined);
     batch.Put(key_joined, value);
-    leveldb::Status s;
-    s = db_conn.db->Write(write_options, &batch);
-    if (!s.ok()) {
-        throw std::runtime_error(s.ToString());
-    }
+    fold_item_edit(batch, record_id, key, value);
+    commit(batch, { make_change(GkRecords::GkChangeType::RecordUpdated, record_id, GkRecords::MiscRecordType::None, key) });
 
     return;
 }
 
+/**
+ * @brief GkDbWrite::add_log_entry writes a whole log entry to the Google LevelDB database, with its UUID, any new
+ * categories and all of its fields going into a single WriteBatch, and then lets any listeners know about the new record.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param uuid The UUID tieing all the separate database entries/keys together.
+ * @param submit The data of the log entry itself.
+ * @return Whether the log entry was written, or else one of the same UUID already exists.
+ * @see GkChangeFeed::changes_committed()
+ */
+bool GkDbWrite::add_log_entry(const std::string &uuid, const GkRecords::GkSubmit &submit)
+{
+    GkTraceSpan span("GkDbWrite::add_log_entry", "db");
+
+    using namespace GkRecords;
+    leveldb::WriteBatch batch;
+    batch.Put(gkStrOp->multipart_key({uuid, dateTime}), std::to_string(submit.date_time));
+    batch.Put(gkStrOp->multipart_key({uuid, furtherNotes}), submit.further_notes);
+    batch.Put(gkStrOp->multipart_key({uuid, vitaminNotes}), submit.vitamin_notes);
+    batch.Put(gkStrOp->multipart_key({uuid, toiletNotes}), submit.toilet_notes);
+    batch.Put(gkStrOp->multipart_key({uuid, tempNotes}), submit.temp_notes);
+    batch.Put(gkStrOp->multipart_key({uuid, weightNotes}), submit.weight_notes);
+    batch.Put(gkStrOp->multipart_key({uuid, hydrationNotes}), submit.hydration_notes);
+    batch.Put(gkStrOp->multipart_key({uuid, boolWentToilet}), std::to_string(submit.went_toilet));
+    batch.Put(gkStrOp->multipart_key({uuid, boolHadHydration}), std::to_string(submit.had_hydration));
+    batch.Put(gkStrOp->multipart_key({uuid, boolHadVitamins}), std::to_string(submit.had_vitamins));
+    batch.Put(gkStrOp->multipart_key({uuid, weightMeasure}), std::to_string(submit.weight));
+    batch.Put(gkStrOp->timestamp_index_key(submit.date_time, uuid), "");
+    batch.Put(gkStrOp->animal_index_key(submit.identifier.name_id, submit.date_time, uuid),
+              gkStrOp->encode_weight(submit.weight));
+    for (const auto &posting: GkTextIndex::postings(uuid, submit)) {
+        batch.Put(posting.first, posting.second);
+    }
+
+    // Only the categories and shared aggregates below are read back before being written, so only they need the lease
+    GkWriteLease lease(db_conn);
+    std::vector<GkChange> changes;
+    if (!add_uuid(batch, changes, uuid, submit.licensee, submit.species, submit.identifier)) {
+        return false; // The record has already been written
+    }
+
+    if (!submit.attachments.empty()) {
+        batch.Put(gkStrOp->multipart_key({uuid, attachmentRefs}), gkStrOp->encode_attachments(submit.attachments));
+        fold_attachment_refs(batch, submit.attachments, true);
+    }
+
+    fold_record_hash(batch, gkStrOp->merge_bucket(submit.date_time), uuid,
+                     gkStrOp->record_leaf(uuid, gkStrOp->record_hash(submit)), true);
+    fold_weight_sketch(batch, submit.species.species_id, gkStrOp->merge_bucket(submit.date_time), submit.weight);
+    fold_flag_index(batch, uuid, submit);
+    std::vector<GkAlert> alerts = fold_animal_summary(batch, uuid, submit.identifier.name_id, submit);
+    if (!alerts.empty()) {
+        queue_alerts(batch, alerts);
+    }
+
+    GkChange change = make_change(GkChangeType::RecordInserted, uuid);
+    change.record = submit;
+    changes.push_back(change);
+    commit(batch, changes);
+
+    if (!alerts.empty()) {
+        emit alerts_raised(alerts);
+    }
+
+    return true;
+}
+
 /**
  * @brief GkDbWrite::del_item_db deletes a single, specified item from the Google LevelDB database.
  * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
@@ -114,651 +905,784 @@ void GkDbWrite::add_item_db(const std::string &record_id, const std::string &key
  */
 void GkDbWrite::del_item_db(const std::string &record_id, const std::string &key)
 {
-    leveldb::WriteOptions write_options;
-    write_options.sync = true;
     leveldb::WriteBatch batch;
-    std::lock_guard<std::mutex> locker(db_mutex);
     std::string key_joined = gkStrOp->multipart_key({record_id, key});
     batch.Delete(key_joined);
-    leveldb::Status s;
-    s = db_conn.db->Write(write_options, &batch);
-    if (!s.ok()) {
-        throw std::runtime_error(s.ToString());
+    stale_indexes(batch); // The record can no longer be read back whole, so have it unindexed
+    commit(batch, { make_change(GkRecords::GkChangeType::RecordUpdated, record_id, GkRecords::MiscRecordType::None, key) });
+
+    return;
+}
+
+/**
+ * @brief GkDbWrite::del_log_entry Will delete a given log entry and all of its related data from the Google LevelDB
+ * database when given a specified UUID. Asking the user whether they really wish to go ahead with this is left up to
+ * the caller.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2018-03-23
+ * @param uuid The UUID of all the database entries that must be deleted.
+ * @return Whether the log entry was deleted, or else there was no such log entry to begin with.
+ * @see GkChangeFeed::changes_committed()
+ */
+bool GkDbWrite::del_log_entry(const std::string &uuid)
+{
+    GkTraceSpan span("GkDbWrite::del_log_entry", "db");
+
+    if (uuid.empty()) {
+        throw std::invalid_argument(tr("One of the given UUIDs are empty!").toStdString());
+    }
+
+    using namespace GkRecords;
+    leveldb::WriteBatch batch;
+    MiscUniqueIds unique_ids;
+    if (!del_uuid(batch, uuid, unique_ids)) {
+        return false; // There is no such record to delete
+    }
+
+    // Everything about the record itself is read before the lease is taken, as nobody else writes to it
+    long int date_time = -1;
+    try {
+        // The record's entries within the timestamp index and its bucket can only be found through its Date/Time
+        date_time = std::stol(gkDbRead->read_item_db(uuid, dateTime));
+        batch.Delete(gkStrOp->timestamp_index_key(date_time, uuid));
+        batch.Delete(gkStrOp->animal_index_key(unique_ids.name_id, date_time, uuid));
+    } catch (const std::exception &e) {
+        Q_UNUSED(e); // The Date/Time is missing or damaged, so the record was never indexed to begin with
+    }
+
+    GkSubmit submit;
+    bool have_submit = false;
+    try {
+        // Likewise, the record's terms within the full-text index can only be found through its notes, and the
+        // photos that it refers to through the record itself
+        submit = gkDbRead->read_log_entry(uuid);
+        for (const auto &posting: GkTextIndex::postings(uuid, submit)) {
+            batch.Delete(posting.first);
+        }
+
+        have_submit = true;
+    } catch (const std::exception &e) {
+        Q_UNUSED(e); // Whatever is left behind gets cleared out the next time the indexes are rebuilt
+    }
+
+    for (const auto &key: {dateTime, furtherNotes, vitaminNotes, toiletNotes, tempNotes, weightNotes, hydrationNotes,
+                           boolWentToilet, boolHadHydration, boolHadVitamins, weightMeasure, attachmentRefs}) {
+        batch.Delete(gkStrOp->multipart_key({uuid, key}));
+    }
+
+    // The shared aggregates are folded under the lease, once it is certain that another process has not deleted the
+    // very same record (and thusly already unfolded it) in the meantime
+    GkWriteLease lease(db_conn);
+    std::string unique_id;
+    if (!db_conn.db->Get(leveldb::ReadOptions(), gkStrOp->unique_id_key(uuid), &unique_id).ok()) {
+        return false;
+    }
+
+    if (date_time >= 0) {
+        const long int bucket = gkStrOp->merge_bucket(date_time);
+        unfold_weight_sketch(batch, unique_ids.species_id, bucket);
+        stale_animal_summary(batch, unique_ids.name_id);
+
+        std::string leaf;
+        if (db_conn.db->Get(leveldb::ReadOptions(), gkStrOp->record_hash_key(bucket, uuid), &leaf).ok()) {
+            fold_record_hash(batch, bucket, uuid, gkStrOp->decode_u64(leaf), false);
+        }
+    }
+
+    if (have_submit) {
+        fold_attachment_refs(batch, submit.attachments, false);
+    }
+
+    unfold_flag_index(batch, uuid);
+    commit(batch, { make_change(GkChangeType::RecordDeleted, uuid) });
+    return true;
+}
+
+/**
+ * @brief GkDbWrite::add_misc_key_val Adds a Unique Identifier for either a new Licensee, Species, or Name/ID sub-record
+ * within the Google LevelDB database, or renames it should it already be there under another name.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2018-02-21
+ * @param batch The WriteBatch that the record which the sub-record belongs to is being written within.
+ * @param changes The changes made by the WriteBatch, to which the new sub-record is added.
+ * @param record_type Whether the sub-record is a Licensee, Species, or Name/ID.
+ * @param record_id The Unique Identifier itself, usually a UUID in this case.
+ * @param value The value to be stored alongside the UUID.
+ */
+void GkDbWrite::add_cat_key_vals(leveldb::WriteBatch &batch, std::vector<GkRecords::GkChange> &changes,
+                                 const GkRecords::MiscRecordType &record_type, const std::string &record_id,
+                                 const std::string &value)
+{
+    if ((!record_id.empty()) && (!value.empty())) {
+        using namespace GkRecords;
+
+        std::string existing;
+        const bool renamed = gkDbRead->get_cat_name(record_type, record_id, existing);
+        if (renamed && (existing == value)) {
+            return; // The category already exists, just as it is
+        }
+
+        batch.Put(gkStrOp->cat_key(record_type, record_id), value);
+        if (renamed) {
+            stale_indexes(batch); // The records are hashed by category name, so have the indexes rebuilt
+        }
+
+        changes.push_back(make_change(renamed ? GkChangeType::CategoryRenamed : GkChangeType::CategoryAdded, record_id,
+                                      record_type, value));
+    } else {
+        throw std::invalid_argument(tr("One of the given Unique IDs and/or values are empty!").toStdString());
+    }
+
+    return;
+}
+
+/**
+ * @brief GkDbWrite::del_misc_key_vals Deletes a specified Unique Identifier for either a Licensee, Species, or
+ * Name/ID sub-record within the Google LevelDB database.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2018-03-13
+ * @param record_type Whether the sub-record is a Licensee, Species, or Name/ID.
+ * @param record_id The Unique Identifier itself, usually a UUID in this case.
+ */
+void GkDbWrite::del_cat_key_vals(const GkRecords::MiscRecordType &record_type, const std::string &record_id)
+{
+    if (!record_id.empty()) {
+        using namespace GkRecords;
+
+        leveldb::WriteBatch batch;
+        batch.Delete(gkStrOp->cat_key(record_type, record_id));
+        commit(batch, { make_change(GkChangeType::CategoryRemoved, record_id, record_type) });
+    } else {
+        throw std::invalid_argument(tr("One of the given Unique IDs are empty!").toStdString());
+    }
+
+    return;
+}
+
+/**
+ * @brief GkDbWrite::add_uuid Adds a new Unique Identifier for the record in question to the Google LevelDB database,
+ * along with any Licensee, Species, or Name/ID sub-records that are new, all within the record's own WriteBatch.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2018-02-21
+ * @param batch The WriteBatch that the record itself is being written within.
+ * @param changes The changes made by the WriteBatch, to which any new sub-records are added.
+ * @param uuid The UUID tieing all the separate database entries/keys together.
+ * @param licensee The licensee in regard to this record in question.
+ * @param species The species of the animal/lizard in question.
+ * @param id The identifier, for the animal/lizard in question.
+ * @return Whether the UUID was added, or else it was already present within the database.
+ */
+bool GkDbWrite::add_uuid(leveldb::WriteBatch &batch, std::vector<GkRecords::GkChange> &changes,
+                         const std::string &uuid, const GkRecords::GkLicensee &licensee,
+                         const GkRecords::GkSpecies &species, const GkRecords::GkId &id)
+{
+    GkTraceSpan span("GkDbWrite::add_uuid", "db");
+
+    using namespace GkRecords;
+    if ((uuid.empty()) || (licensee.licensee_id.empty()) || (species.species_id.empty()) || (id.name_id.empty())) {
+        throw std::invalid_argument(tr("One of the given UUIDs are empty!").toStdString());
     }
 
-    return;
+    MiscUniqueIds unique_ids;
+    if (gkDbRead->get_uuid(uuid, unique_ids)) {
+        return false;
+    }
+
+    // Each of these only gets written should it be new
+    add_cat_key_vals(batch, changes, MiscRecordType::gkLicensee, licensee.licensee_id, licensee.licensee_name);
+    add_cat_key_vals(batch, changes, MiscRecordType::gkSpecies, species.species_id, species.species_name);
+    add_cat_key_vals(batch, changes, MiscRecordType::gkId, id.name_id, id.identifier_str);
+
+    unique_ids.licensee_id = licensee.licensee_id;
+    unique_ids.species_id = species.species_id;
+    unique_ids.name_id = id.name_id;
+    batch.Put(gkStrOp->unique_id_key(uuid), gkStrOp->encode_unique_ids(unique_ids));
+    return true;
 }
 
 /**
- * @brief GkDbWrite::del_log_entry Will delete a given log entry and all of its related data from the Google LevelDB
- * database when given a specified UUID.
+ * @brief GkDbWrite::del_uuid Deletes a specified Unique Identifier for the record in question from the Google LevelDB
+ * database, within the record's own WriteBatch.
  * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
- * @date 2018-03-23
- * @param uuid The UUID of all the database entries that must be deleted.
- * @param unique_id_map // A std::unordered_map<>() of all the UUIDs.
- * @param pose_msg_box Whether to pose a QMessageBox or not to the users, asking if they wish to proceed with the
- * operation or not.
- * @return Whether the operation was successful or not.
+ * @date 2018-03
+ * @param batch The WriteBatch that the record itself is being deleted within.
+ * @param uuid The UUID tieing all the separate database entries/keys together.
+ * @param unique_ids The Unique IDs of the categories that the record was filed under.
+ * @return Whether the UUID was deleted, or else it was never present within the database.
  */
-bool GkDbWrite::del_log_entry(const std::string &uuid, const bool &pose_msg_box)
+bool GkDbWrite::del_uuid(leveldb::WriteBatch &batch, const std::string &uuid, GkRecords::MiscUniqueIds &unique_ids)
 {
-    try {
-        if (!uuid.empty()) {
-            bool msg_box_proceed = false;
-
-            if (pose_msg_box) {
-                QMessageBox msgBox;
-                msgBox.setWindowTitle(tr("Delete Record..."));
-                msgBox.setText(tr("Are you really sure about deleting this record?"));
-                msgBox.setStandardButtons(QMessageBox::Yes | QMessageBox::No | QMessageBox::Cancel);
-                msgBox.setDefaultButton(QMessageBox::Yes);
-                msgBox.setParent(nullptr);
-                int ret = msgBox.exec();
-
-                switch (ret) {
-                    case QMessageBox::Yes:
-                        // Delete the record
-                        msg_box_proceed = true;
-                        break;
-                    case QMessageBox::No:
-                        // Do not delete the record
-                        return false;
-                    case QMessageBox::Cancel:
-                        // Do not delete the record
-                        return false;
-                    default:
-                        // Should never be reached
-                        return false;
-                }
-            }
+    GkTraceSpan span("GkDbWrite::del_uuid", "db");
 
-            if (msg_box_proceed || !pose_msg_box) {
-                using namespace GkRecords;
-                del_item_db(uuid, dateTime);
-                del_item_db(uuid, furtherNotes);
-                del_item_db(uuid, vitaminNotes);
-                del_item_db(uuid, toiletNotes);
-                del_item_db(uuid, tempNotes);
-                del_item_db(uuid, weightNotes);
-                del_item_db(uuid, hydrationNotes);
-                del_item_db(uuid, boolWentToilet);
-                del_item_db(uuid, boolHadHydration);
-                del_item_db(uuid, boolHadVitamins);
-                del_item_db(uuid, weightMeasure);
-                del_uuid(uuid);
-
-                return true;
-            }
-        } else {
-            throw std::invalid_argument(tr("One of the given UUIDs are empty!").toStdString());
-        }
-    } catch (const std::exception &e) {
-        QMessageBox::warning(nullptr, tr("Error!"), e.what(), QMessageBox::Ok);
+    if (uuid.empty()) {
+        throw std::invalid_argument(tr("One of the given UUIDs are empty!").toStdString());
+    }
+
+    if (!gkDbRead->get_uuid(uuid, unique_ids)) {
+        return false;
     }
-    
-    return false;
+
+    batch.Delete(gkStrOp->unique_id_key(uuid));
+    return true;
 }
 
 /**
- * @brief GkDbWrite::add_misc_key_val Adds a Unique Identifier for either a new Licensee, Species, or Name/ID sub-record
- * within the Google LevelDB database.
+ * @brief GkDbWrite::find_cat_dependants determines which records (and thusly which other categories) are associated
+ * with the given Licensee, Species, or Animal, so that the user can be shown what a mass deletion would take with it
+ * before GkDbWrite::mass_del_cat() is ever called.
  * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
- * @date 2018-02-21
- * @param record_type Whether to add data to `store_licensee_id`, `store_species_id`, or `store_name_id` within
- * the Google LevelDB database.
- * @param record_id The Unique Identifier itself, usually a UUID in this case.
- * @param value The value to be stored alongside the UUID.
- * @return Whether the process was a success or not.
+ * @date 2018-03-19
+ * @param record_type Whether the given Unique ID is for a Licensee, Species, or Animal.
+ * @param record_id The Unique ID of the category in question.
+ * @return The associated records, keyed by their UUIDs.
  */
-void GkDbWrite::add_cat_key_vals(const GkRecords::MiscRecordType &record_type, const std::string &record_id,
-                                 const std::string &value)
+GkRecords::GkCategories GkDbWrite::find_cat_dependants(const GkRecords::MiscRecordType &record_type,
+                                                       const std::string &record_id)
 {
-    if ((!record_id.empty()) && (!value.empty())) {
-        std::ostringstream oss;
-        using namespace GkRecords;
+    GkTraceSpan span("GkDbWrite::find_cat_dependants", "db");
+    if (record_id.empty()) {
+        throw std::invalid_argument(tr("One of the given Unique IDs are empty!").toStdString());
+    }
 
-        leveldb::WriteOptions write_options;
-        write_options.sync = true;
-        leveldb::WriteBatch batch;
+    using namespace GkRecords;
+    GkCategories categories;
+    categories.spec_record_id = record_id;
+    auto uuid_cache = gkDbRead->get_uuids();
+
+    switch (record_type) {
+        case MiscRecordType::gkLicensee:
+            // Must firstly determine what species and animals are associated with this licensee record
+            for (const auto &uuid: uuid_cache) {
+                if (uuid.second.licensee_id == record_id) {
+                    if (!categories.species_cache.contains(uuid.second.species_id)) { // <Key: UUID, Value: <License ID, Species ID>>
+                        categories.species_cache.insert(uuid.first, std::make_pair(uuid.second.licensee_id, uuid.second.species_id));
+                    }
 
-        switch (record_type) {
-            case MiscRecordType::gkLicensee:
-            {
-                auto licensee_cache = gkDbRead->get_cat_key_vals(MiscRecordType::gkLicensee);
-                if (!licensee_cache.empty()) {
-                    for (auto it = licensee_cache.begin(); it != licensee_cache.end(); ++it) {
-                        oss << it.key() << "," << it.value() << std::endl;
+                    if (!categories.animals_cache.contains(uuid.second.name_id)) { // <Key: UUID, Value: <Species ID, Animal ID>>
+                        categories.animals_cache.insert(uuid.first, std::make_pair(uuid.second.species_id, uuid.second.name_id));
                     }
                 }
-
-                // Now we insert the new UUID alongside with its value
-                oss << record_id << "," << value << std::endl;
-
-                batch.Delete(LEVELDB_STORE_LICENSEE_ID);
-                batch.Put(LEVELDB_STORE_LICENSEE_ID, oss.str());
             }
 
-                break;
-            case MiscRecordType::gkSpecies:
-            {
-                auto species_cache = gkDbRead->get_cat_key_vals(MiscRecordType::gkSpecies);
-                if (!species_cache.empty()) {
-                    for (auto it = species_cache.begin(); it != species_cache.end(); ++it) {
-                        oss << it.key() << "," << it.value() << std::endl;
+            break;
+        case MiscRecordType::gkSpecies:
+            // We must determine what licensees and animals are associated with this species record.
+            for (const auto &uuid: uuid_cache) {
+                if (uuid.second.species_id == record_id) {
+                    if (!categories.licensee_cache.contains(uuid.first)) { // <Key: UUID, Value: Licensee ID>
+                        categories.licensee_cache.insert(uuid.first, uuid.second.licensee_id);
                     }
-                }
 
-                // Now we insert the new UUID alongside with its value
-                oss << record_id << "," << value << std::endl;
-
-                batch.Delete(LEVELDB_STORE_SPECIES_ID);
-                batch.Put(LEVELDB_STORE_SPECIES_ID, oss.str());
-            }
-
-                break;
-            case MiscRecordType::gkId:
-            {
-                auto id_cache = gkDbRead->get_cat_key_vals(MiscRecordType::gkId);
-                if (!id_cache.empty()) {
-                    for (auto it = id_cache.begin(); it != id_cache.end(); ++it) {
-                        oss << it.key() << "," << it.value() << std::endl;
+                    if (!categories.animals_cache.contains(uuid.first)) { // <Key: UUID, Value: <Species ID, Animal ID>>
+                        categories.animals_cache.insert(uuid.first, std::make_pair(uuid.second.species_id,
+                                                                                   uuid.second.name_id));
                     }
                 }
+            }
 
-                // Now we insert the new UUID alongside with its value
-                oss << record_id << "," << value << std::endl;
+            break;
+        case MiscRecordType::gkId:
+            // We must determine what licensees and species are associated with this animal record.
+            for (const auto &uuid: uuid_cache) {
+                if (uuid.second.name_id == record_id) {
+                    if (!categories.licensee_cache.contains(uuid.first)) { // <Key: UUID, Value: License ID>
+                        categories.licensee_cache.insert(uuid.first, uuid.second.licensee_id);
+                    }
 
-                batch.Delete(LEVELDB_STORE_NAME_ID);
-                batch.Put(LEVELDB_STORE_NAME_ID, oss.str());
+                    if (!categories.species_cache.contains(uuid.first)) { // <Key: UUID, Value: <Species ID, Animal ID>>
+                        categories.species_cache.insert(uuid.first, std::make_pair(uuid.second.species_id,
+                                                                                   uuid.second.name_id));
+                    }
+                }
             }
 
-                break;
-            default:
-                throw std::invalid_argument(tr("Unable to read Unique Identifier from database!").toStdString());
-        }
-
-        std::lock_guard<std::mutex> locker(db_mutex);
-        leveldb::Status s;
-        s = db_conn.db->Write(write_options, &batch);
-        if (!s.ok()) {
-            throw std::runtime_error(s.ToString());
-        }
-    } else {
-        throw std::invalid_argument(tr("One of the given Unique IDs and/or values are empty!").toStdString());
+            break;
+        default:
+            throw std::runtime_error(tr("Unable to delete records from the database!").toStdString());
     }
 
-    return;
+    return categories;
 }
 
 /**
- * @brief GkDbWrite::del_misc_key_vals Deletes a specified Unique Identifier for either a Licensee, Species, or
- * Name/ID sub-record within the Google LevelDB database.
+ * @brief GkDbWrite::mass_del_id Will delete any number of records (depending on what's associated) from the Google LevelDB
+ * database in one, swift go.
  * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
- * @date 2018-03-13
- * @param record_type Whether to remove data from `store_licensee_id`, `store_species_id`, or `store_name_id` within
+ * @date 2018-03-19
+ * @param record_type Whether to delete data from `store_licensee_id`, `store_species_id`, and/or `store_name_id` from within
  * the Google LevelDB database.
- * @param record_id The Unique Identifier itself, usually a UUID in this case.
+ * @param categories The associated records, as given by GkDbWrite::find_cat_dependants().
+ * @return Whether the operation was a success or not.
  */
-void GkDbWrite::del_cat_key_vals(const GkRecords::MiscRecordType &record_type, const std::string &record_id)
+bool GkDbWrite::mass_del_cat(const GkRecords::MiscRecordType &record_type, const GkRecords::GkCategories &categories)
 {
-    if (!record_id.empty()) {
-        std::ostringstream oss;
-        using namespace GkRecords;
+    GkTraceSpan span("GkDbWrite::mass_del_cat", "db");
 
-        leveldb::WriteOptions write_options;
-        write_options.sync = true;
-        leveldb::WriteBatch batch;
+    if (categories.spec_record_id.empty()) {
+        throw std::invalid_argument(tr("One of the given Unique IDs are empty!").toStdString());
+    }
 
-        switch (record_type) {
-            case MiscRecordType::gkLicensee:
-            {
-                auto licensee_cache = gkDbRead->get_cat_key_vals(MiscRecordType::gkLicensee);
-                bool write_db = false;
-                if (!licensee_cache.empty()) {
-                    for (auto it = licensee_cache.begin(); it != licensee_cache.end(); ++it) {
-                        if (it.key() != record_id) { // Write out all the key/value pairs except for the specified one, thus deleting it
-                            oss << it.key() << "," << it.value() << std::endl;
-                            write_db = true;
-                        }
-                    }
+    using namespace GkRecords;
+    QVector<std::string> unique_uuid_vec;
 
-                    batch.Delete(LEVELDB_STORE_LICENSEE_ID);
+    switch (record_type) {
+        case MiscRecordType::gkLicensee:
+        {
+            del_cat_key_vals(MiscRecordType::gkLicensee, categories.spec_record_id); // This deletes the `Licensee ID`
 
-                    if (write_db) { // There is at least one key/value pair that needs to be written back to the database
-                        batch.Put(LEVELDB_STORE_LICENSEE_ID, oss.str());
-                    }
+            for (auto it = categories.species_cache.begin(); it != categories.species_cache.end(); ++it) {
+                del_cat_key_vals(MiscRecordType::gkSpecies, it.value().second);
+
+                if (!unique_uuid_vec.contains(it.key())) {
+                    unique_uuid_vec.push_back(it.key());
                 }
             }
 
-                break;
-            case MiscRecordType::gkSpecies:
-            {
-                auto species_cache = gkDbRead->get_cat_key_vals(MiscRecordType::gkSpecies);
-                bool write_db = false;
-                if (species_cache.empty()) {
-                    for (auto it = species_cache.begin(); it != species_cache.end(); ++it) {
-                        if (it.key() != record_id) { // Write out all the key/value pairs except for the specified one, thus deleting it
-                            oss << it.key() << "," << it.value() << std::endl;
-                            write_db = true;
-                        }
-                    }
-
-                    batch.Delete(LEVELDB_STORE_SPECIES_ID);
+            for (auto it = categories.animals_cache.begin(); it != categories.animals_cache.end(); ++it) {
+                del_cat_key_vals(MiscRecordType::gkId, it.value().second);
 
-                    if (write_db) { // There is at least one key/value pair that needs to be written back to the database
-                        batch.Put(LEVELDB_STORE_SPECIES_ID, oss.str());
-                    }
+                if (!unique_uuid_vec.contains(it.key())) {
+                    unique_uuid_vec.push_back(it.key());
                 }
             }
+        }
 
-                break;
-            case MiscRecordType::gkId:
-            {
-                auto id_cache = gkDbRead->get_cat_key_vals(MiscRecordType::gkId);
-                bool write_db = false;
-                if (!id_cache.empty()) {
-                    for (auto it = id_cache.begin(); it != id_cache.end(); ++it) {
-                        if (it.key() != record_id) { // Write out all the key/value pairs except for the specified one, thus deleting it
-                            oss << it.key() << "," << it.value() << std::endl;
-                            write_db = true;
-                        }
-                    }
+            break;
+        case MiscRecordType::gkSpecies:
+        {
+            QVector<std::string> unique_species_vec;
 
-                    batch.Delete(LEVELDB_STORE_NAME_ID);
+            for (auto it = categories.licensee_cache.begin(); it != categories.licensee_cache.end(); ++it) {
+                del_cat_key_vals(MiscRecordType::gkLicensee, it.value());
 
-                    if (write_db) { // There is at least one key/value pair that needs to be written back to the database
-                        batch.Put(LEVELDB_STORE_NAME_ID, oss.str());
-                    }
+                if (!unique_uuid_vec.contains(it.key())) {
+                    unique_uuid_vec.push_back(it.key());
                 }
             }
 
-                break;
-            default:
-                throw std::invalid_argument(tr("Unable to read Unique Identifier from database!").toStdString());
-        }
-
-        std::lock_guard<std::mutex> locker(db_mutex);
-        leveldb::Status s;
-        s = db_conn.db->Write(write_options, &batch);
-        if (!s.ok()) {
-            throw std::runtime_error(s.ToString());
-        }
-    } else {
-        throw std::invalid_argument(tr("One of the given Unique IDs are empty!").toStdString());
-    }
-
-    return;
-}
+            for (auto it = categories.animals_cache.begin(); it != categories.animals_cache.end(); ++it) {
+                del_cat_key_vals(MiscRecordType::gkId, it.value().second);
 
-/**
- * @brief GkDbWrite::add_uuid Adds a new Unique Identifier for the record in question to the Google LevelDB database.
- * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
- * @date 2018-02-21
- * @param uuid The UUID tieing all the separate database entries/keys together.
- * @param licensee The licensee in regard to this record in question.
- * @param species The species of the animal/lizard in question.
- * @param id The identifier, for the animal/lizard in question.
- * @return Whether the process was a success or not.
- */
-bool GkDbWrite::add_uuid(const std::string &uuid, const GkRecords::GkLicensee &licensee,
-                         const GkRecords::GkSpecies &species, const GkRecords::GkId &id)
-{
-    try {
-        using namespace GkRecords;
-        std::ostringstream oss;
-        auto record_cache = gkDbRead->get_uuids();
-        bool licensee_existing = false;
-        bool species_existing = false;
-        bool animal_existing = false;
-        if (!record_cache.empty()) {
-            for (const auto &record: record_cache) {
-                oss << record.first << "," << record.second.licensee_id << "," << record.second.species_id << ","
-                    << record.second.name_id << std::endl;
-
-                if (record.second.licensee_id == licensee.licensee_id) {
-                    licensee_existing = true;
+                if (!unique_uuid_vec.contains(it.key())) {
+                    unique_uuid_vec.push_back(it.key());
                 }
 
-                if (record.second.species_id == species.species_id) {
-                    species_existing = true;
+                if (!unique_species_vec.contains(it.value().first)) {
+                    unique_species_vec.push_back(it.value().first);
                 }
+            }
 
-                if (record.second.name_id == id.name_id) {
-                    animal_existing = true;
-                }
+            for (const auto &species: unique_species_vec) {
+                del_cat_key_vals(MiscRecordType::gkSpecies, species); // This deletes the `Species ID`
             }
         }
 
-        if ((!uuid.empty()) && (!licensee.licensee_id.empty()) && (!species.species_id.empty()) &&
-                (!id.name_id.empty())) {
-            // Now we insert the new UUID alongside with its value
-            oss << uuid << "," << licensee.licensee_id << "," << species.species_id << "," << id.name_id << std::endl;
-        } else {
-            throw std::invalid_argument(tr("One of the given UUIDs are empty!").toStdString());
-        }
+            break;
+        case MiscRecordType::gkId:
+        {
+            QVector<std::string> unique_animals_vec;
 
-        if (!licensee.licensee_id.empty()) {
-            if (!licensee_existing) { // Check that the `Licensee` does not already exist in the database
-                // We have a new entry for the Licensee sub-record!
-                add_cat_key_vals(MiscRecordType::gkLicensee, licensee.licensee_id, licensee.licensee_name);
-            }
-        }
+            for (auto it = categories.licensee_cache.begin(); it != categories.licensee_cache.end(); ++it) {
+                del_cat_key_vals(MiscRecordType::gkLicensee, it.value());
 
-        if (!species.species_id.empty()) {
-            if (!species_existing) { // Check that the `Species` does not already exist in the database
-                // We have a new entry for the Species sub-record!
-                add_cat_key_vals(MiscRecordType::gkSpecies, species.species_id, species.species_name);
+                if (!unique_uuid_vec.contains(it.key())) {
+                    unique_uuid_vec.push_back(it.key());
+                }
             }
-        }
 
-        if (!id.name_id.empty()) {
-            if (!animal_existing) { // Check that the `Animal ID` does not already exist in the database
-                // We have a new entry for the Name/ID# sub-record!
-                add_cat_key_vals(MiscRecordType::gkId, id.name_id, id.identifier_str);
-            }
-        }
+            for (auto it = categories.species_cache.begin(); it != categories.species_cache.end(); ++it) {
+                del_cat_key_vals(MiscRecordType::gkSpecies, it.value().first);
 
-        leveldb::WriteOptions write_options;
-        write_options.sync = true;
-        leveldb::WriteBatch batch;
-        std::lock_guard<std::mutex> locker(db_mutex);
+                if (!unique_uuid_vec.contains(it.key())) {
+                    unique_uuid_vec.push_back(it.key());
+                }
 
-        batch.Delete(LEVELDB_STORE_RECORD_ID);
-        batch.Put(LEVELDB_STORE_RECORD_ID, oss.str());
+                if (!unique_animals_vec.contains(it.value().second)) {
+                    unique_animals_vec.push_back(it.value().second);
+                }
+            }
 
-        leveldb::Status s;
-        s = db_conn.db->Write(write_options, &batch);
-        if (!s.ok()) {
-            throw std::runtime_error(s.ToString());
+            for (const auto &animals: unique_animals_vec) {
+                del_cat_key_vals(MiscRecordType::gkId, animals); // This deletes the `Animal ID`
+            }
         }
 
-        return true;
-    } catch (const std::exception &e) {
-        QMessageBox::warning(nullptr, tr("Error!"), e.what(), QMessageBox::Ok);
+            break;
+        default:
+            throw std::runtime_error(tr("Unable to delete records from the database!").toStdString());
+    }
+
+    for (const auto &uuid: unique_uuid_vec) {
+        // Now delete the main UUID itself!
+        del_log_entry(uuid);
     }
 
-    return false;
+    return true;
 }
 
 /**
- * @brief GkDbWrite::del_uuid Deletes a specified Unique Identifier for the record in question from the Google LevelDB
- * database.
+ * @brief GkDbWrite::create_uuid Creates a UUID and then converts it to uppercase, ready for use. It is primarily used
+ * for database record-keeping purposes throughout HerpLog.
  * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
- * @date 2018-03
- * @param uuid The UUID tieing all the separate database entries/keys together.
- * @return Whether the operation was a success or not.
+ * @date 2017-12
+ * @return The thusly created UUID.
  */
-bool GkDbWrite::del_uuid(const std::string &uuid)
+std::string GkDbWrite::create_uuid()
 {
-    try {
-        if (!uuid.empty()) {
-            using namespace GkRecords;
-            leveldb::WriteOptions write_options;
-            write_options.sync = true;
-            leveldb::WriteBatch batch;
-
-            std::ostringstream oss;
-            auto record_cache = gkDbRead->get_uuids();
-            bool write_db = false;
-
-            if (!record_cache.empty()) {
-                for (const auto &record: record_cache) {
-                    if (record.first != uuid) {
-                        oss << record.first << "," << record.second.licensee_id << "," << record.second.species_id << ","
-                            << record.second.name_id << std::endl;
-                        write_db = true;
-                    }
-                }
-            } else {
-                throw std::runtime_error(tr("There are no entries to delete!").toStdString());
-            }
+    // TODO: Check to see if UUID already exists in the database or not...
+    boost::mt19937 ran;
+    std::random_device rd;
+    ran.seed(rd());
+    boost::uuids::basic_random_generator<boost::mt19937> gen(&ran);
+    boost::uuids::uuid u = gen();
+    std::string result = boost::uuids::to_string(u); // Convert the Boost UUID to a std::string
+    boost::to_upper(result); // Convert to uppercase
+    return result;
+}
 
-            batch.Delete(LEVELDB_STORE_RECORD_ID);
-            if (write_db) { // There is at least one key/value pair that needs to be written back to the database
-                batch.Put(LEVELDB_STORE_RECORD_ID, oss.str());
-            }
+/**
+ * @brief GkDbWrite::migrate_id_lists splits up the lists of Unique IDs, as kept by older versions of HerpLog within a
+ * single comma-separated value each, into a key of their own per Unique ID.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @return Whether there was anything to be migrated or not.
+ */
+bool GkDbWrite::migrate_id_lists()
+{
+    GkTraceSpan span("GkDbWrite::migrate_id_lists", "db");
 
-            std::lock_guard<std::mutex> locker(db_mutex);
-            leveldb::Status s;
-            s = db_conn.db->Write(write_options, &batch);
-            if (!s.ok()) {
-                throw std::runtime_error(s.ToString());
+    using namespace GkRecords;
+    leveldb::WriteBatch batch;
+    bool migrated = false;
+    std::string csv_read_data;
+    leveldb::Status s = db_conn.db->Get(leveldb::ReadOptions(), LEVELDB_STORE_RECORD_ID, &csv_read_data);
+    if (s.ok()) {
+        csv::istringstream iss(csv_read_data);
+        iss.set_delimiter(',', "$$");
+        std::string record_id;
+        MiscUniqueIds unique_ids;
+        while (iss.read_line()) {
+            iss >> record_id >> unique_ids.licensee_id >> unique_ids.species_id >> unique_ids.name_id;
+            if ((record_id.empty()) || (unique_ids.licensee_id.empty()) || (unique_ids.species_id.empty()) ||
+                    (unique_ids.name_id.empty())) {
+                throw std::invalid_argument(tr("An error had occurred whilst obtaining information about stored-keys from the database!").toStdString());
             }
 
-            return true;
-        } else {
-            throw std::invalid_argument(tr("One of the given UUIDs are empty!").toStdString());
+            batch.Put(gkStrOp->unique_id_key(record_id), gkStrOp->encode_unique_ids(unique_ids));
         }
-    } catch (const std::exception &e) {
-        QMessageBox::warning(nullptr, tr("Error!"), e.what(), QMessageBox::Ok);
+
+        batch.Delete(LEVELDB_STORE_RECORD_ID);
+        migrated = true;
+    } else if (!s.IsNotFound()) {
+        throw std::runtime_error(s.ToString());
+    }
+
+    const std::pair<MiscRecordType, const char *> cat_lists[3] = { { MiscRecordType::gkLicensee, LEVELDB_STORE_LICENSEE_ID },
+                                                                   { MiscRecordType::gkSpecies, LEVELDB_STORE_SPECIES_ID },
+                                                                   { MiscRecordType::gkId, LEVELDB_STORE_NAME_ID } };
+    for (const auto &cat_list: cat_lists) {
+        csv_read_data.clear();
+        s = db_conn.db->Get(leveldb::ReadOptions(), cat_list.second, &csv_read_data);
+        if (s.IsNotFound()) {
+            continue;
+        } else if (!s.ok()) {
+            throw std::runtime_error(s.ToString());
+        }
+
+        csv::istringstream iss(csv_read_data);
+        iss.set_delimiter(',', "$$");
+        std::string id, name;
+        while (iss.read_line()) {
+            iss >> id >> name;
+            if (!id.empty()) {
+                batch.Put(gkStrOp->cat_key(cat_list.first, id), name);
+            }
+        }
+
+        batch.Delete(cat_list.second);
+        migrated = true;
+    }
+
+    if (migrated) {
+        commit(batch);
     }
 
-    return false;
+    return migrated;
 }
 
 /**
- * @brief GkDbWrite::mass_del_id Will delete any number of records (depending on what's associated) from the Google LevelDB
- * database in one, swift go.
+ * @brief GkDbWrite::rebuild_indexes (re)creates the secondary indexes from the records themselves, whenever the
+ * database was written by a version of HerpLog that either lacked them or laid them out differently.
  * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
- * @date 2018-03-19
- * @param record_type Whether to delete data from `store_licensee_id`, `store_species_id`, and/or `store_name_id` from within
- * the Google LevelDB database.
- * @param record_id The Unique ID of the record in question.
- * @param recursive If records of another type should be deleted recursively as well, or not.
- * @return Whether the operation was a success or not.
+ * @date 2026-10-18
+ * @param force Whether to rebuild the indexes even if they appear to be up-to-date.
+ * @return Whether the indexes were rebuilt or not.
  */
-bool GkDbWrite::mass_del_cat(const GkRecords::MiscRecordType &record_type, const std::string &record_id)
+bool GkDbWrite::rebuild_indexes(const bool &force)
 {
-    try {
-        if (!record_id.empty()) {
-            using namespace GkRecords;
-            switch (record_type) {
-                case MiscRecordType::gkLicensee:
-                {
-                    // Must firstly determine what species and animals are associated with this licensee record
-                    auto uuid_cache = gkDbRead->get_uuids();
-                    QMap<std::string, std::pair<std::string, std::string>> unique_species_map; // <Key: UUID, Value: <License ID, Species ID>>
-                    QMap<std::string, std::pair<std::string, std::string>> unique_animals_map; // <Key: UUID, Value: <Species ID, Animal ID>>
-
-                    for (const auto &uuid: uuid_cache) {
-                        if (uuid.second.licensee_id == record_id) {
-                            if (!unique_species_map.contains(uuid.second.species_id)) {
-                                unique_species_map.insert(uuid.first, std::make_pair(uuid.second.licensee_id, uuid.second.species_id));
-                            }
-
-                            if (!unique_animals_map.contains(uuid.second.name_id)) {
-                                unique_animals_map.insert(uuid.first, std::make_pair(uuid.second.species_id, uuid.second.name_id));
-                            }
-                        }
-                    }
+    GkTraceSpan span("GkDbWrite::rebuild_indexes", "db");
+    GkWriteLease lease(db_conn);
 
-                    GkCategories categories;
-                    categories.spec_record_id = record_id;
-                    categories.species_cache = unique_species_map;
-                    categories.animals_cache = unique_animals_map;
-                    bool ret = gkStrOp->del_cat_msg_box(categories, MiscRecordType::gkLicensee);
+    using namespace GkRecords;
+    const std::string current_version = std::to_string(LEVELDB_INDEX_CURRENT_VERSION);
 
-                    if (ret) {
-                        QVector<std::string> unique_uuid_vec;
-                        del_cat_key_vals(MiscRecordType::gkLicensee, record_id); // This deletes the `Licensee ID`
+    std::string stored_version;
+    leveldb::Status s;
+    s = db_conn.db->Get(leveldb::ReadOptions(), LEVELDB_INDEX_VERSION, &stored_version);
+    if (!s.ok() && !s.IsNotFound()) {
+        throw std::runtime_error(s.ToString());
+    }
 
-                        for (auto it = unique_species_map.begin(); it != unique_species_map.end(); ++it) {
-                            del_cat_key_vals(MiscRecordType::gkSpecies, it.value().second);
+    if ((stored_version == current_version) && !force) {
+        return false;
+    }
 
-                            if (!unique_uuid_vec.contains(it.key())) {
-                                unique_uuid_vec.push_back(it.key());
-                            }
-                        }
+    migrate_id_lists(); // The indexes are rebuilt from the lists of Unique IDs, so these must be read-able first
 
-                        for (auto it = unique_animals_map.begin(); it != unique_animals_map.end(); ++it) {
-                            del_cat_key_vals(MiscRecordType::gkId, it.value().second);
+    leveldb::WriteBatch batch;
 
-                            if (!unique_uuid_vec.contains(it.key())) {
-                                unique_uuid_vec.push_back(it.key());
-                            }
-                        }
+    // Clear out whatever is left of the old indexes before anything else
+    for (const std::string prefix: { LEVELDB_INDEX_TIMESTAMP, LEVELDB_INDEX_RECORD_HASH, LEVELDB_INDEX_BUCKET_DIGEST,
+                                     LEVELDB_INDEX_TEXT, LEVELDB_INDEX_ANIMAL, LEVELDB_INDEX_WEIGHT_SKETCH, LEVELDB_INDEX_WEIGHT_STALE,
+                                     LEVELDB_INDEX_ANIMAL_SUMMARY, LEVELDB_INDEX_ATTACHMENT_REF, LEVELDB_INDEX_FLAG_ROW,
+                                     LEVELDB_INDEX_FLAG_RECORD, LEVELDB_INDEX_FLAG_BITMAP, LEVELDB_INDEX_FLAG_META }) {
+        leveldb::ReadOptions read_opt;
+        read_opt.fill_cache = false;
+        std::unique_ptr<leveldb::Iterator> it(db_conn.db->NewIterator(read_opt));
+        for (it->Seek(prefix); it->Valid() && it->key().starts_with(prefix); it->Next()) {
+            batch.Delete(it->key());
+        }
+    }
 
-                        for (const auto &uuid: unique_uuid_vec) {
-                            // Now delete the main UUID itself!
-                            del_log_entry(uuid, false);
-                        }
-                    }
-                }
+    // The records are hashed by the names of their categories, rather than by their Unique IDs
+    std::unordered_map<std::string, std::string> cat_names[3];
+    const MiscRecordType cat_types[3] = { MiscRecordType::gkLicensee, MiscRecordType::gkSpecies, MiscRecordType::gkId };
+    for (int i = 0; i < 3; ++i) {
+        auto cat_key_vals = gkDbRead->get_cat_key_vals(cat_types[i]);
+        for (auto cat = cat_key_vals.begin(); cat != cat_key_vals.end(); ++cat) {
+            cat_names[i][cat.key()] = cat.value();
+        }
+    }
 
-                    return true;
-                case MiscRecordType::gkSpecies:
-                {
-                    // We must determine what licensees and animals are associated with this species record.
-                    auto uuid_cache = gkDbRead->get_uuids();
-                    QMap<std::string, std::string> unique_licensees_map; // <Key: UUID, Value: Licensee ID>
-                    QMap<std::string, std::pair<std::string, std::string>> unique_animals_map; // <Key: UUID, Value: <Species ID, Animal ID>>
-
-                    for (const auto &uuid: uuid_cache) {
-                        if (uuid.second.species_id == record_id) {
-                            if (!unique_licensees_map.contains(uuid.first)) {
-                                unique_licensees_map.insert(uuid.first, uuid.second.licensee_id);
-                            }
-
-                            if (!unique_animals_map.contains(uuid.first)) {
-                                unique_animals_map.insert(uuid.first, std::make_pair(uuid.second.species_id,
-                                                                                     uuid.second.name_id));
-                            }
-                        }
-                    }
+    std::map<long int, GkBucketDigest> digests;
+    std::map<std::pair<std::string, long int>, GkQuantileSketch> sketches;
+    std::map<std::string, std::vector<std::pair<GkAnimalIndexEntry, std::uint8_t>>> animal_records;
+    std::map<std::string, std::uint64_t> attachment_refs;
+    std::vector<GkFlagRow> flag_rows;
+    for (const auto &record: gkDbRead->get_uuids()) {
+        // A photo is counted even if the rest of its record is damaged, lest it gets swept away from underneath it
+        const auto hashes = gkDbRead->read_attachments(record.first);
+        for (const auto &hash: std::set<std::string>(hashes.begin(), hashes.end())) {
+            ++attachment_refs[hash];
+        }
 
-                    GkCategories categories;
-                    categories.spec_record_id = record_id;
-                    categories.licensee_cache = unique_licensees_map;
-                    categories.animals_cache = unique_animals_map;
-                    bool ret = gkStrOp->del_cat_msg_box(categories, MiscRecordType::gkSpecies);
+        try {
+            const long int date_time = std::stol(gkDbRead->read_item_db(record.first, dateTime));
+            batch.Put(gkStrOp->timestamp_index_key(date_time, record.first), "");
+        } catch (const std::exception &e) {
+            Q_UNUSED(e); // A record without a (valid) Date/Time cannot be placed within the indexes
+            continue;
+        }
 
-                    if (ret) {
-                        QVector<std::string> unique_uuid_vec;
-                        QVector<std::string> unique_species_vec;
+        try {
+            GkSubmit submit = gkDbRead->read_log_entry(record.first);
+            submit.licensee.licensee_name = cat_names[0][record.second.licensee_id];
+            submit.species.species_name = cat_names[1][record.second.species_id];
+            submit.identifier.identifier_str = cat_names[2][record.second.name_id];
+
+            const long int bucket = gkStrOp->merge_bucket(submit.date_time);
+            const std::uint64_t leaf = gkStrOp->record_leaf(record.first, gkStrOp->record_hash(submit));
+            batch.Put(gkStrOp->record_hash_key(bucket, record.first), gkStrOp->encode_u64(leaf));
+            batch.Put(gkStrOp->animal_index_key(record.second.name_id, submit.date_time, record.first),
+                      gkStrOp->encode_weight(submit.weight));
+            auto digest = digests.emplace(bucket, GkBucketDigest { 0, 0 }).first;
+            digest->second.digest ^= leaf;
+            ++digest->second.count;
+            sketches[std::make_pair(record.second.species_id, bucket)].insert(submit.weight);
+            const std::uint8_t flags = (submit.went_toilet ? WentToilet : 0) | (submit.had_hydration ? HadHydration : 0) |
+                                       (submit.had_vitamins ? HadVitamins : 0);
+            animal_records[record.second.name_id].emplace_back(
+                        GkAnimalIndexEntry { submit.date_time, record.first, submit.weight }, flags);
+            flag_rows.push_back(GkFlagRow { 0, record.first, record.second.name_id, submit.date_time, flags });
+
+            for (const auto &posting: GkTextIndex::postings(record.first, submit)) {
+                batch.Put(posting.first, posting.second);
+            }
+        } catch (const std::exception &e) {
+            Q_UNUSED(e); // A damaged record is left out of the digests, and so will never be merged elsewhere
+        }
+    }
 
-                        for (auto it = unique_licensees_map.begin(); it != unique_licensees_map.end(); ++it) {
-                            del_cat_key_vals(MiscRecordType::gkLicensee, it.value());
+    for (const auto &digest: digests) {
+        batch.Put(gkStrOp->bucket_digest_key(digest.first),
+                  gkStrOp->encode_u64(digest.second.digest) + gkStrOp->encode_u64(digest.second.count));
+    }
 
-                            if (!unique_uuid_vec.contains(it.key())) {
-                                unique_uuid_vec.push_back(it.key());
-                            }
-                        }
+    for (const auto &sketch: sketches) {
+        batch.Put(gkStrOp->weight_sketch_key(sketch.first.first, sketch.first.second), sketch.second.serialise());
+    }
 
-                        for (auto it = unique_animals_map.begin(); it != unique_animals_map.end(); ++it) {
-                            del_cat_key_vals(MiscRecordType::gkId, it.value().second);
+    for (auto &animal: animal_records) {
+        std::sort(animal.second.begin(), animal.second.end(), [](const std::pair<GkAnimalIndexEntry, std::uint8_t> &lhs,
+                                                                 const std::pair<GkAnimalIndexEntry, std::uint8_t> &rhs) {
+            return std::tie(lhs.first.date_time, lhs.first.record_id) < std::tie(rhs.first.date_time, rhs.first.record_id);
+        });
+
+        std::vector<GkAnimalIndexEntry> entries;
+        std::vector<std::uint8_t> flags;
+        for (const auto &entry: animal.second) {
+            entries.push_back(entry.first);
+            flags.push_back(entry.second);
+        }
 
-                            if (!unique_uuid_vec.contains(it.key())) {
-                                unique_uuid_vec.push_back(it.key());
-                            }
+        batch.Put(gkStrOp->animal_summary_key(animal.first),
+                  gkStrOp->encode_animal_summary(GkAnimalStats::summarise(animal.first, entries, flags)));
+    }
 
-                            if (!unique_species_vec.contains(it.value().first)) {
-                                unique_species_vec.push_back(it.value().first);
-                            }
-                        }
+    for (const auto &refs: attachment_refs) {
+        batch.Put(gkStrOp->attachment_ref_key(refs.first), gkStrOp->encode_u64(refs.second));
+    }
 
-                        for (const auto &species: unique_species_vec) {
-                            del_cat_key_vals(MiscRecordType::gkSpecies, species); // This deletes the `Species ID`
-                        }
+    // The flag index starts over with its ordinals in order of Date/Time, without any gaps
+    std::sort(flag_rows.begin(), flag_rows.end(), [](const GkFlagRow &lhs, const GkFlagRow &rhs) {
+        return std::tie(lhs.date_time, lhs.record_id) < std::tie(rhs.date_time, rhs.record_id);
+    });
+
+    std::map<std::pair<std::string, std::uint16_t>, GkBitmap> flag_chunks;
+    for (std::size_t i = 0; i < flag_rows.size(); ++i) {
+        GkFlagRow &row = flag_rows[i];
+        row.ordinal = static_cast<std::uint32_t>(i);
+        batch.Put(gkStrOp->flag_row_key(row.ordinal), gkStrOp->encode_flag_row(row));
+        batch.Put(gkStrOp->flag_record_key(row.record_id), gkStrOp->encode_u64(row.ordinal));
+        for (const auto &bitmap: GkFlagIndex::bitmaps(row.flags, row.name_id)) {
+            flag_chunks[std::make_pair(bitmap, static_cast<std::uint16_t>(row.ordinal >> 16))].add(row.ordinal);
+        }
+    }
 
-                        for (const auto &uuid: unique_uuid_vec) {
-                            // Now delete the main UUID itself!
-                            del_log_entry(uuid, false);
-                        }
-                    }
-                }
+    for (const auto &chunk: flag_chunks) {
+        batch.Put(gkStrOp->flag_bitmap_key(chunk.first.first, chunk.first.second), chunk.second.serialise());
+    }
 
-                    return true;
-                case MiscRecordType::gkId:
-                {
-                    // We must determine what licensees and species are associated with this animal record.
-                    auto uuid_cache = gkDbRead->get_uuids();
-                    QMap<std::string, std::string> unique_licensees_map; // <Key: UUID, Value: License ID>
-                    QMap<std::string, std::pair<std::string, std::string>> unique_species_map; // <Key: UUID, Value: <Species ID, Animal ID>>
-
-                    for (const auto &uuid: uuid_cache) {
-                        if (uuid.second.name_id == record_id) {
-                            if (!unique_licensees_map.contains(uuid.first)) {
-                                unique_licensees_map.insert(uuid.first, uuid.second.licensee_id);
-                            }
-
-                            if (!unique_species_map.contains(uuid.first)) {
-                                unique_species_map.insert(uuid.first, std::make_pair(uuid.second.species_id,
-                                                                                     uuid.second.name_id));
-                            }
-                        }
-                    }
+    const GkFlagIndexMeta flag_meta = { flag_rows.size(), flag_rows.size(),
+                                        flag_rows.empty() ? 0 : flag_rows.back().date_time };
+    batch.Put(LEVELDB_INDEX_FLAG_META, gkStrOp->encode_flag_meta(flag_meta));
 
-                    GkCategories categories;
-                    categories.spec_record_id = record_id;
-                    categories.licensee_cache = unique_licensees_map;
-                    categories.species_cache = unique_species_map;
-                    bool ret = gkStrOp->del_cat_msg_box(categories, MiscRecordType::gkId);
+    batch.Put(LEVELDB_INDEX_VERSION, current_version);
+    commit(batch);
 
-                    if (ret) {
-                        QVector<std::string> unique_uuid_vec;
-                        QVector<std::string> unique_animals_vec;
+    return true;
+}
 
-                        for (auto it = unique_licensees_map.begin(); it != unique_licensees_map.end(); ++it) {
-                            del_cat_key_vals(MiscRecordType::gkLicensee, it.value());
+/**
+ * @brief GkDbWrite::repair_animal_summaries works out anew the rolling statistics of every animal that has had a record
+ * deleted, or one come in out of order, since they were last worked out. It's meant to be run in the background, well
+ * after the writes that made the summaries stale, whereby it only needs to read the records of those animals.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @return How many of the summaries were repaired.
+ * @see GkDbWrite::fold_animal_summary()
+ */
+std::size_t GkDbWrite::repair_animal_summaries()
+{
+    GkTraceSpan span("GkDbWrite::repair_animal_summaries", "db");
+    GkWriteLease lease(db_conn);
 
-                            if (!unique_uuid_vec.contains(it.key())) {
-                                unique_uuid_vec.push_back(it.key());
-                            }
-                        }
+    using namespace GkRecords;
+    leveldb::WriteBatch batch;
+    std::size_t repaired = 0;
+    for (const auto &stale: gkDbRead->read_animal_summaries()) {
+        if (!stale.stale) {
+            continue;
+        }
 
-                        for (auto it = unique_species_map.begin(); it != unique_species_map.end(); ++it) {
-                            del_cat_key_vals(MiscRecordType::gkSpecies, it.value().first);
+        const auto entries = gkDbRead->scan_animal_index(stale.name_id, std::numeric_limits<long int>::min(),
+                                                         std::numeric_limits<long int>::max(),
+                                                         std::numeric_limits<std::size_t>::max());
+        std::vector<std::uint8_t> flags;
+        flags.reserve(entries.size());
+        for (const auto &entry: entries) {
+            std::uint8_t entry_flags = 0;
+            try {
+                entry_flags |= (std::stoi(gkDbRead->read_item_db(entry.record_id, boolWentToilet)) != 0) ? WentToilet : 0;
+                entry_flags |= (std::stoi(gkDbRead->read_item_db(entry.record_id, boolHadHydration)) != 0) ? HadHydration : 0;
+                entry_flags |= (std::stoi(gkDbRead->read_item_db(entry.record_id, boolHadVitamins)) != 0) ? HadVitamins : 0;
+            } catch (const std::exception &e) {
+                Q_UNUSED(e); // A damaged flag is taken as not having been set
+            }
 
-                            if (!unique_uuid_vec.contains(it.key())) {
-                                unique_uuid_vec.push_back(it.key());
-                            }
+            flags.push_back(entry_flags);
+        }
 
-                            if (!unique_animals_vec.contains(it.value().second)) {
-                                unique_animals_vec.push_back(it.value().second);
-                            }
-                        }
+        if (entries.empty()) {
+            batch.Delete(gkStrOp->animal_summary_key(stale.name_id));
+        } else {
+            batch.Put(gkStrOp->animal_summary_key(stale.name_id),
+                      gkStrOp->encode_animal_summary(GkAnimalStats::summarise(stale.name_id, entries, flags)));
+        }
 
-                        for (const auto &animals: unique_animals_vec) {
-                            del_cat_key_vals(MiscRecordType::gkId, animals); // This deletes the `Animal ID`
-                        }
+        ++repaired;
+    }
 
-                        for (const auto &uuid: unique_uuid_vec) {
-                            // Now delete the main UUID itself!
-                            del_log_entry(uuid, false);
-                        }
-                    }
-                }
+    if (repaired > 0) {
+        commit(batch);
+    }
 
-                    return true;
-                default:
-                    throw std::runtime_error(tr("Unable to delete records from the database!").toStdString());
-            }
+    return repaired;
+}
+
+/**
+ * @brief GkDbWrite::repair_weight_sketches makes anew, and writes back, the quantile sketches of any buckets that have
+ * had a record deleted from them. Much like GkDbWrite::repair_animal_summaries(), it's meant to be run in the background
+ * well after the deletes themselves, whereby each bucket only gets read the once however many were deleted from it.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @return How many of the sketches were repaired.
+ * @see GkDbWrite::unfold_weight_sketch()
+ */
+std::size_t GkDbWrite::repair_weight_sketches()
+{
+    GkTraceSpan span("GkDbWrite::repair_weight_sketches", "db");
+    GkWriteLease lease(db_conn);
+
+    leveldb::WriteBatch batch;
+    const auto stale = gkDbRead->read_stale_weight_sketches();
+    for (const auto &sketch_id: stale) {
+        const GkQuantileSketch sketch = gkDbRead->make_weight_sketch(sketch_id.first, sketch_id.second);
+        const std::string sketch_key = gkStrOp->weight_sketch_key(sketch_id.first, sketch_id.second);
+        if (sketch.empty()) {
+            batch.Delete(sketch_key);
         } else {
-            throw std::invalid_argument(tr("One of the given Unique IDs are empty!").toStdString());
+            batch.Put(sketch_key, sketch.serialise());
         }
-    } catch (const std::exception &e) {
-        QMessageBox::warning(nullptr, tr("Error!"), e.what(), QMessageBox::Ok);
+
+        batch.Delete(gkStrOp->stale_weight_sketch_key(sketch_id.first, sketch_id.second));
+    }
+
+    if (!stale.empty()) {
+        commit(batch);
     }
 
-    return false;
+    return stale.size();
 }
 
 /**
- * @brief GkDbWrite::create_uuid Creates a UUID and then converts it to uppercase, ready for use. It is primarily used
- * for database record-keeping purposes throughout HerpLog.
+ * @brief GkDbWrite::acknowledge_alerts takes the given alerts off the queue, once the user has seen to them.
  * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
- * @date 2017-12
- * @return The thusly created UUID.
+ * @date 2026-10-19
+ * @param sequences The sequence numbers of the alerts to be acknowledged.
+ * @see GkDbRead::read_alerts()
  */
-std::string GkDbWrite::create_uuid()
+void GkDbWrite::acknowledge_alerts(const std::vector<std::uint64_t> &sequences)
 {
-    // TODO: Check to see if UUID already exists in the database or not...
-    boost::mt19937 ran;
-    std::random_device rd;
-    ran.seed(rd());
-    boost::uuids::basic_random_generator<boost::mt19937> gen(&ran);
-    boost::uuids::uuid u = gen();
-    std::string result = boost::uuids::to_string(u); // Convert the Boost UUID to a std::string
-    boost::to_upper(result); // Convert to uppercase
-    return result;
+    if (sequences.empty()) {
+        return;
+    }
+
+    leveldb::WriteBatch batch;
+    for (const auto &sequence: sequences) {
+        batch.Delete(gkStrOp->alert_key(sequence));
+    }
+
+    commit(batch);
+    return;
 }
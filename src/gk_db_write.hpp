@@ -47,12 +47,16 @@
 #include "options.hpp"
 #include "gk_string_op.hpp"
 #include "gk_db_read.hpp"
+#include "gk_change_feed.hpp"
 #include <QtCore/QObject>
+#include <QtCore/QMetaType>
 #include <unordered_map>
 #include <string>
 #include <mutex>
 #include <utility>
 #include <memory>
+#include <vector>
+#include <cstdint>
 
 namespace GekkoFyre {
 class GkDbWrite;
@@ -66,25 +70,63 @@ public:
     ~GkDbWrite();
 
     void add_item_db(const std::string &record_id, const std::string &key, std::string value);
+    bool add_log_entry(const std::string &uuid, const GkRecords::GkSubmit &submit);
     void del_item_db(const std::string &record_id, const std::string &key);
-    bool del_log_entry(const std::string &uuid, const bool &pose_msg_box = false);
-    bool add_uuid(const std::string &uuid, const GkRecords::GkLicensee &licensee, const GkRecords::GkSpecies &species,
-                  const GkRecords::GkId &id);
-    bool del_uuid(const std::string &uuid);
-    bool mass_del_cat(const GkRecords::MiscRecordType &record_type, const std::string &record_id);
+    bool del_log_entry(const std::string &uuid);
+    GkRecords::GkCategories find_cat_dependants(const GkRecords::MiscRecordType &record_type, const std::string &record_id);
+    bool mass_del_cat(const GkRecords::MiscRecordType &record_type, const GkRecords::GkCategories &categories);
     std::string create_uuid();
+    bool rebuild_indexes(const bool &force = false);
+    std::size_t repair_animal_summaries();
+    std::size_t repair_weight_sketches();
+    void acknowledge_alerts(const std::vector<std::uint64_t> &sequences);
+    std::shared_ptr<GkChangeFeed> change_feed() const;
+
+signals:
+    void alerts_raised(const std::vector<GkRecords::GkAlert> &alerts);
 
 private:
-    void add_cat_key_vals(const GkRecords::MiscRecordType &record_type, const std::string &record_id,
+    void add_cat_key_vals(leveldb::WriteBatch &batch, std::vector<GkRecords::GkChange> &changes,
+                          const GkRecords::MiscRecordType &record_type, const std::string &record_id,
                           const std::string &value);
+    bool add_uuid(leveldb::WriteBatch &batch, std::vector<GkRecords::GkChange> &changes, const std::string &uuid,
+                  const GkRecords::GkLicensee &licensee, const GkRecords::GkSpecies &species, const GkRecords::GkId &id);
+    bool del_uuid(leveldb::WriteBatch &batch, const std::string &uuid, GkRecords::MiscUniqueIds &unique_ids);
     void del_cat_key_vals(const GkRecords::MiscRecordType &record_type, const std::string &record_id);
+    void commit(leveldb::WriteBatch &batch, std::vector<GkRecords::GkChange> changes = {});
+    bool migrate_id_lists();
+    void stale_indexes(leveldb::WriteBatch &batch);
+    void fold_record_hash(leveldb::WriteBatch &batch, const long int &bucket, const std::string &record_id,
+                          const std::uint64_t &leaf, const bool &inserted);
+    void fold_record_hash(leveldb::WriteBatch &batch, const long int &bucket, const std::string &record_id,
+                          const std::uint64_t &old_leaf, const std::uint64_t &new_leaf);
+    void fold_item_edit(leveldb::WriteBatch &batch, const std::string &record_id, const std::string &key,
+                        const std::string &value);
+    void refile_flag_row(leveldb::WriteBatch &batch, const std::string &record_id, const long int &date_time);
+    void fold_weight_sketch(leveldb::WriteBatch &batch, const std::string &species_id, const long int &bucket,
+                            const double &weight);
+    std::vector<GkRecords::GkAlert> fold_animal_summary(leveldb::WriteBatch &batch, const std::string &record_id,
+                                                        const std::string &name_id, const GkRecords::GkSubmit &submit);
+    void queue_alerts(leveldb::WriteBatch &batch, std::vector<GkRecords::GkAlert> &alerts);
+    void stale_animal_summary(leveldb::WriteBatch &batch, const std::string &name_id);
+    void fold_attachment_refs(leveldb::WriteBatch &batch, const std::vector<std::string> &hashes,
+                              const bool &inserted);
+    void unfold_weight_sketch(leveldb::WriteBatch &batch, const std::string &species_id, const long int &bucket);
+    void fold_flag_index(leveldb::WriteBatch &batch, const std::string &record_id, const GkRecords::GkSubmit &submit);
+    void unfold_flag_index(leveldb::WriteBatch &batch, const std::string &record_id);
+    bool fold_flag_bitmap(leveldb::WriteBatch &batch, const std::string &bitmap, const std::uint32_t &ordinal,
+                          const bool &inserted);
 
     std::shared_ptr<GkStringOp> gkStrOp;
     GkFile::FileDb db_conn;
     std::shared_ptr<GkDbRead> gkDbRead;
+    std::shared_ptr<GkChangeFeed> gkChangeFeed;
 
     std::mutex db_mutex;
+    bool indexes_stale; // Whether the batch being committed could not be folded into the indexes
 };
 }
 
+Q_DECLARE_METATYPE(std::vector<GekkoFyre::GkRecords::GkAlert>)
+
 #endif // GKDB_WRITE_HPP
\ No newline at end of file
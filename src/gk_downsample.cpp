@@ -0,0 +1,126 @@
+/**
+ **  _   _                 _
+ ** | | | |               | |
+ ** | |_| | ___ _ __ _ __ | |     ___   __ _
+ ** |  _  |/ _ \ '__| '_ \| |    / _ \ / _` |
+ ** | | | |  __/ |  | |_) | |___| (_) | (_| |
+ ** \_| |_/\___|_|  | .__/\_____/\___/ \__, |
+ **                 | |                 __/ |
+ **                 |_|                |___/
+ **
+ **   Thank you for using "HerpLog" for your herpetology management requirements!
+ **   Copyright (C) 2017-2018. GekkoFyre.
+ **
+ **
+ **   HerpLog is free software: you can redistribute it and/or modify
+ **   it under the terms of the GNU General Public License as published by
+ **   the Free Software Foundation, either version 3 of the License, or
+ **   (at your option) any later version.
+ **
+ **   HerpLog is distributed in the hope that it will be useful,
+ **   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **   GNU General Public License for more details.
+ **
+ **   You should have received a copy of the GNU General Public License
+ **   along with HerpLog.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ **
+ **   The latest source code updates can be obtained from [ 1 ] below at your
+ **   discretion. A web-browser or the 'git' application may be required.
+ **
+ **   [ 1 ] - https://github.com/GekkoFyre/HerpLog
+ **
+ ********************************************************************************/
+
+/**
+ * @file gk_downsample.cpp
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @brief Routines for reducing the amount of plot points within a series, whilst keeping its visual shape intact.
+ */
+
+#include "gk_downsample.hpp"
+#include <cmath>
+
+using namespace GekkoFyre;
+
+/**
+ * @brief GkDownsample::lttb reduces a series down to `threshold` plot points with the Largest-Triangle-Three-Buckets
+ * algorithm. The first and last points are always kept, and every bucket in between contributes the one point that
+ * forms the largest triangle with the previously chosen point and the average of the next bucket.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @note Sveinn Steinarsson, "Downsampling Time Series for Visual Representation", University of Iceland, 2013.
+ * @param x The x-values of the series, which must be in ascending order.
+ * @param y The y-values of the series.
+ * @param count The amount of plot points within the series.
+ * @param threshold The amount of plot points that are wanted, usually the width of the chart in pixels.
+ * @param indices_out The indices of the plot points that were chosen, in ascending order.
+ * @return The amount of plot points that were chosen.
+ */
+std::size_t GkDownsample::lttb(const double *x, const double *y, const std::size_t &count, const std::size_t &threshold,
+                               std::vector<std::size_t> &indices_out)
+{
+    indices_out.clear();
+    if ((threshold >= count) || (threshold < 3)) {
+        // Nothing to be gained, so keep every plot point
+        indices_out.reserve(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            indices_out.push_back(i);
+        }
+
+        return indices_out.size();
+    }
+
+    indices_out.reserve(threshold);
+    const double bucket_size = static_cast<double>(count - 2) / static_cast<double>(threshold - 2);
+    std::size_t prev = 0;
+    indices_out.push_back(prev);
+
+    for (std::size_t bucket = 0; bucket < threshold - 2; ++bucket) {
+        // The average of the next bucket forms the third point of the triangle
+        std::size_t next_start = static_cast<std::size_t>(std::floor(static_cast<double>(bucket + 1) * bucket_size)) + 1;
+        std::size_t next_end = static_cast<std::size_t>(std::floor(static_cast<double>(bucket + 2) * bucket_size)) + 1;
+        if (next_end > count) {
+            next_end = count;
+        }
+
+        if (next_start >= next_end) {
+            next_start = count - 1;
+            next_end = count;
+        }
+
+        double avg_x = 0.0;
+        double avg_y = 0.0;
+        for (std::size_t i = next_start; i < next_end; ++i) {
+            avg_x += x[i];
+            avg_y += y[i];
+        }
+
+        avg_x /= static_cast<double>(next_end - next_start);
+        avg_y /= static_cast<double>(next_end - next_start);
+
+        // Pick the point within the current bucket that forms the largest triangle
+        const std::size_t start = static_cast<std::size_t>(std::floor(static_cast<double>(bucket) * bucket_size)) + 1;
+        const std::size_t end = static_cast<std::size_t>(std::floor(static_cast<double>(bucket + 1) * bucket_size)) + 1;
+        const double prev_x = x[prev];
+        const double prev_y = y[prev];
+
+        double max_area = -1.0;
+        std::size_t chosen = start;
+        for (std::size_t i = start; i < end && i < count - 1; ++i) {
+            const double area = std::fabs((prev_x - avg_x) * (y[i] - prev_y) - (prev_x - x[i]) * (avg_y - prev_y));
+            if (area > max_area) {
+                max_area = area;
+                chosen = i;
+            }
+        }
+
+        indices_out.push_back(chosen);
+        prev = chosen;
+    }
+
+    indices_out.push_back(count - 1);
+    return indices_out.size();
+}
@@ -0,0 +1,179 @@
+/**
+ **  _   _                 _
+ ** | | | |               | |
+ ** | |_| | ___ _ __ _ __ | |     ___   __ _
+ ** |  _  |/ _ \ '__| '_ \| |    / _ \ / _` |
+ ** | | | |  __/ |  | |_) | |___| (_) | (_| |
+ ** \_| |_/\___|_|  | .__/\_____/\___/ \__, |
+ **                 | |                 __/ |
+ **                 |_|                |___/
+ **
+ **   Thank you for using "HerpLog" for your herpetology management requirements!
+ **   Copyright (C) 2017-2018. GekkoFyre.
+ **
+ **
+ **   HerpLog is free software: you can redistribute it and/or modify
+ **   it under the terms of the GNU General Public License as published by
+ **   the Free Software Foundation, either version 3 of the License, or
+ **   (at your option) any later version.
+ **
+ **   HerpLog is distributed in the hope that it will be useful,
+ **   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **   GNU General Public License for more details.
+ **
+ **   You should have received a copy of the GNU General Public License
+ **   along with HerpLog.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ **
+ **   The latest source code updates can be obtained from [ 1 ] below at your
+ **   discretion. A web-browser or the 'git' application may be required.
+ **
+ **   [ 1 ] - https://github.com/GekkoFyre/HerpLog
+ **
+ ********************************************************************************/
+
+/**
+ * @file gk_executor.cpp
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @brief A small task executor that runs queued jobs upon its own, dedicated thread(s) and hands back the results as
+ * std::future<>'s.
+ */
+
+#include "gk_executor.hpp"
+#include "gk_trace.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+using namespace GekkoFyre;
+
+/**
+ * @brief GkExecutor::GkExecutor starts up the worker thread(s). Jobs are run strictly in the order that they were
+ * submitted when there's only the one thread, which is what the database routines rely upon.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param num_threads How many worker threads to run.
+ */
+GkExecutor::GkExecutor(const std::size_t &num_threads)
+{
+    jobs_running = 0;
+    stopping = false;
+
+    const std::size_t count = std::max<std::size_t>(1, num_threads);
+    workers.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        workers.emplace_back(&GkExecutor::worker_loop, this);
+    }
+}
+
+/**
+ * @brief GkExecutor::~GkExecutor lets any jobs that are still queued up finish, before then joining the worker
+ * thread(s).
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ */
+GkExecutor::~GkExecutor()
+{
+    {
+        std::lock_guard<std::mutex> locker(jobs_mutex);
+        stopping = true;
+    }
+
+    jobs_cv.notify_all();
+    for (auto &worker: workers) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+}
+
+/**
+ * @brief GkExecutor::wait_for_idle blocks until every job submitted so far has been run. It must not be called from
+ * within a job itself.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ */
+void GkExecutor::wait_for_idle()
+{
+    std::unique_lock<std::mutex> locker(jobs_mutex);
+    idle_cv.wait(locker, [this]() { return jobs.empty() && (jobs_running == 0); });
+
+    return;
+}
+
+/**
+ * @brief GkExecutor::pending
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @return The number of jobs that are either queued up or currently running.
+ */
+std::size_t GkExecutor::pending()
+{
+    std::lock_guard<std::mutex> locker(jobs_mutex);
+    return jobs.size() + jobs_running;
+}
+
+/**
+ * @brief GkExecutor::on_worker_thread
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @return Whether the calling thread is one of this executor's own worker threads.
+ */
+bool GkExecutor::on_worker_thread() const
+{
+    const auto this_id = std::this_thread::get_id();
+    for (const auto &worker: workers) {
+        if (worker.get_id() == this_id) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void GkExecutor::enqueue(std::function<void()> job)
+{
+    {
+        std::lock_guard<std::mutex> locker(jobs_mutex);
+        if (stopping) {
+            throw std::runtime_error("Unable to queue up a job, as the executor is shutting down!");
+        }
+
+        jobs.push_back(std::move(job));
+        GkTrace::counter("GkExecutor::queued_jobs", static_cast<double>(jobs.size()));
+    }
+
+    jobs_cv.notify_one();
+    return;
+}
+
+void GkExecutor::worker_loop()
+{
+    GkTrace::set_thread_name("GkExecutor worker");
+    while (true) {
+        std::function<void()> job;
+
+        {
+            std::unique_lock<std::mutex> locker(jobs_mutex);
+            jobs_cv.wait(locker, [this]() { return stopping || !jobs.empty(); });
+            if (jobs.empty()) {
+                return; // Stopping, and there's nothing left to do
+            }
+
+            job = std::move(jobs.front());
+            jobs.pop_front();
+            ++jobs_running;
+        }
+
+        job(); // Any exceptions are caught by the std::packaged_task<> and stored within the std::future<>
+
+        {
+            std::lock_guard<std::mutex> locker(jobs_mutex);
+            --jobs_running;
+            if (jobs.empty() && (jobs_running == 0)) {
+                idle_cv.notify_all();
+            }
+        }
+    }
+}
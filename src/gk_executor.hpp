@@ -0,0 +1,106 @@
+/**
+ **  _   _                 _
+ ** | | | |               | |
+ ** | |_| | ___ _ __ _ __ | |     ___   __ _
+ ** |  _  |/ _ \ '__| '_ \| |    / _ \ / _` |
+ ** | | | |  __/ |  | |_) | |___| (_) | (_| |
+ ** \_| |_/\___|_|  | .__/\_____/\___/ \__, |
+ **                 | |                 __/ |
+ **                 |_|                |___/
+ **
+ **   Thank you for using "HerpLog" for your herpetology management requirements!
+ **   Copyright (C) 2017-2018. GekkoFyre.
+ **
+ **
+ **   HerpLog is free software: you can redistribute it and/or modify
+ **   it under the terms of the GNU General Public License as published by
+ **   the Free Software Foundation, either version 3 of the License, or
+ **   (at your option) any later version.
+ **
+ **   HerpLog is distributed in the hope that it will be useful,
+ **   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **   GNU General Public License for more details.
+ **
+ **   You should have received a copy of the GNU General Public License
+ **   along with HerpLog.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ **
+ **   The latest source code updates can be obtained from [ 1 ] below at your
+ **   discretion. A web-browser or the 'git' application may be required.
+ **
+ **   [ 1 ] - https://github.com/GekkoFyre/HerpLog
+ **
+ ********************************************************************************/
+
+/**
+ * @file gk_executor.hpp
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @brief A small task executor that runs queued jobs upon its own, dedicated thread(s) and hands back the results as
+ * std::future<>'s.
+ */
+
+#ifndef GK_EXECUTOR_HPP
+#define GK_EXECUTOR_HPP
+
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <deque>
+#include <vector>
+#include <utility>
+
+namespace GekkoFyre {
+class GkExecutor;
+
+class GkExecutor {
+
+public:
+    explicit GkExecutor(const std::size_t &num_threads = 1);
+    ~GkExecutor();
+
+    GkExecutor(const GkExecutor &) = delete;
+    GkExecutor &operator=(const GkExecutor &) = delete;
+
+    /**
+     * @brief GkExecutor::submit queues up a job to be run upon one of the executor's threads. Any exception thrown by
+     * the job is captured and re-thrown from std::future<>::get().
+     * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+     * @date 2026-10-18
+     * @param task The job itself, which takes no arguments.
+     * @return The result of the job, once it has been run.
+     */
+    template <typename Fn>
+    auto submit(Fn task) -> std::future<decltype(task())>
+    {
+        using result_type = decltype(task());
+        auto packaged = std::make_shared<std::packaged_task<result_type()>>(std::move(task));
+        std::future<result_type> result = packaged->get_future();
+        enqueue([packaged]() { (*packaged)(); });
+        return result;
+    }
+
+    void wait_for_idle();
+    std::size_t pending();
+    bool on_worker_thread() const;
+
+private:
+    void enqueue(std::function<void()> job);
+    void worker_loop();
+
+    std::vector<std::thread> workers;
+    std::deque<std::function<void()>> jobs;
+    std::size_t jobs_running;
+    bool stopping;
+
+    std::mutex jobs_mutex;
+    std::condition_variable jobs_cv;
+    std::condition_variable idle_cv;
+};
+}
+
+#endif // GK_EXECUTOR_HPP
@@ -41,12 +41,12 @@
  */
 
 #include "gk_file_io.hpp"
+#include "gk_trace.hpp"
 #include "3rd_party/minicsv/minicsv.h"
 #include <boost/exception/all.hpp>
 #include <boost/crc.hpp>
 #include <zipper.h>
 #include <unzipper.h>
-#include <QMessageBox>
 #include <QDir>
 #include <exception>
 #include <algorithm>
@@ -75,9 +75,11 @@ GkFileIo::~GkFileIo()
  * @param folderLoc is the location of the folder to be compressed.
  * @param saveFileAsLoc The location of where you wish to save the compressed archive as.
  * @return Whether the operation was successful or not.
+ * @note Any failure is thrown as a `std::runtime_error`, so that the caller (GUI or otherwise) may report it as it sees fit.
  */
 bool GkFileIo::compress_files(const std::string &folderLoc, const std::string &saveFileAsLoc)
 {
+    GkTraceSpan span("GkFileIo::compress_files", "file");
     std::stringstream csv_out;
     Zipper zipper(saveFileAsLoc);
     sys::error_code ec;
@@ -92,21 +94,28 @@ bool GkFileIo::compress_files(const std::string &folderLoc, const std::string &s
         const std::string csv_file = fs::path(folderLoc + fs::path::preferred_separator + GkFile::GkCsv::zip_contents_csv).string();
         if (fs::exists(csv_file)) {
             if (!fs::remove(csv_file, ec)) {
-                throw ec.message();
+                throw std::runtime_error(ec.message());
             }
         }
 
         zipper.open();
         for (const auto &file: dir_contents) {
             fs::path file_path = std::string(folderLoc + fs::path::preferred_separator + file);
+            if (fs::is_directory(file_path, ec)) {
+                if (file == GkFile::attachment_dir) {
+                    add_attachments(zipper, file_path);
+                }
+
+                continue;
+            }
+
             if (std::strcmp(file.c_str(), GkFile::GkCsv::zip_contents_csv) != 0) { // Skip the addition of the checksum file, that'll be added on its own later
                 if (fs::exists(file_path, ec)) { // Check that the file(s) to be compressed do exist still
                     std::string fileData = readFileToString(file_path.string());
                     csv_out << file << "," << getCrc32(fileData) << "," << "CRC32" << std::endl; // Create the CSV strings
                     zipper.add(file_path.string());
                 } else {
-                    QMessageBox::warning(nullptr, tr("Error!"), QString::fromStdString(ec.message()), QMessageBox::Ok);
-                    return false;
+                    throw std::runtime_error(ec.message());
                 }
             }
         }
@@ -118,12 +127,40 @@ bool GkFileIo::compress_files(const std::string &folderLoc, const std::string &s
         zipper.add(csv_file); // Add the checksum file to the compressed archive (i.e. database file)
         zipper.close();
     } catch (const std::exception &e) {
-        QMessageBox::warning(nullptr, tr("Error!"), tr("An error has occurred during the saving of your database file.\n\n%1").arg(e.what()),
-                             QMessageBox::Ok);
-        return false;
+        throw std::runtime_error(tr("An error has occurred during the saving of your database file.\n\n%1").arg(e.what()).toStdString());
     }
 
-    return false;
+    return true;
+}
+
+/**
+ * @brief GkFileIo::add_attachments adds the photos attached to log entries to the archive, by streaming each of them
+ * in as they are, rather than compressing them all over again. Photos hardly compress at all to begin with, and as
+ * each is named after its own SHA-256 hash, they're left out of the CRC32 checksums too, which would've meant reading
+ * them in whole.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param zipper The archive that is being saved.
+ * @param attachment_dir The directory of the photos, as kept by the `GkAttachmentStore`.
+ * @see GkAttachmentStore::export_file()
+ */
+void GkFileIo::add_attachments(Zipper &zipper, const fs::path &attachment_dir)
+{
+    GkTraceSpan span("GkFileIo::add_attachments", "file");
+    for (fs::directory_iterator it(attachment_dir), end; it != end; ++it) {
+        const std::string name = it->path().filename().string();
+        if (name.empty() || (name[0] == '.') || !fs::is_regular_file(it->path())) {
+            continue; // A photo that was still being copied in when the database was saved
+        }
+
+        std::ifstream input(it->path().string(), std::ios::in | std::ios::binary);
+        if (!input.is_open() || !zipper.add(input, std::string(GkFile::attachment_dir) + "/" + name, Zipper::Store)) {
+            throw std::runtime_error(tr("Unable to add the photo, \"%1\", to the database file!")
+                                     .arg(QString::fromStdString(name)).toStdString());
+        }
+    }
+
+    return;
 }
 
 /**
@@ -132,10 +169,13 @@ bool GkFileIo::compress_files(const std::string &folderLoc, const std::string &s
  * @date 2017-12-17
  * @note <https://github.com/sebastiandev/zipper>
  * @param fileLoc The location to the file to be decompressed, on local storage.
+ * @param tempName The name of the temporary directory to decompress into, if not to be named after the file itself.
  * @return The temporary location of where the files from the archive were decompressed.
+ * @note A corrupt or unreadable archive is thrown as a `std::runtime_error`.
  */
-std::string GkFileIo::decompress_file(const std::string &fileLoc)
+std::string GkFileIo::decompress_file(const std::string &fileLoc, const std::string &tempName)
 {
+    GkTraceSpan span("GkFileIo::decompress_file", "file");
     try {
         Unzipper unzipper(fileLoc);
         std::vector<ZipEntry> entries = unzipper.entries();
@@ -144,10 +184,10 @@ std::string GkFileIo::decompress_file(const std::string &fileLoc)
 
         csv::istringstream iss(std::string(reinterpret_cast<const char *>(unzipped_data_csv.data()), unzipped_data_csv.size()));
         std::string csv_file_entry, csv_hash_entry, hashType;
-        fs::path fileName = fs::path(fileLoc).filename();
+        fs::path fileName = tempName.empty() ? fs::path(fileLoc).filename() : fs::path(tempName);
 
         // Remove all file-extensions from the filename
-        while(!fileName.extension().empty()) {
+        while(tempName.empty() && !fileName.extension().empty()) {
             fileName = fileName.stem();
         }
 
@@ -177,16 +217,14 @@ std::string GkFileIo::decompress_file(const std::string &fileLoc)
                                 if (crc32 == csv_hash_entry) {
                                     continue;
                                 } else {
-                                    QMessageBox::warning(nullptr, tr("Error!"), tr("The database, \"%1\", appears to be corrupt. Aborting...")
-                                            .arg(QString::fromStdString(fileName.string())), QMessageBox::Ok);
                                     unzipper.close();
-                                    return "";
+                                    throw std::runtime_error(tr("The database, \"%1\", appears to be corrupt. Aborting...")
+                                                                     .arg(QString::fromStdString(fileName.string())).toStdString());
                                 }
                             } else {
-                                QMessageBox::warning(nullptr, tr("Error!"), tr("A problem was encountered whilst opening your saved database. Error:\n\n%1")
-                                        .arg(QString::fromStdString(ec.message())), QMessageBox::Ok);
                                 unzipper.close();
-                                return "";
+                                throw std::runtime_error(tr("A problem was encountered whilst opening your saved database. Error:\n\n%1")
+                                                                 .arg(QString::fromStdString(ec.message())).toStdString());
                             }
                         }
                     }
@@ -197,12 +235,9 @@ std::string GkFileIo::decompress_file(const std::string &fileLoc)
         unzipper.close();
         return temp_dir;
     } catch (const std::exception &e) {
-        QMessageBox::warning(nullptr, tr("Error!"), tr("An issue has been encountered whilst opening your database file. Please ensure that the "
-                                                               "integrity of the file is intact before trying once more. Error:\n\n%1").arg(e.what()),
-                             QMessageBox::Ok);
+        throw std::runtime_error(tr("An issue has been encountered whilst opening your database file. Please ensure that the "
+                                    "integrity of the file is intact before trying once more. Error:\n\n%1").arg(e.what()).toStdString());
     }
-
-    return "";
 }
 
 /**
@@ -273,7 +308,7 @@ bool GkFileIo::checkExistingTempDir(const fs::path &tempDir, const bool &askAbou
     if (fs::exists(tempDir, ec)) {
         if (deleteDir) {
             if (!fs::remove_all(tempDir, ec)) {
-                throw ec.message();
+                throw std::runtime_error(ec.message());
             }
         }
 
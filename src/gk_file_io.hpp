@@ -47,6 +47,10 @@
 #include <QObject>
 #include <boost/filesystem.hpp>
 
+namespace zipper {
+class Zipper;
+}
+
 namespace GekkoFyre {
 class GkFileIo;
 
@@ -58,13 +62,14 @@ public:
     ~GkFileIo();
 
     bool compress_files(const std::string &folderLoc, const std::string &saveFileAsLoc);
-    std::string decompress_file(const std::string &fileLoc);
+    std::string decompress_file(const std::string &fileLoc, const std::string &tempName = "");
     bool checkExistingTempDir(const fs::path &tempDir, const bool &askAboutLockFile = false, const bool &deleteDir = true);
 
 private:
     std::string readFileToString(const std::string &fileLoc);
     std::string getCrc32(const std::string &fileData);
     void read_directory(const std::string &dirLoc, std::vector<std::string> &output);
+    void add_attachments(zipper::Zipper &zipper, const fs::path &attachment_dir);
 };
 }
 
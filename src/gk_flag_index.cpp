@@ -0,0 +1,542 @@
+/**
+ **  _   _                 _
+ ** | | | |               | |
+ ** | |_| | ___ _ __ _ __ | |     ___   __ _
+ ** |  _  |/ _ \ '__| '_ \| |    / _ \ / _` |
+ ** | | | |  __/ |  | |_) | |___| (_) | (_| |
+ ** \_| |_/\___|_|  | .__/\_____/\___/ \__, |
+ **                 | |                 __/ |
+ **                 |_|                |___/
+ **
+ **   Thank you for using "HerpLog" for your herpetology management requirements!
+ **   Copyright (C) 2017-2018. GekkoFyre.
+ **
+ **
+ **   HerpLog is free software: you can redistribute it and/or modify
+ **   it under the terms of the GNU General Public License as published by
+ **   the Free Software Foundation, either version 3 of the License, or
+ **   (at your option) any later version.
+ **
+ **   HerpLog is distributed in the hope that it will be useful,
+ **   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **   GNU General Public License for more details.
+ **
+ **   You should have received a copy of the GNU General Public License
+ **   along with HerpLog.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ **
+ **   The latest source code updates can be obtained from [ 1 ] below at your
+ **   discretion. A web-browser or the 'git' application may be required.
+ **
+ **   [ 1 ] - https://github.com/GekkoFyre/HerpLog
+ **
+ ********************************************************************************/
+
+/**
+ * @file gk_flag_index.cpp
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @brief Bitmap indexes over the boolean husbandry flags of every record (i.e. toilet, hydration and vitamins), so that
+ * questions of compliance can be answered by combining bitmaps rather than decoding each and every record.
+ */
+
+#include "gk_flag_index.hpp"
+#include "gk_trace.hpp"
+#include <leveldb/db.h>
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+
+using namespace GekkoFyre;
+
+namespace {
+const std::string BITMAP_LIVE = "live";
+const std::string BITMAP_FLAGS[3] = { "toilet", "hydration", "vitamins" };
+const char BITMAP_ANIMAL = '@';
+}
+
+GkFlagIndex::GkFlagIndex(const GkFile::FileDb &database, const std::shared_ptr<GkStringOp> &gk_str_op,
+                         QObject *parent) : QObject(parent)
+{
+    db_conn = database;
+    gkStrOp = gk_str_op;
+    sorted_count = 0;
+    built = false;
+}
+
+GkFlagIndex::~GkFlagIndex()
+{}
+
+/**
+ * @brief GkFlagIndex::load reads the bitmaps, as they are kept up-to-date within the database by GkDbWrite, along with
+ * the rows that map their ordinals back onto the records. None of the records themselves are read. Should too many of
+ * the records have come in out of order, or been deleted, then the ordinals are redone in memory.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @see GkDbWrite::fold_flag_index(), GkDbWrite::rebuild_indexes()
+ */
+void GkFlagIndex::load()
+{
+    GkTraceSpan span("GkFlagIndex::load", "index");
+    using namespace GkRecords;
+    std::lock_guard<std::mutex> locker(index_mutex);
+    ordinal_ids.clear();
+    ordinal_times.clear();
+    ordinal_flags.clear();
+    ordinal_animals.clear();
+    ordinals.clear();
+    animal_ids.clear();
+    animal_lookup.clear();
+    animal_bitmaps.clear();
+    live_bitmap = GkBitmap();
+    for (auto &bitmap: flag_bitmaps) {
+        bitmap = GkBitmap();
+    }
+
+    leveldb::ReadOptions read_opt;
+    read_opt.fill_cache = false;
+    std::shared_ptr<const leveldb::Snapshot> snapshot(db_conn.db->GetSnapshot(), [this](const leveldb::Snapshot *s) {
+        db_conn.db->ReleaseSnapshot(s);
+    });
+
+    read_opt.snapshot = snapshot.get();
+
+    GkFlagIndexMeta meta = { 0, 0, 0 };
+    std::string value;
+    if (!db_conn.db->Get(read_opt, LEVELDB_INDEX_FLAG_META, &value).ok() || !gkStrOp->decode_flag_meta(value, meta)) {
+        meta = { 0, 0, 0 }; // Then none of the ordinals can be relied upon to be in order
+    }
+
+    // The rows come out in order of their ordinals, whereby the gaps left behind by deleted records take on the
+    // Date/Time of the row before them, so that the ordinals below `sorted_count` stay in order
+    GkBitmap rows;
+    std::unique_ptr<leveldb::Iterator> it(db_conn.db->NewIterator(read_opt));
+    const std::string row_prefix(LEVELDB_INDEX_FLAG_ROW);
+    for (it->Seek(row_prefix); it->Valid() && it->key().starts_with(row_prefix); it->Next()) {
+        GkFlagRow row;
+        if (!gkStrOp->decode_flag_row(it->key().ToString(), it->value().ToString(), row)) {
+            continue; // Damaged, so the record is left out of the index until it's next rebuilt
+        }
+
+        while (ordinal_ids.size() < row.ordinal) {
+            ordinal_ids.emplace_back();
+            ordinal_times.push_back(ordinal_times.empty() ? std::numeric_limits<long int>::min() : ordinal_times.back());
+            ordinal_flags.push_back(0);
+            ordinal_animals.push_back(0);
+        }
+
+        ordinal_ids.push_back(row.record_id);
+        ordinal_times.push_back(row.date_time);
+        ordinal_flags.push_back(row.flags);
+        ordinal_animals.push_back(intern(row.name_id));
+        ordinals[row.record_id] = row.ordinal;
+        rows.add(row.ordinal);
+    }
+
+    const std::string bitmap_prefix(LEVELDB_INDEX_FLAG_BITMAP);
+    for (it->Seek(bitmap_prefix); it->Valid() && it->key().starts_with(bitmap_prefix); it->Next()) {
+        std::string name;
+        std::uint16_t chunk = 0;
+        GkBitmap container;
+        if (!gkStrOp->decode_flag_bitmap_key(it->key().ToString(), name, chunk) ||
+                !GkBitmap::deserialise(it->value().ToString(), container)) {
+            continue;
+        }
+
+        GkBitmap *bitmap = nullptr;
+        if (name == BITMAP_LIVE) {
+            bitmap = &live_bitmap;
+        } else if (!name.empty() && (name[0] == BITMAP_ANIMAL)) {
+            bitmap = &animal_bitmaps[intern(name.substr(1))];
+        } else {
+            for (std::size_t slot = 0; slot < 3; ++slot) {
+                if (name == BITMAP_FLAGS[slot]) {
+                    bitmap = &flag_bitmaps[slot];
+                }
+            }
+        }
+
+        if (bitmap != nullptr) {
+            *bitmap = *bitmap | container;
+        }
+    }
+
+    if (!it->status().ok()) {
+        throw std::runtime_error(it->status().ToString());
+    }
+
+    // An ordinal whose row is missing cannot be mapped back onto its record, so it's left out of every bitmap
+    live_bitmap = live_bitmap & rows;
+    for (auto &bitmap: flag_bitmaps) {
+        bitmap = bitmap & live_bitmap;
+    }
+
+    for (auto &bitmap: animal_bitmaps) {
+        bitmap = bitmap & live_bitmap;
+    }
+
+    sorted_count = std::min<std::size_t>(static_cast<std::size_t>(meta.sorted_count), ordinal_ids.size());
+    if (((ordinal_ids.size() - sorted_count) > HERPLOG_FLAG_INDEX_TAIL_MAX) ||
+            ((ordinal_ids.size() - live_bitmap.cardinality()) > live_bitmap.cardinality())) {
+        renumber();
+    }
+
+    GkTrace::counter("GkFlagIndex::records", static_cast<double>(live_bitmap.cardinality()));
+    built = true;
+    return;
+}
+
+/**
+ * @brief GkFlagIndex::clear throws away the bitmaps, so that the next user of them will have to load them once more.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ */
+void GkFlagIndex::clear()
+{
+    std::lock_guard<std::mutex> locker(index_mutex);
+    ordinal_ids.clear();
+    ordinal_times.clear();
+    ordinal_flags.clear();
+    ordinal_animals.clear();
+    ordinals.clear();
+    animal_ids.clear();
+    animal_lookup.clear();
+    animal_bitmaps.clear();
+    live_bitmap = GkBitmap();
+    for (auto &bitmap: flag_bitmaps) {
+        bitmap = GkBitmap();
+    }
+
+    sorted_count = 0;
+    built = false;
+    return;
+}
+
+bool GkFlagIndex::is_built()
+{
+    std::lock_guard<std::mutex> locker(index_mutex);
+    return built;
+}
+
+std::size_t GkFlagIndex::size()
+{
+    std::lock_guard<std::mutex> locker(index_mutex);
+    return static_cast<std::size_t>(live_bitmap.cardinality());
+}
+
+/**
+ * @brief GkFlagIndex::bitmaps names the bitmaps that a record sets its bit within, being the bitmap of every record,
+ * one for each of its flags that are set, and that of its animal.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param flags A bitmask made up of `GkRecords::GkFlagBits`.
+ * @param name_id The Unique ID of the animal that the record is filed under.
+ * @return The names, ready for use with GkStringOp::flag_bitmap_key().
+ */
+std::vector<std::string> GkFlagIndex::bitmaps(const std::uint8_t &flags, const std::string &name_id)
+{
+    using namespace GkRecords;
+    std::vector<std::string> names = { BITMAP_LIVE };
+    for (const auto &flag: { GkFlagBits::WentToilet, GkFlagBits::HadHydration, GkFlagBits::HadVitamins }) {
+        if (flags & flag) {
+            names.push_back(bitmap_name(flag));
+        }
+    }
+
+    names.push_back(BITMAP_ANIMAL + name_id);
+    return names;
+}
+
+/**
+ * @brief GkFlagIndex::bitmap_name names the bitmap of the records that have the given flag set.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param flag Just the one of the `GkRecords::GkFlagBits`.
+ */
+std::string GkFlagIndex::bitmap_name(const GkRecords::GkFlagBits &flag)
+{
+    return BITMAP_FLAGS[flag_slot(flag)];
+}
+
+/**
+ * @brief GkFlagIndex::live provides every record that's still within the database, such that it can have other bitmaps
+ * taken away from it, e.g. `live().and_not(flagged(HadVitamins))` for the records without any vitamins.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ */
+GkBitmap GkFlagIndex::live()
+{
+    std::lock_guard<std::mutex> locker(index_mutex);
+    return live_bitmap;
+}
+
+/**
+ * @brief GkFlagIndex::flagged provides the records that have the given flag set.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param flag Just the one of the `GkRecords::GkFlagBits`.
+ */
+GkBitmap GkFlagIndex::flagged(const GkRecords::GkFlagBits &flag)
+{
+    std::lock_guard<std::mutex> locker(index_mutex);
+    return flag_bitmaps[flag_slot(flag)];
+}
+
+/**
+ * @brief GkFlagIndex::animal provides the records of the given animal, or an empty bitmap if it has none.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param name_id The Unique ID of the animal.
+ */
+GkBitmap GkFlagIndex::animal(const std::string &name_id)
+{
+    std::lock_guard<std::mutex> locker(index_mutex);
+    auto it = animal_lookup.find(name_id);
+    return (it != animal_lookup.end()) ? animal_bitmaps[it->second] : GkBitmap();
+}
+
+/**
+ * @brief GkFlagIndex::date_range provides the records that fall within the given date range, inclusive of both ends.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param dateStart The beginning of the date range, as UNIX Epoch Time.
+ * @param dateEnd The end of the date range, as UNIX Epoch Time.
+ */
+GkBitmap GkFlagIndex::date_range(const long int &dateStart, const long int &dateEnd)
+{
+    std::lock_guard<std::mutex> locker(index_mutex);
+    return find_range(dateStart, dateEnd);
+}
+
+/**
+ * @brief GkFlagIndex::record_ids maps the ordinals within a bitmap back onto the Unique IDs of their records.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param ordinals A bitmap that was made up from those handed out by this index, since it was last modified.
+ */
+std::vector<std::string> GkFlagIndex::record_ids(const GkBitmap &ordinals)
+{
+    std::lock_guard<std::mutex> locker(index_mutex);
+    std::vector<std::string> output;
+    output.reserve(static_cast<std::size_t>(ordinals.cardinality()));
+    ordinals.for_each([&](const std::uint32_t &ordinal) {
+        if (ordinal < ordinal_ids.size()) {
+            output.push_back(ordinal_ids[ordinal]);
+        }
+    });
+
+    return output;
+}
+
+/**
+ * @brief GkFlagIndex::flag_lapses finds the animals that went for at least `min_gap` seconds without the given flag
+ * being set upon any of their records, such as those that went a week without hydration. Only the span between each
+ * animal's first and last record within the date range is considered, and only the longest lapse of each is kept.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param flag Just the one of the `GkRecords::GkFlagBits`.
+ * @param min_gap The shortest lapse that is worth reporting, in seconds.
+ * @param dateStart The beginning of the date range, as UNIX Epoch Time.
+ * @param dateEnd The end of the date range, as UNIX Epoch Time.
+ * @return The longest lapse of each animal that had one, with the longest lapses first.
+ */
+std::vector<GkRecords::GkFlagLapse> GkFlagIndex::flag_lapses(const GkRecords::GkFlagBits &flag, const long int &min_gap,
+                                                              const long int &dateStart, const long int &dateEnd)
+{
+    std::lock_guard<std::mutex> locker(index_mutex);
+    const GkBitmap window = find_range(dateStart, dateEnd);
+    const GkBitmap &flag_bitmap = flag_bitmaps[flag_slot(flag)];
+    const bool sorted = (sorted_count == ordinal_times.size());
+
+    std::vector<GkRecords::GkFlagLapse> output;
+    std::vector<long int> record_times;
+    std::vector<long int> flag_times;
+    for (std::size_t animal_idx = 0; animal_idx < animal_bitmaps.size(); ++animal_idx) {
+        const GkBitmap records = animal_bitmaps[animal_idx] & window;
+        if (records.empty()) {
+            continue;
+        }
+
+        long int first = ordinal_times[records.minimum()];
+        long int last = ordinal_times[records.maximum()];
+        record_times.clear();
+        if (!sorted) {
+            records.for_each([&](const std::uint32_t &ordinal) { record_times.push_back(ordinal_times[ordinal]); });
+            std::sort(record_times.begin(), record_times.end());
+            first = record_times.front();
+            last = record_times.back();
+        }
+
+        if ((last - first) < min_gap) {
+            continue; // Not even the whole span of records would make for a long enough lapse
+        }
+
+        flag_times.clear();
+        flag_times.push_back(first);
+        (records & flag_bitmap).for_each([&](const std::uint32_t &ordinal) {
+            flag_times.push_back(ordinal_times[ordinal]);
+        });
+
+        flag_times.push_back(last);
+        if (!sorted) {
+            std::sort(flag_times.begin() + 1, flag_times.end() - 1);
+        }
+
+        GkRecords::GkFlagLapse lapse;
+        lapse.name_id = animal_ids[animal_idx];
+        lapse.lapse_start = first;
+        lapse.lapse_end = first;
+        for (std::size_t i = 1; i < flag_times.size(); ++i) {
+            if ((flag_times[i] - flag_times[i - 1]) > (lapse.lapse_end - lapse.lapse_start)) {
+                lapse.lapse_start = flag_times[i - 1];
+                lapse.lapse_end = flag_times[i];
+            }
+        }
+
+        if ((lapse.lapse_end - lapse.lapse_start) < min_gap) {
+            continue;
+        }
+
+        lapse.records = 0;
+        records.for_each([&](const std::uint32_t &ordinal) {
+            if ((ordinal_times[ordinal] >= lapse.lapse_start) && (ordinal_times[ordinal] <= lapse.lapse_end)) {
+                ++lapse.records;
+            }
+        });
+
+        output.push_back(std::move(lapse));
+    }
+
+    std::sort(output.begin(), output.end(), [](const GkRecords::GkFlagLapse &lhs, const GkRecords::GkFlagLapse &rhs) {
+        return (lhs.lapse_end - lhs.lapse_start) > (rhs.lapse_end - rhs.lapse_start);
+    });
+
+    return output;
+}
+
+std::size_t GkFlagIndex::flag_slot(const GkRecords::GkFlagBits &flag)
+{
+    using namespace GkRecords;
+    switch (flag) {
+    case GkFlagBits::WentToilet:
+        return 0;
+    case GkFlagBits::HadHydration:
+        return 1;
+    case GkFlagBits::HadVitamins:
+        return 2;
+    default:
+        throw std::invalid_argument(tr("Only a single husbandry flag may be looked up at a time!").toStdString());
+    }
+}
+
+std::uint32_t GkFlagIndex::intern(const std::string &name_id)
+{
+    auto it = animal_lookup.find(name_id);
+    if (it != animal_lookup.end()) {
+        return it->second;
+    }
+
+    const std::uint32_t idx = static_cast<std::uint32_t>(animal_ids.size());
+    animal_ids.push_back(name_id);
+    animal_bitmaps.emplace_back();
+    animal_lookup.emplace(name_id, idx);
+    return idx;
+}
+
+void GkFlagIndex::append(const std::string &record_id, const long int &date_time, const std::uint8_t &flags,
+                         const std::uint32_t &animal_idx)
+{
+    using namespace GkRecords;
+    const std::uint32_t ordinal = static_cast<std::uint32_t>(ordinal_ids.size());
+    ordinal_ids.push_back(record_id);
+    ordinal_times.push_back(date_time);
+    ordinal_flags.push_back(flags);
+    ordinal_animals.push_back(animal_idx);
+    ordinals[record_id] = ordinal;
+
+    live_bitmap.add(ordinal);
+    animal_bitmaps[animal_idx].add(ordinal);
+    if (flags & GkFlagBits::WentToilet) {
+        flag_bitmaps[0].add(ordinal);
+    }
+
+    if (flags & GkFlagBits::HadHydration) {
+        flag_bitmaps[1].add(ordinal);
+    }
+
+    if (flags & GkFlagBits::HadVitamins) {
+        flag_bitmaps[2].add(ordinal);
+    }
+
+    return;
+}
+
+/**
+ * @brief GkFlagIndex::renumber hands out the ordinals afresh, in order of Date/Time and without any gaps left behind by
+ * deleted records, all without having to go back to the database.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ */
+void GkFlagIndex::renumber()
+{
+    GkTraceSpan span("GkFlagIndex::renumber", "index");
+    std::vector<std::uint32_t> order = live_bitmap.values();
+    std::stable_sort(order.begin(), order.end(), [this](const std::uint32_t &lhs, const std::uint32_t &rhs) {
+        return ordinal_times[lhs] < ordinal_times[rhs];
+    });
+
+    std::vector<std::string> old_ids;
+    std::vector<long int> old_times;
+    std::vector<std::uint8_t> old_flags;
+    std::vector<std::uint32_t> old_animals;
+    old_ids.swap(ordinal_ids);
+    old_times.swap(ordinal_times);
+    old_flags.swap(ordinal_flags);
+    old_animals.swap(ordinal_animals);
+
+    ordinals.clear();
+    live_bitmap = GkBitmap();
+    for (auto &bitmap: flag_bitmaps) {
+        bitmap = GkBitmap();
+    }
+
+    for (auto &bitmap: animal_bitmaps) {
+        bitmap = GkBitmap();
+    }
+
+    ordinal_ids.reserve(order.size());
+    ordinal_times.reserve(order.size());
+    ordinal_flags.reserve(order.size());
+    ordinal_animals.reserve(order.size());
+    for (const auto &old_ordinal: order) {
+        append(old_ids[old_ordinal], old_times[old_ordinal], old_flags[old_ordinal], old_animals[old_ordinal]);
+    }
+
+    sorted_count = ordinal_times.size();
+    return;
+}
+
+/**
+ * @brief GkFlagIndex::find_range binary searches the ordinals that are in order of their Date/Time, then checks over
+ * those few that were inserted out of order one by one.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ */
+GkBitmap GkFlagIndex::find_range(const long int &dateStart, const long int &dateEnd) const
+{
+    const auto sorted_end = ordinal_times.begin() + static_cast<std::ptrdiff_t>(sorted_count);
+    const auto lower = std::lower_bound(ordinal_times.begin(), sorted_end, dateStart);
+    const auto upper = std::upper_bound(lower, sorted_end, dateEnd);
+    GkBitmap output = GkBitmap::range(static_cast<std::uint32_t>(std::distance(ordinal_times.begin(), lower)),
+                                      static_cast<std::uint32_t>(std::distance(ordinal_times.begin(), upper)));
+
+    for (std::size_t ordinal = sorted_count; ordinal < ordinal_times.size(); ++ordinal) {
+        if ((ordinal_times[ordinal] >= dateStart) && (ordinal_times[ordinal] <= dateEnd)) {
+            output.add(static_cast<std::uint32_t>(ordinal));
+        }
+    }
+
+    return output & live_bitmap;
+}
@@ -0,0 +1,115 @@
+/**
+ **  _   _                 _
+ ** | | | |               | |
+ ** | |_| | ___ _ __ _ __ | |     ___   __ _
+ ** |  _  |/ _ \ '__| '_ \| |    / _ \ / _` |
+ ** | | | |  __/ |  | |_) | |___| (_) | (_| |
+ ** \_| |_/\___|_|  | .__/\_____/\___/ \__, |
+ **                 | |                 __/ |
+ **                 |_|                |___/
+ **
+ **   Thank you for using "HerpLog" for your herpetology management requirements!
+ **   Copyright (C) 2017-2018. GekkoFyre.
+ **
+ **
+ **   HerpLog is free software: you can redistribute it and/or modify
+ **   it under the terms of the GNU General Public License as published by
+ **   the Free Software Foundation, either version 3 of the License, or
+ **   (at your option) any later version.
+ **
+ **   HerpLog is distributed in the hope that it will be useful,
+ **   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **   GNU General Public License for more details.
+ **
+ **   You should have received a copy of the GNU General Public License
+ **   along with HerpLog.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ **
+ **   The latest source code updates can be obtained from [ 1 ] below at your
+ **   discretion. A web-browser or the 'git' application may be required.
+ **
+ **   [ 1 ] - https://github.com/GekkoFyre/HerpLog
+ **
+ ********************************************************************************/
+
+/**
+ * @file gk_flag_index.hpp
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @brief Bitmap indexes over the boolean husbandry flags of every record (i.e. toilet, hydration and vitamins), so that
+ * questions of compliance can be answered by combining bitmaps rather than decoding each and every record.
+ */
+
+#ifndef GK_FLAG_INDEX_HPP
+#define GK_FLAG_INDEX_HPP
+
+#include "options.hpp"
+#include "gk_string_op.hpp"
+#include "gk_bitmap.hpp"
+#include <QtCore/QObject>
+#include <unordered_map>
+#include <string>
+#include <vector>
+#include <mutex>
+#include <memory>
+
+namespace GekkoFyre {
+class GkFlagIndex;
+
+class GkFlagIndex : public QObject {
+    Q_OBJECT
+
+public:
+    explicit GkFlagIndex(const GkFile::FileDb &database, const std::shared_ptr<GkStringOp> &gk_str_op,
+                         QObject *parent = nullptr);
+    ~GkFlagIndex();
+
+    void load();
+    void clear();
+    bool is_built();
+    std::size_t size();
+
+    GkBitmap live();
+    GkBitmap flagged(const GkRecords::GkFlagBits &flag);
+    GkBitmap animal(const std::string &name_id);
+    GkBitmap date_range(const long int &dateStart, const long int &dateEnd);
+    std::vector<std::string> record_ids(const GkBitmap &ordinals);
+    std::vector<GkRecords::GkFlagLapse> flag_lapses(const GkRecords::GkFlagBits &flag, const long int &min_gap,
+                                                    const long int &dateStart, const long int &dateEnd);
+
+    static std::vector<std::string> bitmaps(const std::uint8_t &flags, const std::string &name_id);
+    static std::string bitmap_name(const GkRecords::GkFlagBits &flag);
+
+private:
+    static std::size_t flag_slot(const GkRecords::GkFlagBits &flag);
+    std::uint32_t intern(const std::string &name_id);
+    void append(const std::string &record_id, const long int &date_time, const std::uint8_t &flags,
+                const std::uint32_t &animal_idx);
+    void renumber();
+    GkBitmap find_range(const long int &dateStart, const long int &dateEnd) const;
+
+    GkFile::FileDb db_conn;
+    std::shared_ptr<GkStringOp> gkStrOp;
+
+    // Each record is given a dense ordinal, with the ordinals below `sorted_count` being in order of their Date/Time
+    std::vector<std::string> ordinal_ids;
+    std::vector<long int> ordinal_times;
+    std::vector<std::uint8_t> ordinal_flags;     // A bitmask made up of `GkRecords::GkFlagBits`
+    std::vector<std::uint32_t> ordinal_animals;  // Dense index into `animal_ids`
+    std::unordered_map<std::string, std::uint32_t> ordinals; // Record ID -> Ordinal
+    std::size_t sorted_count;
+
+    std::vector<std::string> animal_ids;
+    std::unordered_map<std::string, std::uint32_t> animal_lookup;
+
+    GkBitmap live_bitmap;               // The ordinals that have not since been deleted
+    GkBitmap flag_bitmaps[3];           // One for each of `GkRecords::GkFlagBits`
+    std::vector<GkBitmap> animal_bitmaps;
+    bool built;
+
+    std::mutex index_mutex;
+};
+}
+
+#endif // GK_FLAG_INDEX_HPP
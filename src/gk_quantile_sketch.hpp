@@ -0,0 +1,90 @@
+/**
+ **  _   _                 _
+ ** | | | |               | |
+ ** | |_| | ___ _ __ _ __ | |     ___   __ _
+ ** |  _  |/ _ \ '__| '_ \| |    / _ \ / _` |
+ ** | | | |  __/ |  | |_) | |___| (_) | (_| |
+ ** \_| |_/\___|_|  | .__/\_____/\___/ \__, |
+ **                 | |                 __/ |
+ **                 |_|                |___/
+ **
+ **   Thank you for using "HerpLog" for your herpetology management requirements!
+ **   Copyright (C) 2017-2018. GekkoFyre.
+ **
+ **
+ **   HerpLog is free software: you can redistribute it and/or modify
+ **   it under the terms of the GNU General Public License as published by
+ **   the Free Software Foundation, either version 3 of the License, or
+ **   (at your option) any later version.
+ **
+ **   HerpLog is distributed in the hope that it will be useful,
+ **   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **   GNU General Public License for more details.
+ **
+ **   You should have received a copy of the GNU General Public License
+ **   along with HerpLog.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ **
+ **   The latest source code updates can be obtained from [ 1 ] below at your
+ **   discretion. A web-browser or the 'git' application may be required.
+ **
+ **   [ 1 ] - https://github.com/GekkoFyre/HerpLog
+ **
+ ********************************************************************************/
+
+/**
+ * @file gk_quantile_sketch.hpp
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @brief A KLL quantile sketch, which answers percentile queries over a stream of values within a bounded rank error,
+ * whilst only holding onto a few hundred of them, and which can be merged with other sketches of the same accuracy.
+ */
+
+#ifndef GK_QUANTILE_SKETCH_HPP
+#define GK_QUANTILE_SKETCH_HPP
+
+#include "options.hpp"
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace GekkoFyre {
+class GkQuantileSketch;
+
+class GkQuantileSketch {
+
+public:
+    explicit GkQuantileSketch(const std::uint32_t &k = HERPLOG_QUANTILE_SKETCH_K);
+    ~GkQuantileSketch();
+
+    void insert(const double &value);
+    void merge(const GkQuantileSketch &other);
+    double quantile(const double &fraction) const;
+    double rank(const double &value) const;
+    std::uint64_t count() const;
+    bool empty() const;
+    double minimum() const;
+    double maximum() const;
+    double rank_error() const;
+    std::size_t retained() const;
+
+    std::string serialise() const;
+    static bool deserialise(const std::string &value, GkQuantileSketch &sketch);
+
+private:
+    std::uint32_t k;                            // The capacity of the topmost compactor
+    std::uint64_t n;                            // How many values have been inserted, including those merged in
+    double min_value;
+    double max_value;
+    std::vector<std::vector<double>> levels;    // The compactors, whereby a value at level `h` stands in for 2^h of them
+
+    std::size_t capacity(const std::size_t &level) const;
+    std::size_t max_retained() const;
+    void compress();
+    std::vector<std::pair<double, std::uint64_t>> weighted_values() const;
+};
+}
+
+#endif // GK_QUANTILE_SKETCH_HPP
@@ -0,0 +1,473 @@
+/**
+ **  _   _                 _
+ ** | | | |               | |
+ ** | |_| | ___ _ __ _ __ | |     ___   __ _
+ ** |  _  |/ _ \ '__| '_ \| |    / _ \ / _` |
+ ** | | | |  __/ |  | |_) | |___| (_) | (_| |
+ ** \_| |_/\___|_|  | .__/\_____/\___/ \__, |
+ **                 | |                 __/ |
+ **                 |_|                |___/
+ **
+ **   Thank you for using "HerpLog" for your herpetology management requirements!
+ **   Copyright (C) 2017-2018. GekkoFyre.
+ **
+ **
+ **   HerpLog is free software: you can redistribute it and/or modify
+ **   it under the terms of the GNU General Public License as published by
+ **   the Free Software Foundation, either version 3 of the License, or
+ **   (at your option) any later version.
+ **
+ **   HerpLog is distributed in the hope that it will be useful,
+ **   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **   GNU General Public License for more details.
+ **
+ **   You should have received a copy of the GNU General Public License
+ **   along with HerpLog.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ **
+ **   The latest source code updates can be obtained from [ 1 ] below at your
+ **   discretion. A web-browser or the 'git' application may be required.
+ **
+ **   [ 1 ] - https://github.com/GekkoFyre/HerpLog
+ **
+ ********************************************************************************/
+
+/**
+ * @file gk_remote_db.cpp
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @brief A stand-in for a Google LevelDB database that forwards everything to the HerpLog service, so that the rest of
+ * HerpLog can work with a served database exactly as it would with one of its own.
+ */
+
+#include "gk_remote_db.hpp"
+#include <leveldb/write_batch.h>
+#include <algorithm>
+#include <exception>
+
+using namespace GekkoFyre;
+using namespace GkService;
+
+namespace {
+/**
+ * @brief The GkRemoteSnapshot class is the client's handle upon a snapshot that's held by the service.
+ */
+class GkRemoteSnapshot : public leveldb::Snapshot {
+
+public:
+    explicit GkRemoteSnapshot(const std::uint64_t &snapshot_id) : id(snapshot_id) {}
+    ~GkRemoteSnapshot() override {}
+
+    const std::uint64_t id;
+};
+
+/**
+ * @brief The GkRemoteIterator class walks over the database a page at a time, with each page being twice the size of
+ * the one before, so that short scans stay short and long ones don't make a round-trip per key. Unless told otherwise,
+ * the iterator pins a snapshot of its own, so every page sees the database as it was when the iterator was made.
+ */
+class GkRemoteIterator : public leveldb::Iterator {
+
+public:
+    GkRemoteIterator(GkRemoteDb *remote_db, const std::uint64_t &snapshot_id, const bool &owns_snapshot,
+                     const bool &fill_cache)
+        : db(remote_db), snapshot(snapshot_id), owned(owns_snapshot), fill(fill_cache), pos(0), page_size(0),
+          forward(true), exhausted(true) {}
+
+    ~GkRemoteIterator() override
+    {
+        if (owned) {
+            try {
+                db->release_snapshot(snapshot);
+            } catch (const std::exception &e) {
+                Q_UNUSED(e); // The service has gone away, and taken the snapshot along with it
+            }
+        }
+    }
+
+    bool Valid() const override { return pos < page.size(); }
+    void SeekToFirst() override { fetch(GkScanMode::First, "", true); }
+    void SeekToLast() override { fetch(GkScanMode::Last, "", false); }
+    void Seek(const leveldb::Slice &target) override { fetch(GkScanMode::AtOrAfter, target.ToString(), true); }
+
+    void Next() override
+    {
+        const std::string current = page[pos].first;
+        if (!forward) {
+            fetch(GkScanMode::After, current, true);
+        } else if (++pos >= page.size() && !exhausted) {
+            fetch(GkScanMode::After, current, true, false);
+        }
+    }
+
+    void Prev() override
+    {
+        const std::string current = page[pos].first;
+        if (forward) {
+            fetch(GkScanMode::Before, current, false);
+        } else if (++pos >= page.size() && !exhausted) {
+            fetch(GkScanMode::Before, current, false, false);
+        }
+    }
+
+    leveldb::Slice key() const override { return page[pos].first; }
+    leveldb::Slice value() const override { return page[pos].second; }
+    leveldb::Status status() const override { return last_status; }
+
+private:
+    void fetch(const GkScanMode &mode, const std::string &key, const bool &forwards, const bool &restart = true)
+    {
+        page_size = restart ? HERPLOG_SERVICE_SCAN_PAGE_MIN : std::min(page_size * 2, HERPLOG_SERVICE_SCAN_PAGE_MAX);
+        forward = forwards;
+        pos = 0;
+        page.clear();
+        last_status = db->scan(snapshot, fill, mode, key, page_size, page);
+        exhausted = !last_status.ok() || (page.size() < page_size);
+    }
+
+    GkRemoteDb *db;
+    const std::uint64_t snapshot;
+    const bool owned;
+    const bool fill;
+
+    std::vector<std::pair<std::string, std::string>> page;
+    std::size_t pos;
+    std::size_t page_size;
+    bool forward;
+    bool exhausted;
+    leveldb::Status last_status;
+};
+}
+
+GkRemoteDb::GkRemoteDb(GkSocket &&sock) : socket(std::move(sock)), lease_depth(0)
+{}
+
+GkRemoteDb::~GkRemoteDb()
+{}
+
+/**
+ * @brief GkRemoteDb::connect connects to the HerpLog service that's listening upon the given socket, if there is one.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param socket_path Where the service listens, as given by GkDbServer::socket_path_for().
+ * @return The served database, or nullptr if no service is listening upon `socket_path`.
+ */
+std::shared_ptr<leveldb::DB> GkRemoteDb::connect(const std::string &socket_path)
+{
+    GkSocket sock = GkSocket::connect_to(socket_path);
+    if (!sock.is_open()) {
+        return nullptr;
+    }
+
+    auto remote_db = std::make_shared<GkRemoteDb>(std::move(sock));
+    remote_db->socket_path = socket_path;
+    GkWireWriter request;
+    request.put_u8(GkOpcode::Hello).put_varint(HERPLOG_SERVICE_PROTOCOL_VERSION);
+    std::string response;
+    leveldb::Status s = remote_db->call(request, response);
+    if (!s.ok()) {
+        throw std::runtime_error(s.ToString());
+    }
+
+    return remote_db;
+}
+
+/**
+ * @brief GkRemoteDb::from finds out whether the given database is being served, rather than opened directly.
+ * @return The served database, or nullptr if it's one of our own.
+ */
+GkRemoteDb *GkRemoteDb::from(const GkFile::FileDb &db_conn)
+{
+    return dynamic_cast<GkRemoteDb *>(db_conn.db.get());
+}
+
+const std::string &GkRemoteDb::path() const
+{
+    return socket_path;
+}
+
+/**
+ * @brief GkRemoteDb::disconnect cuts the connection to the service short, so that a thread which is waiting upon a
+ * response (such as for GkRemoteDb::changes_since()) gives up straight away rather than once the response arrives.
+ */
+void GkRemoteDb::disconnect()
+{
+    socket.shutdown();
+    return;
+}
+
+leveldb::Status GkRemoteDb::Put(const leveldb::WriteOptions &options, const leveldb::Slice &key, const leveldb::Slice &value)
+{
+    leveldb::WriteBatch batch;
+    batch.Put(key, value);
+    return Write(options, &batch);
+}
+
+leveldb::Status GkRemoteDb::Delete(const leveldb::WriteOptions &options, const leveldb::Slice &key)
+{
+    leveldb::WriteBatch batch;
+    batch.Delete(key);
+    return Write(options, &batch);
+}
+
+leveldb::Status GkRemoteDb::Write(const leveldb::WriteOptions &options, leveldb::WriteBatch *updates)
+{
+    GkWireWriter request;
+    request.put_u8(GkOpcode::Write).put_u8(options.sync ? 1 : 0).put_batch(*updates);
+    std::string response;
+    return call(request, response);
+}
+
+leveldb::Status GkRemoteDb::Get(const leveldb::ReadOptions &options, const leveldb::Slice &key, std::string *value)
+{
+    GkWireWriter request;
+    request.put_u8(GkOpcode::Get).put_varint(snapshot_id(options.snapshot)).put_u8(options.verify_checksums ? 1 : 0)
+            .put_string(key);
+    std::string response;
+    leveldb::Status s = call(request, response);
+    if (s.ok()) {
+        *value = GkWireReader(response).get_string();
+    }
+
+    return s;
+}
+
+leveldb::Iterator *GkRemoteDb::NewIterator(const leveldb::ReadOptions &options)
+{
+    try {
+        const bool owns_snapshot = (options.snapshot == nullptr);
+        const std::uint64_t id = owns_snapshot ? acquire_snapshot() : snapshot_id(options.snapshot);
+        return new GkRemoteIterator(this, id, owns_snapshot, options.fill_cache);
+    } catch (const std::exception &e) {
+        return leveldb::NewErrorIterator(leveldb::Status::IOError(e.what()));
+    }
+}
+
+const leveldb::Snapshot *GkRemoteDb::GetSnapshot()
+{
+    return new GkRemoteSnapshot(acquire_snapshot());
+}
+
+void GkRemoteDb::ReleaseSnapshot(const leveldb::Snapshot *snapshot)
+{
+    const GkRemoteSnapshot *remote_snapshot = static_cast<const GkRemoteSnapshot *>(snapshot);
+    release_snapshot(remote_snapshot->id);
+    delete remote_snapshot;
+    return;
+}
+
+bool GkRemoteDb::GetProperty(const leveldb::Slice &property, std::string *value)
+{
+    GkWireWriter request;
+    request.put_u8(GkOpcode::Property).put_string(property);
+    std::string response;
+    if (!call(request, response).ok()) {
+        return false;
+    }
+
+    *value = GkWireReader(response).get_string();
+    return true;
+}
+
+void GkRemoteDb::GetApproximateSizes(const leveldb::Range *range, int n, uint64_t *sizes)
+{
+    GkWireWriter request;
+    request.put_u8(GkOpcode::ApproximateSizes).put_varint(static_cast<std::uint64_t>(n));
+    for (int i = 0; i < n; ++i) {
+        request.put_string(range[i].start).put_string(range[i].limit);
+    }
+
+    std::string response;
+    const bool ok = call(request, response).ok();
+    GkWireReader in(response);
+    for (int i = 0; i < n; ++i) {
+        sizes[i] = ok ? in.get_varint() : 0;
+    }
+
+    return;
+}
+
+void GkRemoteDb::CompactRange(const leveldb::Slice *begin, const leveldb::Slice *end)
+{
+    GkWireWriter request;
+    request.put_u8(GkOpcode::Compact).put_u8(begin ? 1 : 0).put_string(begin ? *begin : leveldb::Slice())
+            .put_u8(end ? 1 : 0).put_string(end ? *end : leveldb::Slice());
+    std::string response;
+    call(request, response);
+    return;
+}
+
+/**
+ * @brief GkRemoteDb::acquire_lease waits until this process is the only one that may read-modify-write the served
+ * database, and is to be paired with GkRemoteDb::release_lease(). The lease may be taken more than once by the same
+ * thread, and is only given back to the service once the outermost holder has released it.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @see GkDbServer::acquire_lease()
+ */
+void GkRemoteDb::acquire_lease()
+{
+    lease_mutex.lock();
+    if (lease_depth++ == 0) {
+        GkWireWriter request;
+        request.put_u8(GkOpcode::LeaseAcquire);
+        std::string response;
+        leveldb::Status s = call(request, response);
+        if (!s.ok()) {
+            --lease_depth;
+            lease_mutex.unlock();
+            throw std::runtime_error(s.ToString());
+        }
+    }
+
+    return;
+}
+
+void GkRemoteDb::release_lease()
+{
+    if (--lease_depth == 0) {
+        GkWireWriter request;
+        request.put_u8(GkOpcode::LeaseRelease);
+        std::string response;
+        call(request, response); // Should the service have gone away, then so has the lease
+    }
+
+    lease_mutex.unlock();
+    return;
+}
+
+std::uint64_t GkRemoteDb::acquire_snapshot()
+{
+    GkWireWriter request;
+    request.put_u8(GkOpcode::SnapshotAcquire);
+    std::string response;
+    leveldb::Status s = call(request, response);
+    if (!s.ok()) {
+        throw std::runtime_error(s.ToString());
+    }
+
+    return GkWireReader(response).get_varint();
+}
+
+void GkRemoteDb::release_snapshot(const std::uint64_t &snapshot_id)
+{
+    GkWireWriter request;
+    request.put_u8(GkOpcode::SnapshotRelease).put_varint(snapshot_id);
+    std::string response;
+    call(request, response);
+    return;
+}
+
+/**
+ * @brief GkRemoteDb::scan reads a page of consecutive keys and their values from the served database.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param snapshot_id The snapshot to read from, or zero for the latest state of the database.
+ * @param fill_cache Whether the service should keep the blocks that are read within its cache.
+ * @param mode Where to start from, and in which direction to go.
+ * @param key The key to start from, if `mode` calls for one.
+ * @param limit The maximum amount of entries to read.
+ * @param entries The keys and values that were read, in the order they were walked over.
+ */
+leveldb::Status GkRemoteDb::scan(const std::uint64_t &snapshot_id, const bool &fill_cache, const GkScanMode &mode,
+                                 const std::string &key, const std::size_t &limit,
+                                 std::vector<std::pair<std::string, std::string>> &entries)
+{
+    GkWireWriter request;
+    request.put_u8(GkOpcode::Scan).put_varint(snapshot_id).put_u8(fill_cache ? 1 : 0).put_u8(mode).put_string(key)
+            .put_varint(limit);
+    std::string response;
+    leveldb::Status s = call(request, response);
+    if (s.ok()) {
+        GkWireReader in(response);
+        const std::uint64_t count = in.get_varint();
+        entries.reserve(static_cast<std::size_t>(count));
+        for (std::uint64_t i = 0; i < count; ++i) {
+            std::string entry_key = in.get_string();
+            entries.emplace_back(std::move(entry_key), in.get_string());
+        }
+    }
+
+    return s;
+}
+
+/**
+ * @brief GkRemoteDb::call sends a request to the service and waits upon its response. Requests from each of the
+ * threads of this process take it in turns upon the one connection.
+ * @param request The request, starting with its `GkOpcode`.
+ * @param response The body of the response, after its `GkStatus`.
+ * @return The outcome of the request, with a lost connection being reported as an IOError.
+ */
+/**
+ * @brief GkRemoteDb::publish passes the changes that this process has just committed along to the service, for every
+ * other HerpLog process that shares the database to hear about.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param changes The changes that have been committed, as numbered by GkChangeFeed::stamp().
+ * @see GkDbServer::publish_changes()
+ */
+leveldb::Status GkRemoteDb::publish(const std::vector<GkRecords::GkChange> &changes)
+{
+    GkWireWriter request;
+    request.put_u8(GkOpcode::Publish).put_changes(changes);
+    std::string response;
+    return call(request, response);
+}
+
+/**
+ * @brief GkRemoteDb::changes_since asks the service for whatever changes any of its clients have published after the
+ * given sequence number.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param after_sequence The last sequence number that this process has seen.
+ * @param wait_ms How long the service should wait for any changes to turn up, should there be none as of yet.
+ * @param changes_out The changes that this process has yet to see, oldest first.
+ * @note Every other request upon this connection is held up whilst the service waits, so a connection of its own is
+ * best used for any waiting.
+ * @see GkDbServer::changes_since()
+ */
+leveldb::Status GkRemoteDb::changes_since(const std::uint64_t &after_sequence, const int &wait_ms,
+                                          std::vector<GkRecords::GkChange> &changes_out)
+{
+    GkWireWriter request;
+    request.put_u8(GkOpcode::FeedSince).put_varint(after_sequence).put_varint(static_cast<std::uint64_t>(wait_ms));
+    std::string response;
+    leveldb::Status s = call(request, response);
+    if (s.ok()) {
+        GkWireReader(response).get_changes(changes_out);
+    }
+
+    return s;
+}
+
+leveldb::Status GkRemoteDb::call(const GkWireWriter &request, std::string &response)
+{
+    std::string frame;
+    {
+        std::lock_guard<std::mutex> locker(socket_mutex);
+        if (!socket.send_frame(request.data()) || !socket.recv_frame(frame)) {
+            return leveldb::Status::IOError("The connection to the HerpLog service has been lost!");
+        }
+    }
+
+    if (frame.empty()) {
+        return leveldb::Status::Corruption("The HerpLog service sent back an empty response!");
+    }
+
+    const std::uint8_t status = static_cast<std::uint8_t>(frame[0]);
+    response = frame.substr(1);
+    switch (status) {
+        case GkStatus::Ok:
+            return leveldb::Status::OK();
+        case GkStatus::NotFound:
+            return leveldb::Status::NotFound(leveldb::Slice());
+        default:
+            return leveldb::Status::IOError(GkWireReader(response).get_string());
+    }
+}
+
+std::uint64_t GkRemoteDb::snapshot_id(const leveldb::Snapshot *snapshot)
+{
+    return (snapshot == nullptr) ? 0 : static_cast<const GkRemoteSnapshot *>(snapshot)->id;
+}
@@ -0,0 +1,109 @@
+/**
+ **  _   _                 _
+ ** | | | |               | |
+ ** | |_| | ___ _ __ _ __ | |     ___   __ _
+ ** |  _  |/ _ \ '__| '_ \| |    / _ \ / _` |
+ ** | | | |  __/ |  | |_) | |___| (_) | (_| |
+ ** \_| |_/\___|_|  | .__/\_____/\___/ \__, |
+ **                 | |                 __/ |
+ **                 |_|                |___/
+ **
+ **   Thank you for using "HerpLog" for your herpetology management requirements!
+ **   Copyright (C) 2017-2018. GekkoFyre.
+ **
+ **
+ **   HerpLog is free software: you can redistribute it and/or modify
+ **   it under the terms of the GNU General Public License as published by
+ **   the Free Software Foundation, either version 3 of the License, or
+ **   (at your option) any later version.
+ **
+ **   HerpLog is distributed in the hope that it will be useful,
+ **   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **   GNU General Public License for more details.
+ **
+ **   You should have received a copy of the GNU General Public License
+ **   along with HerpLog.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ **
+ **   The latest source code updates can be obtained from [ 1 ] below at your
+ **   discretion. A web-browser or the 'git' application may be required.
+ **
+ **   [ 1 ] - https://github.com/GekkoFyre/HerpLog
+ **
+ ********************************************************************************/
+
+/**
+ * @file gk_remote_db.hpp
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @brief A stand-in for a Google LevelDB database that forwards everything to the HerpLog service, so that the rest of
+ * HerpLog can work with a served database exactly as it would with one of its own.
+ */
+
+#ifndef GK_REMOTE_DB_HPP
+#define GK_REMOTE_DB_HPP
+
+#include "options.hpp"
+#include "gk_db_protocol.hpp"
+#include <leveldb/db.h>
+#include <leveldb/iterator.h>
+#include <memory>
+#include <string>
+#include <vector>
+#include <mutex>
+#include <utility>
+
+namespace GekkoFyre {
+class GkRemoteDb;
+
+class GkRemoteDb : public leveldb::DB {
+
+public:
+    explicit GkRemoteDb(GkSocket &&sock);
+    ~GkRemoteDb() override;
+
+    static std::shared_ptr<leveldb::DB> connect(const std::string &socket_path);
+    static GkRemoteDb *from(const GkFile::FileDb &db_conn);
+    const std::string &path() const;
+    void disconnect();
+
+    leveldb::Status Put(const leveldb::WriteOptions &options, const leveldb::Slice &key,
+                        const leveldb::Slice &value) override;
+    leveldb::Status Delete(const leveldb::WriteOptions &options, const leveldb::Slice &key) override;
+    leveldb::Status Write(const leveldb::WriteOptions &options, leveldb::WriteBatch *updates) override;
+    leveldb::Status Get(const leveldb::ReadOptions &options, const leveldb::Slice &key, std::string *value) override;
+    leveldb::Iterator *NewIterator(const leveldb::ReadOptions &options) override;
+    const leveldb::Snapshot *GetSnapshot() override;
+    void ReleaseSnapshot(const leveldb::Snapshot *snapshot) override;
+    bool GetProperty(const leveldb::Slice &property, std::string *value) override;
+    void GetApproximateSizes(const leveldb::Range *range, int n, uint64_t *sizes) override;
+    void CompactRange(const leveldb::Slice *begin, const leveldb::Slice *end) override;
+
+    void acquire_lease();
+    void release_lease();
+
+    std::uint64_t acquire_snapshot();
+    void release_snapshot(const std::uint64_t &snapshot_id);
+    leveldb::Status scan(const std::uint64_t &snapshot_id, const bool &fill_cache, const GkService::GkScanMode &mode,
+                         const std::string &key, const std::size_t &limit,
+                         std::vector<std::pair<std::string, std::string>> &entries);
+
+    leveldb::Status publish(const std::vector<GkRecords::GkChange> &changes);
+    leveldb::Status changes_since(const std::uint64_t &after_sequence, const int &wait_ms,
+                                  std::vector<GkRecords::GkChange> &changes_out);
+
+private:
+    leveldb::Status call(const GkWireWriter &request, std::string &response);
+    static std::uint64_t snapshot_id(const leveldb::Snapshot *snapshot);
+
+    GkSocket socket;
+    std::string socket_path;
+    std::mutex socket_mutex;
+
+    std::recursive_mutex lease_mutex; // Keeps the other threads of this process out, whilst one of them holds the lease
+    int lease_depth;
+};
+}
+
+#endif // GK_REMOTE_DB_HPP
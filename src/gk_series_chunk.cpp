@@ -0,0 +1,410 @@
+/**
+ **  _   _                 _
+ ** | | | |               | |
+ ** | |_| | ___ _ __ _ __ | |     ___   __ _
+ ** |  _  |/ _ \ '__| '_ \| |    / _ \ / _` |
+ ** | | | |  __/ |  | |_) | |___| (_) | (_| |
+ ** \_| |_/\___|_|  | .__/\_____/\___/ \__, |
+ **                 | |                 __/ |
+ **                 |_|                |___/
+ **
+ **   Thank you for using "HerpLog" for your herpetology management requirements!
+ **   Copyright (C) 2017-2018. GekkoFyre.
+ **
+ **
+ **   HerpLog is free software: you can redistribute it and/or modify
+ **   it under the terms of the GNU General Public License as published by
+ **   the Free Software Foundation, either version 3 of the License, or
+ **   (at your option) any later version.
+ **
+ **   HerpLog is distributed in the hope that it will be useful,
+ **   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **   GNU General Public License for more details.
+ **
+ **   You should have received a copy of the GNU General Public License
+ **   along with HerpLog.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ **
+ **   The latest source code updates can be obtained from [ 1 ] below at your
+ **   discretion. A web-browser or the 'git' application may be required.
+ **
+ **   [ 1 ] - https://github.com/GekkoFyre/HerpLog
+ **
+ ********************************************************************************/
+
+/**
+ * @file gk_series_chunk.cpp
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @brief A fixed-size chunk of a numeric time-series, compressed as per Facebook's Gorilla, whereby the Date/Times are
+ * stored as the delta of their deltas and the readings as the XOR of one against the last.
+ */
+
+#include "gk_series_chunk.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+using namespace GekkoFyre;
+
+namespace {
+constexpr std::size_t HEADER_BYTES = 4 + 8 + 8 + 8 + 8 + 8;
+
+void put_u64(std::string &out, const std::uint64_t &value, const int &bytes = 8)
+{
+    for (int shift = (bytes - 1) * 8; shift >= 0; shift -= 8) {
+        out.push_back(static_cast<char>((value >> shift) & 0xFF));
+    }
+}
+
+std::uint64_t get_u64(const std::string &in, std::size_t &pos, const int &bytes = 8)
+{
+    std::uint64_t value = 0;
+    for (int i = 0; i < bytes; ++i) {
+        value = (value << 8) | static_cast<unsigned char>(in[pos++]);
+    }
+
+    return value;
+}
+
+std::uint64_t double_bits(const double &value)
+{
+    std::uint64_t bits = 0;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+double bits_double(const std::uint64_t &bits)
+{
+    double value = 0.0;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+/**
+ * @brief The GkBitReader class reads back the bits written by GkSeriesChunk::write_bits(), most significant first, and
+ * goes bad rather than reading past the end of a damaged chunk.
+ */
+class GkBitReader {
+
+public:
+    GkBitReader(const std::string &in, const std::size_t &offset) : data(in), pos(offset * 8), good(true) {}
+
+    std::uint64_t read(int bits)
+    {
+        std::uint64_t value = 0;
+        if ((pos + static_cast<std::size_t>(bits)) > (data.size() * 8)) {
+            good = false;
+            return 0;
+        }
+
+        while (bits > 0) {
+            const int available = 8 - static_cast<int>(pos % 8);
+            const int take = std::min(available, bits);
+            const unsigned char byte = static_cast<unsigned char>(data[pos / 8]);
+            value = (value << take) | ((byte >> (available - take)) & ((1U << take) - 1));
+            bits -= take;
+            pos += static_cast<std::size_t>(take);
+        }
+
+        return value;
+    }
+
+    // Counts the leading ones of a control code, up to `max_ones` of them
+    int ones(const int &max_ones)
+    {
+        int count = 0;
+        while ((count < max_ones) && (read(1) == 1)) {
+            ++count;
+        }
+
+        return count;
+    }
+
+    bool ok() const { return good; }
+
+private:
+    const std::string &data;
+    std::size_t pos;
+    bool good;
+};
+
+// The ranges of the delta-of-deltas that fit within 7, 9 and 12 bits, as per the Gorilla paper
+struct GkDodBucket {
+    long int low;
+    long int high;
+    int bits;
+};
+
+constexpr GkDodBucket DOD_BUCKETS[] = { { -63, 64, 7 }, { -255, 256, 9 }, { -2047, 2048, 12 } };
+}
+
+GkSeriesChunk::GkSeriesChunk(const std::uint32_t &capacity) : capacity(std::max<std::uint32_t>(capacity, 2)), n(0),
+    t_first(0), t_last(0), last_delta(0), last_bits(0), last_leading(-1), last_trailing(0),
+    min_value(std::numeric_limits<double>::max()), max_value(std::numeric_limits<double>::lowest()), sum_value(0.0),
+    sealed(false), bit_count(0)
+{}
+
+GkSeriesChunk::~GkSeriesChunk()
+{}
+
+/**
+ * @brief GkSeriesChunk::append compresses another reading onto the end of the chunk. Readings taken at a steady rate
+ * cost a single bit for their Date/Time, and a reading that hasn't changed costs a single bit for its value.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param date_time The Date/Time of the reading, as UNIX Epoch Time.
+ * @param value The reading itself, which must not be NaN.
+ * @return False if the chunk is full, was read back from the database, or if the reading is no later than the last, in
+ * which case the chunk is left as it was.
+ */
+bool GkSeriesChunk::append(const long int &date_time, const double &value)
+{
+    if (sealed || full() || std::isnan(value) || ((n > 0) && (date_time <= t_last))) {
+        return false;
+    }
+
+    const std::uint64_t bits = double_bits(value);
+    if (n == 0) {
+        t_first = date_time;
+        write_bits(bits, 64);
+    } else {
+        const long int delta = date_time - t_last;
+        const long int dod = delta - last_delta;
+        if (dod == 0) {
+            write_bits(0, 1);
+        } else {
+            int code = 0;
+            for (; code < 3; ++code) {
+                if ((dod >= DOD_BUCKETS[code].low) && (dod <= DOD_BUCKETS[code].high)) {
+                    break;
+                }
+            }
+
+            // The control code is `10`, `110` or `1110` for each of the buckets, with `1111` being followed by all 64 bits
+            if (code < 3) {
+                write_bits((std::uint64_t(1) << (code + 2)) - 2, code + 2);
+                write_bits(static_cast<std::uint64_t>(dod - DOD_BUCKETS[code].low), DOD_BUCKETS[code].bits);
+            } else {
+                write_bits(0x0F, 4);
+                write_bits(static_cast<std::uint64_t>(dod), 64);
+            }
+        }
+
+        const std::uint64_t xor_bits = bits ^ last_bits;
+        if (xor_bits == 0) {
+            write_bits(0, 1);
+        } else {
+            const int leading = std::min(__builtin_clzll(xor_bits), 31);
+            const int trailing = __builtin_ctzll(xor_bits);
+            if ((last_leading >= 0) && (leading >= last_leading) && (trailing >= last_trailing)) {
+                write_bits(0x02, 2); // Fits within the window of meaningful bits of the last XOR
+                write_bits(xor_bits >> last_trailing, 64 - last_leading - last_trailing);
+            } else {
+                const int meaningful = 64 - leading - trailing;
+                write_bits(0x03, 2);
+                write_bits(static_cast<std::uint64_t>(leading), 5);
+                write_bits(static_cast<std::uint64_t>(meaningful & 0x3F), 6); // A width of 64 wraps around to zero
+                write_bits(xor_bits >> trailing, meaningful);
+                last_leading = leading;
+                last_trailing = trailing;
+            }
+        }
+
+        last_delta = delta;
+    }
+
+    ++n;
+    t_last = date_time;
+    last_bits = bits;
+    min_value = std::min(min_value, value);
+    max_value = std::max(max_value, value);
+    sum_value += value;
+    return true;
+}
+
+bool GkSeriesChunk::full() const
+{
+    return n >= capacity;
+}
+
+bool GkSeriesChunk::empty() const
+{
+    return n == 0;
+}
+
+std::uint32_t GkSeriesChunk::count() const
+{
+    return n;
+}
+
+long int GkSeriesChunk::first_time() const
+{
+    return t_first;
+}
+
+long int GkSeriesChunk::last_time() const
+{
+    return t_last;
+}
+
+double GkSeriesChunk::minimum() const
+{
+    return min_value;
+}
+
+double GkSeriesChunk::maximum() const
+{
+    return max_value;
+}
+
+double GkSeriesChunk::sum() const
+{
+    return sum_value;
+}
+
+/**
+ * @brief GkSeriesChunk::decode decompresses the readings of the chunk that fall within the given range, stopping as
+ * soon as it has gone past the end of it.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param from The beginning of the range, as UNIX Epoch Time.
+ * @param to The end of the range, inclusive.
+ * @param points Where the readings are appended to, in chronological order.
+ * @return False if the chunk turned out to be damaged, whereby only the readings before the damage were appended.
+ */
+bool GkSeriesChunk::decode(const long int &from, const long int &to, std::vector<GkSeries::GkSeriesPoint> &points) const
+{
+    if ((n == 0) || (to < t_first) || (from > t_last)) {
+        return true;
+    }
+
+    GkBitReader reader(stream, 0);
+    long int date_time = t_first;
+    long int delta = 0;
+    std::uint64_t bits = reader.read(64);
+    int leading = 0;
+    int meaningful = 0;
+    for (std::uint32_t i = 0; (i < n) && reader.ok(); ++i) {
+        if (i > 0) {
+            const int code = reader.ones(4);
+            if (code == 4) {
+                delta += static_cast<long int>(reader.read(64));
+            } else if (code > 0) {
+                delta += static_cast<long int>(reader.read(DOD_BUCKETS[code - 1].bits)) + DOD_BUCKETS[code - 1].low;
+            }
+
+            date_time += delta;
+            if (reader.read(1) == 1) {
+                if (reader.read(1) == 1) {
+                    leading = static_cast<int>(reader.read(5));
+                    meaningful = static_cast<int>(reader.read(6));
+                    meaningful = (meaningful == 0) ? 64 : meaningful;
+                }
+
+                if ((meaningful == 0) || (leading + meaningful > 64)) {
+                    return false;
+                }
+
+                bits ^= reader.read(meaningful) << (64 - leading - meaningful);
+            }
+        }
+
+        if (!reader.ok()) {
+            return false;
+        }
+
+        if (date_time > to) {
+            break;
+        }
+
+        if (date_time >= from) {
+            points.push_back({ date_time, bits_double(bits) });
+        }
+    }
+
+    return reader.ok();
+}
+
+/**
+ * @brief GkSeriesChunk::serialise lays the chunk out as a string, for keeping within the database. The number of
+ * readings, their time span and their minimum, maximum and sum come first, so that a chunk can be skipped over or
+ * downsampled without decompressing it.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @see GkSeriesChunk::deserialise()
+ */
+std::string GkSeriesChunk::serialise() const
+{
+    std::string out;
+    out.reserve(HEADER_BYTES + stream.size());
+    put_u64(out, n, 4);
+    put_u64(out, static_cast<std::uint64_t>(t_first));
+    put_u64(out, static_cast<std::uint64_t>(t_last));
+    put_u64(out, double_bits(min_value));
+    put_u64(out, double_bits(max_value));
+    put_u64(out, double_bits(sum_value));
+    out.append(stream);
+    return out;
+}
+
+/**
+ * @brief GkSeriesChunk::deserialise does the opposite of GkSeriesChunk::serialise(). The chunk that results can be
+ * decoded, but not appended to.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param value The chunk, as it was kept within the database.
+ * @param chunk The decoded chunk, which is left untouched if `value` turns out to be damaged.
+ * @return Whether `value` made for a valid chunk or not.
+ */
+bool GkSeriesChunk::deserialise(const std::string &value, GkSeriesChunk &chunk)
+{
+    if (value.size() < HEADER_BYTES + 8) {
+        return false;
+    }
+
+    std::size_t pos = 0;
+    GkSeriesChunk decoded;
+    decoded.n = static_cast<std::uint32_t>(get_u64(value, pos, 4));
+    decoded.t_first = static_cast<long int>(get_u64(value, pos));
+    decoded.t_last = static_cast<long int>(get_u64(value, pos));
+    decoded.min_value = bits_double(get_u64(value, pos));
+    decoded.max_value = bits_double(get_u64(value, pos));
+    decoded.sum_value = bits_double(get_u64(value, pos));
+    if ((decoded.n == 0) || (decoded.t_last < decoded.t_first)) {
+        return false;
+    }
+
+    decoded.capacity = std::max(decoded.capacity, decoded.n);
+    decoded.stream = value.substr(HEADER_BYTES);
+    decoded.bit_count = static_cast<std::uint64_t>(decoded.stream.size()) * 8;
+    decoded.sealed = true;
+    chunk = decoded;
+    return true;
+}
+
+/**
+ * @brief GkSeriesChunk::write_bits appends the lowest `bits` bits of `value` onto the stream, most significant first.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ */
+void GkSeriesChunk::write_bits(const std::uint64_t &value, const int &bits)
+{
+    int remaining = bits;
+    while (remaining > 0) {
+        const int available = 8 - static_cast<int>(bit_count % 8);
+        if (available == 8) {
+            stream.push_back('\0');
+        }
+
+        const int take = std::min(available, remaining);
+        const unsigned chunk = static_cast<unsigned>((value >> (remaining - take)) & ((1U << take) - 1));
+        stream.back() = static_cast<char>(static_cast<unsigned char>(stream.back()) | (chunk << (available - take)));
+        remaining -= take;
+        bit_count += static_cast<std::uint64_t>(take);
+    }
+
+    return;
+}
@@ -0,0 +1,95 @@
+/**
+ **  _   _                 _
+ ** | | | |               | |
+ ** | |_| | ___ _ __ _ __ | |     ___   __ _
+ ** |  _  |/ _ \ '__| '_ \| |    / _ \ / _` |
+ ** | | | |  __/ |  | |_) | |___| (_) | (_| |
+ ** \_| |_/\___|_|  | .__/\_____/\___/ \__, |
+ **                 | |                 __/ |
+ **                 |_|                |___/
+ **
+ **   Thank you for using "HerpLog" for your herpetology management requirements!
+ **   Copyright (C) 2017-2018. GekkoFyre.
+ **
+ **
+ **   HerpLog is free software: you can redistribute it and/or modify
+ **   it under the terms of the GNU General Public License as published by
+ **   the Free Software Foundation, either version 3 of the License, or
+ **   (at your option) any later version.
+ **
+ **   HerpLog is distributed in the hope that it will be useful,
+ **   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **   GNU General Public License for more details.
+ **
+ **   You should have received a copy of the GNU General Public License
+ **   along with HerpLog.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ **
+ **   The latest source code updates can be obtained from [ 1 ] below at your
+ **   discretion. A web-browser or the 'git' application may be required.
+ **
+ **   [ 1 ] - https://github.com/GekkoFyre/HerpLog
+ **
+ ********************************************************************************/
+
+/**
+ * @file gk_series_chunk.hpp
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @brief A fixed-size chunk of a numeric time-series, compressed as per Facebook's Gorilla, whereby the Date/Times are
+ * stored as the delta of their deltas and the readings as the XOR of one against the last.
+ */
+
+#ifndef GK_SERIES_CHUNK_HPP
+#define GK_SERIES_CHUNK_HPP
+
+#include "options.hpp"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace GekkoFyre {
+class GkSeriesChunk;
+
+class GkSeriesChunk {
+
+public:
+    explicit GkSeriesChunk(const std::uint32_t &capacity = HERPLOG_SERIES_CHUNK_POINTS);
+    ~GkSeriesChunk();
+
+    bool append(const long int &date_time, const double &value);
+    bool full() const;
+    bool empty() const;
+    std::uint32_t count() const;
+    long int first_time() const;
+    long int last_time() const;
+    double minimum() const;
+    double maximum() const;
+    double sum() const;
+    bool decode(const long int &from, const long int &to, std::vector<GkSeries::GkSeriesPoint> &points) const;
+
+    std::string serialise() const;
+    static bool deserialise(const std::string &value, GkSeriesChunk &chunk);
+
+private:
+    std::uint32_t capacity;
+    std::uint32_t n;
+    long int t_first;
+    long int t_last;
+    long int last_delta;
+    std::uint64_t last_bits;            // The IEEE 754 representation of the last reading
+    int last_leading;                   // The window of meaningful bits of the last XOR, or -1 if there is none yet
+    int last_trailing;
+    double min_value;
+    double max_value;
+    double sum_value;
+    bool sealed;                        // A chunk read back from the database only knows its bits, not how to carry on
+    std::string stream;
+    std::uint64_t bit_count;
+
+    void write_bits(const std::uint64_t &value, const int &bits);
+};
+}
+
+#endif // GK_SERIES_CHUNK_HPP
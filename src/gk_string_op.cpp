@@ -46,11 +46,62 @@
 #include <boost/uuid/uuid_io.hpp>
 #include <boost/algorithm/string.hpp>
 #include <boost/random.hpp>
-#include <QMessageBox>
+#include <QVector>
+#include <cstring>
+#include <limits>
 #include <random>
 #include <sstream>
 
 using namespace GekkoFyre;
+
+namespace {
+constexpr std::uint64_t FNV_OFFSET_BASIS = 14695981039346656037ULL;
+constexpr std::uint64_t FNV_PRIME = 1099511628211ULL;
+constexpr std::size_t ANIMAL_SUMMARY_BYTES = (17 * 8) + 1; // Seventeen eight-byte fields, then whether the summary is stale
+
+/**
+ * @brief append_ordered writes a signed integer as eight big-endian bytes with its sign bit flipped, so that Google
+ * LevelDB's bytewise ordering of the keys is also the numeric ordering of the integers.
+ */
+void append_ordered(std::string &key, const long int &value)
+{
+    const std::uint64_t ordered = static_cast<std::uint64_t>(static_cast<std::int64_t>(value)) ^ (1ULL << 63);
+    for (int shift = 56; shift >= 0; shift -= 8) {
+        key.push_back(static_cast<char>((ordered >> shift) & 0xFF));
+    }
+}
+
+/**
+ * @brief read_ordered does the opposite of append_ordered(), for the eight bytes found at `offset`.
+ */
+long int read_ordered(const std::string &key, const std::size_t &offset)
+{
+    std::uint64_t ordered = 0;
+    for (std::size_t i = 0; i < 8; ++i) {
+        ordered = (ordered << 8) | static_cast<unsigned char>(key[offset + i]);
+    }
+
+    return static_cast<long int>(static_cast<std::int64_t>(ordered ^ (1ULL << 63)));
+}
+
+/**
+ * @brief fnv_field folds a single field into a FNV-1a hash, length first, so that no two different sets of fields can
+ * ever be run together into the same stream of bytes.
+ */
+void fnv_field(std::uint64_t &hash, const std::string &field)
+{
+    std::uint64_t len = field.size();
+    for (int i = 0; i < 8; ++i) {
+        hash = (hash ^ static_cast<unsigned char>(len & 0xFF)) * FNV_PRIME;
+        len >>= 8;
+    }
+
+    for (const char &c: field) {
+        hash = (hash ^ static_cast<unsigned char>(c)) * FNV_PRIME;
+    }
+}
+}
+
 GkStringOp::GkStringOp(QObject *parent) : QObject(parent)
 {}
 
@@ -81,8 +132,7 @@ std::string GkStringOp::random_hash()
 std::string GkStringOp::multipart_key(const std::initializer_list<std::string> &args)
 {
     std::ostringstream ret_val;
-    static int counter;
-    counter = 0;
+    int counter = 0;
     for (const auto &arg: args) {
         ++counter;
         if (counter == 1) {
@@ -96,195 +146,1075 @@ std::string GkStringOp::multipart_key(const std::initializer_list<std::string> &
 }
 
 /**
- * @brief GkStringOp::del_cat_msg_box will pose a QMessageBox to the user of HerpLog and ask them if they want to proceed
- * with the action of deleting the specified categories in question (`Licensee`, `Species`, or `Animal ID`) from
- * the Google LevelDB database.
+ * @brief GkStringOp::unique_id_key creates the key under which the Unique IDs of a record's categories are kept, so
+ * that whether a record exists (and what it belongs to) comes down to a single lookup.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param record_id The Unique ID of the record.
+ * @return The key, ready for use within the database.
+ * @see GkStringOp::encode_unique_ids()
+ */
+std::string GkStringOp::unique_id_key(const std::string &record_id)
+{
+    std::string key(GkRecords::LEVELDB_STORE_RECORD_PREFIX);
+    key.append(record_id);
+    return key;
+}
+
+/**
+ * @brief GkStringOp::cat_prefix gives the prefix under which every Licensee, Species, or Name/ID sub-record is kept.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param record_type Whether the prefix is for a Licensee, Species, or Name/ID sub-record.
+ * @return The prefix, ready for use within the database.
+ */
+std::string GkStringOp::cat_prefix(const GkRecords::MiscRecordType &record_type)
+{
+    switch (record_type) {
+        case GkRecords::MiscRecordType::gkLicensee:
+            return GkRecords::LEVELDB_STORE_LICENSEE_PREFIX;
+        case GkRecords::MiscRecordType::gkSpecies:
+            return GkRecords::LEVELDB_STORE_SPECIES_PREFIX;
+        case GkRecords::MiscRecordType::gkId:
+            return GkRecords::LEVELDB_STORE_NAME_PREFIX;
+        default:
+            throw std::invalid_argument(tr("Unable to read Unique Identifier from database!").toStdString());
+    }
+}
+
+/**
+ * @brief GkStringOp::cat_key creates the key under which the name of a single Licensee, Species, or Name/ID sub-record
+ * is kept.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param record_type Whether the sub-record is a Licensee, Species, or Name/ID.
+ * @param cat_id The Unique ID of the sub-record.
+ * @return The key, ready for use within the database.
+ */
+std::string GkStringOp::cat_key(const GkRecords::MiscRecordType &record_type, const std::string &cat_id)
+{
+    std::string key = cat_prefix(record_type);
+    key.append(cat_id);
+    return key;
+}
+
+/**
+ * @brief GkStringOp::encode_unique_ids lays out the Unique IDs of a record's Licensee, Species and Name/ID, in that
+ * order, separated by commas.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @see GkStringOp::decode_unique_ids()
+ */
+std::string GkStringOp::encode_unique_ids(const GkRecords::MiscUniqueIds &ids)
+{
+    return ids.licensee_id + "," + ids.species_id + "," + ids.name_id;
+}
+
+/**
+ * @brief GkStringOp::decode_unique_ids does the opposite of GkStringOp::encode_unique_ids().
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param value The value, as found within the database.
+ * @param ids The decoded Unique IDs.
+ * @return Whether all three of the Unique IDs were present or not.
+ */
+bool GkStringOp::decode_unique_ids(const std::string &value, GkRecords::MiscUniqueIds &ids)
+{
+    const std::size_t first = value.find(',');
+    const std::size_t second = (first == std::string::npos) ? std::string::npos : value.find(',', first + 1);
+    if ((first == std::string::npos) || (second == std::string::npos) || (first == 0) || (second == first + 1) ||
+            (second + 1 == value.size())) {
+        return false;
+    }
+
+    ids.licensee_id = value.substr(0, first);
+    ids.species_id = value.substr(first + 1, second - first - 1);
+    ids.name_id = value.substr(second + 1);
+    return true;
+}
+
+/**
+ * @brief GkStringOp::timestamp_index_key creates the key for a record's entry within the timestamp index. The Date/Time
+ * is stored as a big-endian integer with its sign bit flipped, so that Google LevelDB's bytewise ordering of the keys is
+ * also their chronological ordering.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param date_time The Date/Time of the record, as UNIX Epoch Time.
+ * @param record_id The Unique ID of the record.
+ * @return The key, ready for use within the database.
+ */
+std::string GkStringOp::timestamp_index_key(const long int &date_time, const std::string &record_id)
+{
+    std::string key(GkRecords::LEVELDB_INDEX_TIMESTAMP);
+    append_ordered(key, date_time);
+    key.append(record_id);
+    return key;
+}
+
+/**
+ * @brief GkStringOp::decode_timestamp_index_key does the opposite of GkStringOp::timestamp_index_key().
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param key The key, as found within the database.
+ * @param entry The decoded Date/Time and Record ID.
+ * @return Whether the key was a valid timestamp index key or not.
+ */
+bool GkStringOp::decode_timestamp_index_key(const std::string &key, GkRecords::GkIndexEntry &entry)
+{
+    const std::string prefix(GkRecords::LEVELDB_INDEX_TIMESTAMP);
+    if ((key.size() <= prefix.size() + 8) || (key.compare(0, prefix.size(), prefix) != 0)) {
+        return false;
+    }
+
+    entry.date_time = read_ordered(key, prefix.size());
+    entry.record_id = key.substr(prefix.size() + 8);
+    return true;
+}
+
+/**
+ * @brief GkStringOp::animal_index_prefix creates the prefix shared by every entry of a single animal within the (Animal,
+ * Date/Time) index. The terminating NUL keeps one animal's entries from running into those of another whose Unique ID
+ * merely begins with the same characters.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param name_id The Unique ID of the animal.
+ */
+std::string GkStringOp::animal_index_prefix(const std::string &name_id)
+{
+    std::string key(GkRecords::LEVELDB_INDEX_ANIMAL);
+    key.append(name_id);
+    key.push_back('\0');
+    return key;
+}
+
+/**
+ * @brief GkStringOp::animal_index_key creates the key for a record's entry within the (Animal, Date/Time) index, whereby
+ * an animal's records sit next to one another in chronological order, just as within the timestamp index.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param name_id The Unique ID of the animal that the record is filed under.
+ * @param date_time The Date/Time of the record, as UNIX Epoch Time.
+ * @param record_id The Unique ID of the record.
+ * @return The key, ready for use within the database.
+ * @see GkStringOp::timestamp_index_key()
+ */
+std::string GkStringOp::animal_index_key(const std::string &name_id, const long int &date_time,
+                                         const std::string &record_id)
+{
+    std::string key = animal_index_prefix(name_id);
+    append_ordered(key, date_time);
+    key.append(record_id);
+    return key;
+}
+
+/**
+ * @brief GkStringOp::encode_weight stores the weight of a record as the eight bytes of its IEEE 754 representation, for
+ * the value of its entry within the (Animal, Date/Time) index.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ */
+std::string GkStringOp::encode_weight(const double &weight)
+{
+    std::uint64_t bits = 0;
+    static_assert(sizeof(bits) == sizeof(weight), "A double must be 64-bits wide!");
+    std::memcpy(&bits, &weight, sizeof(bits));
+    return encode_u64(bits);
+}
+
+/**
+ * @brief GkStringOp::decode_animal_index_entry does the opposite of GkStringOp::animal_index_key() and
+ * GkStringOp::encode_weight().
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param key The key, as found within the database.
+ * @param value The value stored alongside the key.
+ * @param prefix_len The length of the animal's prefix, as given by GkStringOp::animal_index_prefix().
+ * @param entry The decoded Date/Time, Record ID and weight.
+ * @return Whether the key and value made for a valid entry or not.
+ */
+bool GkStringOp::decode_animal_index_entry(const std::string &key, const std::string &value,
+                                           const std::size_t &prefix_len, GkRecords::GkAnimalIndexEntry &entry)
+{
+    if ((key.size() <= prefix_len + 8) || (value.size() != 8)) {
+        return false;
+    }
+
+    entry.date_time = read_ordered(key, prefix_len);
+    entry.record_id = key.substr(prefix_len + 8);
+
+    const std::uint64_t bits = decode_u64(value);
+    std::memcpy(&entry.weight, &bits, sizeof(bits));
+    return true;
+}
+
+/**
+ * @brief GkStringOp::merge_bucket works out which bucket of time a record falls within, for the purposes of comparing
+ * one database against another without having to look at every record of each.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param date_time The Date/Time of the record, as UNIX Epoch Time.
+ * @return The bucket, whereby dates before 1970 are rounded down rather than towards zero.
+ * @see GkDbMerge
+ */
+long int GkStringOp::merge_bucket(const long int &date_time)
+{
+    long int bucket = date_time / HERPLOG_MERGE_BUCKET_SECONDS;
+    if ((date_time % HERPLOG_MERGE_BUCKET_SECONDS) < 0) {
+        --bucket;
+    }
+
+    return bucket;
+}
+
+/**
+ * @brief GkStringOp::record_hash_key creates the key under which the leaf hash of a record is kept, ordered first by
+ * bucket so that all of the records within a bucket can be read with a single scan.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param bucket The bucket of time that the record falls within.
+ * @param record_id The Unique ID of the record.
+ * @return The key, ready for use within the database.
+ * @see GkStringOp::merge_bucket()
+ */
+std::string GkStringOp::record_hash_key(const long int &bucket, const std::string &record_id)
+{
+    std::string key(GkRecords::LEVELDB_INDEX_RECORD_HASH);
+    append_ordered(key, bucket);
+    key.append(record_id);
+    return key;
+}
+
+/**
+ * @brief GkStringOp::bucket_digest_key creates the key under which the digest of a whole bucket is kept.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param bucket The bucket of time in question.
+ * @return The key, ready for use within the database.
+ */
+std::string GkStringOp::bucket_digest_key(const long int &bucket)
+{
+    std::string key(GkRecords::LEVELDB_INDEX_BUCKET_DIGEST);
+    append_ordered(key, bucket);
+    return key;
+}
+
+/**
+ * @brief GkStringOp::decode_record_hash_key does the opposite of GkStringOp::record_hash_key().
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param key The key, as found within the database.
+ * @param bucket The decoded bucket.
+ * @param record_id The decoded Record ID.
+ * @return Whether the key was a valid record hash key or not.
+ */
+bool GkStringOp::decode_record_hash_key(const std::string &key, long int &bucket, std::string &record_id)
+{
+    const std::string prefix(GkRecords::LEVELDB_INDEX_RECORD_HASH);
+    if ((key.size() <= prefix.size() + 8) || (key.compare(0, prefix.size(), prefix) != 0)) {
+        return false;
+    }
+
+    bucket = read_ordered(key, prefix.size());
+    record_id = key.substr(prefix.size() + 8);
+    return true;
+}
+
+/**
+ * @brief GkStringOp::decode_bucket_digest_key does the opposite of GkStringOp::bucket_digest_key().
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param key The key, as found within the database.
+ * @param bucket The decoded bucket.
+ * @return Whether the key was a valid bucket digest key or not.
+ */
+bool GkStringOp::decode_bucket_digest_key(const std::string &key, long int &bucket)
+{
+    const std::string prefix(GkRecords::LEVELDB_INDEX_BUCKET_DIGEST);
+    if ((key.size() != prefix.size() + 8) || (key.compare(0, prefix.size(), prefix) != 0)) {
+        return false;
+    }
+
+    bucket = read_ordered(key, prefix.size());
+    return true;
+}
+
+/**
+ * @brief GkStringOp::record_hash hashes the contents of a log entry. The Licensee, Species and Animal are hashed by
+ * their names rather than their Unique IDs, since two databases that were kept apart will have given the very same
+ * Animal a different Unique ID each. The numbers are hashed as they are stored, so the hash is the same upon every
+ * computer and every version of HerpLog.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param submit The log entry, with the names of its categories filled in.
+ * @return A 64-bit FNV-1a hash of the log entry.
+ */
+std::uint64_t GkStringOp::record_hash(const GkRecords::GkSubmit &submit)
+{
+    std::uint64_t hash = FNV_OFFSET_BASIS;
+    for (const auto &field: { std::to_string(submit.date_time), submit.licensee.licensee_name,
+                              submit.species.species_name, submit.identifier.identifier_str, submit.further_notes,
+                              submit.vitamin_notes, submit.toilet_notes, submit.temp_notes, submit.weight_notes,
+                              submit.hydration_notes, std::to_string(submit.went_toilet),
+                              std::to_string(submit.had_hydration), std::to_string(submit.had_vitamins),
+                              std::to_string(submit.weight) }) {
+        fnv_field(hash, field);
+    }
+
+    for (const auto &attachment: submit.attachments) {
+        fnv_field(hash, attachment); // Records without any photos hash just as they did before photos came about
+    }
+
+    return hash;
+}
+
+/**
+ * @brief GkStringOp::record_leaf combines the Record ID with the hash of its contents into the leaf that is folded into
+ * the digest of its bucket. The result is well mixed, so that XOR'ing the leaves together gives a usable digest.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param record_id The Unique ID of the record.
+ * @param content_hash The hash of the record's contents, as given by GkStringOp::record_hash().
+ * @return The leaf hash.
+ */
+std::uint64_t GkStringOp::record_leaf(const std::string &record_id, const std::uint64_t &content_hash)
+{
+    std::uint64_t hash = FNV_OFFSET_BASIS;
+    fnv_field(hash, record_id);
+
+    // The finalizer of SplitMix64
+    std::uint64_t leaf = hash ^ content_hash;
+    leaf = (leaf ^ (leaf >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    leaf = (leaf ^ (leaf >> 27)) * 0x94D049BB133111EBULL;
+    return leaf ^ (leaf >> 31);
+}
+
+/**
+ * @brief GkStringOp::weight_sketch_prefix creates the prefix shared by the weight sketches of a single species, which
+ * is NUL-terminated for the same reasons as GkStringOp::animal_index_prefix().
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param species_id The Unique ID of the species.
+ */
+std::string GkStringOp::weight_sketch_prefix(const std::string &species_id)
+{
+    std::string key(GkRecords::LEVELDB_INDEX_WEIGHT_SKETCH);
+    key.append(species_id);
+    key.push_back('\0');
+    return key;
+}
+
+/**
+ * @brief GkStringOp::weight_sketch_key creates the key under which the quantile sketch of the weights of a species is
+ * kept, for a single bucket of time, so that the sketches of a species sit next to one another in chronological order.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param species_id The Unique ID of the species.
+ * @param bucket The bucket of time in question, as given by GkStringOp::merge_bucket().
+ * @return The key, ready for use within the database.
+ * @see GkQuantileSketch
+ */
+std::string GkStringOp::weight_sketch_key(const std::string &species_id, const long int &bucket)
+{
+    std::string key = weight_sketch_prefix(species_id);
+    append_ordered(key, bucket);
+    return key;
+}
+
+/**
+ * @brief GkStringOp::decode_weight_sketch_key does the opposite of GkStringOp::weight_sketch_key().
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param key The key, as found within the database.
+ * @param prefix_len The length of the species' prefix, as given by GkStringOp::weight_sketch_prefix().
+ * @param bucket The decoded bucket.
+ * @return Whether the key was a valid weight sketch key or not.
+ */
+bool GkStringOp::decode_weight_sketch_key(const std::string &key, const std::size_t &prefix_len, long int &bucket)
+{
+    if (key.size() != prefix_len + 8) {
+        return false;
+    }
+
+    bucket = read_ordered(key, prefix_len);
+    return true;
+}
+
+/**
+ * @brief GkStringOp::stale_weight_sketch_key creates the key that marks the quantile sketch of a species, for a single
+ * bucket of time, as needing to be made anew from the records that are left within it.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param species_id The Unique ID of the species.
+ * @param bucket The bucket of time in question, as given by GkStringOp::merge_bucket().
+ * @return The key, ready for use within the database.
+ */
+std::string GkStringOp::stale_weight_sketch_key(const std::string &species_id, const long int &bucket)
+{
+    std::string key(GkRecords::LEVELDB_INDEX_WEIGHT_STALE);
+    key.append(species_id);
+    key.push_back('\0');
+    append_ordered(key, bucket);
+    return key;
+}
+
+/**
+ * @brief GkStringOp::decode_stale_weight_sketch_key does the opposite of GkStringOp::stale_weight_sketch_key().
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param key The key, as found within the database.
+ * @param species_id The decoded Unique ID of the species.
+ * @param bucket The decoded bucket.
+ * @return Whether the key was a valid key or not.
+ */
+bool GkStringOp::decode_stale_weight_sketch_key(const std::string &key, std::string &species_id, long int &bucket)
+{
+    const std::string prefix(GkRecords::LEVELDB_INDEX_WEIGHT_STALE);
+    if ((key.size() < prefix.size() + 10) || (key.compare(0, prefix.size(), prefix) != 0) ||
+            (key[key.size() - 9] != '\0')) {
+        return false;
+    }
+
+    species_id = key.substr(prefix.size(), key.size() - 9 - prefix.size());
+    bucket = read_ordered(key, key.size() - 8);
+    return true;
+}
+
+/**
+ * @brief GkStringOp::animal_summary_key creates the key under which the rolling statistics of an animal are kept.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param name_id The Unique ID of the animal.
+ * @return The key, ready for use within the database.
+ */
+std::string GkStringOp::animal_summary_key(const std::string &name_id)
+{
+    std::string key(GkRecords::LEVELDB_INDEX_ANIMAL_SUMMARY);
+    key.append(name_id);
+    return key;
+}
+
+/**
+ * @brief GkStringOp::encode_animal_summary lays out the rolling statistics of an animal as a fixed run of big-endian
+ * fields, whereby the weights and sums keep to their IEEE 754 representations just as with GkStringOp::encode_weight().
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @see GkStringOp::decode_animal_summary()
+ */
+std::string GkStringOp::encode_animal_summary(const GkRecords::GkAnimalSummary &summary)
+{
+    std::string value;
+    value.reserve(ANIMAL_SUMMARY_BYTES);
+    value.append(encode_u64(summary.record_count));
+    value.append(encode_u64(static_cast<std::uint64_t>(summary.first_seen)));
+    value.append(encode_u64(static_cast<std::uint64_t>(summary.last_seen)));
+    value.append(encode_weight(summary.last_weight));
+    value.append(encode_weight(summary.weight_ewma));
+    value.append(encode_u64(static_cast<std::uint64_t>(summary.last_toilet)));
+    value.append(encode_u64(static_cast<std::uint64_t>(summary.last_hydration)));
+    value.append(encode_u64(static_cast<std::uint64_t>(summary.last_vitamins)));
+    value.append(encode_u64(static_cast<std::uint64_t>(summary.window_start)));
+    value.append(encode_u64(summary.window_count));
+    value.append(encode_weight(summary.window_sum_t));
+    value.append(encode_weight(summary.window_sum_w));
+    value.append(encode_weight(summary.window_sum_tt));
+    value.append(encode_weight(summary.window_sum_tw));
+    value.append(encode_u64(summary.delta_count));
+    value.append(encode_weight(summary.delta_mean));
+    value.append(encode_weight(summary.delta_var));
+    value.push_back(summary.stale ? '\x01' : '\x00');
+    return value;
+}
+
+/**
+ * @brief GkStringOp::decode_animal_summary does the opposite of GkStringOp::animal_summary_key() and
+ * GkStringOp::encode_animal_summary().
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param key The key, as found within the database.
+ * @param value The value stored alongside the key.
+ * @param summary The decoded statistics.
+ * @return Whether the key and value made for a valid summary or not.
+ */
+bool GkStringOp::decode_animal_summary(const std::string &key, const std::string &value,
+                                       GkRecords::GkAnimalSummary &summary)
+{
+    const std::string prefix(GkRecords::LEVELDB_INDEX_ANIMAL_SUMMARY);
+    if ((key.size() <= prefix.size()) || (key.compare(0, prefix.size(), prefix) != 0) ||
+            (value.size() != ANIMAL_SUMMARY_BYTES)) {
+        return false;
+    }
+
+    const auto decode_double = [this, &value](const std::size_t &offset) {
+        const std::uint64_t bits = decode_u64(value, offset);
+        double decoded = 0.0;
+        std::memcpy(&decoded, &bits, sizeof(bits));
+        return decoded;
+    };
+
+    summary.name_id = key.substr(prefix.size());
+    summary.record_count = decode_u64(value, 0);
+    summary.first_seen = static_cast<long int>(decode_u64(value, 8));
+    summary.last_seen = static_cast<long int>(decode_u64(value, 16));
+    summary.last_weight = decode_double(24);
+    summary.weight_ewma = decode_double(32);
+    summary.last_toilet = static_cast<long int>(decode_u64(value, 40));
+    summary.last_hydration = static_cast<long int>(decode_u64(value, 48));
+    summary.last_vitamins = static_cast<long int>(decode_u64(value, 56));
+    summary.window_start = static_cast<long int>(decode_u64(value, 64));
+    summary.window_count = decode_u64(value, 72);
+    summary.window_sum_t = decode_double(80);
+    summary.window_sum_w = decode_double(88);
+    summary.window_sum_tt = decode_double(96);
+    summary.window_sum_tw = decode_double(104);
+    summary.delta_count = decode_u64(value, 112);
+    summary.delta_mean = decode_double(120);
+    summary.delta_var = decode_double(128);
+    summary.stale = (value[136] != '\x00');
+    return true;
+}
+
+/**
+ * @brief GkStringOp::alert_key creates the key under which an alert waits to be acknowledged, whereby the alerts are
+ * kept in the order that they were raised.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param sequence The sequence number of the alert.
+ * @return The key, ready for use within the database.
+ */
+std::string GkStringOp::alert_key(const std::uint64_t &sequence)
+{
+    return std::string(GkRecords::LEVELDB_ALERT_QUEUE) + encode_u64(sequence);
+}
+
+/**
+ * @brief GkStringOp::encode_alert lays out an alert as its Date/Time, kind and score, followed by the Unique IDs of the
+ * animal and record with a NUL in between.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @see GkStringOp::decode_alert()
+ */
+std::string GkStringOp::encode_alert(const GkRecords::GkAlert &alert)
+{
+    std::string value = encode_u64(static_cast<std::uint64_t>(alert.date_time));
+    value.push_back(static_cast<char>(alert.kind));
+    value.append(encode_weight(alert.score));
+    value.append(alert.name_id);
+    value.push_back('\0');
+    value.append(alert.record_id);
+    return value;
+}
+
+/**
+ * @brief GkStringOp::decode_alert does the opposite of GkStringOp::alert_key() and GkStringOp::encode_alert().
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param key The key, as found within the database.
+ * @param value The value stored alongside the key.
+ * @param alert The decoded alert.
+ * @return Whether the key and value made for a valid alert or not.
+ */
+bool GkStringOp::decode_alert(const std::string &key, const std::string &value, GkRecords::GkAlert &alert)
+{
+    const std::string prefix(GkRecords::LEVELDB_ALERT_QUEUE);
+    if ((key.size() != prefix.size() + 8) || (key.compare(0, prefix.size(), prefix) != 0) || (value.size() < 17)) {
+        return false;
+    }
+
+    const std::size_t separator = value.find('\0', 17);
+    if (separator == std::string::npos) {
+        return false;
+    }
+
+    const std::uint64_t score_bits = decode_u64(value, 9);
+    alert.sequence = decode_u64(key, prefix.size());
+    alert.date_time = static_cast<long int>(decode_u64(value, 0));
+    alert.kind = static_cast<GkRecords::GkAlertKind>(value[8]);
+    std::memcpy(&alert.score, &score_bits, sizeof(score_bits));
+    alert.name_id = value.substr(17, separator - 17);
+    alert.record_id = value.substr(separator + 1);
+    return true;
+}
+
+/**
+ * @brief GkStringOp::series_prefix creates the prefix shared by the chunks of a single time-series, which is
+ * NUL-terminated for the same reasons as GkStringOp::animal_index_prefix().
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param series The name of the series, such as `viv-3/temperature`.
+ */
+std::string GkStringOp::series_prefix(const std::string &series)
+{
+    std::string key(GkRecords::LEVELDB_SERIES_CHUNK);
+    key.append(series);
+    key.push_back('\0');
+    return key;
+}
+
+/**
+ * @brief GkStringOp::series_chunk_key creates the key under which a compressed chunk of a time-series is kept, going
+ * by the Date/Time of its first reading, so that the chunks of a series sit next to one another in chronological order.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param series The name of the series.
+ * @param first_time The Date/Time of the first reading within the chunk, as UNIX Epoch Time.
+ * @return The key, ready for use within the database.
+ * @see GkSeriesChunk
+ */
+std::string GkStringOp::series_chunk_key(const std::string &series, const long int &first_time)
+{
+    std::string key = series_prefix(series);
+    append_ordered(key, first_time);
+    return key;
+}
+
+/**
+ * @brief GkStringOp::decode_series_chunk_key does the opposite of GkStringOp::series_chunk_key(), for any chunk at all,
+ * which is how the names of the series are found without knowing them beforehand.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param key The key, as found within the database.
+ * @param series The decoded name of the series.
+ * @param first_time The decoded Date/Time of the first reading within the chunk.
+ * @return Whether the key was a valid chunk key or not.
+ */
+bool GkStringOp::decode_series_chunk_key(const std::string &key, std::string &series, long int &first_time)
+{
+    const std::string prefix(GkRecords::LEVELDB_SERIES_CHUNK);
+    if ((key.size() < prefix.size() + 9) || (key.compare(0, prefix.size(), prefix) != 0) ||
+            (key[key.size() - 9] != '\0')) {
+        return false;
+    }
+
+    series = key.substr(prefix.size(), key.size() - prefix.size() - 9);
+    first_time = read_ordered(key, key.size() - 8);
+    return true;
+}
+
+/**
+ * @brief GkStringOp::attachment_ref_key creates the key under which the amount of records that refer to a photo is
+ * kept, so that the photo can be swept away from the disk once nothing refers to it any longer.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param hash The SHA-256 hash of the photo, in hexadecimal.
+ * @return The key, ready for use within the database.
+ * @see GkAttachmentStore
+ */
+std::string GkStringOp::attachment_ref_key(const std::string &hash)
+{
+    std::string key(GkRecords::LEVELDB_INDEX_ATTACHMENT_REF);
+    key.append(hash);
+    return key;
+}
+
+/**
+ * @brief GkStringOp::encode_attachments joins the hashes of the photos of a record into the single value that is kept
+ * alongside the other fields of the record. Only the hashes are kept there, never the photos themselves.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param hashes The SHA-256 hashes of the photos, in hexadecimal.
+ * @return The hashes, separated by commas.
+ */
+std::string GkStringOp::encode_attachments(const std::vector<std::string> &hashes)
+{
+    std::string value;
+    for (const auto &hash: hashes) {
+        if (!value.empty()) {
+            value.push_back(',');
+        }
+
+        value.append(hash);
+    }
+
+    return value;
+}
+
+/**
+ * @brief GkStringOp::decode_attachments does the opposite of GkStringOp::encode_attachments().
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param value The value, as found within the database.
+ * @return The SHA-256 hashes of the photos, in the order that they were attached.
+ */
+std::vector<std::string> GkStringOp::decode_attachments(const std::string &value)
+{
+    std::vector<std::string> hashes;
+    std::size_t start = 0;
+    while (start < value.size()) {
+        std::size_t end = value.find(',', start);
+        if (end == std::string::npos) {
+            end = value.size();
+        }
+
+        if (end > start) {
+            hashes.push_back(value.substr(start, end - start));
+        }
+
+        start = end + 1;
+    }
+
+    return hashes;
+}
+
+/**
+ * @brief GkStringOp::flag_row_key creates the key under which a record's row within the flag index is kept, going by
+ * its ordinal, so that the rows sit next to one another in the same order as the bits of the bitmaps.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param ordinal The ordinal of the record within the flag index.
+ * @return The key, ready for use within the database.
+ * @see GkFlagIndex
+ */
+std::string GkStringOp::flag_row_key(const std::uint32_t &ordinal)
+{
+    std::string key(GkRecords::LEVELDB_INDEX_FLAG_ROW);
+    key.append(encode_u64(ordinal).substr(4));
+    return key;
+}
+
+/**
+ * @brief GkStringOp::encode_flag_row lays out a record's row within the flag index as its ordered Date/Time and its
+ * flags, followed by the Unique IDs of the record and of its animal with a NUL in between.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @see GkStringOp::decode_flag_row()
+ */
+std::string GkStringOp::encode_flag_row(const GkRecords::GkFlagRow &row)
+{
+    std::string value;
+    append_ordered(value, row.date_time);
+    value.push_back(static_cast<char>(row.flags));
+    value.append(row.record_id);
+    value.push_back('\0');
+    value.append(row.name_id);
+    return value;
+}
+
+/**
+ * @brief GkStringOp::decode_flag_row does the opposite of GkStringOp::flag_row_key() and GkStringOp::encode_flag_row().
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param key The key, as found within the database.
+ * @param value The value stored alongside the key.
+ * @param row The decoded row.
+ * @return Whether the key and value made for a valid row or not.
+ */
+bool GkStringOp::decode_flag_row(const std::string &key, const std::string &value, GkRecords::GkFlagRow &row)
+{
+    const std::string prefix(GkRecords::LEVELDB_INDEX_FLAG_ROW);
+    if ((key.size() != prefix.size() + 4) || (key.compare(0, prefix.size(), prefix) != 0) || (value.size() < 11)) {
+        return false;
+    }
+
+    const std::size_t separator = value.find('\0', 9);
+    if ((separator == std::string::npos) || (separator == 9) || (separator + 1 == value.size())) {
+        return false;
+    }
+
+    row.ordinal = static_cast<std::uint32_t>(decode_u64(std::string(4, '\0') + key.substr(prefix.size())));
+    row.date_time = read_ordered(value, 0);
+    row.flags = static_cast<std::uint8_t>(value[8]);
+    row.record_id = value.substr(9, separator - 9);
+    row.name_id = value.substr(separator + 1);
+    return true;
+}
+
+/**
+ * @brief GkStringOp::flag_record_key creates the key under which the ordinal of a record within the flag index is
+ * kept, so that the record can be found again once it comes to be deleted.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param record_id The Unique ID of the record.
+ * @return The key, ready for use within the database.
+ */
+std::string GkStringOp::flag_record_key(const std::string &record_id)
+{
+    std::string key(GkRecords::LEVELDB_INDEX_FLAG_RECORD);
+    key.append(record_id);
+    return key;
+}
+
+/**
+ * @brief GkStringOp::flag_bitmap_key creates the key under which a single container of one of the flag index's bitmaps
+ * is kept, whereby a record only ever has to rewrite the 65,536 ordinals' worth of each bitmap that its own falls in.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param bitmap The name of the bitmap, as given by GkFlagIndex::bitmaps().
+ * @param chunk The upper 16-bits of the ordinals held within the container.
+ * @return The key, ready for use within the database.
+ */
+std::string GkStringOp::flag_bitmap_key(const std::string &bitmap, const std::uint16_t &chunk)
+{
+    std::string key(GkRecords::LEVELDB_INDEX_FLAG_BITMAP);
+    key.append(bitmap);
+    key.push_back('\0');
+    key.push_back(static_cast<char>(chunk >> 8));
+    key.push_back(static_cast<char>(chunk & 0xFF));
+    return key;
+}
+
+/**
+ * @brief GkStringOp::decode_flag_bitmap_key does the opposite of GkStringOp::flag_bitmap_key().
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param key The key, as found within the database.
+ * @param bitmap The decoded name of the bitmap.
+ * @param chunk The decoded upper 16-bits of the ordinals.
+ * @return Whether the key was a valid bitmap key or not.
+ */
+bool GkStringOp::decode_flag_bitmap_key(const std::string &key, std::string &bitmap, std::uint16_t &chunk)
+{
+    const std::string prefix(GkRecords::LEVELDB_INDEX_FLAG_BITMAP);
+    if ((key.size() < prefix.size() + 4) || (key.compare(0, prefix.size(), prefix) != 0) ||
+            (key[key.size() - 3] != '\0')) {
+        return false;
+    }
+
+    bitmap = key.substr(prefix.size(), key.size() - prefix.size() - 3);
+    chunk = static_cast<std::uint16_t>((static_cast<unsigned char>(key[key.size() - 2]) << 8) |
+                                       static_cast<unsigned char>(key[key.size() - 1]));
+    return true;
+}
+
+/**
+ * @brief GkStringOp::encode_flag_meta lays out how far along the flag index is with handing out its ordinals.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @see GkStringOp::decode_flag_meta()
+ */
+std::string GkStringOp::encode_flag_meta(const GkRecords::GkFlagIndexMeta &meta)
+{
+    return encode_u64(meta.next_ordinal) + encode_u64(meta.sorted_count) +
+            encode_u64(static_cast<std::uint64_t>(meta.last_sorted));
+}
+
+/**
+ * @brief GkStringOp::decode_flag_meta does the opposite of GkStringOp::encode_flag_meta().
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param value The value, as found within the database.
+ * @param meta The decoded progress of the flag index.
+ * @return Whether the value was valid or not.
+ */
+bool GkStringOp::decode_flag_meta(const std::string &value, GkRecords::GkFlagIndexMeta &meta)
+{
+    if (value.size() != 24) {
+        return false;
+    }
+
+    meta.next_ordinal = decode_u64(value, 0);
+    meta.sorted_count = decode_u64(value, 8);
+    meta.last_sorted = static_cast<long int>(decode_u64(value, 16));
+    return (meta.sorted_count <= meta.next_ordinal) &&
+            (meta.next_ordinal <= static_cast<std::uint64_t>(std::numeric_limits<std::uint32_t>::max()) + 1);
+}
+
+/**
+ * @brief GkStringOp::encode_u64 stores an unsigned integer as eight big-endian bytes.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param value The integer to be stored.
+ * @return The eight bytes.
+ */
+std::string GkStringOp::encode_u64(const std::uint64_t &value)
+{
+    std::string bytes;
+    bytes.reserve(8);
+    for (int shift = 56; shift >= 0; shift -= 8) {
+        bytes.push_back(static_cast<char>((value >> shift) & 0xFF));
+    }
+
+    return bytes;
+}
+
+/**
+ * @brief GkStringOp::decode_u64 does the opposite of GkStringOp::encode_u64().
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param value The bytes, as found within the database.
+ * @param offset Where within `value` the eight bytes begin.
+ * @return The integer, or zero if there aren't enough bytes.
+ */
+std::uint64_t GkStringOp::decode_u64(const std::string &value, const std::size_t &offset)
+{
+    if (value.size() < offset + 8) {
+        return 0;
+    }
+
+    std::uint64_t result = 0;
+    for (std::size_t i = 0; i < 8; ++i) {
+        result = (result << 8) | static_cast<unsigned char>(value[offset + i]);
+    }
+
+    return result;
+}
+
+/**
+ * @brief GkStringOp::tally_cat_deletions counts up how many Licensees, Species, Animal IDs and log entries would be
+ * removed from the Google LevelDB database, were the specified category (`Licensee`, `Species`, or `Animal ID`) to be
+ * deleted. It is up to the caller as to how the user is asked for confirmation.
  * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
  * @date 2018-03-21
- * @param uuid_cache The cache of UUIDs that have been passed on from the previous function.
- * @param record_id The specified and unique Record ID in question that's to be deleted.
+ * @param cat_struct The dependants of the category in question, as found by GkDbWrite::find_cat_dependants().
  * @param record_type The type of category we are dealing with in this instance (`Licensee`, `Species`, or `Animal ID`).
- * @return Whether the user wants to delete the specified categories in question (TRUE) or not (FALSE).
+ * @return The number of each kind of item that will be deleted.
  * @see GekkoFyre::GkDbWrite::mass_del_cat()
  */
-bool GkStringOp::del_cat_msg_box(const GkRecords::GkCategories &cat_struct, const GkRecords::MiscRecordType &record_type)
-{
-    try {
-        if ((!cat_struct.spec_record_id.empty())) {
-            using namespace GkRecords;
-            QMessageBox msgBox;
-            msgBox.setWindowTitle(tr("Proceed?"));
-            msgBox.setText(tr("Are you sure about deleting all of the specified `categories` and `log entries`?"));
-            msgBox.setStandardButtons(QMessageBox::YesToAll | QMessageBox::No | QMessageBox::Cancel);
-            msgBox.setDefaultButton(QMessageBox::No);
-            msgBox.setParent(nullptr);
-
-            int count_licensees = 0, count_species = 0, count_animal_ids = 0, count_log_entries = 0;
-            switch (record_type) {
-                case MiscRecordType::gkLicensee:
-                {
-                    count_licensees += 1;
-                    if ((!cat_struct.species_cache.empty()) && (!cat_struct.animals_cache.empty())) {
-                        QVector<std::string> unique_uuid_vec;
-                        QVector<std::string> unique_licensee_vec;
-                        QVector<std::string> unique_species_vec;
-                        QVector<std::string> unique_animals_vec;
-
-                        for (auto it = cat_struct.species_cache.begin(); it != cat_struct.species_cache.end(); ++it) {
-                            if (!unique_uuid_vec.contains(it.key())) {
-                                unique_uuid_vec.push_back(it.key());
-                            }
-
-                            if (!unique_licensee_vec.contains(it.value().first)) {
-                                unique_licensee_vec.push_back(it.value().first);
-                            }
-
-                            if (!unique_species_vec.contains(it.value().second)) {
-                                unique_species_vec.push_back(it.value().second);
-                            }
-                        }
-
-                        for (auto it = cat_struct.animals_cache.begin(); it != cat_struct.animals_cache.end(); ++it) {
-                            if (!unique_uuid_vec.contains(it.key())) {
-                                unique_uuid_vec.push_back(it.key());
-                            }
-
-                            if (!unique_animals_vec.contains(it.value().second)) {
-                                unique_animals_vec.push_back(it.value().second);
-                            }
-                        }
-
-                        // Calculate the numbers of each `category` that will be deleted
-                        count_licensees = unique_licensee_vec.size();
-                        count_species = unique_species_vec.size();
-                        count_animal_ids = unique_animals_vec.size();
-
-                        // Calculate the amount of `log entries` that will be deleted
-                        count_log_entries = unique_uuid_vec.size();
-                    } else {
-                        throw std::invalid_argument(tr("Cache is not initialized! It's empty!").toStdString());
+GkRecords::GkCatDeletionTally GkStringOp::tally_cat_deletions(const GkRecords::GkCategories &cat_struct,
+                                                              const GkRecords::MiscRecordType &record_type)
+{
+    if (cat_struct.spec_record_id.empty()) {
+        throw std::invalid_argument(tr("One of the given UUID caches are empty!").toStdString());
+    }
+
+    using namespace GkRecords;
+    GkCatDeletionTally tally;
+    int count_licensees = 0, count_species = 0, count_animal_ids = 0, count_log_entries = 0;
+    switch (record_type) {
+        case MiscRecordType::gkLicensee:
+        {
+            count_licensees += 1;
+            if ((!cat_struct.species_cache.empty()) && (!cat_struct.animals_cache.empty())) {
+                QVector<std::string> unique_uuid_vec;
+                QVector<std::string> unique_licensee_vec;
+                QVector<std::string> unique_species_vec;
+                QVector<std::string> unique_animals_vec;
+
+                for (auto it = cat_struct.species_cache.begin(); it != cat_struct.species_cache.end(); ++it) {
+                    if (!unique_uuid_vec.contains(it.key())) {
+                        unique_uuid_vec.push_back(it.key());
+                    }
+
+                    if (!unique_licensee_vec.contains(it.value().first)) {
+                        unique_licensee_vec.push_back(it.value().first);
+                    }
+
+                    if (!unique_species_vec.contains(it.value().second)) {
+                        unique_species_vec.push_back(it.value().second);
                     }
                 }
 
-                    break;
-                case MiscRecordType::gkSpecies:
-                {
-                    if ((!cat_struct.licensee_cache.empty()) && (!cat_struct.animals_cache.empty())) {
-                        QVector<std::string> unique_uuid_vec;
-                        QVector<std::string> unique_licensee_vec;
-                        QVector<std::string> unique_species_vec;
-                        QVector<std::string> unique_animals_vec;
-
-                        for (auto it = cat_struct.licensee_cache.begin(); it != cat_struct.licensee_cache.end(); ++it) {
-                            if (!unique_uuid_vec.contains(it.key())) {
-                                unique_uuid_vec.push_back(it.key());
-                            }
-
-                            if (!unique_licensee_vec.contains(it.value())) {
-                                unique_licensee_vec.push_back(it.value());
-                            }
-                        }
-
-                        for (auto it = cat_struct.animals_cache.begin(); it != cat_struct.animals_cache.end(); ++it) {
-                            if (!unique_uuid_vec.contains(it.key())) {
-                                unique_uuid_vec.push_back(it.key());
-                            }
-
-                            if (!unique_species_vec.contains(it.value().first)) {
-                                unique_species_vec.push_back(it.value().first);
-                            }
-
-                            if (!unique_animals_vec.contains(it.value().second)) {
-                                unique_animals_vec.push_back(it.value().second);
-                            }
-                        }
-
-                        // Calculate the numbers of each `category` that will be deleted
-                        count_licensees = unique_licensee_vec.size();
-                        count_species = unique_species_vec.size();
-                        count_animal_ids = unique_animals_vec.size();
-
-                        // Calculate the amount of `log entries` that will be deleted
-                        count_log_entries = unique_uuid_vec.size();
-                    } else {
-                        throw std::invalid_argument(tr("Cache is not initialized! It's empty!").toStdString());
+                for (auto it = cat_struct.animals_cache.begin(); it != cat_struct.animals_cache.end(); ++it) {
+                    if (!unique_uuid_vec.contains(it.key())) {
+                        unique_uuid_vec.push_back(it.key());
+                    }
+
+                    if (!unique_animals_vec.contains(it.value().second)) {
+                        unique_animals_vec.push_back(it.value().second);
                     }
                 }
 
-                    break;
-                case MiscRecordType::gkId:
-                {
-                    if ((!cat_struct.licensee_cache.empty()) && (!cat_struct.species_cache.empty())) {
-                        QVector<std::string> unique_uuid_vec;
-                        QVector<std::string> unique_licensee_vec;
-                        QVector<std::string> unique_species_vec;
-                        QVector<std::string> unique_animals_vec;
-
-                        for (auto it = cat_struct.licensee_cache.begin(); it != cat_struct.licensee_cache.end(); ++it) {
-                            if (!unique_uuid_vec.contains(it.key())) {
-                                unique_uuid_vec.push_back(it.key());
-                            }
-
-                            if (!unique_licensee_vec.contains(it.value())) {
-                                unique_licensee_vec.push_back(it.value());
-                            }
-                        }
-
-                        for (auto it = cat_struct.species_cache.begin(); it != cat_struct.species_cache.end(); ++it) {
-                            if (!unique_uuid_vec.contains(it.key())) {
-                                unique_uuid_vec.push_back(it.key());
-                            }
-
-                            if (!unique_species_vec.contains(it.value().first)) {
-                                unique_species_vec.push_back(it.value().first);
-                            }
-
-                            if (!unique_animals_vec.contains(it.value().second)) {
-                                unique_animals_vec.push_back(it.value().second);
-                            }
-                        }
-
-                        // Calculate the numbers of each `category` that will be deleted
-                        count_licensees = unique_licensee_vec.size();
-                        count_species = unique_species_vec.size();
-                        count_animal_ids = unique_animals_vec.size();
-
-                        // Calculate the amount of `log entries` that will be deleted
-                        count_log_entries = unique_uuid_vec.size();
-                    } else {
-                        throw std::invalid_argument(tr("Cache is not initialized! It's empty!").toStdString());
+                // Calculate the numbers of each `category` that will be deleted
+                count_licensees = unique_licensee_vec.size();
+                count_species = unique_species_vec.size();
+                count_animal_ids = unique_animals_vec.size();
+
+                // Calculate the amount of `log entries` that will be deleted
+                count_log_entries = unique_uuid_vec.size();
+            } else {
+                throw std::invalid_argument(tr("Cache is not initialized! It's empty!").toStdString());
+            }
+        }
+
+            break;
+        case MiscRecordType::gkSpecies:
+        {
+            if ((!cat_struct.licensee_cache.empty()) && (!cat_struct.animals_cache.empty())) {
+                QVector<std::string> unique_uuid_vec;
+                QVector<std::string> unique_licensee_vec;
+                QVector<std::string> unique_species_vec;
+                QVector<std::string> unique_animals_vec;
+
+                for (auto it = cat_struct.licensee_cache.begin(); it != cat_struct.licensee_cache.end(); ++it) {
+                    if (!unique_uuid_vec.contains(it.key())) {
+                        unique_uuid_vec.push_back(it.key());
+                    }
+
+                    if (!unique_licensee_vec.contains(it.value())) {
+                        unique_licensee_vec.push_back(it.value());
                     }
                 }
 
-                    break;
-                default:
-                    throw std::runtime_error(tr("Unable to perform calculation for deletion of records from the database!")
-                                                     .toStdString());
+                for (auto it = cat_struct.animals_cache.begin(); it != cat_struct.animals_cache.end(); ++it) {
+                    if (!unique_uuid_vec.contains(it.key())) {
+                        unique_uuid_vec.push_back(it.key());
+                    }
+
+                    if (!unique_species_vec.contains(it.value().first)) {
+                        unique_species_vec.push_back(it.value().first);
+                    }
+
+                    if (!unique_animals_vec.contains(it.value().second)) {
+                        unique_animals_vec.push_back(it.value().second);
+                    }
+                }
+
+                // Calculate the numbers of each `category` that will be deleted
+                count_licensees = unique_licensee_vec.size();
+                count_species = unique_species_vec.size();
+                count_animal_ids = unique_animals_vec.size();
+
+                // Calculate the amount of `log entries` that will be deleted
+                count_log_entries = unique_uuid_vec.size();
+            } else {
+                throw std::invalid_argument(tr("Cache is not initialized! It's empty!").toStdString());
             }
+        }
+
+            break;
+        case MiscRecordType::gkId:
+        {
+            if ((!cat_struct.licensee_cache.empty()) && (!cat_struct.species_cache.empty())) {
+                QVector<std::string> unique_uuid_vec;
+                QVector<std::string> unique_licensee_vec;
+                QVector<std::string> unique_species_vec;
+                QVector<std::string> unique_animals_vec;
+
+                for (auto it = cat_struct.licensee_cache.begin(); it != cat_struct.licensee_cache.end(); ++it) {
+                    if (!unique_uuid_vec.contains(it.key())) {
+                        unique_uuid_vec.push_back(it.key());
+                    }
+
+                    if (!unique_licensee_vec.contains(it.value())) {
+                        unique_licensee_vec.push_back(it.value());
+                    }
+                }
+
+                for (auto it = cat_struct.species_cache.begin(); it != cat_struct.species_cache.end(); ++it) {
+                    if (!unique_uuid_vec.contains(it.key())) {
+                        unique_uuid_vec.push_back(it.key());
+                    }
+
+                    if (!unique_species_vec.contains(it.value().first)) {
+                        unique_species_vec.push_back(it.value().first);
+                    }
+
+                    if (!unique_animals_vec.contains(it.value().second)) {
+                        unique_animals_vec.push_back(it.value().second);
+                    }
+                }
+
+                // Calculate the numbers of each `category` that will be deleted
+                count_licensees = unique_licensee_vec.size();
+                count_species = unique_species_vec.size();
+                count_animal_ids = unique_animals_vec.size();
 
-            msgBox.setDetailedText(tr("Total number of deletions include...\n\n%1 x Licensees\n%2 x Species\n%3 x Animal IDs\n\n%4 x Log entries")
-                                           .arg(QString::number(count_licensees))
-                                           .arg(QString::number(count_species))
-                                           .arg(QString::number(count_animal_ids))
-                                           .arg(QString::number(count_log_entries)));
-            int ret = msgBox.exec();
-            switch (ret) {
-                case QMessageBox::YesToAll:
-                    return true;
-                case QMessageBox::No:
-                    return false;
-                case QMessageBox::Cancel:
-                    return false;
-                default:
-                    // Should never be reached!
-                    throw std::invalid_argument(tr("Unable to read Unique Identifier from database!").toStdString());
+                // Calculate the amount of `log entries` that will be deleted
+                count_log_entries = unique_uuid_vec.size();
+            } else {
+                throw std::invalid_argument(tr("Cache is not initialized! It's empty!").toStdString());
             }
-        } else {
-            throw std::invalid_argument(tr("One of the given UUID caches are empty!").toStdString());
         }
-    } catch (const std::exception &e) {
-        QMessageBox::warning(nullptr, tr("Error!"), e.what(), QMessageBox::Ok);
+
+            break;
+        default:
+            throw std::runtime_error(tr("Unable to perform calculation for deletion of records from the database!")
+                                             .toStdString());
     }
 
-    return false;
+    tally.licensees = count_licensees;
+    tally.species = count_species;
+    tally.animal_ids = count_animal_ids;
+    tally.log_entries = count_log_entries;
+
+    return tally;
 }
@@ -46,6 +46,7 @@
 #include "options.hpp"
 #include <QtCore/QObject>
 #include <initializer_list>
+#include <cstdint>
 #include <string>
 #include <QMap>
 
@@ -61,7 +62,54 @@ public:
 
     std::string random_hash();
     std::string multipart_key(const std::initializer_list<std::string> &args);
-    bool del_cat_msg_box(const GkRecords::GkCategories &cat_struct, const GkRecords::MiscRecordType &record_type);
+    std::string unique_id_key(const std::string &record_id);
+    std::string cat_prefix(const GkRecords::MiscRecordType &record_type);
+    std::string cat_key(const GkRecords::MiscRecordType &record_type, const std::string &cat_id);
+    std::string encode_unique_ids(const GkRecords::MiscUniqueIds &ids);
+    bool decode_unique_ids(const std::string &value, GkRecords::MiscUniqueIds &ids);
+    std::string timestamp_index_key(const long int &date_time, const std::string &record_id);
+    bool decode_timestamp_index_key(const std::string &key, GkRecords::GkIndexEntry &entry);
+    std::string animal_index_prefix(const std::string &name_id);
+    std::string animal_index_key(const std::string &name_id, const long int &date_time, const std::string &record_id);
+    std::string encode_weight(const double &weight);
+    bool decode_animal_index_entry(const std::string &key, const std::string &value, const std::size_t &prefix_len,
+                                   GkRecords::GkAnimalIndexEntry &entry);
+    long int merge_bucket(const long int &date_time);
+    std::string record_hash_key(const long int &bucket, const std::string &record_id);
+    std::string bucket_digest_key(const long int &bucket);
+    bool decode_record_hash_key(const std::string &key, long int &bucket, std::string &record_id);
+    bool decode_bucket_digest_key(const std::string &key, long int &bucket);
+    std::uint64_t record_hash(const GkRecords::GkSubmit &submit);
+    std::uint64_t record_leaf(const std::string &record_id, const std::uint64_t &content_hash);
+    std::string weight_sketch_prefix(const std::string &species_id);
+    std::string weight_sketch_key(const std::string &species_id, const long int &bucket);
+    bool decode_weight_sketch_key(const std::string &key, const std::size_t &prefix_len, long int &bucket);
+    std::string stale_weight_sketch_key(const std::string &species_id, const long int &bucket);
+    bool decode_stale_weight_sketch_key(const std::string &key, std::string &species_id, long int &bucket);
+    std::string animal_summary_key(const std::string &name_id);
+    std::string encode_animal_summary(const GkRecords::GkAnimalSummary &summary);
+    bool decode_animal_summary(const std::string &key, const std::string &value, GkRecords::GkAnimalSummary &summary);
+    std::string alert_key(const std::uint64_t &sequence);
+    std::string encode_alert(const GkRecords::GkAlert &alert);
+    bool decode_alert(const std::string &key, const std::string &value, GkRecords::GkAlert &alert);
+    std::string series_prefix(const std::string &series);
+    std::string series_chunk_key(const std::string &series, const long int &first_time);
+    bool decode_series_chunk_key(const std::string &key, std::string &series, long int &first_time);
+    std::string attachment_ref_key(const std::string &hash);
+    std::string encode_attachments(const std::vector<std::string> &hashes);
+    std::vector<std::string> decode_attachments(const std::string &value);
+    std::string flag_row_key(const std::uint32_t &ordinal);
+    std::string encode_flag_row(const GkRecords::GkFlagRow &row);
+    bool decode_flag_row(const std::string &key, const std::string &value, GkRecords::GkFlagRow &row);
+    std::string flag_record_key(const std::string &record_id);
+    std::string flag_bitmap_key(const std::string &bitmap, const std::uint16_t &chunk);
+    bool decode_flag_bitmap_key(const std::string &key, std::string &bitmap, std::uint16_t &chunk);
+    std::string encode_flag_meta(const GkRecords::GkFlagIndexMeta &meta);
+    bool decode_flag_meta(const std::string &value, GkRecords::GkFlagIndexMeta &meta);
+    std::string encode_u64(const std::uint64_t &value);
+    std::uint64_t decode_u64(const std::string &value, const std::size_t &offset = 0);
+    GkRecords::GkCatDeletionTally tally_cat_deletions(const GkRecords::GkCategories &cat_struct,
+                                                      const GkRecords::MiscRecordType &record_type);
 };
 }
 
@@ -0,0 +1,472 @@
+/**
+ **  _   _                 _
+ ** | | | |               | |
+ ** | |_| | ___ _ __ _ __ | |     ___   __ _
+ ** |  _  |/ _ \ '__| '_ \| |    / _ \ / _` |
+ ** | | | |  __/ |  | |_) | |___| (_) | (_| |
+ ** \_| |_/\___|_|  | .__/\_____/\___/ \__, |
+ **                 | |                 __/ |
+ **                 |_|                |___/
+ **
+ **   Thank you for using "HerpLog" for your herpetology management requirements!
+ **   Copyright (C) 2017-2018. GekkoFyre.
+ **
+ **
+ **   HerpLog is free software: you can redistribute it and/or modify
+ **   it under the terms of the GNU General Public License as published by
+ **   the Free Software Foundation, either version 3 of the License, or
+ **   (at your option) any later version.
+ **
+ **   HerpLog is distributed in the hope that it will be useful,
+ **   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **   GNU General Public License for more details.
+ **
+ **   You should have received a copy of the GNU General Public License
+ **   along with HerpLog.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ **
+ **   The latest source code updates can be obtained from [ 1 ] below at your
+ **   discretion. A web-browser or the 'git' application may be required.
+ **
+ **   [ 1 ] - https://github.com/GekkoFyre/HerpLog
+ **
+ ********************************************************************************/
+
+/**
+ * @file gk_text_index.cpp
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @brief An inverted index over the notes of every log entry, so that they can be searched through by word, prefix or
+ * phrase without having to read each and every record.
+ */
+
+#include "gk_text_index.hpp"
+#include "gk_db_protocol.hpp"
+#include "gk_trace.hpp"
+#include <QString>
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+
+using namespace GekkoFyre;
+
+namespace {
+/**
+ * @brief The notes of a log entry which are indexed, in the order of the field numbers stored within each posting.
+ */
+const char *const indexed_fields[] = { GkRecords::furtherNotes, GkRecords::vitaminNotes, GkRecords::toiletNotes,
+                                       GkRecords::tempNotes, GkRecords::weightNotes, GkRecords::hydrationNotes };
+
+const std::string *notes_field(const GkRecords::GkSubmit &submit, const std::size_t &field)
+{
+    switch (field) {
+        case 0: return &submit.further_notes;
+        case 1: return &submit.vitamin_notes;
+        case 2: return &submit.toilet_notes;
+        case 3: return &submit.temp_notes;
+        case 4: return &submit.weight_notes;
+        case 5: return &submit.hydration_notes;
+        default: return nullptr;
+    }
+}
+
+/**
+ * @brief The GkSnapshot class holds a snapshot of the database for as long as a search runs, so that every term of a
+ * query is looked up against the very same state of it.
+ */
+class GkSnapshot {
+
+public:
+    explicit GkSnapshot(const std::shared_ptr<leveldb::DB> &database) : db(database), snapshot(database->GetSnapshot()) {}
+    ~GkSnapshot() { db->ReleaseSnapshot(snapshot); }
+
+    const leveldb::Snapshot *get() const { return snapshot; }
+
+private:
+    std::shared_ptr<leveldb::DB> db;
+    const leveldb::Snapshot *snapshot;
+};
+}
+
+GkTextIndex::GkTextIndex(const GkFile::FileDb &database, QObject *parent) : QObject(parent)
+{
+    db_conn = database;
+}
+
+GkTextIndex::~GkTextIndex()
+{}
+
+/**
+ * @brief GkTextIndex::search finds every log entry whose notes match the given query. Words separated by spaces must
+ * all be present (`AND` may be written out too, but needn't be), whilst `OR` separates alternatives. A word ending in
+ * `*` matches any word starting with it, and words within double-quotes must appear next to each other, in order and
+ * within the same field of notes.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param query The query, such as `regurg* OR "stuck shed" tail`.
+ * @return The Unique IDs of the matching records, in the order of their IDs.
+ */
+std::vector<std::string> GkTextIndex::search(const std::string &query)
+{
+    GkTraceSpan span("GkTextIndex::search", "db");
+    GkSnapshot snapshot(db_conn.db);
+    leveldb::ReadOptions read_opt;
+    read_opt.snapshot = snapshot.get();
+
+    std::vector<std::string> matches;
+    for (const auto &group: parse(query)) {
+        std::vector<std::string> candidates;
+        bool first = true;
+        for (const auto &clause: group) {
+            if (!first && candidates.empty()) {
+                break; // Nothing left to narrow down
+            }
+
+            if (clause.terms.size() > 1) {
+                candidates = match_phrase(read_opt, clause.terms, candidates, first);
+            } else if (first) {
+                candidates = scan_term(read_opt, clause.terms.front(), clause.prefix);
+            } else if (clause.prefix || (candidates.size() > HERPLOG_TEXT_SEEK_LIMIT)) {
+                std::vector<std::string> term_ids = scan_term(read_opt, clause.terms.front(), clause.prefix);
+                std::vector<std::string> both;
+                std::set_intersection(candidates.begin(), candidates.end(), term_ids.begin(), term_ids.end(),
+                                      std::back_inserter(both));
+                candidates.swap(both);
+            } else {
+                candidates = filter_term(read_opt, candidates, clause.terms.front());
+            }
+
+            first = false;
+        }
+
+        std::vector<std::string> either;
+        std::set_union(matches.begin(), matches.end(), candidates.begin(), candidates.end(), std::back_inserter(either));
+        matches.swap(either);
+    }
+
+    return matches;
+}
+
+/**
+ * @brief GkTextIndex::tokenise splits some text up into the terms that are indexed, being runs of letters and digits
+ * that have been case-folded, so that `Shed`, `SHED` and `shed` are all one and the same.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param text The text to be split up, in UTF-8.
+ * @return The terms, in the order that they appear within the text.
+ */
+std::vector<std::string> GkTextIndex::tokenise(const std::string &text)
+{
+    std::vector<std::string> terms;
+    const QString qtext = QString::fromStdString(text);
+    QString word;
+    for (int i = 0; i <= qtext.size(); ++i) {
+        if ((i < qtext.size()) && qtext.at(i).isLetterOrNumber()) {
+            word.append(qtext.at(i));
+            continue;
+        }
+
+        if (!word.isEmpty()) {
+            std::string term = word.toCaseFolded().toStdString();
+            if (term.size() <= HERPLOG_TEXT_TERM_MAX_BYTES) {
+                terms.push_back(term);
+            }
+
+            word.clear();
+        }
+    }
+
+    return terms;
+}
+
+/**
+ * @brief GkTextIndex::postings works out the entries a log entry has within the index, one for each distinct term of
+ * its notes. The value of each holds the positions of the term within every field it appears in, as deltas from one
+ * another; the Record IDs themselves follow one another in key order, and so share their prefixes within LevelDB's
+ * blocks of keys.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param record_id The Unique ID of the log entry.
+ * @param submit The log entry itself.
+ * @return The keys and values, ready to be either written or deleted within the same WriteBatch as the log entry.
+ */
+std::vector<std::pair<std::string, std::string>> GkTextIndex::postings(const std::string &record_id,
+                                                                         const GkRecords::GkSubmit &submit)
+{
+    // <Term, <Field, Positions>>
+    std::map<std::string, std::map<std::uint8_t, std::vector<std::uint64_t>>> occurrences;
+    for (std::size_t field = 0; field < sizeof(indexed_fields) / sizeof(indexed_fields[0]); ++field) {
+        const std::vector<std::string> terms = tokenise(*notes_field(submit, field));
+        for (std::size_t pos = 0; pos < terms.size(); ++pos) {
+            occurrences[terms[pos]][static_cast<std::uint8_t>(field)].push_back(pos);
+        }
+    }
+
+    std::vector<std::pair<std::string, std::string>> entries;
+    entries.reserve(occurrences.size());
+    for (const auto &term: occurrences) {
+        GkWireWriter value;
+        for (const auto &field: term.second) {
+            value.put_u8(field.first).put_varint(field.second.size());
+            std::uint64_t prev = 0;
+            for (const auto &pos: field.second) {
+                value.put_varint(pos - prev);
+                prev = pos;
+            }
+        }
+
+        entries.push_back(std::make_pair(posting_key(term.first, record_id), value.data()));
+    }
+
+    return entries;
+}
+
+/**
+ * @brief GkTextIndex::parse breaks a query up into groups of clauses, whereby every clause of a group must match and
+ * any one of the groups may.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ */
+std::vector<std::vector<GkTextIndex::GkClause>> GkTextIndex::parse(const std::string &query)
+{
+    std::vector<std::vector<GkClause>> groups(1);
+    std::size_t i = 0;
+    while (i < query.size()) {
+        if (std::isspace(static_cast<unsigned char>(query[i]))) {
+            ++i;
+            continue;
+        }
+
+        std::string word;
+        bool quoted = false;
+        if (query[i] == '"') {
+            const std::size_t close = query.find('"', i + 1);
+            word = query.substr(i + 1, (close == std::string::npos) ? std::string::npos : close - i - 1);
+            i = (close == std::string::npos) ? query.size() : close + 1;
+            quoted = true;
+        } else {
+            const std::size_t start = i;
+            while ((i < query.size()) && !std::isspace(static_cast<unsigned char>(query[i])) && (query[i] != '"')) {
+                ++i;
+            }
+
+            word = query.substr(start, i - start);
+        }
+
+        if (!quoted && (word == "OR")) {
+            if (!groups.back().empty()) {
+                groups.emplace_back();
+            }
+
+            continue;
+        } else if (!quoted && (word == "AND")) {
+            continue;
+        }
+
+        GkClause clause;
+        clause.prefix = !quoted && (word.size() > 1) && (word.back() == '*');
+        clause.terms = tokenise(word);
+        if (!clause.terms.empty()) {
+            groups.back().push_back(clause);
+        }
+    }
+
+    if (groups.back().empty()) {
+        groups.pop_back();
+    }
+
+    return groups;
+}
+
+/**
+ * @brief GkTextIndex::scan_term reads the whole posting list of a term, or of every term starting with it.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @return The Unique IDs of the records the term appears within, in order.
+ */
+std::vector<std::string> GkTextIndex::scan_term(const leveldb::ReadOptions &read_opt, const std::string &term,
+                                                const bool &prefix)
+{
+    const std::string key_prefix = prefix ? (std::string(GkRecords::LEVELDB_INDEX_TEXT) + term) : posting_key(term, "");
+    const std::size_t term_start = std::string(GkRecords::LEVELDB_INDEX_TEXT).size();
+
+    std::vector<std::string> record_ids;
+    std::unique_ptr<leveldb::Iterator> it(db_conn.db->NewIterator(read_opt));
+    for (it->Seek(key_prefix); it->Valid() && it->key().starts_with(key_prefix); it->Next()) {
+        const leveldb::Slice key = it->key();
+        const char *separator = static_cast<const char *>(std::memchr(key.data() + term_start, '\0',
+                                                                      key.size() - term_start));
+        if (separator != nullptr) {
+            record_ids.emplace_back(separator + 1, key.data() + key.size() - (separator + 1));
+        }
+    }
+
+    if (!it->status().ok()) {
+        throw std::runtime_error(it->status().ToString());
+    }
+
+    if (prefix) {
+        // Each of the matching terms has its own run of Record IDs
+        std::sort(record_ids.begin(), record_ids.end());
+        record_ids.erase(std::unique(record_ids.begin(), record_ids.end()), record_ids.end());
+    }
+
+    return record_ids;
+}
+
+/**
+ * @brief GkTextIndex::filter_term keeps only those candidates that the term appears within, by seeking to each of them
+ * in turn, which is much quicker than reading the whole posting list of a common term.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ */
+std::vector<std::string> GkTextIndex::filter_term(const leveldb::ReadOptions &read_opt,
+                                                  const std::vector<std::string> &candidates, const std::string &term)
+{
+    std::vector<std::string> record_ids;
+    std::unique_ptr<leveldb::Iterator> it(db_conn.db->NewIterator(read_opt));
+    for (const auto &record_id: candidates) {
+        const std::string key = posting_key(term, record_id);
+        it->Seek(key);
+        if (it->Valid() && (it->key() == leveldb::Slice(key))) {
+            record_ids.push_back(record_id);
+        }
+    }
+
+    if (!it->status().ok()) {
+        throw std::runtime_error(it->status().ToString());
+    }
+
+    return record_ids;
+}
+
+/**
+ * @brief GkTextIndex::match_phrase finds the records within which the terms of a phrase appear one straight after the
+ * other, within any one field of their notes. Should there only be a few candidates left already, then just their
+ * postings are looked up, otherwise the posting lists of the terms are read through in full alongside each other.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param terms The terms of the phrase, in order.
+ * @param candidates The records that have matched the query so far.
+ * @param unconstrained Whether this is the first clause, and so there are no candidates to speak of yet.
+ * @return The Unique IDs of the records that the phrase appears within, in order.
+ */
+std::vector<std::string> GkTextIndex::match_phrase(const leveldb::ReadOptions &read_opt,
+                                                   const std::vector<std::string> &terms,
+                                                   const std::vector<std::string> &candidates, const bool &unconstrained)
+{
+    // <Record ID, Postings of each term so far>
+    std::vector<std::pair<std::string, std::vector<std::string>>> matched;
+    if (!unconstrained && (candidates.size() <= HERPLOG_TEXT_SEEK_LIMIT)) {
+        for (const auto &record_id: candidates) {
+            std::vector<std::string> values;
+            for (const auto &term: terms) {
+                std::string value;
+                leveldb::Status s = db_conn.db->Get(read_opt, posting_key(term, record_id), &value);
+                if (s.IsNotFound()) {
+                    break;
+                } else if (!s.ok()) {
+                    throw std::runtime_error(s.ToString());
+                }
+
+                values.push_back(value);
+            }
+
+            if (values.size() == terms.size()) {
+                matched.emplace_back(record_id, std::move(values));
+            }
+        }
+    } else {
+        for (std::size_t i = 0; i < terms.size(); ++i) {
+            const std::string key_prefix = posting_key(terms[i], "");
+            std::vector<std::pair<std::string, std::vector<std::string>>> next;
+            auto prev = matched.begin();
+            std::unique_ptr<leveldb::Iterator> it(db_conn.db->NewIterator(read_opt));
+            for (it->Seek(key_prefix); it->Valid() && it->key().starts_with(key_prefix); it->Next()) {
+                const std::string record_id(it->key().data() + key_prefix.size(), it->key().size() - key_prefix.size());
+                if (i == 0) {
+                    if (unconstrained || std::binary_search(candidates.begin(), candidates.end(), record_id)) {
+                        next.emplace_back(record_id, std::vector<std::string>(1, it->value().ToString()));
+                    }
+
+                    continue;
+                }
+
+                while ((prev != matched.end()) && (prev->first < record_id)) {
+                    ++prev;
+                }
+
+                if ((prev != matched.end()) && (prev->first == record_id)) {
+                    prev->second.push_back(it->value().ToString());
+                    next.push_back(std::move(*prev));
+                    ++prev;
+                }
+            }
+
+            if (!it->status().ok()) {
+                throw std::runtime_error(it->status().ToString());
+            }
+
+            matched.swap(next);
+            if (matched.empty()) {
+                break;
+            }
+        }
+    }
+
+    std::vector<std::string> record_ids;
+    for (const auto &record: matched) {
+        std::vector<std::map<std::uint8_t, std::vector<std::uint64_t>>> positions;
+        for (const auto &value: record.second) {
+            positions.push_back(decode_positions(value));
+        }
+
+        bool found = false;
+        for (auto field = positions.front().begin(); (field != positions.front().end()) && !found; ++field) {
+            for (auto start = field->second.begin(); (start != field->second.end()) && !found; ++start) {
+                found = true;
+                for (std::size_t i = 1; (i < positions.size()) && found; ++i) {
+                    auto next = positions[i].find(field->first);
+                    found = (next != positions[i].end()) &&
+                            std::binary_search(next->second.begin(), next->second.end(), *start + i);
+                }
+            }
+        }
+
+        if (found) {
+            record_ids.push_back(record.first);
+        }
+    }
+
+    return record_ids;
+}
+
+std::string GkTextIndex::posting_key(const std::string &term, const std::string &record_id)
+{
+    std::string key(GkRecords::LEVELDB_INDEX_TEXT);
+    key.append(term);
+    key.push_back('\0');
+    key.append(record_id);
+    return key;
+}
+
+std::map<std::uint8_t, std::vector<std::uint64_t>> GkTextIndex::decode_positions(const std::string &value)
+{
+    std::map<std::uint8_t, std::vector<std::uint64_t>> fields;
+    GkWireReader in(value);
+    while (!in.at_end()) {
+        std::vector<std::uint64_t> &positions = fields[in.get_u8()];
+        const std::uint64_t count = in.get_varint();
+        std::uint64_t pos = 0;
+        for (std::uint64_t i = 0; i < count; ++i) {
+            pos += in.get_varint();
+            positions.push_back(pos);
+        }
+    }
+
+    return fields;
+}
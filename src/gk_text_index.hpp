@@ -0,0 +1,93 @@
+/**
+ **  _   _                 _
+ ** | | | |               | |
+ ** | |_| | ___ _ __ _ __ | |     ___   __ _
+ ** |  _  |/ _ \ '__| '_ \| |    / _ \ / _` |
+ ** | | | |  __/ |  | |_) | |___| (_) | (_| |
+ ** \_| |_/\___|_|  | .__/\_____/\___/ \__, |
+ **                 | |                 __/ |
+ **                 |_|                |___/
+ **
+ **   Thank you for using "HerpLog" for your herpetology management requirements!
+ **   Copyright (C) 2017-2018. GekkoFyre.
+ **
+ **
+ **   HerpLog is free software: you can redistribute it and/or modify
+ **   it under the terms of the GNU General Public License as published by
+ **   the Free Software Foundation, either version 3 of the License, or
+ **   (at your option) any later version.
+ **
+ **   HerpLog is distributed in the hope that it will be useful,
+ **   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **   GNU General Public License for more details.
+ **
+ **   You should have received a copy of the GNU General Public License
+ **   along with HerpLog.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ **
+ **   The latest source code updates can be obtained from [ 1 ] below at your
+ **   discretion. A web-browser or the 'git' application may be required.
+ **
+ **   [ 1 ] - https://github.com/GekkoFyre/HerpLog
+ **
+ ********************************************************************************/
+
+/**
+ * @file gk_text_index.hpp
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @brief An inverted index over the notes of every log entry, so that they can be searched through by word, prefix or
+ * phrase without having to read each and every record.
+ */
+
+#ifndef GK_TEXT_INDEX_HPP
+#define GK_TEXT_INDEX_HPP
+
+#include "options.hpp"
+#include <leveldb/db.h>
+#include <QtCore/QObject>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace GekkoFyre {
+class GkTextIndex;
+
+class GkTextIndex : public QObject {
+    Q_OBJECT
+
+public:
+    explicit GkTextIndex(const GkFile::FileDb &database, QObject *parent = nullptr);
+    ~GkTextIndex();
+
+    std::vector<std::string> search(const std::string &query);
+
+    static std::vector<std::string> tokenise(const std::string &text);
+    static std::vector<std::pair<std::string, std::string>> postings(const std::string &record_id,
+                                                                      const GkRecords::GkSubmit &submit);
+
+private:
+    // A single word, prefix (e.g. `regurg*`) or phrase (e.g. `"stuck shed"`) within a query
+    struct GkClause {
+        std::vector<std::string> terms;
+        bool prefix;
+    };
+
+    std::vector<std::vector<GkClause>> parse(const std::string &query);
+    std::vector<std::string> scan_term(const leveldb::ReadOptions &read_opt, const std::string &term,
+                                       const bool &prefix);
+    std::vector<std::string> filter_term(const leveldb::ReadOptions &read_opt, const std::vector<std::string> &candidates,
+                                         const std::string &term);
+    std::vector<std::string> match_phrase(const leveldb::ReadOptions &read_opt, const std::vector<std::string> &terms,
+                                          const std::vector<std::string> &candidates, const bool &unconstrained);
+
+    static std::string posting_key(const std::string &term, const std::string &record_id);
+    static std::map<std::uint8_t, std::vector<std::uint64_t>> decode_positions(const std::string &value);
+
+    GkFile::FileDb db_conn;
+};
+}
+
+#endif // GK_TEXT_INDEX_HPP
@@ -0,0 +1,579 @@
+/**
+ **  _   _                 _
+ ** | | | |               | |
+ ** | |_| | ___ _ __ _ __ | |     ___   __ _
+ ** |  _  |/ _ \ '__| '_ \| |    / _ \ / _` |
+ ** | | | |  __/ |  | |_) | |___| (_) | (_| |
+ ** \_| |_/\___|_|  | .__/\_____/\___/ \__, |
+ **                 | |                 __/ |
+ **                 |_|                |___/
+ **
+ **   Thank you for using "HerpLog" for your herpetology management requirements!
+ **   Copyright (C) 2017-2018. GekkoFyre.
+ **
+ **
+ **   HerpLog is free software: you can redistribute it and/or modify
+ **   it under the terms of the GNU General Public License as published by
+ **   the Free Software Foundation, either version 3 of the License, or
+ **   (at your option) any later version.
+ **
+ **   HerpLog is distributed in the hope that it will be useful,
+ **   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **   GNU General Public License for more details.
+ **
+ **   You should have received a copy of the GNU General Public License
+ **   along with HerpLog.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ **
+ **   The latest source code updates can be obtained from [ 1 ] below at your
+ **   discretion. A web-browser or the 'git' application may be required.
+ **
+ **   [ 1 ] - https://github.com/GekkoFyre/HerpLog
+ **
+ ********************************************************************************/
+
+/**
+ * @file gk_time_series.cpp
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @brief Keeps the readings of enclosure probes, such as temperature and humidity, as compressed chunks of numeric
+ * time-series, and reads them back by range or downsampled into buckets.
+ */
+
+#include "gk_time_series.hpp"
+#include "gk_series_chunk.hpp"
+#include "gk_remote_db.hpp"
+#include "gk_trace.hpp"
+#include <QDateTime>
+#include <QString>
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <exception>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+
+using namespace GekkoFyre;
+
+GkTimeSeries::GkTimeSeries(const GkFile::FileDb &database, const std::shared_ptr<GkStringOp> &gk_str_op,
+                           QObject *parent) : QObject(parent)
+{
+    db_conn = database;
+    gkStrOp = gk_str_op;
+}
+
+GkTimeSeries::~GkTimeSeries()
+{}
+
+/**
+ * @brief GkTimeSeries::import_file reads in the readings of a file exported from the enclosure probes, writing them out
+ * a million or so at a time. Either of two formats are understood, going by the first line of the file:
+ *   - CSV, whose header names a Date/Time column followed by one column per measurement, e.g.
+ *     `time,temperature,humidity`, each of which becomes the series `<subject>/<column>`.
+ *   - InfluxDB line protocol, e.g. `viv-3,probe=basking temperature=31.5,humidity=48 1760832000000000000`, whereby each
+ *     field becomes the series `<measurement and tags>/<field>`, or `<subject>/<field>` if a subject was given.
+ * The Date/Times may be UNIX Epoch Time in seconds, milliseconds, microseconds or nanoseconds, or ISO 8601.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param file_path The file to be imported.
+ * @param subject The enclosure or animal that the readings belong to.
+ * @return How many readings were imported. Lines that could not be made sense of are skipped.
+ */
+std::size_t GkTimeSeries::import_file(const std::string &file_path, const std::string &subject)
+{
+    using namespace GkSeries;
+    GkTraceSpan span("GkTimeSeries::import_file", "db");
+    std::ifstream in(file_path, std::ios::in | std::ios::binary);
+    if (!in.is_open()) {
+        throw std::runtime_error(tr("Unable to open the file, \"%1\", for importing!")
+                                 .arg(QString::fromStdString(file_path)).toStdString());
+    }
+
+    enum class GkFormat { Unknown, Csv, LineProtocol };
+    GkFormat format = GkFormat::Unknown;
+    std::unordered_map<std::string, std::vector<GkSeriesPoint>> pending;
+    std::vector<std::vector<GkSeriesPoint> *> csv_columns; // Looked up the once, rather than upon every line
+    std::size_t buffered = 0;
+    std::size_t imported = 0;
+
+    std::string line;
+    while (std::getline(in, line)) {
+        if (!line.empty() && (line.back() == '\r')) {
+            line.pop_back();
+        }
+
+        if (line.empty() || (line[0] == '#')) {
+            continue;
+        }
+
+        if (format == GkFormat::Unknown) {
+            const std::size_t space = line.find(' ');
+            if ((space != std::string::npos) && (line.find('=', space) != std::string::npos)) {
+                format = GkFormat::LineProtocol;
+            } else {
+                format = GkFormat::Csv;
+                std::size_t start = line.find(',');
+                while (start != std::string::npos) {
+                    const std::size_t end = line.find(',', start + 1);
+                    const std::string column = line.substr(start + 1, (end == std::string::npos) ? std::string::npos :
+                                                                                                   end - start - 1);
+                    csv_columns.push_back(&pending[subject + "/" + column]);
+                    start = end;
+                }
+
+                continue;
+            }
+        }
+
+        long int date_time = 0;
+        if (format == GkFormat::Csv) {
+            const std::size_t comma = line.find(',');
+            if ((comma == std::string::npos) || !parse_time(line.substr(0, comma), date_time)) {
+                continue;
+            }
+
+            const char *pos = line.c_str() + comma;
+            for (std::size_t column = 0; (column < csv_columns.size()) && (*pos == ','); ++column) {
+                char *end = nullptr;
+                const double value = std::strtod(pos + 1, &end);
+                if ((end != pos + 1) && !std::isnan(value)) {
+                    csv_columns[column]->push_back({ date_time, value });
+                    ++buffered;
+                }
+
+                pos = end;
+                while ((*pos != ',') && (*pos != '\0')) {
+                    ++pos; // Skips over an empty or non-numeric column
+                }
+            }
+        } else {
+            const std::size_t key_end = line.find(' ');
+            if (key_end == std::string::npos) {
+                continue;
+            }
+
+            const std::size_t fields_end = line.find(' ', key_end + 1);
+            if (fields_end == std::string::npos) {
+                date_time = static_cast<long int>(QDateTime::currentDateTime().toTime_t());
+            } else if (!parse_time(line.substr(fields_end + 1), date_time)) {
+                continue;
+            }
+
+            const std::string series_key = subject.empty() ? line.substr(0, key_end) : subject;
+            const std::string fields = line.substr(key_end + 1, (fields_end == std::string::npos) ? std::string::npos :
+                                                                                                    fields_end - key_end - 1);
+            std::size_t start = 0;
+            while (start < fields.size()) {
+                std::size_t end = fields.find(',', start);
+                end = (end == std::string::npos) ? fields.size() : end;
+                const std::size_t equals = fields.find('=', start);
+                if ((equals != std::string::npos) && (equals < end)) {
+                    char *value_end = nullptr;
+                    const char *value_begin = fields.c_str() + equals + 1;
+                    const double value = std::strtod(value_begin, &value_end);
+                    if ((value_end != value_begin) && !std::isnan(value)) { // Strings and booleans are skipped over
+                        pending[series_key + "/" + fields.substr(start, equals - start)].push_back({ date_time, value });
+                        ++buffered;
+                    }
+                }
+
+                start = end + 1;
+            }
+        }
+
+        if (buffered >= HERPLOG_SERIES_IMPORT_BATCH) {
+            flush_points(pending);
+            imported += buffered;
+            buffered = 0;
+        }
+    }
+
+    flush_points(pending);
+    imported += buffered;
+    return imported;
+}
+
+/**
+ * @brief GkTimeSeries::write_points adds the given readings to a series, whereby any reading at the same Date/Time as
+ * one already within the series takes its place.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param series The name of the series, such as `viv-3/temperature`.
+ * @param points The readings, in any order.
+ */
+void GkTimeSeries::write_points(const std::string &series, std::vector<GkSeries::GkSeriesPoint> points)
+{
+    std::unordered_map<std::string, std::vector<GkSeries::GkSeriesPoint>> pending;
+    pending[series] = std::move(points);
+    flush_points(pending);
+    return;
+}
+
+/**
+ * @brief GkTimeSeries::read_range decompresses the readings of a series within the given range, only touching upon the
+ * chunks that overlap with it.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param series The name of the series.
+ * @param dateStart The beginning of the range, as UNIX Epoch Time.
+ * @param dateEnd The end of the range, inclusive.
+ * @return The readings, in chronological order.
+ */
+std::vector<GkSeries::GkSeriesPoint> GkTimeSeries::read_range(const std::string &series, const long int &dateStart,
+                                                              const long int &dateEnd)
+{
+    GkTraceSpan span("GkTimeSeries::read_range", "db");
+    const std::string prefix = gkStrOp->series_prefix(series);
+    leveldb::ReadOptions read_opt;
+    read_opt.fill_cache = false;
+
+    std::vector<GkSeries::GkSeriesPoint> points;
+    std::unique_ptr<leveldb::Iterator> it = seek_chunk(read_opt, series, dateStart);
+    for (; it->Valid() && it->key().starts_with(prefix); it->Next()) {
+        GkSeriesChunk chunk;
+        if (!GkSeriesChunk::deserialise(it->value().ToString(), chunk) || !chunk.decode(dateStart, dateEnd, points)) {
+            throw std::runtime_error(tr("A chunk of the time-series, \"%1\", is damaged!")
+                                     .arg(QString::fromStdString(series)).toStdString());
+        }
+
+        if (chunk.last_time() >= dateEnd) {
+            break;
+        }
+    }
+
+    if (!it->status().ok()) {
+        throw std::runtime_error(it->status().ToString());
+    }
+
+    return points;
+}
+
+/**
+ * @brief GkTimeSeries::downsample sums up the readings of a series within the given range into buckets of time, for
+ * the charting of ranges far longer than there are pixels to show them with. A chunk that lies wholly within a single
+ * bucket is summed up from its header alone, without being decompressed.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param series The name of the series.
+ * @param dateStart The beginning of the range, as UNIX Epoch Time.
+ * @param dateEnd The end of the range, inclusive.
+ * @param bucket_seconds How long each bucket is, whereby the buckets are aligned to the UNIX Epoch.
+ * @return The buckets that have any readings within them, in chronological order.
+ */
+std::vector<GkSeries::GkSeriesBucket> GkTimeSeries::downsample(const std::string &series, const long int &dateStart,
+                                                               const long int &dateEnd, const long int &bucket_seconds)
+{
+    using namespace GkSeries;
+    GkTraceSpan span("GkTimeSeries::downsample", "db");
+    const long int width = std::max(1L, bucket_seconds);
+    const auto bucket_of = [width](const long int &date_time) {
+        const long int remainder = date_time % width;
+        return date_time - ((remainder < 0) ? remainder + width : remainder);
+    };
+
+    std::vector<GkSeriesBucket> buckets;
+    const auto add = [&buckets](const long int &bucket, const std::uint64_t &count, const double &minimum,
+                                const double &maximum, const double &sum) {
+        if (buckets.empty() || (buckets.back().bucket != bucket)) {
+            buckets.push_back({ bucket, 0, minimum, maximum, 0.0 });
+        }
+
+        GkSeriesBucket &last = buckets.back();
+        last.mean += sum; // Summed up for now, and divided through once every reading has been added
+        last.count += count;
+        last.minimum = std::min(last.minimum, minimum);
+        last.maximum = std::max(last.maximum, maximum);
+    };
+
+    const std::string prefix = gkStrOp->series_prefix(series);
+    leveldb::ReadOptions read_opt;
+    read_opt.fill_cache = false;
+
+    std::vector<GkSeriesPoint> points;
+    std::unique_ptr<leveldb::Iterator> it = seek_chunk(read_opt, series, dateStart);
+    for (; it->Valid() && it->key().starts_with(prefix); it->Next()) {
+        GkSeriesChunk chunk;
+        if (!GkSeriesChunk::deserialise(it->value().ToString(), chunk)) {
+            throw std::runtime_error(tr("A chunk of the time-series, \"%1\", is damaged!")
+                                     .arg(QString::fromStdString(series)).toStdString());
+        }
+
+        if (chunk.first_time() > dateEnd) {
+            break;
+        }
+
+        if ((chunk.first_time() >= dateStart) && (chunk.last_time() <= dateEnd) &&
+                (bucket_of(chunk.first_time()) == bucket_of(chunk.last_time()))) {
+            add(bucket_of(chunk.first_time()), chunk.count(), chunk.minimum(), chunk.maximum(), chunk.sum());
+            continue;
+        }
+
+        points.clear();
+        if (!chunk.decode(dateStart, dateEnd, points)) {
+            throw std::runtime_error(tr("A chunk of the time-series, \"%1\", is damaged!")
+                                     .arg(QString::fromStdString(series)).toStdString());
+        }
+
+        for (const auto &point: points) {
+            add(bucket_of(point.date_time), 1, point.value, point.value, point.value);
+        }
+    }
+
+    if (!it->status().ok()) {
+        throw std::runtime_error(it->status().ToString());
+    }
+
+    for (auto &bucket: buckets) {
+        bucket.mean /= static_cast<double>(bucket.count);
+    }
+
+    return buckets;
+}
+
+/**
+ * @brief GkTimeSeries::list_series gives the names of every series within the database, by seeking from one to the next
+ * rather than reading each and every chunk.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ */
+std::vector<std::string> GkTimeSeries::list_series()
+{
+    const std::string prefix(GkRecords::LEVELDB_SERIES_CHUNK);
+    leveldb::ReadOptions read_opt;
+    read_opt.fill_cache = false;
+
+    std::vector<std::string> series_names;
+    std::unique_ptr<leveldb::Iterator> it(db_conn.db->NewIterator(read_opt));
+    it->Seek(prefix);
+    while (it->Valid() && it->key().starts_with(prefix)) {
+        std::string series;
+        long int first_time = 0;
+        if (!gkStrOp->decode_series_chunk_key(it->key().ToString(), series, first_time)) {
+            it->Next();
+            continue;
+        }
+
+        series_names.push_back(series);
+        std::string next_series = gkStrOp->series_prefix(series);
+        next_series.back() = '\x01'; // Just past the very last chunk of this series
+        it->Seek(next_series);
+    }
+
+    if (!it->status().ok()) {
+        throw std::runtime_error(it->status().ToString());
+    }
+
+    return series_names;
+}
+
+/**
+ * @brief GkTimeSeries::merge_points merges the given readings into the chunks of a series. Only the chunks that overlap
+ * with the readings are rewritten, along with the one just before them if it has room to spare, so appending to the end
+ * of a series fills up its last chunk before starting upon another.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param batch The WriteBatch that the chunks are to be written within.
+ * @param series The name of the series.
+ * @param points The readings, which get sorted with any duplicate Date/Times removed, the last of them winning.
+ */
+void GkTimeSeries::merge_points(leveldb::WriteBatch &batch, const std::string &series,
+                                std::vector<GkSeries::GkSeriesPoint> &points)
+{
+    using namespace GkSeries;
+    std::stable_sort(points.begin(), points.end(), [](const GkSeriesPoint &lhs, const GkSeriesPoint &rhs) {
+        return lhs.date_time < rhs.date_time;
+    });
+
+    std::vector<GkSeriesPoint> incoming;
+    incoming.reserve(points.size());
+    for (const auto &point: points) {
+        if (!incoming.empty() && (incoming.back().date_time == point.date_time)) {
+            incoming.back() = point;
+        } else {
+            incoming.push_back(point);
+        }
+    }
+
+    if (incoming.empty()) {
+        return;
+    }
+
+    const long int first = incoming.front().date_time;
+    const long int last = incoming.back().date_time;
+    const std::string prefix = gkStrOp->series_prefix(series);
+    leveldb::ReadOptions read_opt;
+    read_opt.fill_cache = false;
+
+    std::vector<GkSeriesPoint> existing;
+    std::unique_ptr<leveldb::Iterator> it = seek_chunk(read_opt, series, first);
+    for (; it->Valid() && it->key().starts_with(prefix); it->Next()) {
+        GkSeriesChunk chunk;
+        if (!GkSeriesChunk::deserialise(it->value().ToString(), chunk)) {
+            throw std::runtime_error(tr("A chunk of the time-series, \"%1\", is damaged!")
+                                     .arg(QString::fromStdString(series)).toStdString());
+        }
+
+        if (chunk.first_time() > last) {
+            break;
+        }
+
+        if ((chunk.last_time() < first) && chunk.full()) {
+            continue; // Nothing to add to it
+        }
+
+        if (!chunk.decode(std::numeric_limits<long int>::min(), std::numeric_limits<long int>::max(), existing)) {
+            throw std::runtime_error(tr("A chunk of the time-series, \"%1\", is damaged!")
+                                     .arg(QString::fromStdString(series)).toStdString());
+        }
+
+        batch.Delete(it->key());
+    }
+
+    if (!it->status().ok()) {
+        throw std::runtime_error(it->status().ToString());
+    }
+
+    GkSeriesChunk chunk;
+    const auto append = [&](const GkSeriesPoint &point) {
+        if (chunk.full()) {
+            batch.Put(gkStrOp->series_chunk_key(series, chunk.first_time()), chunk.serialise());
+            chunk = GkSeriesChunk();
+        }
+
+        chunk.append(point.date_time, point.value);
+    };
+
+    auto old_point = existing.begin();
+    for (const auto &point: incoming) {
+        for (; (old_point != existing.end()) && (old_point->date_time < point.date_time); ++old_point) {
+            append(*old_point);
+        }
+
+        if ((old_point != existing.end()) && (old_point->date_time == point.date_time)) {
+            ++old_point; // Replaced by the new reading
+        }
+
+        append(point);
+    }
+
+    for (; old_point != existing.end(); ++old_point) {
+        append(*old_point);
+    }
+
+    batch.Put(gkStrOp->series_chunk_key(series, chunk.first_time()), chunk.serialise());
+    return;
+}
+
+/**
+ * @brief GkTimeSeries::flush_points writes out the readings that have been held onto for each series, within a single
+ * WriteBatch, and then empties them out again whilst keeping the series themselves around.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param pending The readings of each series, keyed by the name of the series.
+ */
+void GkTimeSeries::flush_points(std::unordered_map<std::string, std::vector<GkSeries::GkSeriesPoint>> &pending)
+{
+    GkTraceSpan span("GkTimeSeries::flush_points", "db");
+    std::lock_guard<std::mutex> locker(write_mutex);
+
+    // As with GkDbWrite, hold onto the service's write lease between reading the last chunks and writing them back
+    GkRemoteDb *remote_db = GkRemoteDb::from(db_conn);
+    if (remote_db != nullptr) {
+        remote_db->acquire_lease();
+    }
+
+    try {
+        leveldb::WriteBatch batch;
+        for (auto &series: pending) {
+            merge_points(batch, series.first, series.second);
+            series.second.clear();
+        }
+
+        leveldb::Status s = db_conn.db->Write(leveldb::WriteOptions(), &batch);
+        if (!s.ok()) {
+            throw std::runtime_error(s.ToString());
+        }
+    } catch (...) {
+        if (remote_db != nullptr) {
+            remote_db->release_lease();
+        }
+
+        throw;
+    }
+
+    if (remote_db != nullptr) {
+        remote_db->release_lease();
+    }
+
+    return;
+}
+
+/**
+ * @brief GkTimeSeries::seek_chunk positions an iterator upon the chunk of a series that the given Date/Time would fall
+ * within, which is the last one to begin at or before it, or otherwise upon the first chunk after it.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ */
+std::unique_ptr<leveldb::Iterator> GkTimeSeries::seek_chunk(const leveldb::ReadOptions &read_opt,
+                                                            const std::string &series, const long int &date_time)
+{
+    const std::string prefix = gkStrOp->series_prefix(series);
+    const std::string key = gkStrOp->series_chunk_key(series, date_time);
+    std::unique_ptr<leveldb::Iterator> it(db_conn.db->NewIterator(read_opt));
+    it->Seek(key);
+    if (it->Valid() && (it->key().ToString() == key)) {
+        return it;
+    }
+
+    if (it->Valid()) {
+        it->Prev();
+    } else {
+        it->SeekToLast();
+    }
+
+    if (!it->Valid() || !it->key().starts_with(prefix)) {
+        it->Seek(key);
+    }
+
+    return it;
+}
+
+/**
+ * @brief GkTimeSeries::parse_time reads a Date/Time that is either ISO 8601 or UNIX Epoch Time, whereby the latter is
+ * taken to be in nanoseconds, microseconds or milliseconds if it is far too large to be in seconds.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param value The Date/Time, as found within the file.
+ * @param date_time The Date/Time, as UNIX Epoch Time.
+ * @return Whether `value` was a valid Date/Time or not.
+ */
+bool GkTimeSeries::parse_time(const std::string &value, long int &date_time)
+{
+    char *end = nullptr;
+    const long long epoch = std::strtoll(value.c_str(), &end, 10);
+    if ((end != value.c_str()) && (*end == '\0')) {
+        const long long magnitude = std::llabs(epoch);
+        if (magnitude >= 100000000000000000LL) {
+            date_time = static_cast<long int>(epoch / 1000000000LL);
+        } else if (magnitude >= 100000000000000LL) {
+            date_time = static_cast<long int>(epoch / 1000000LL);
+        } else if (magnitude >= 100000000000LL) {
+            date_time = static_cast<long int>(epoch / 1000LL);
+        } else {
+            date_time = static_cast<long int>(epoch);
+        }
+
+        return true;
+    }
+
+    const QDateTime parsed = QDateTime::fromString(QString::fromStdString(value), Qt::ISODate);
+    if (value.empty() || !parsed.isValid()) {
+        return false;
+    }
+
+    date_time = static_cast<long int>(parsed.toTime_t());
+    return true;
+}
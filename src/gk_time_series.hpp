@@ -0,0 +1,92 @@
+/**
+ **  _   _                 _
+ ** | | | |               | |
+ ** | |_| | ___ _ __ _ __ | |     ___   __ _
+ ** |  _  |/ _ \ '__| '_ \| |    / _ \ / _` |
+ ** | | | |  __/ |  | |_) | |___| (_) | (_| |
+ ** \_| |_/\___|_|  | .__/\_____/\___/ \__, |
+ **                 | |                 __/ |
+ **                 |_|                |___/
+ **
+ **   Thank you for using "HerpLog" for your herpetology management requirements!
+ **   Copyright (C) 2017-2018. GekkoFyre.
+ **
+ **
+ **   HerpLog is free software: you can redistribute it and/or modify
+ **   it under the terms of the GNU General Public License as published by
+ **   the Free Software Foundation, either version 3 of the License, or
+ **   (at your option) any later version.
+ **
+ **   HerpLog is distributed in the hope that it will be useful,
+ **   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **   GNU General Public License for more details.
+ **
+ **   You should have received a copy of the GNU General Public License
+ **   along with HerpLog.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ **
+ **   The latest source code updates can be obtained from [ 1 ] below at your
+ **   discretion. A web-browser or the 'git' application may be required.
+ **
+ **   [ 1 ] - https://github.com/GekkoFyre/HerpLog
+ **
+ ********************************************************************************/
+
+/**
+ * @file gk_time_series.hpp
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @brief Keeps the readings of enclosure probes, such as temperature and humidity, as compressed chunks of numeric
+ * time-series, and reads them back by range or downsampled into buckets.
+ */
+
+#ifndef GK_TIME_SERIES_HPP
+#define GK_TIME_SERIES_HPP
+
+#include "options.hpp"
+#include "gk_string_op.hpp"
+#include <leveldb/db.h>
+#include <leveldb/write_batch.h>
+#include <QtCore/QObject>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <string>
+#include <vector>
+
+namespace GekkoFyre {
+class GkTimeSeries;
+
+class GkTimeSeries : public QObject {
+    Q_OBJECT
+
+public:
+    explicit GkTimeSeries(const GkFile::FileDb &database, const std::shared_ptr<GkStringOp> &gk_str_op,
+                          QObject *parent = nullptr);
+    ~GkTimeSeries();
+
+    std::size_t import_file(const std::string &file_path, const std::string &subject = "");
+    void write_points(const std::string &series, std::vector<GkSeries::GkSeriesPoint> points);
+    std::vector<GkSeries::GkSeriesPoint> read_range(const std::string &series, const long int &dateStart,
+                                                    const long int &dateEnd);
+    std::vector<GkSeries::GkSeriesBucket> downsample(const std::string &series, const long int &dateStart,
+                                                     const long int &dateEnd, const long int &bucket_seconds);
+    std::vector<std::string> list_series();
+
+private:
+    void merge_points(leveldb::WriteBatch &batch, const std::string &series,
+                      std::vector<GkSeries::GkSeriesPoint> &points);
+    void flush_points(std::unordered_map<std::string, std::vector<GkSeries::GkSeriesPoint>> &pending);
+    std::unique_ptr<leveldb::Iterator> seek_chunk(const leveldb::ReadOptions &read_opt, const std::string &series,
+                                                  const long int &date_time);
+    static bool parse_time(const std::string &value, long int &date_time);
+
+    GkFile::FileDb db_conn;
+    std::shared_ptr<GkStringOp> gkStrOp;
+
+    std::mutex write_mutex;
+};
+}
+
+#endif // GK_TIME_SERIES_HPP
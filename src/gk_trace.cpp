@@ -0,0 +1,292 @@
+/**
+ **  _   _                 _
+ ** | | | |               | |
+ ** | |_| | ___ _ __ _ __ | |     ___   __ _
+ ** |  _  |/ _ \ '__| '_ \| |    / _ \ / _` |
+ ** | | | |  __/ |  | |_) | |___| (_) | (_| |
+ ** \_| |_/\___|_|  | .__/\_____/\___/ \__, |
+ **                 | |                 __/ |
+ **                 |_|                |___/
+ **
+ **   Thank you for using "HerpLog" for your herpetology management requirements!
+ **   Copyright (C) 2017-2018. GekkoFyre.
+ **
+ **
+ **   HerpLog is free software: you can redistribute it and/or modify
+ **   it under the terms of the GNU General Public License as published by
+ **   the Free Software Foundation, either version 3 of the License, or
+ **   (at your option) any later version.
+ **
+ **   HerpLog is distributed in the hope that it will be useful,
+ **   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **   GNU General Public License for more details.
+ **
+ **   You should have received a copy of the GNU General Public License
+ **   along with HerpLog.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ **
+ **   The latest source code updates can be obtained from [ 1 ] below at your
+ **   discretion. A web-browser or the 'git' application may be required.
+ **
+ **   [ 1 ] - https://github.com/GekkoFyre/HerpLog
+ **
+ ********************************************************************************/
+
+/**
+ * @file gk_trace.cpp
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @brief Low-overhead tracing of the hot paths of HerpLog, with scoped spans and counters that are kept within a ring
+ * buffer per thread, and which can be exported as a Chrome trace (i.e. for `chrome://tracing` or Perfetto) on demand.
+ */
+
+#include "gk_trace.hpp"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+using namespace GekkoFyre;
+
+namespace {
+/**
+ * @brief The GkTraceBuffer struct is the ring buffer of a single thread. Only that thread ever writes to it, and each
+ * slot carries a sequence number which is odd whilst the slot is being written, so that an export running upon another
+ * thread can tell when an event has been torn (and skip over it) without the writer ever having to take a lock.
+ */
+struct GkTraceBuffer {
+    std::array<GkTracing::GkTraceEvent, HERPLOG_TRACE_BUFFER_EVENTS> events;
+    std::array<std::atomic<std::uint64_t>, HERPLOG_TRACE_BUFFER_EVENTS> sequence;
+    std::atomic<std::uint64_t> head;    // How many events have ever been written to this buffer
+    std::atomic<std::uint64_t> floor;   // Events before this were cleared away by GkTrace::clear()
+    std::uint32_t tid;
+    std::string thread_name;            // Guarded by `registry_mutex`
+
+    GkTraceBuffer() : head(0), floor(0), tid(0)
+    {
+        for (auto &seq: sequence) {
+            seq.store(0, std::memory_order_relaxed);
+        }
+    }
+};
+
+std::mutex registry_mutex;
+std::vector<std::shared_ptr<GkTraceBuffer>> registry; // Kept after their threads have exited, so they can be exported
+thread_local GkTraceBuffer *local_buffer = nullptr;
+
+const std::chrono::steady_clock::time_point trace_epoch = std::chrono::steady_clock::now();
+
+/**
+ * @brief thread_buffer finds the ring buffer of the calling thread, creating it upon the first event.
+ */
+GkTraceBuffer *thread_buffer()
+{
+    if (local_buffer == nullptr) {
+        auto buffer = std::make_shared<GkTraceBuffer>();
+        std::lock_guard<std::mutex> locker(registry_mutex);
+        buffer->tid = static_cast<std::uint32_t>(registry.size() + 1);
+        registry.push_back(buffer);
+        local_buffer = buffer.get();
+    }
+
+    return local_buffer;
+}
+
+void append_escaped(std::ostringstream &oss, const char *str)
+{
+    for (const char *c = (str != nullptr) ? str : ""; *c != '\0'; ++c) {
+        if ((*c == '"') || (*c == '\\')) {
+            oss << '\\' << *c;
+        } else if (static_cast<unsigned char>(*c) >= 0x20) {
+            oss << *c;
+        }
+    }
+}
+}
+
+std::atomic<bool> GkTrace::trace_enabled(false);
+
+/**
+ * @brief GkTrace::set_enabled switches tracing on or off for every thread. Whatever has been traced so far is kept.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param enable Whether to start tracing.
+ */
+void GkTrace::set_enabled(const bool &enable)
+{
+    trace_enabled.store(enable, std::memory_order_relaxed);
+    return;
+}
+
+/**
+ * @brief GkTrace::set_thread_name gives the calling thread a name within the exported trace.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param name The name of the thread, such as "GUI".
+ */
+void GkTrace::set_thread_name(const char *name)
+{
+    GkTraceBuffer *buffer = thread_buffer();
+    std::lock_guard<std::mutex> locker(registry_mutex);
+    buffer->thread_name = (name != nullptr) ? name : "";
+    return;
+}
+
+/**
+ * @brief GkTrace::counter traces a value, such as the size of a cache, at the current point in time.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param name The name of the counter, which must be a string literal.
+ * @param value Its current value.
+ */
+void GkTrace::counter(const char *name, const double &value)
+{
+    if (!enabled()) {
+        return;
+    }
+
+    record({ name, "counter", now_ns(), 0, value, GkTracing::GkTracePhase::Counter });
+    return;
+}
+
+/**
+ * @brief GkTrace::complete traces a span that started at `start_ns` and has just now finished.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param name The name of the span, which must be a string literal.
+ * @param category The category of the span (e.g. "db", "file", or "ui"), which must be a string literal.
+ * @param start_ns As given by GkTrace::now_ns() when the span started.
+ * @see GkTraceSpan
+ */
+void GkTrace::complete(const char *name, const char *category, const std::int64_t &start_ns)
+{
+    record({ name, category, start_ns, now_ns() - start_ns, 0.0, GkTracing::GkTracePhase::Complete });
+    return;
+}
+
+/**
+ * @brief GkTrace::now_ns is the time in nanoseconds since tracing was first made use of.
+ */
+std::int64_t GkTrace::now_ns()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - trace_epoch).count();
+}
+
+/**
+ * @brief GkTrace::clear throws away everything that has been traced so far, without disturbing any thread that may be
+ * tracing at this very moment.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ */
+void GkTrace::clear()
+{
+    std::lock_guard<std::mutex> locker(registry_mutex);
+    for (const auto &buffer: registry) {
+        buffer->floor.store(buffer->head.load(std::memory_order_acquire), std::memory_order_relaxed);
+    }
+
+    return;
+}
+
+/**
+ * @brief GkTrace::chrome_trace_json exports the latest events of every thread in the Chrome trace format. Tracing may
+ * carry on whilst this is running, and any event that is overwritten whilst being read is simply left out.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @return The JSON document.
+ * @see https://docs.google.com/document/d/1CvAClvFfyA5R-PhYUmn5OOQtYMH4h6I0nSsKchNAySU
+ */
+std::string GkTrace::chrome_trace_json()
+{
+    std::ostringstream oss;
+    oss.precision(3);
+    oss << std::fixed << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    oss << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"HerpLog\"}}";
+
+    std::lock_guard<std::mutex> locker(registry_mutex);
+    for (const auto &buffer: registry) {
+        if (!buffer->thread_name.empty()) {
+            oss << ",{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->tid << ",\"args\":{\"name\":\"";
+            append_escaped(oss, buffer->thread_name.c_str());
+            oss << "\"}}";
+        }
+
+        const std::uint64_t head = buffer->head.load(std::memory_order_acquire);
+        std::uint64_t first = buffer->floor.load(std::memory_order_relaxed);
+        if (head > HERPLOG_TRACE_BUFFER_EVENTS) {
+            first = std::max(first, head - HERPLOG_TRACE_BUFFER_EVENTS);
+        }
+
+        for (std::uint64_t i = first; i < head; ++i) {
+            const std::size_t slot = static_cast<std::size_t>(i % HERPLOG_TRACE_BUFFER_EVENTS);
+            const std::uint64_t expected = (i * 2) + 2;
+            if (buffer->sequence[slot].load(std::memory_order_acquire) != expected) {
+                continue; // Already overwritten by a newer event
+            }
+
+            const GkTracing::GkTraceEvent event = buffer->events[slot];
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (buffer->sequence[slot].load(std::memory_order_relaxed) != expected) {
+                continue; // Overwritten whilst we were reading it
+            }
+
+            oss << ",{\"name\":\"";
+            append_escaped(oss, event.name);
+            oss << "\",\"cat\":\"";
+            append_escaped(oss, event.category);
+            oss << "\",\"ph\":\"" << static_cast<char>(event.phase) << "\",\"pid\":1,\"tid\":" << buffer->tid
+                << ",\"ts\":" << (static_cast<double>(event.ts_ns) / 1000.0);
+            if (event.phase == GkTracing::GkTracePhase::Complete) {
+                oss << ",\"dur\":" << (static_cast<double>(event.dur_ns) / 1000.0);
+            } else {
+                oss << ",\"args\":{\"value\":" << event.value << "}";
+            }
+
+            oss << "}";
+        }
+    }
+
+    oss << "]}";
+    return oss.str();
+}
+
+/**
+ * @brief GkTrace::write_chrome_trace writes the output of GkTrace::chrome_trace_json() out to a file.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param file_path Where to write the trace to, which is usually given a `.json` extension.
+ */
+void GkTrace::write_chrome_trace(const std::string &file_path)
+{
+    std::ofstream out(file_path, std::ios::out | std::ios::trunc);
+    out << chrome_trace_json();
+    if (!out) {
+        throw std::runtime_error("Unable to write the trace to \"" + file_path + "\"!");
+    }
+
+    return;
+}
+
+/**
+ * @brief GkTrace::record appends an event to the ring buffer of the calling thread, overwriting the oldest event once
+ * the buffer has filled up.
+ */
+void GkTrace::record(const GkTracing::GkTraceEvent &event)
+{
+    GkTraceBuffer *buffer = thread_buffer();
+    const std::uint64_t i = buffer->head.load(std::memory_order_relaxed);
+    const std::size_t slot = static_cast<std::size_t>(i % HERPLOG_TRACE_BUFFER_EVENTS);
+
+    buffer->sequence[slot].store((i * 2) + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    buffer->events[slot] = event;
+    buffer->sequence[slot].store((i * 2) + 2, std::memory_order_release);
+    buffer->head.store(i + 1, std::memory_order_release);
+    return;
+}
@@ -0,0 +1,110 @@
+/**
+ **  _   _                 _
+ ** | | | |               | |
+ ** | |_| | ___ _ __ _ __ | |     ___   __ _
+ ** |  _  |/ _ \ '__| '_ \| |    / _ \ / _` |
+ ** | | | |  __/ |  | |_) | |___| (_) | (_| |
+ ** \_| |_/\___|_|  | .__/\_____/\___/ \__, |
+ **                 | |                 __/ |
+ **                 |_|                |___/
+ **
+ **   Thank you for using "HerpLog" for your herpetology management requirements!
+ **   Copyright (C) 2017-2018. GekkoFyre.
+ **
+ **
+ **   HerpLog is free software: you can redistribute it and/or modify
+ **   it under the terms of the GNU General Public License as published by
+ **   the Free Software Foundation, either version 3 of the License, or
+ **   (at your option) any later version.
+ **
+ **   HerpLog is distributed in the hope that it will be useful,
+ **   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **   GNU General Public License for more details.
+ **
+ **   You should have received a copy of the GNU General Public License
+ **   along with HerpLog.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ **
+ **   The latest source code updates can be obtained from [ 1 ] below at your
+ **   discretion. A web-browser or the 'git' application may be required.
+ **
+ **   [ 1 ] - https://github.com/GekkoFyre/HerpLog
+ **
+ ********************************************************************************/
+
+/**
+ * @file gk_trace.hpp
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @brief Low-overhead tracing of the hot paths of HerpLog, with scoped spans and counters that are kept within a ring
+ * buffer per thread, and which can be exported as a Chrome trace (i.e. for `chrome://tracing` or Perfetto) on demand.
+ */
+
+#ifndef GK_TRACE_HPP
+#define GK_TRACE_HPP
+
+#include "options.hpp"
+#include "gk_watchdog.hpp"
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+namespace GekkoFyre {
+class GkTrace;
+
+class GkTrace {
+
+public:
+    /**
+     * @brief GkTrace::enabled is all that tracing costs whilst it's switched off, so it's kept inline.
+     */
+    static inline bool enabled() { return trace_enabled.load(std::memory_order_relaxed); }
+
+    static void set_enabled(const bool &enable);
+    static void set_thread_name(const char *name);
+    static void counter(const char *name, const double &value);
+    static void complete(const char *name, const char *category, const std::int64_t &start_ns);
+    static std::int64_t now_ns();
+    static void clear();
+    static std::string chrome_trace_json();
+    static void write_chrome_trace(const std::string &file_path);
+
+private:
+    static void record(const GkTracing::GkTraceEvent &event);
+
+    static std::atomic<bool> trace_enabled;
+};
+
+/**
+ * @brief The GkTraceSpan class traces how long it was in scope for, such as for the whole of a function, e.g.
+ * `GkTraceSpan span("GkDbRead::get_uuids", "db");`. Both of the names must be string literals. The name doubles as a
+ * stall marker, so that `GkWatchdog` can blame a frozen GUI upon the span it froze within.
+ */
+class GkTraceSpan {
+
+public:
+    GkTraceSpan(const char *name, const char *category) : span_name(name), span_category(category),
+                                                          start_ns(GkTrace::enabled() ? GkTrace::now_ns() : -1),
+                                                          stall_marker(name)
+    {}
+
+    ~GkTraceSpan()
+    {
+        if (start_ns >= 0) {
+            GkTrace::complete(span_name, span_category, start_ns);
+        }
+    }
+
+    GkTraceSpan(const GkTraceSpan &) = delete;
+    GkTraceSpan &operator=(const GkTraceSpan &) = delete;
+
+private:
+    const char *span_name;
+    const char *span_category;
+    std::int64_t start_ns;
+    GkStallMarker stall_marker;
+};
+}
+
+#endif // GK_TRACE_HPP
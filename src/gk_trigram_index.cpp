@@ -0,0 +1,257 @@
+/**
+ **  _   _                 _
+ ** | | | |               | |
+ ** | |_| | ___ _ __ _ __ | |     ___   __ _
+ ** |  _  |/ _ \ '__| '_ \| |    / _ \ / _` |
+ ** | | | |  __/ |  | |_) | |___| (_) | (_| |
+ ** \_| |_/\___|_|  | .__/\_____/\___/ \__, |
+ **                 | |                 __/ |
+ **                 |_|                |___/
+ **
+ **   Thank you for using "HerpLog" for your herpetology management requirements!
+ **   Copyright (C) 2017-2018. GekkoFyre.
+ **
+ **
+ **   HerpLog is free software: you can redistribute it and/or modify
+ **   it under the terms of the GNU General Public License as published by
+ **   the Free Software Foundation, either version 3 of the License, or
+ **   (at your option) any later version.
+ **
+ **   HerpLog is distributed in the hope that it will be useful,
+ **   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **   GNU General Public License for more details.
+ **
+ **   You should have received a copy of the GNU General Public License
+ **   along with HerpLog.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ **
+ **   The latest source code updates can be obtained from [ 1 ] below at your
+ **   discretion. A web-browser or the 'git' application may be required.
+ **
+ **   [ 1 ] - https://github.com/GekkoFyre/HerpLog
+ **
+ ********************************************************************************/
+
+/**
+ * @file gk_trigram_index.cpp
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @brief A trigram index over the names of the Licensees, Species, or Animals, so that they can be looked up by whatever
+ * fragment of a name the user can recall, typos and all.
+ */
+
+#include "gk_trigram_index.hpp"
+#include <QString>
+#include <algorithm>
+#include <limits>
+
+using namespace GekkoFyre;
+
+GkTrigramIndex::GkTrigramIndex()
+{
+    indexed = 0;
+}
+
+GkTrigramIndex::~GkTrigramIndex()
+{}
+
+/**
+ * @brief GkTrigramIndex::insert indexes the name of a node, replacing whatever name it was indexed under beforehand.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param idx The node of the category within its tier of the `GkCategoryTree`.
+ * @param name The name of the category, in UTF-8.
+ */
+void GkTrigramIndex::insert(const std::uint32_t &idx, const std::string &name)
+{
+    if (idx < folded_names.size()) {
+        erase(idx);
+    } else {
+        folded_names.resize(idx + 1);
+        gram_counts.resize(idx + 1, 0);
+        shared.resize(idx + 1, 0);
+    }
+
+    const std::string folded = fold(name);
+    const std::vector<std::uint64_t> grams = trigrams(folded);
+    if (grams.empty()) {
+        return;
+    }
+
+    for (const auto &gram: grams) {
+        auto &nodes = postings[gram];
+        nodes.insert(std::lower_bound(nodes.begin(), nodes.end(), idx), idx);
+    }
+
+    folded_names[idx] = folded;
+    gram_counts[idx] = static_cast<std::uint16_t>(std::min<std::size_t>(grams.size(),
+                                                                         std::numeric_limits<std::uint16_t>::max()));
+    ++indexed;
+    return;
+}
+
+void GkTrigramIndex::clear()
+{
+    postings.clear();
+    folded_names.clear();
+    gram_counts.clear();
+    shared.clear();
+    indexed = 0;
+
+    return;
+}
+
+std::size_t GkTrigramIndex::size() const
+{
+    return indexed;
+}
+
+/**
+ * @brief GkTrigramIndex::search finds the names that share the most trigrams with the query, by walking only the
+ * posting lists of the query's own trigrams. A name counts as a match once it holds at least
+ * `HERPLOG_TRIGRAM_MIN_COVERAGE` of them, and the matches are ranked by that share, by how little else the name is made
+ * up of, and lastly by whether the query is found within the name word-for-word.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param query Whatever the user has typed so far.
+ * @param limit How many of the best matches to return.
+ * @param accept Decides whether a node may be returned at all, such as when it no longer has any records.
+ * @return The best matches, the best of which comes first.
+ */
+std::vector<GkRecords::GkNameMatch> GkTrigramIndex::search(const std::string &query, const std::size_t &limit,
+                                                           const std::function<bool(const std::uint32_t &)> &accept)
+{
+    std::vector<GkRecords::GkNameMatch> matches;
+    const std::string folded = fold(query);
+    const std::vector<std::uint64_t> grams = trigrams(folded);
+    if (grams.empty() || (limit == 0)) {
+        return matches;
+    }
+
+    std::vector<std::uint32_t> touched;
+    for (const auto &gram: grams) {
+        auto it = postings.find(gram);
+        if (it == postings.end()) {
+            continue;
+        }
+
+        for (const auto &idx: it->second) {
+            if (shared[idx]++ == 0) {
+                touched.push_back(idx);
+            }
+        }
+    }
+
+    const double query_grams = static_cast<double>(grams.size());
+    for (const auto &idx: touched) {
+        const double hits = static_cast<double>(shared[idx]);
+        shared[idx] = 0;
+
+        const double coverage = hits / query_grams;
+        if ((coverage < HERPLOG_TRIGRAM_MIN_COVERAGE) || !accept(idx)) {
+            continue;
+        }
+
+        // Jaccard similarity, so that `Pogona #4` ranks above `Pogona #412` when that is what was typed
+        double score = coverage + (0.5 * hits / (query_grams + static_cast<double>(gram_counts[idx]) - hits));
+        const std::string &name = folded_names[idx];
+        if (name.compare(0, folded.size(), folded) == 0) {
+            score += 1.0;
+        } else if (name.find(folded) != std::string::npos) {
+            score += 0.5;
+        }
+
+        matches.push_back({ idx, score });
+    }
+
+    const auto ranking = [this](const GkRecords::GkNameMatch &lhs, const GkRecords::GkNameMatch &rhs) {
+        if (lhs.score != rhs.score) {
+            return lhs.score > rhs.score;
+        }
+
+        return folded_names[lhs.idx] < folded_names[rhs.idx];
+    };
+
+    if (matches.size() > limit) {
+        std::partial_sort(matches.begin(), matches.begin() + static_cast<std::ptrdiff_t>(limit), matches.end(), ranking);
+        matches.resize(limit);
+    } else {
+        std::sort(matches.begin(), matches.end(), ranking);
+    }
+
+    return matches;
+}
+
+/**
+ * @brief GkTrigramIndex::fold case-folds a name, so that `POGONA`, `Pogona` and `pogona` are all one and the same.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ */
+std::string GkTrigramIndex::fold(const std::string &name)
+{
+    return QString::fromStdString(name).toCaseFolded().toStdString();
+}
+
+/**
+ * @brief GkTrigramIndex::trigrams splits a name up into words of letters and digits, pads each with two spaces in front
+ * and one behind, and takes every run of three characters from them. The padding means the start of a word counts for
+ * more than its middle, and that even a single character typed makes for a trigram.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param folded The case-folded name, in UTF-8.
+ * @return The distinct trigrams, each with its three UTF-16 code units packed together, in ascending order.
+ */
+std::vector<std::uint64_t> GkTrigramIndex::trigrams(const std::string &folded)
+{
+    std::vector<std::uint64_t> grams;
+    const QString text = QString::fromStdString(folded);
+    std::uint64_t window = (static_cast<std::uint64_t>(' ') << 16) | static_cast<std::uint64_t>(' ');
+    bool in_word = false;
+    for (int i = 0; i <= text.size(); ++i) {
+        if ((i < text.size()) && text.at(i).isLetterOrNumber()) {
+            window = ((window << 16) | static_cast<std::uint64_t>(text.at(i).unicode())) & 0xFFFFFFFFFFFFULL;
+            grams.push_back(window);
+            in_word = true;
+            continue;
+        }
+
+        if (in_word) {
+            grams.push_back(((window << 16) | static_cast<std::uint64_t>(' ')) & 0xFFFFFFFFFFFFULL);
+            window = (static_cast<std::uint64_t>(' ') << 16) | static_cast<std::uint64_t>(' ');
+            in_word = false;
+        }
+    }
+
+    std::sort(grams.begin(), grams.end());
+    grams.erase(std::unique(grams.begin(), grams.end()), grams.end());
+    return grams;
+}
+
+void GkTrigramIndex::erase(const std::uint32_t &idx)
+{
+    if (folded_names[idx].empty()) {
+        return;
+    }
+
+    for (const auto &gram: trigrams(folded_names[idx])) {
+        auto it = postings.find(gram);
+        if (it == postings.end()) {
+            continue;
+        }
+
+        auto pos = std::lower_bound(it->second.begin(), it->second.end(), idx);
+        if ((pos != it->second.end()) && (*pos == idx)) {
+            it->second.erase(pos);
+        }
+
+        if (it->second.empty()) {
+            postings.erase(it);
+        }
+    }
+
+    folded_names[idx].clear();
+    gram_counts[idx] = 0;
+    --indexed;
+    return;
+}
@@ -0,0 +1,84 @@
+/**
+ **  _   _                 _
+ ** | | | |               | |
+ ** | |_| | ___ _ __ _ __ | |     ___   __ _
+ ** |  _  |/ _ \ '__| '_ \| |    / _ \ / _` |
+ ** | | | |  __/ |  | |_) | |___| (_) | (_| |
+ ** \_| |_/\___|_|  | .__/\_____/\___/ \__, |
+ **                 | |                 __/ |
+ **                 |_|                |___/
+ **
+ **   Thank you for using "HerpLog" for your herpetology management requirements!
+ **   Copyright (C) 2017-2018. GekkoFyre.
+ **
+ **
+ **   HerpLog is free software: you can redistribute it and/or modify
+ **   it under the terms of the GNU General Public License as published by
+ **   the Free Software Foundation, either version 3 of the License, or
+ **   (at your option) any later version.
+ **
+ **   HerpLog is distributed in the hope that it will be useful,
+ **   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **   GNU General Public License for more details.
+ **
+ **   You should have received a copy of the GNU General Public License
+ **   along with HerpLog.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ **
+ **   The latest source code updates can be obtained from [ 1 ] below at your
+ **   discretion. A web-browser or the 'git' application may be required.
+ **
+ **   [ 1 ] - https://github.com/GekkoFyre/HerpLog
+ **
+ ********************************************************************************/
+
+/**
+ * @file gk_trigram_index.hpp
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @brief A trigram index over the names of the Licensees, Species, or Animals, so that they can be looked up by whatever
+ * fragment of a name the user can recall, typos and all.
+ */
+
+#ifndef GK_TRIGRAM_INDEX_HPP
+#define GK_TRIGRAM_INDEX_HPP
+
+#include "options.hpp"
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace GekkoFyre {
+class GkTrigramIndex;
+
+class GkTrigramIndex {
+
+public:
+    GkTrigramIndex();
+    ~GkTrigramIndex();
+
+    void insert(const std::uint32_t &idx, const std::string &name);
+    void clear();
+    std::size_t size() const;
+
+    std::vector<GkRecords::GkNameMatch> search(const std::string &query, const std::size_t &limit,
+                                               const std::function<bool(const std::uint32_t &)> &accept);
+
+    static std::string fold(const std::string &name);
+    static std::vector<std::uint64_t> trigrams(const std::string &folded);
+
+private:
+    void erase(const std::uint32_t &idx);
+
+    std::unordered_map<std::uint64_t, std::vector<std::uint32_t>> postings; // <Key: Trigram, Value: Nodes, ascending>
+    std::vector<std::string> folded_names;      // Node -> Case-folded name, or empty if the node isn't indexed
+    std::vector<std::uint16_t> gram_counts;     // Node -> How many distinct trigrams the name is made up of
+    std::vector<std::uint16_t> shared;          // Scratch space for `search()`, which is only ever non-zero therein
+    std::size_t indexed;
+};
+}
+
+#endif // GK_TRIGRAM_INDEX_HPP
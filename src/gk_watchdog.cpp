@@ -0,0 +1,340 @@
+/**
+ **  _   _                 _
+ ** | | | |               | |
+ ** | |_| | ___ _ __ _ __ | |     ___   __ _
+ ** |  _  |/ _ \ '__| '_ \| |    / _ \ / _` |
+ ** | | | |  __/ |  | |_) | |___| (_) | (_| |
+ ** \_| |_/\___|_|  | .__/\_____/\___/ \__, |
+ **                 | |                 __/ |
+ **                 |_|                |___/
+ **
+ **   Thank you for using "HerpLog" for your herpetology management requirements!
+ **   Copyright (C) 2017-2018. GekkoFyre.
+ **
+ **
+ **   HerpLog is free software: you can redistribute it and/or modify
+ **   it under the terms of the GNU General Public License as published by
+ **   the Free Software Foundation, either version 3 of the License, or
+ **   (at your option) any later version.
+ **
+ **   HerpLog is distributed in the hope that it will be useful,
+ **   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **   GNU General Public License for more details.
+ **
+ **   You should have received a copy of the GNU General Public License
+ **   along with HerpLog.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ **
+ **   The latest source code updates can be obtained from [ 1 ] below at your
+ **   discretion. A web-browser or the 'git' application may be required.
+ **
+ **   [ 1 ] - https://github.com/GekkoFyre/HerpLog
+ **
+ ********************************************************************************/
+
+/**
+ * @file gk_watchdog.cpp
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @brief Watches over the event loop of the GUI thread from a thread of its own, and blames every stall upon whatever
+ * the GUI thread was busy with at the time, so that we know just what needs moving off of it.
+ */
+
+#include "gk_watchdog.hpp"
+#include "gk_trace.hpp"
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <stdexcept>
+#include <unordered_map>
+
+using namespace GekkoFyre;
+
+namespace {
+GkMarkerStack watched_markers; // Never freed, as a marker may well outlive the watchdog that it was pushed for
+
+/**
+ * @brief sample_culprit reads off what the watched thread is busy with, as both the outermost marker (usually a slot of
+ * `HerpApp`) and the innermost (usually a call into the data layer).
+ */
+std::string sample_culprit()
+{
+    const int depth = std::min(watched_markers.depth.load(std::memory_order_acquire), HERPLOG_WATCHDOG_MARKER_DEPTH);
+    if (depth <= 0) {
+        return "(unmarked)";
+    }
+
+    const char *outer = watched_markers.names[0].load(std::memory_order_relaxed);
+    const char *inner = watched_markers.names[depth - 1].load(std::memory_order_relaxed);
+    std::string culprit = (outer != nullptr) ? outer : "(unmarked)";
+    if ((depth > 1) && (inner != nullptr) && (inner != outer)) {
+        culprit += " > ";
+        culprit += inner;
+    }
+
+    return culprit;
+}
+}
+
+thread_local GkMarkerStack *GkWatchdog::watched_stack = nullptr;
+
+GkWatchdog::GkWatchdog(const int &threshold_ms, QObject *parent) : QObject(parent)
+{
+    stall_threshold_ms = threshold_ms;
+    last_beat_ms = 0;
+    max_latency_ms = 0;
+    heartbeat_count = 0;
+    started_ms = 0;
+    stopped_ms = 0;
+    stop_watching = true;
+
+    heartbeat_timer = new QTimer(this);
+    heartbeat_timer->setTimerType(Qt::PreciseTimer);
+    heartbeat_timer->setInterval(HERPLOG_WATCHDOG_HEARTBEAT_MS);
+    QObject::connect(heartbeat_timer, &QTimer::timeout, this, &GkWatchdog::heartbeat);
+}
+
+GkWatchdog::~GkWatchdog()
+{
+    stop();
+}
+
+/**
+ * @brief GkWatchdog::start begins watching over the event loop of the calling thread, which ought to be the GUI
+ * thread. Any stalls from a previous watch are forgotten about.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ */
+void GkWatchdog::start()
+{
+    if (running()) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> locker(watch_mutex);
+        stalls.clear();
+        stop_watching = false;
+    }
+
+    watched_stack = &watched_markers;
+    started_ms = now_ms();
+    stopped_ms = 0;
+    last_beat_ms.store(started_ms, std::memory_order_release);
+    max_latency_ms = 0;
+    heartbeat_count = 0;
+
+    heartbeat_timer->start();
+    watcher = std::thread(&GkWatchdog::watch, this);
+    return;
+}
+
+/**
+ * @brief GkWatchdog::stop stops watching, whilst keeping hold of the stalls seen so far for `report()`.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ */
+void GkWatchdog::stop()
+{
+    if (!running()) {
+        return;
+    }
+
+    heartbeat_timer->stop();
+    {
+        std::lock_guard<std::mutex> locker(watch_mutex);
+        stop_watching = true;
+    }
+
+    watch_cond.notify_all();
+    watcher.join();
+    watched_stack = nullptr;
+    stopped_ms = now_ms();
+    return;
+}
+
+bool GkWatchdog::running() const
+{
+    return watcher.joinable();
+}
+
+/**
+ * @brief GkWatchdog::report sums up the stalls, with a histogram of how long they lasted and the markers that were to
+ * blame for the most time stalled.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ */
+GkStalls::GkStallReport GkWatchdog::report() const
+{
+    GkStalls::GkStallReport report;
+    {
+        std::lock_guard<std::mutex> locker(watch_mutex);
+        report.stalls = stalls;
+    }
+
+    report.watched_ms = (started_ms == 0) ? 0 : ((stopped_ms == 0) ? now_ms() : stopped_ms) - started_ms;
+    report.heartbeats = heartbeat_count.load(std::memory_order_relaxed);
+    report.max_latency_ms = max_latency_ms.load(std::memory_order_relaxed);
+
+    const std::vector<std::pair<std::int64_t, std::string>> buckets = {
+        { 250, tr("under 250 ms").toStdString() }, { 500, tr("250-500 ms").toStdString() },
+        { 1000, tr("0.5-1 s").toStdString() }, { 2000, tr("1-2 s").toStdString() },
+        { 5000, tr("2-5 s").toStdString() }, { std::numeric_limits<std::int64_t>::max(), tr("5 s or more").toStdString() }
+    };
+
+    for (const auto &bucket: buckets) {
+        report.histogram.push_back(std::make_pair(bucket.second, 0));
+    }
+
+    std::unordered_map<std::string, GkStalls::GkStallOffender> offenders;
+    for (const auto &stall: report.stalls) {
+        for (std::size_t i = 0; i < buckets.size(); ++i) {
+            if (stall.duration_ms < buckets[i].first) {
+                ++report.histogram[i].second;
+                break;
+            }
+        }
+
+        GkStalls::GkStallOffender &offender = offenders[stall.culprit];
+        offender.culprit = stall.culprit;
+        ++offender.count;
+        offender.total_ms += stall.duration_ms;
+        offender.max_ms = std::max(offender.max_ms, stall.duration_ms);
+    }
+
+    for (const auto &offender: offenders) {
+        report.offenders.push_back(offender.second);
+    }
+
+    std::sort(report.offenders.begin(), report.offenders.end(),
+              [](const GkStalls::GkStallOffender &a, const GkStalls::GkStallOffender &b) {
+        return (a.total_ms != b.total_ms) ? (a.total_ms > b.total_ms) : (a.culprit < b.culprit);
+    });
+
+    return report;
+}
+
+/**
+ * @brief GkWatchdog::report_text lays out `report()` as plain text, ready to be saved or pasted into a bug report.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ */
+QString GkWatchdog::report_text() const
+{
+    const GkStalls::GkStallReport stall_report = report();
+    std::int64_t stalled_ms = 0;
+    for (const auto &stall: stall_report.stalls) {
+        stalled_ms += stall.duration_ms;
+    }
+
+    QString text;
+    text += tr("Watched for %1 ms, over %2 heartbeats of %3 ms\n").arg(stall_report.watched_ms)
+            .arg(stall_report.heartbeats).arg(HERPLOG_WATCHDOG_HEARTBEAT_MS);
+    text += tr("Worst heartbeat latency: %1 ms\n").arg(stall_report.max_latency_ms);
+    text += tr("Stalls of %1 ms or more: %2, totalling %3 ms\n\n").arg(stall_threshold_ms)
+            .arg(static_cast<qulonglong>(stall_report.stalls.size())).arg(stalled_ms);
+
+    text += tr("Durations\n");
+    for (const auto &bucket: stall_report.histogram) {
+        text += QString("  %1 %2\n").arg(QString::fromStdString(bucket.first), -14)
+                .arg(static_cast<qulonglong>(bucket.second));
+    }
+
+    text += tr("\nTop offenders (count, total, worst)\n");
+    for (const auto &offender: stall_report.offenders) {
+        text += tr("  %1 x%2, %3 ms, %4 ms\n").arg(QString::fromStdString(offender.culprit))
+                .arg(static_cast<qulonglong>(offender.count)).arg(offender.total_ms).arg(offender.max_ms);
+    }
+
+    text += tr("\nStalls (start, duration, culprit)\n");
+    for (const auto &stall: stall_report.stalls) {
+        text += tr("  +%1 ms, %2 ms, %3\n").arg(stall.start_ms).arg(stall.duration_ms)
+                .arg(QString::fromStdString(stall.culprit));
+    }
+
+    return text;
+}
+
+void GkWatchdog::write_report(const std::string &file_path) const
+{
+    std::ofstream out(file_path, std::ios::out | std::ios::trunc);
+    if (!out.is_open()) {
+        throw std::runtime_error(tr("Unable to write the stall report to, \"%1\"!").arg(QString::fromStdString(file_path)).toStdString());
+    }
+
+    out << report_text().toStdString();
+    return;
+}
+
+/**
+ * @brief GkWatchdog::heartbeat is run by the event loop being watched, whenever it gets the chance to.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ */
+void GkWatchdog::heartbeat()
+{
+    const std::int64_t now = now_ms();
+    const std::int64_t latency = now - last_beat_ms.load(std::memory_order_relaxed) - HERPLOG_WATCHDOG_HEARTBEAT_MS;
+    if (latency > max_latency_ms.load(std::memory_order_relaxed)) {
+        max_latency_ms.store(latency, std::memory_order_relaxed);
+    }
+
+    heartbeat_count.fetch_add(1, std::memory_order_relaxed);
+    last_beat_ms.store(now, std::memory_order_release);
+    return;
+}
+
+/**
+ * @brief GkWatchdog::watch is run by the watchdog's own thread. Once a heartbeat is overdue by more than the threshold,
+ * the markers of the watched thread are sampled every poll until the heartbeat does turn up, and the stall is then
+ * blamed upon whichever marker was seen the most.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ */
+void GkWatchdog::watch()
+{
+    GkTrace::set_thread_name("Watchdog");
+    std::map<std::string, std::size_t> samples;
+    std::int64_t seen_beat = last_beat_ms.load(std::memory_order_acquire);
+
+    std::unique_lock<std::mutex> locker(watch_mutex);
+    while (!stop_watching) {
+        watch_cond.wait_for(locker, std::chrono::milliseconds(HERPLOG_WATCHDOG_POLL_MS));
+        if (stop_watching) {
+            break;
+        }
+
+        const std::int64_t beat = last_beat_ms.load(std::memory_order_acquire);
+        if (beat != seen_beat) {
+            const std::int64_t late_ms = beat - seen_beat - HERPLOG_WATCHDOG_HEARTBEAT_MS;
+            if (late_ms >= stall_threshold_ms) {
+                GkStalls::GkStall stall;
+                stall.start_ms = seen_beat + HERPLOG_WATCHDOG_HEARTBEAT_MS - started_ms;
+                stall.duration_ms = late_ms;
+                stall.culprit = samples.empty() ? std::string("(not sampled)") :
+                                std::max_element(samples.begin(), samples.end(),
+                                                 [](const std::pair<const std::string, std::size_t> &a,
+                                                    const std::pair<const std::string, std::size_t> &b) {
+                                    return a.second < b.second;
+                                })->first;
+                stalls.push_back(stall);
+                GkTrace::counter("GkWatchdog::stall_ms", static_cast<double>(late_ms));
+            }
+
+            samples.clear();
+            seen_beat = beat;
+        } else if (now_ms() - beat > HERPLOG_WATCHDOG_HEARTBEAT_MS + stall_threshold_ms) {
+            ++samples[sample_culprit()];
+        }
+    }
+
+    return;
+}
+
+std::int64_t GkWatchdog::now_ms()
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
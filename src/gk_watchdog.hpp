@@ -0,0 +1,159 @@
+/**
+ **  _   _                 _
+ ** | | | |               | |
+ ** | |_| | ___ _ __ _ __ | |     ___   __ _
+ ** |  _  |/ _ \ '__| '_ \| |    / _ \ / _` |
+ ** | | | |  __/ |  | |_) | |___| (_) | (_| |
+ ** \_| |_/\___|_|  | .__/\_____/\___/ \__, |
+ **                 | |                 __/ |
+ **                 |_|                |___/
+ **
+ **   Thank you for using "HerpLog" for your herpetology management requirements!
+ **   Copyright (C) 2017-2018. GekkoFyre.
+ **
+ **
+ **   HerpLog is free software: you can redistribute it and/or modify
+ **   it under the terms of the GNU General Public License as published by
+ **   the Free Software Foundation, either version 3 of the License, or
+ **   (at your option) any later version.
+ **
+ **   HerpLog is distributed in the hope that it will be useful,
+ **   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **   GNU General Public License for more details.
+ **
+ **   You should have received a copy of the GNU General Public License
+ **   along with HerpLog.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ **
+ **   The latest source code updates can be obtained from [ 1 ] below at your
+ **   discretion. A web-browser or the 'git' application may be required.
+ **
+ **   [ 1 ] - https://github.com/GekkoFyre/HerpLog
+ **
+ ********************************************************************************/
+
+/**
+ * @file gk_watchdog.hpp
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @brief Watches over the event loop of the GUI thread from a thread of its own, and blames every stall upon whatever
+ * the GUI thread was busy with at the time, so that we know just what needs moving off of it.
+ */
+
+#ifndef GK_WATCHDOG_HPP
+#define GK_WATCHDOG_HPP
+
+#include "options.hpp"
+#include <QtCore/QObject>
+#include <QString>
+#include <QTimer>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace GekkoFyre {
+class GkWatchdog;
+
+/**
+ * @brief The GkMarkerStack struct holds the names of the stall markers that are in scope upon the watched thread. Only
+ * that thread ever writes to it, whilst the watchdog reads it without a lock; a torn read only costs a sample.
+ */
+struct GkMarkerStack {
+    std::atomic<int> depth;
+    std::array<std::atomic<const char *>, HERPLOG_WATCHDOG_MARKER_DEPTH> names;
+
+    GkMarkerStack() : depth(0)
+    {
+        for (auto &name: names) {
+            name.store(nullptr, std::memory_order_relaxed);
+        }
+    }
+};
+
+class GkWatchdog : public QObject {
+    Q_OBJECT
+
+public:
+    explicit GkWatchdog(const int &threshold_ms = HERPLOG_WATCHDOG_THRESHOLD_MS, QObject *parent = nullptr);
+    ~GkWatchdog();
+
+    void start();
+    void stop();
+    bool running() const;
+
+    GkStalls::GkStallReport report() const;
+    QString report_text() const;
+    void write_report(const std::string &file_path) const;
+
+    /**
+     * @brief GkWatchdog::marker_stack is the stack of the calling thread, or nullptr if it's not being watched.
+     */
+    static inline GkMarkerStack *marker_stack() { return watched_stack; }
+
+private slots:
+    void heartbeat();
+
+private:
+    void watch();
+    static std::int64_t now_ms();
+
+    static thread_local GkMarkerStack *watched_stack;
+
+    QTimer *heartbeat_timer;
+    std::thread watcher;
+    int stall_threshold_ms;
+
+    std::atomic<std::int64_t> last_beat_ms;
+    std::atomic<std::int64_t> max_latency_ms;
+    std::atomic<std::uint64_t> heartbeat_count;
+    std::int64_t started_ms;
+    std::int64_t stopped_ms;
+
+    mutable std::mutex watch_mutex; // Guards `stalls` and `stop_watching`
+    std::condition_variable watch_cond;
+    bool stop_watching;
+    std::vector<GkStalls::GkStall> stalls;
+};
+
+/**
+ * @brief The GkStallMarker class marks what the watched thread is busy with for as long as it's in scope, e.g.
+ * `GkStallMarker marker("HerpApp::update_charts");`. The name must be a string literal. Every `GkTraceSpan` carries
+ * one of these already, so they're only needed by themselves where a span would be too costly.
+ */
+class GkStallMarker {
+
+public:
+    explicit GkStallMarker(const char *name) : stack(GkWatchdog::marker_stack())
+    {
+        if (stack != nullptr) {
+            const int depth = stack->depth.load(std::memory_order_relaxed);
+            if (depth < HERPLOG_WATCHDOG_MARKER_DEPTH) {
+                stack->names[depth].store(name, std::memory_order_relaxed);
+            }
+
+            stack->depth.store(depth + 1, std::memory_order_release);
+        }
+    }
+
+    ~GkStallMarker()
+    {
+        if (stack != nullptr) {
+            stack->depth.store(stack->depth.load(std::memory_order_relaxed) - 1, std::memory_order_release);
+        }
+    }
+
+    GkStallMarker(const GkStallMarker &) = delete;
+    GkStallMarker &operator=(const GkStallMarker &) = delete;
+
+private:
+    GkMarkerStack *stack;
+};
+}
+
+#endif // GK_WATCHDOG_HPP
@@ -0,0 +1,360 @@
+/**
+ **  _   _                 _
+ ** | | | |               | |
+ ** | |_| | ___ _ __ _ __ | |     ___   __ _
+ ** |  _  |/ _ \ '__| '_ \| |    / _ \ / _` |
+ ** | | | |  __/ |  | |_) | |___| (_) | (_| |
+ ** \_| |_/\___|_|  | .__/\_____/\___/ \__, |
+ **                 | |                 __/ |
+ **                 |_|                |___/
+ **
+ **   Thank you for using "HerpLog" for your herpetology management requirements!
+ **   Copyright (C) 2017-2018. GekkoFyre.
+ **
+ **
+ **   HerpLog is free software: you can redistribute it and/or modify
+ **   it under the terms of the GNU General Public License as published by
+ **   the Free Software Foundation, either version 3 of the License, or
+ **   (at your option) any later version.
+ **
+ **   HerpLog is distributed in the hope that it will be useful,
+ **   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **   GNU General Public License for more details.
+ **
+ **   You should have received a copy of the GNU General Public License
+ **   along with HerpLog.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ **
+ **   The latest source code updates can be obtained from [ 1 ] below at your
+ **   discretion. A web-browser or the 'git' application may be required.
+ **
+ **   [ 1 ] - https://github.com/GekkoFyre/HerpLog
+ **
+ ********************************************************************************/
+
+/**
+ * @file gk_attention_dialog.cpp
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @brief Lists every animal alongside its rolling statistics, with those that need attention at the top, straight from
+ * the summaries that are kept up-to-date as the log entries come in. Beneath them are the alerts that were raised as
+ * the log entries were written, which wait there until acknowledged.
+ */
+
+#include "gk_attention_dialog.hpp"
+#include "ui_gk_attention_dialog.h"
+#include "./../gk_animal_stats.hpp"
+#include <QDateTime>
+#include <QFont>
+#include <QHeaderView>
+#include <QItemSelectionModel>
+#include <QMessageBox>
+#include <QPointer>
+#include <QStringList>
+#include <QTableWidgetItem>
+#include <algorithm>
+#include <exception>
+#include <utility>
+#include <vector>
+
+GkAttentionDialog::GkAttentionDialog(const std::shared_ptr<GkDbRead> &db_read,
+                                     const std::shared_ptr<GkCategoryTree> &category_tree, GkDbAsync *db_async,
+                                     QWidget *parent) : QDialog(parent), ui(new Ui::GkAttentionDialog)
+{
+    ui->setupUi(this);
+    gkDbRead = db_read;
+    gkCategoryTree = category_tree;
+    gkDbAsync = db_async;
+
+    ui->tableWidget_attention->setColumnCount(10);
+    ui->tableWidget_attention->setHorizontalHeaderLabels({ tr("Animal"), tr("Needs Attention"), tr("Last Logged"),
+                                                           tr("Last Weight"), tr("Average Weight"), tr("Trend (per week)"),
+                                                           tr("Toilet"), tr("Hydration"), tr("Vitamins"),
+                                                           tr("Records") });
+    ui->tableWidget_attention->horizontalHeader()->setStretchLastSection(true);
+
+    ui->tableWidget_alerts->setColumnCount(4);
+    ui->tableWidget_alerts->setHorizontalHeaderLabels({ tr("Animal"), tr("Logged"), tr("Alert"), tr("Score") });
+    ui->tableWidget_alerts->horizontalHeader()->setStretchLastSection(true);
+
+    refresh();
+}
+
+GkAttentionDialog::~GkAttentionDialog()
+{
+    delete ui;
+}
+
+/**
+ * @brief GkAttentionDialog::on_pushButton_acknowledge_clicked dismisses the selected alerts, or every one of them if
+ * none are selected. The alerts are taken off the queue by HerpApp, upon the database thread.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @see GkDbWrite::acknowledge_alerts()
+ */
+void GkAttentionDialog::on_pushButton_acknowledge_clicked()
+{
+    std::vector<std::uint64_t> sequences;
+    for (const auto &index: ui->tableWidget_alerts->selectionModel()->selectedRows()) {
+        if (index.row() < static_cast<int>(alert_sequences.size())) {
+            sequences.push_back(alert_sequences[index.row()]);
+        }
+    }
+
+    if (sequences.empty()) {
+        sequences = alert_sequences;
+    }
+
+    if (!sequences.empty()) {
+        emit alerts_acknowledged(sequences);
+    }
+
+    return;
+}
+
+void GkAttentionDialog::on_pushButton_refresh_clicked()
+{
+    refresh();
+    return;
+}
+
+void GkAttentionDialog::on_pushButton_close_window_clicked()
+{
+    this->close();
+    return;
+}
+
+/**
+ * @brief GkAttentionDialog::refresh reads the summary of every animal, and then the alerts, upon the database thread.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @see GkDbWrite::repair_animal_summaries()
+ */
+void GkAttentionDialog::refresh()
+{
+    auto db_read = gkDbRead;
+    QPointer<GkAttentionDialog> self(this); // The dialog deletes itself on closing, perhaps before the summaries are in
+    gkDbAsync->dispatch([db_read]() { return db_read->read_animal_summaries(); },
+                        [self](const std::vector<GkRecords::GkAnimalSummary> &summaries) {
+        if (!self.isNull()) {
+            self->show_summaries(summaries);
+            self->refresh_alerts();
+        }
+    });
+
+    return;
+}
+
+/**
+ * @brief GkAttentionDialog::show_summaries lists the summary of every animal, with those that need attention for the
+ * most reasons at the top. A summary that is awaiting repair is shown in italics.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param summaries The summaries as read from the database.
+ */
+void GkAttentionDialog::show_summaries(const std::vector<GkRecords::GkAnimalSummary> &summaries)
+{
+    try {
+        using namespace GkRecords;
+        const long int now = static_cast<long int>(QDateTime::currentDateTime().toTime_t());
+        std::vector<std::pair<std::uint8_t, GkAnimalSummary>> animals;
+        for (const auto &summary: summaries) {
+            animals.emplace_back(GkAnimalStats::attention(summary, now), summary);
+        }
+
+        const auto reason_count = [](std::uint8_t reasons) {
+            int count = 0;
+            for (; reasons != 0; reasons &= static_cast<std::uint8_t>(reasons - 1)) {
+                ++count;
+            }
+
+            return count;
+        };
+
+        std::sort(animals.begin(), animals.end(), [&reason_count](const std::pair<std::uint8_t, GkAnimalSummary> &lhs,
+                                                                  const std::pair<std::uint8_t, GkAnimalSummary> &rhs) {
+            if (reason_count(lhs.first) != reason_count(rhs.first)) {
+                return reason_count(lhs.first) > reason_count(rhs.first);
+            }
+
+            return lhs.second.last_seen > rhs.second.last_seen;
+        });
+
+        int needing_attention = 0;
+        ui->tableWidget_attention->setRowCount(static_cast<int>(animals.size()));
+        for (int row = 0; row < static_cast<int>(animals.size()); ++row) {
+            const GkAnimalSummary &summary = animals[row].second;
+            const QString animal_name = QString::fromStdString(gkCategoryTree->name(MiscRecordType::gkId,
+                                                                                    gkCategoryTree->find(MiscRecordType::gkId,
+                                                                                                         summary.name_id)));
+            QDateTime last_seen;
+            last_seen.setTime_t(static_cast<uint>(summary.last_seen));
+
+            const QStringList cells = {
+                animal_name, reasons_text(animals[row].first), last_seen.toString(tr("dd/MM/yyyy hh:mm AP")),
+                QString::number(summary.last_weight, 'f', 1), QString::number(summary.weight_ewma, 'f', 1),
+                QString::number(GkAnimalStats::weight_slope(summary) * 7.0, 'f', 1),
+                days_since(summary.last_toilet, now), days_since(summary.last_hydration, now),
+                days_since(summary.last_vitamins, now), QString::number(summary.record_count)
+            };
+
+            for (int column = 0; column < cells.size(); ++column) {
+                QTableWidgetItem *item = new QTableWidgetItem(cells[column]);
+                if (summary.stale) {
+                    QFont font = item->font();
+                    font.setItalic(true);
+                    item->setFont(font);
+                    item->setToolTip(tr("A log entry of this animal was changed, so these figures are being worked out "
+                                        "anew in the background."));
+                }
+
+                ui->tableWidget_attention->setItem(row, column, item);
+            }
+
+            if (animals[row].first != AttentionNone) {
+                ++needing_attention;
+            }
+        }
+
+        ui->label_attention_status->setText(tr("%1 of %2 animals need attention").arg(needing_attention)
+                                            .arg(animals.size()));
+    } catch (const std::exception &e) {
+        QMessageBox::warning(this, tr("Error!"), e.what(), QMessageBox::Ok);
+    }
+
+    return;
+}
+
+/**
+ * @brief GkAttentionDialog::refresh_alerts reads the alerts that have yet to be acknowledged upon the database thread.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @see GkDbRead::read_alerts()
+ */
+void GkAttentionDialog::refresh_alerts()
+{
+    auto db_read = gkDbRead;
+    QPointer<GkAttentionDialog> self(this);
+    gkDbAsync->dispatch([db_read]() { return db_read->read_alerts(); },
+                        [self](const std::vector<GkRecords::GkAlert> &alerts) {
+        if (!self.isNull()) {
+            self->show_alerts(alerts);
+        }
+    });
+
+    return;
+}
+
+/**
+ * @brief GkAttentionDialog::show_alerts lists the alerts that have yet to be acknowledged, the newest at the top.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param alerts The alerts as read from the database, oldest first.
+ */
+void GkAttentionDialog::show_alerts(std::vector<GkRecords::GkAlert> alerts)
+{
+    try {
+        using namespace GkRecords;
+        std::reverse(alerts.begin(), alerts.end());
+
+        alert_sequences.clear();
+        ui->tableWidget_alerts->setRowCount(static_cast<int>(alerts.size()));
+        for (int row = 0; row < static_cast<int>(alerts.size()); ++row) {
+            const GkAlert &alert = alerts[row];
+            QDateTime logged;
+            logged.setTime_t(static_cast<uint>(alert.date_time));
+
+            const QStringList cells = {
+                QString::fromStdString(gkCategoryTree->name(MiscRecordType::gkId,
+                                                            gkCategoryTree->find(MiscRecordType::gkId, alert.name_id))),
+                logged.toString(tr("dd/MM/yyyy hh:mm AP")), alert_text(alert), QString::number(alert.score, 'f', 1)
+            };
+
+            for (int column = 0; column < cells.size(); ++column) {
+                ui->tableWidget_alerts->setItem(row, column, new QTableWidgetItem(cells[column]));
+            }
+
+            alert_sequences.push_back(alert.sequence);
+        }
+
+        ui->label_alerts->setText(tr("%1 alerts raised as the log entries were written:").arg(alerts.size()));
+        ui->pushButton_acknowledge->setEnabled(!alerts.empty());
+    } catch (const std::exception &e) {
+        QMessageBox::warning(this, tr("Error!"), e.what(), QMessageBox::Ok);
+    }
+
+    return;
+}
+
+/**
+ * @brief GkAttentionDialog::alert_text spells out what an alert was raised for.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @see GkAnimalStats::score()
+ */
+QString GkAttentionDialog::alert_text(const GkRecords::GkAlert &alert)
+{
+    using namespace GkRecords;
+    switch (alert.kind) {
+    case AlertWeightDrop:
+        return tr("Sudden weight loss");
+    case AlertWeightGain:
+        return tr("Sudden weight gain");
+    case AlertMissedToilet:
+        return tr("No toilet for %1 days").arg(static_cast<int>(alert.score));
+    case AlertMissedHydration:
+        return tr("No hydration for %1 days").arg(static_cast<int>(alert.score));
+    case AlertMissedVitamins:
+        return tr("No vitamins for %1 days").arg(static_cast<int>(alert.score));
+    }
+
+    return QString();
+}
+
+/**
+ * @brief GkAttentionDialog::reasons_text spells out the reasons why an animal needs attention.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @see GkAnimalStats::attention()
+ */
+QString GkAttentionDialog::reasons_text(const std::uint8_t &reasons)
+{
+    using namespace GkRecords;
+    QStringList why;
+    if ((reasons & AttentionWeightLoss) != 0) {
+        why << tr("Losing weight");
+    }
+
+    if ((reasons & AttentionToilet) != 0) {
+        why << tr("No toilet");
+    }
+
+    if ((reasons & AttentionHydration) != 0) {
+        why << tr("No hydration");
+    }
+
+    if ((reasons & AttentionVitamins) != 0) {
+        why << tr("No vitamins");
+    }
+
+    if ((reasons & AttentionNotLogged) != 0) {
+        why << tr("Not logged lately");
+    }
+
+    return why.join(tr(", "));
+}
+
+/**
+ * @brief GkAttentionDialog::days_since gives how many whole days ago a husbandry flag was last set.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ */
+QString GkAttentionDialog::days_since(const long int &date_time, const long int &now)
+{
+    if (date_time == 0) {
+        return tr("Never");
+    }
+
+    return tr("%1 days ago").arg(std::max(0L, (now - date_time) / (24L * 60L * 60L)));
+}
@@ -0,0 +1,99 @@
+/**
+ **  _   _                 _
+ ** | | | |               | |
+ ** | |_| | ___ _ __ _ __ | |     ___   __ _
+ ** |  _  |/ _ \ '__| '_ \| |    / _ \ / _` |
+ ** | | | |  __/ |  | |_) | |___| (_) | (_| |
+ ** \_| |_/\___|_|  | .__/\_____/\___/ \__, |
+ **                 | |                 __/ |
+ **                 |_|                |___/
+ **
+ **   Thank you for using "HerpLog" for your herpetology management requirements!
+ **   Copyright (C) 2017-2018. GekkoFyre.
+ **
+ **
+ **   HerpLog is free software: you can redistribute it and/or modify
+ **   it under the terms of the GNU General Public License as published by
+ **   the Free Software Foundation, either version 3 of the License, or
+ **   (at your option) any later version.
+ **
+ **   HerpLog is distributed in the hope that it will be useful,
+ **   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **   GNU General Public License for more details.
+ **
+ **   You should have received a copy of the GNU General Public License
+ **   along with HerpLog.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ **
+ **   The latest source code updates can be obtained from [ 1 ] below at your
+ **   discretion. A web-browser or the 'git' application may be required.
+ **
+ **   [ 1 ] - https://github.com/GekkoFyre/HerpLog
+ **
+ ********************************************************************************/
+
+/**
+ * @file gk_attention_dialog.hpp
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @brief Lists every animal alongside its rolling statistics, with those that need attention at the top, straight from
+ * the summaries that are kept up-to-date as the log entries come in. Beneath them are the alerts that were raised as
+ * the log entries were written, which wait there until acknowledged.
+ */
+
+#ifndef GK_ATTENTION_DIALOG_HPP
+#define GK_ATTENTION_DIALOG_HPP
+
+#include "./../options.hpp"
+#include "./../gk_db_read.hpp"
+#include "./../gk_category_tree.hpp"
+#include "./../gk_db_async.hpp"
+#include <QDialog>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace GekkoFyre;
+namespace Ui {
+class GkAttentionDialog;
+}
+
+class GkAttentionDialog : public QDialog
+{
+    Q_OBJECT
+
+public:
+    explicit GkAttentionDialog(const std::shared_ptr<GkDbRead> &db_read,
+                               const std::shared_ptr<GkCategoryTree> &category_tree, GkDbAsync *db_async,
+                               QWidget *parent = nullptr);
+    ~GkAttentionDialog();
+
+public slots:
+    void refresh();
+
+signals:
+    void alerts_acknowledged(const std::vector<std::uint64_t> &sequences);
+
+private slots:
+    void on_pushButton_acknowledge_clicked();
+    void on_pushButton_refresh_clicked();
+    void on_pushButton_close_window_clicked();
+
+private:
+    Ui::GkAttentionDialog *ui;
+    std::shared_ptr<GkDbRead> gkDbRead;
+    std::shared_ptr<GkCategoryTree> gkCategoryTree;
+    GkDbAsync *gkDbAsync;
+    std::vector<std::uint64_t> alert_sequences;
+
+    void refresh_alerts();
+    void show_summaries(const std::vector<GkRecords::GkAnimalSummary> &summaries);
+    void show_alerts(std::vector<GkRecords::GkAlert> alerts);
+    QString alert_text(const GkRecords::GkAlert &alert);
+    QString reasons_text(const std::uint8_t &reasons);
+    QString days_since(const long int &date_time, const long int &now);
+};
+
+#endif // GK_ATTENTION_DIALOG_HPP
@@ -0,0 +1,110 @@
+/**
+ **  _   _                 _
+ ** | | | |               | |
+ ** | |_| | ___ _ __ _ __ | |     ___   __ _
+ ** |  _  |/ _ \ '__| '_ \| |    / _ \ / _` |
+ ** | | | |  __/ |  | |_) | |___| (_) | (_| |
+ ** \_| |_/\___|_|  | .__/\_____/\___/ \__, |
+ **                 | |                 __/ |
+ **                 |_|                |___/
+ **
+ **   Thank you for using "HerpLog" for your herpetology management requirements!
+ **   Copyright (C) 2017-2018. GekkoFyre.
+ **
+ **
+ **   HerpLog is free software: you can redistribute it and/or modify
+ **   it under the terms of the GNU General Public License as published by
+ **   the Free Software Foundation, either version 3 of the License, or
+ **   (at your option) any later version.
+ **
+ **   HerpLog is distributed in the hope that it will be useful,
+ **   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **   GNU General Public License for more details.
+ **
+ **   You should have received a copy of the GNU General Public License
+ **   along with HerpLog.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ **
+ **   The latest source code updates can be obtained from [ 1 ] below at your
+ **   discretion. A web-browser or the 'git' application may be required.
+ **
+ **   [ 1 ] - https://github.com/GekkoFyre/HerpLog
+ **
+ ********************************************************************************/
+
+/**
+ * @file gk_diagnostics_dialog.cpp
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @brief Shows the internals of LevelDB, the hit rate of its block cache and the footprint of the database upon the
+ * disk, as gathered up by `GkDbDiagnostics`.
+ */
+
+#include "gk_diagnostics_dialog.hpp"
+#include "ui_gk_diagnostics_dialog.h"
+#include "./../gk_db_conn.hpp"
+#include <QMessageBox>
+#include <QFontDatabase>
+#include <exception>
+
+GkDiagnosticsDialog::GkDiagnosticsDialog(const GkFile::FileDb &database, const fs::path &temp_dir,
+                                         const std::string &archive_file, QWidget *parent)
+    : QDialog(parent), ui(new Ui::GkDiagnosticsDialog)
+{
+    ui->setupUi(this);
+    ui->plainTextEdit_report->setFont(QFontDatabase::systemFont(QFontDatabase::FixedFont));
+
+    db_conn = database;
+    db_temp_dir = temp_dir;
+    db_archive_file = archive_file;
+    gkDiagnostics = std::make_unique<GkDbDiagnostics>(db_conn);
+    ui->pushButton_reset_cache->setEnabled(db_conn.block_cache != nullptr);
+
+    refresh();
+}
+
+GkDiagnosticsDialog::~GkDiagnosticsDialog()
+{
+    delete ui;
+}
+
+void GkDiagnosticsDialog::on_pushButton_refresh_clicked()
+{
+    refresh();
+    return;
+}
+
+/**
+ * @brief GkDiagnosticsDialog::on_pushButton_reset_cache_clicked zeroes the hits and misses of the block cache, so that
+ * the hit rate of whatever is done next can be seen on its own.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ */
+void GkDiagnosticsDialog::on_pushButton_reset_cache_clicked()
+{
+    if (db_conn.block_cache != nullptr) {
+        db_conn.block_cache->reset_counters();
+    }
+
+    refresh();
+    return;
+}
+
+void GkDiagnosticsDialog::on_pushButton_close_window_clicked()
+{
+    this->close();
+    return;
+}
+
+void GkDiagnosticsDialog::refresh()
+{
+    try {
+        GkDiagnostics::GkDbReport report = gkDiagnostics->collect(db_temp_dir, db_archive_file);
+        ui->plainTextEdit_report->setPlainText(gkDiagnostics->to_text(report));
+    } catch (const std::exception &e) {
+        QMessageBox::warning(this, tr("Error!"), e.what(), QMessageBox::Ok);
+    }
+
+    return;
+}
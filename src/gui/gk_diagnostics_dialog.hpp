@@ -0,0 +1,82 @@
+/**
+ **  _   _                 _
+ ** | | | |               | |
+ ** | |_| | ___ _ __ _ __ | |     ___   __ _
+ ** |  _  |/ _ \ '__| '_ \| |    / _ \ / _` |
+ ** | | | |  __/ |  | |_) | |___| (_) | (_| |
+ ** \_| |_/\___|_|  | .__/\_____/\___/ \__, |
+ **                 | |                 __/ |
+ **                 |_|                |___/
+ **
+ **   Thank you for using "HerpLog" for your herpetology management requirements!
+ **   Copyright (C) 2017-2018. GekkoFyre.
+ **
+ **
+ **   HerpLog is free software: you can redistribute it and/or modify
+ **   it under the terms of the GNU General Public License as published by
+ **   the Free Software Foundation, either version 3 of the License, or
+ **   (at your option) any later version.
+ **
+ **   HerpLog is distributed in the hope that it will be useful,
+ **   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **   GNU General Public License for more details.
+ **
+ **   You should have received a copy of the GNU General Public License
+ **   along with HerpLog.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ **
+ **   The latest source code updates can be obtained from [ 1 ] below at your
+ **   discretion. A web-browser or the 'git' application may be required.
+ **
+ **   [ 1 ] - https://github.com/GekkoFyre/HerpLog
+ **
+ ********************************************************************************/
+
+/**
+ * @file gk_diagnostics_dialog.hpp
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @brief Shows the internals of LevelDB, the hit rate of its block cache and the footprint of the database upon the
+ * disk, as gathered up by `GkDbDiagnostics`.
+ */
+
+#ifndef GK_DIAGNOSTICS_DIALOG_HPP
+#define GK_DIAGNOSTICS_DIALOG_HPP
+
+#include "./../options.hpp"
+#include "./../gk_db_diagnostics.hpp"
+#include <QDialog>
+#include <memory>
+#include <string>
+
+using namespace GekkoFyre;
+namespace Ui {
+class GkDiagnosticsDialog;
+}
+
+class GkDiagnosticsDialog : public QDialog
+{
+    Q_OBJECT
+
+public:
+    explicit GkDiagnosticsDialog(const GkFile::FileDb &database, const fs::path &temp_dir,
+                                 const std::string &archive_file, QWidget *parent = nullptr);
+    ~GkDiagnosticsDialog();
+
+private slots:
+    void on_pushButton_refresh_clicked();
+    void on_pushButton_reset_cache_clicked();
+    void on_pushButton_close_window_clicked();
+
+private:
+    Ui::GkDiagnosticsDialog *ui;
+    std::unique_ptr<GkDbDiagnostics> gkDiagnostics;
+    GkFile::FileDb db_conn;
+    fs::path db_temp_dir;
+    std::string db_archive_file;
+
+    void refresh();
+};
+
+#endif // GK_DIAGNOSTICS_DIALOG_HPP
@@ -0,0 +1,228 @@
+/**
+ **  _   _                 _
+ ** | | | |               | |
+ ** | |_| | ___ _ __ _ __ | |     ___   __ _
+ ** |  _  |/ _ \ '__| '_ \| |    / _ \ / _` |
+ ** | | | |  __/ |  | |_) | |___| (_) | (_| |
+ ** \_| |_/\___|_|  | .__/\_____/\___/ \__, |
+ **                 | |                 __/ |
+ **                 |_|                |___/
+ **
+ **   Thank you for using "HerpLog" for your herpetology management requirements!
+ **   Copyright (C) 2017-2018. GekkoFyre.
+ **
+ **
+ **   HerpLog is free software: you can redistribute it and/or modify
+ **   it under the terms of the GNU General Public License as published by
+ **   the Free Software Foundation, either version 3 of the License, or
+ **   (at your option) any later version.
+ **
+ **   HerpLog is distributed in the hope that it will be useful,
+ **   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **   GNU General Public License for more details.
+ **
+ **   You should have received a copy of the GNU General Public License
+ **   along with HerpLog.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ **
+ **   The latest source code updates can be obtained from [ 1 ] below at your
+ **   discretion. A web-browser or the 'git' application may be required.
+ **
+ **   [ 1 ] - https://github.com/GekkoFyre/HerpLog
+ **
+ ********************************************************************************/
+
+/**
+ * @file gk_find_dialog.cpp
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @brief Searches through the notes of every log entry via the full-text index, and takes the user to whichever one
+ * they pick out from the results.
+ */
+
+#include "gk_find_dialog.hpp"
+#include "ui_gk_find_dialog.h"
+#include <QDateTime>
+#include <QElapsedTimer>
+#include <QHeaderView>
+#include <QPointer>
+#include <QTableWidgetItem>
+#include <algorithm>
+#include <exception>
+
+GkFindDialog::GkFindDialog(const std::shared_ptr<GkTextIndex> &text_index, const std::shared_ptr<GkDbRead> &db_read,
+                           GkDbAsync *db_async, QWidget *parent) : QDialog(parent), ui(new Ui::GkFindDialog)
+{
+    ui->setupUi(this);
+    gkTextIndex = text_index;
+    gkDbRead = db_read;
+    gkDbAsync = db_async;
+    find_generation = 0;
+
+    ui->tableWidget_find_results->setColumnCount(2);
+    ui->tableWidget_find_results->setHorizontalHeaderLabels({ tr("Date/Time"), tr("Notes") });
+    ui->tableWidget_find_results->horizontalHeader()->setStretchLastSection(true);
+    ui->lineEdit_find_query->setFocus();
+}
+
+GkFindDialog::~GkFindDialog()
+{
+    delete ui;
+}
+
+void GkFindDialog::on_pushButton_find_clicked()
+{
+    find();
+    return;
+}
+
+void GkFindDialog::on_lineEdit_find_query_returnPressed()
+{
+    find();
+    return;
+}
+
+void GkFindDialog::on_tableWidget_find_results_cellActivated(int row, int column)
+{
+    Q_UNUSED(column);
+    QTableWidgetItem *item = ui->tableWidget_find_results->item(row, 0);
+    if (item != nullptr) {
+        emit record_selected(item->data(Qt::UserRole).toString().toStdString());
+    }
+
+    return;
+}
+
+void GkFindDialog::on_pushButton_close_window_clicked()
+{
+    this->close();
+    return;
+}
+
+/**
+ * @brief GkFindDialog::find runs the query upon the database thread, then reads back the matching log entries (up to a
+ * point) there as well, so that they can be shown newest first, alongside whichever of their notes matched.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ */
+void GkFindDialog::find()
+{
+    const std::string query = ui->lineEdit_find_query->text().toStdString();
+    const std::uint64_t generation = ++find_generation;
+    ui->tableWidget_find_results->setRowCount(0);
+    if (query.empty()) {
+        ui->label_find_status->clear();
+        return;
+    }
+
+    ui->label_find_status->setText(tr("Searching..."));
+    auto text_index = gkTextIndex;
+    auto db_read = gkDbRead;
+    QPointer<GkFindDialog> self(this); // The dialog deletes itself on closing, perhaps before the results are in
+    gkDbAsync->dispatch([text_index, db_read, query]() {
+        QElapsedTimer timer;
+        timer.start();
+        const std::vector<std::string> matches = text_index->search(query);
+
+        GkFindResults results;
+        results.match_count = matches.size();
+        results.search_ms = timer.elapsed();
+        for (const auto &record_id: matches) {
+            if (results.records.size() >= static_cast<std::size_t>(HERPLOG_FIND_RESULTS_SHOWN)) {
+                break;
+            }
+
+            try {
+                results.records.push_back(db_read->read_log_entry(record_id));
+            } catch (const std::exception &e) {
+                Q_UNUSED(e); // Damaged beyond being shown, so leave it out
+            }
+        }
+
+        std::sort(results.records.begin(), results.records.end(),
+                  [](const GkRecords::GkSubmit &a, const GkRecords::GkSubmit &b) {
+            return a.date_time > b.date_time;
+        });
+
+        return results;
+    }, [self, generation, query](const GkFindResults &results) {
+        if (self.isNull() || (generation != self->find_generation)) {
+            return; // Closed, or another query has been sent off in the meantime
+        }
+
+        self->show_results(query, results);
+    });
+
+    return;
+}
+
+/**
+ * @brief GkFindDialog::show_results lists the log entries that were found by `find()`.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param query The query that was run.
+ * @param results What the query turned up.
+ */
+void GkFindDialog::show_results(const std::string &query, const GkFindResults &results)
+{
+    const std::vector<std::string> query_terms = GkTextIndex::tokenise(query);
+    const auto &records = results.records;
+    ui->tableWidget_find_results->setRowCount(static_cast<int>(records.size()));
+    for (int row = 0; row < static_cast<int>(records.size()); ++row) {
+        QDateTime qdt;
+        qdt.setTime_t(records[row].date_time);
+        QTableWidgetItem *date_item = new QTableWidgetItem(qdt.toString(tr("dd/MM/yyyy hh:mm:ss AP")));
+        date_item->setData(Qt::UserRole, QString::fromStdString(records[row].record_id));
+        ui->tableWidget_find_results->setItem(row, 0, date_item);
+        ui->tableWidget_find_results->setItem(row, 1, new QTableWidgetItem(snippet(records[row], query_terms)));
+    }
+
+    if (results.match_count > records.size()) {
+        ui->label_find_status->setText(tr("%1 matching log entries, found in %2 ms (showing %3)")
+                                       .arg(results.match_count).arg(results.search_ms).arg(records.size()));
+    } else {
+        ui->label_find_status->setText(tr("%1 matching log entries, found in %2 ms").arg(results.match_count)
+                                       .arg(results.search_ms));
+    }
+
+    return;
+}
+
+/**
+ * @brief GkFindDialog::snippet picks out whichever of the notes of a log entry contain a word of the query, or the
+ * first of them that isn't empty otherwise.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ */
+QString GkFindDialog::snippet(const GkRecords::GkSubmit &submit, const std::vector<std::string> &query_terms)
+{
+    const std::vector<std::pair<QString, const std::string *>> fields = {
+        { tr("Notes"), &submit.further_notes }, { tr("Vitamins"), &submit.vitamin_notes },
+        { tr("Toilet"), &submit.toilet_notes }, { tr("Temperature"), &submit.temp_notes },
+        { tr("Weight"), &submit.weight_notes }, { tr("Hydration"), &submit.hydration_notes }
+    };
+
+    const std::pair<QString, const std::string *> *chosen = nullptr;
+    for (const auto &field: fields) {
+        if (field.second->empty()) {
+            continue;
+        }
+
+        if (chosen == nullptr) {
+            chosen = &field;
+        }
+
+        const std::vector<std::string> terms = GkTextIndex::tokenise(*field.second);
+        if (std::find_first_of(terms.begin(), terms.end(), query_terms.begin(), query_terms.end()) != terms.end()) {
+            chosen = &field;
+            break;
+        }
+    }
+
+    if (chosen == nullptr) {
+        return QString();
+    }
+
+    return tr("%1: %2").arg(chosen->first, QString::fromStdString(*chosen->second).simplified());
+}
@@ -0,0 +1,97 @@
+/**
+ **  _   _                 _
+ ** | | | |               | |
+ ** | |_| | ___ _ __ _ __ | |     ___   __ _
+ ** |  _  |/ _ \ '__| '_ \| |    / _ \ / _` |
+ ** | | | |  __/ |  | |_) | |___| (_) | (_| |
+ ** \_| |_/\___|_|  | .__/\_____/\___/ \__, |
+ **                 | |                 __/ |
+ **                 |_|                |___/
+ **
+ **   Thank you for using "HerpLog" for your herpetology management requirements!
+ **   Copyright (C) 2017-2018. GekkoFyre.
+ **
+ **
+ **   HerpLog is free software: you can redistribute it and/or modify
+ **   it under the terms of the GNU General Public License as published by
+ **   the Free Software Foundation, either version 3 of the License, or
+ **   (at your option) any later version.
+ **
+ **   HerpLog is distributed in the hope that it will be useful,
+ **   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **   GNU General Public License for more details.
+ **
+ **   You should have received a copy of the GNU General Public License
+ **   along with HerpLog.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ **
+ **   The latest source code updates can be obtained from [ 1 ] below at your
+ **   discretion. A web-browser or the 'git' application may be required.
+ **
+ **   [ 1 ] - https://github.com/GekkoFyre/HerpLog
+ **
+ ********************************************************************************/
+
+/**
+ * @file gk_find_dialog.hpp
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @brief Searches through the notes of every log entry via the full-text index, and takes the user to whichever one
+ * they pick out from the results.
+ */
+
+#ifndef GK_FIND_DIALOG_HPP
+#define GK_FIND_DIALOG_HPP
+
+#include "./../options.hpp"
+#include "./../gk_db_read.hpp"
+#include "./../gk_text_index.hpp"
+#include "./../gk_db_async.hpp"
+#include <QDialog>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace GekkoFyre;
+namespace Ui {
+class GkFindDialog;
+}
+
+class GkFindDialog : public QDialog
+{
+    Q_OBJECT
+
+public:
+    explicit GkFindDialog(const std::shared_ptr<GkTextIndex> &text_index, const std::shared_ptr<GkDbRead> &db_read,
+                          GkDbAsync *db_async, QWidget *parent = nullptr);
+    ~GkFindDialog();
+
+signals:
+    void record_selected(const std::string &record_id);
+
+private slots:
+    void on_pushButton_find_clicked();
+    void on_lineEdit_find_query_returnPressed();
+    void on_tableWidget_find_results_cellActivated(int row, int column);
+    void on_pushButton_close_window_clicked();
+
+private:
+    Ui::GkFindDialog *ui;
+    std::shared_ptr<GkTextIndex> gkTextIndex;
+    std::shared_ptr<GkDbRead> gkDbRead;
+    GkDbAsync *gkDbAsync;
+    std::uint64_t find_generation; // Bumped with every query, so that the results of an earlier one are dropped
+
+    struct GkFindResults {
+        std::size_t match_count;                  // How many log entries matched, all told
+        qint64 search_ms;                         // How long the full-text index took to search
+        std::vector<GkRecords::GkSubmit> records; // The log entries that are to be shown, newest first
+    };
+
+    void find();
+    void show_results(const std::string &query, const GkFindResults &results);
+    QString snippet(const GkRecords::GkSubmit &submit, const std::vector<std::string> &query_terms);
+};
+
+#endif // GK_FIND_DIALOG_HPP
@@ -0,0 +1,163 @@
+/**
+ **  _   _                 _
+ ** | | | |               | |
+ ** | |_| | ___ _ __ _ __ | |     ___   __ _
+ ** |  _  |/ _ \ '__| '_ \| |    / _ \ / _` |
+ ** | | | |  __/ |  | |_) | |___| (_) | (_| |
+ ** \_| |_/\___|_|  | .__/\_____/\___/ \__, |
+ **                 | |                 __/ |
+ **                 |_|                |___/
+ **
+ **   Thank you for using "HerpLog" for your herpetology management requirements!
+ **   Copyright (C) 2017-2018. GekkoFyre.
+ **
+ **
+ **   HerpLog is free software: you can redistribute it and/or modify
+ **   it under the terms of the GNU General Public License as published by
+ **   the Free Software Foundation, either version 3 of the License, or
+ **   (at your option) any later version.
+ **
+ **   HerpLog is distributed in the hope that it will be useful,
+ **   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **   GNU General Public License for more details.
+ **
+ **   You should have received a copy of the GNU General Public License
+ **   along with HerpLog.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ **
+ **   The latest source code updates can be obtained from [ 1 ] below at your
+ **   discretion. A web-browser or the 'git' application may be required.
+ **
+ **   [ 1 ] - https://github.com/GekkoFyre/HerpLog
+ **
+ ********************************************************************************/
+
+/**
+ * @file gk_name_completer.cpp
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @brief Pops up the Licensees, Species, or Animals whose names most resemble what has been typed into one of the
+ * category QComboBoxes, as ranked by the trigram index of the `GkCategoryTree`.
+ */
+
+#include "gk_name_completer.hpp"
+#include <QAbstractItemView>
+#include <QLineEdit>
+#include <QStandardItem>
+
+/**
+ * @brief GkNameCompleter::GkNameCompleter makes the given QComboBox editable, so that a name can be typed into it, but
+ * without ever adding whatever was typed as an item of its own; only the categories already within it can be chosen.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param category_tree The tree whose names are looked up.
+ * @param record_type Whether the QComboBox holds Licensees, Species, or Animals.
+ * @param parent The QComboBox to complete the names of.
+ */
+GkNameCompleter::GkNameCompleter(const std::shared_ptr<GkCategoryTree> &category_tree,
+                                 const GkRecords::MiscRecordType &record_type, QComboBox *parent) : QCompleter(parent)
+{
+    gkCategoryTree = category_tree;
+    category_type = record_type;
+    comboBox = parent;
+
+    // The matches are already ranked by the trigram index, so QCompleter mustn't filter them by prefix a second time
+    matches_model = new QStandardItemModel(this);
+    setModel(matches_model);
+    setCompletionMode(QCompleter::UnfilteredPopupCompletion);
+    setMaxVisibleItems(static_cast<int>(HERPLOG_COMPLETER_MATCHES));
+
+    comboBox->setEditable(true);
+    comboBox->setInsertPolicy(QComboBox::NoInsert);
+    comboBox->setCompleter(this);
+
+    QObject::connect(comboBox->lineEdit(), &QLineEdit::textEdited, this, &GkNameCompleter::text_edited);
+    QObject::connect(comboBox->lineEdit(), &QLineEdit::editingFinished, this, &GkNameCompleter::editing_finished);
+
+    // Queued, so that the QLineEdit has already been handed the completion by the time the QComboBox is put right
+    QObject::connect(this, static_cast<void (QCompleter::*)(const QModelIndex &)>(&QCompleter::activated),
+                     this, &GkNameCompleter::match_activated, Qt::QueuedConnection);
+}
+
+GkNameCompleter::~GkNameCompleter()
+{}
+
+/**
+ * @brief GkNameCompleter::text_edited looks up the names that best match what has been typed so far, upon every
+ * keystroke, and hands them over to the popup.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ */
+void GkNameCompleter::text_edited(const QString &text)
+{
+    matches_model->clear();
+    if (text.trimmed().isEmpty()) {
+        popup()->hide();
+        return;
+    }
+
+    for (const auto &match: gkCategoryTree->fuzzy_find(category_type, text.toStdString(), HERPLOG_COMPLETER_MATCHES)) {
+        QStandardItem *item = new QStandardItem(display_name(match.idx));
+        item->setData(static_cast<uint>(match.idx), Qt::UserRole);
+        matches_model->appendRow(item);
+    }
+
+    if (matches_model->rowCount() > 0) {
+        complete();
+    } else {
+        popup()->hide();
+    }
+
+    return;
+}
+
+void GkNameCompleter::match_activated(const QModelIndex &index)
+{
+    if (!index.isValid() || comboBox.isNull()) {
+        return;
+    }
+
+    emit category_chosen(static_cast<std::uint32_t>(index.data(Qt::UserRole).toUInt()));
+    editing_finished();
+    return;
+}
+
+/**
+ * @brief GkNameCompleter::editing_finished puts back the name of the selected category, so that whatever was left
+ * half-typed within the QComboBox is never mistaken for it.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ */
+void GkNameCompleter::editing_finished()
+{
+    if (!comboBox.isNull()) {
+        comboBox->setEditText(comboBox->itemText(comboBox->currentIndex()));
+    }
+
+    return;
+}
+
+/**
+ * @brief GkNameCompleter::display_name shows the name of a Species or Animal alongside that of its parent, as there may
+ * well be more than one `Pogona vitticeps` to choose from.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ */
+QString GkNameCompleter::display_name(const std::uint32_t &node_idx)
+{
+    using namespace GkRecords;
+    const QString name = QString::fromStdString(gkCategoryTree->name(category_type, node_idx));
+    if (category_type == MiscRecordType::gkLicensee) {
+        return name;
+    }
+
+    const MiscRecordType parent_type = (category_type == MiscRecordType::gkId) ? MiscRecordType::gkSpecies :
+                                                                                  MiscRecordType::gkLicensee;
+    const std::uint32_t parent_idx = gkCategoryTree->parent(category_type, node_idx);
+    if (parent_idx == GkCategoryTree::npos) {
+        return name;
+    }
+
+    return tr("%1 (%2)").arg(name).arg(QString::fromStdString(gkCategoryTree->name(parent_type, parent_idx)));
+}
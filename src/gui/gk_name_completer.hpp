@@ -0,0 +1,83 @@
+/**
+ **  _   _                 _
+ ** | | | |               | |
+ ** | |_| | ___ _ __ _ __ | |     ___   __ _
+ ** |  _  |/ _ \ '__| '_ \| |    / _ \ / _` |
+ ** | | | |  __/ |  | |_) | |___| (_) | (_| |
+ ** \_| |_/\___|_|  | .__/\_____/\___/ \__, |
+ **                 | |                 __/ |
+ **                 |_|                |___/
+ **
+ **   Thank you for using "HerpLog" for your herpetology management requirements!
+ **   Copyright (C) 2017-2018. GekkoFyre.
+ **
+ **
+ **   HerpLog is free software: you can redistribute it and/or modify
+ **   it under the terms of the GNU General Public License as published by
+ **   the Free Software Foundation, either version 3 of the License, or
+ **   (at your option) any later version.
+ **
+ **   HerpLog is distributed in the hope that it will be useful,
+ **   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **   GNU General Public License for more details.
+ **
+ **   You should have received a copy of the GNU General Public License
+ **   along with HerpLog.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ **
+ **   The latest source code updates can be obtained from [ 1 ] below at your
+ **   discretion. A web-browser or the 'git' application may be required.
+ **
+ **   [ 1 ] - https://github.com/GekkoFyre/HerpLog
+ **
+ ********************************************************************************/
+
+/**
+ * @file gk_name_completer.hpp
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @brief Pops up the Licensees, Species, or Animals whose names most resemble what has been typed into one of the
+ * category QComboBoxes, as ranked by the trigram index of the `GkCategoryTree`.
+ */
+
+#ifndef GK_NAME_COMPLETER_HPP
+#define GK_NAME_COMPLETER_HPP
+
+#include "./../options.hpp"
+#include "./../gk_category_tree.hpp"
+#include <QCompleter>
+#include <QComboBox>
+#include <QPointer>
+#include <QStandardItemModel>
+#include <memory>
+
+using namespace GekkoFyre;
+
+class GkNameCompleter : public QCompleter
+{
+    Q_OBJECT
+
+public:
+    explicit GkNameCompleter(const std::shared_ptr<GkCategoryTree> &category_tree,
+                             const GkRecords::MiscRecordType &record_type, QComboBox *parent);
+    ~GkNameCompleter();
+
+signals:
+    void category_chosen(const std::uint32_t &node_idx);
+
+private slots:
+    void text_edited(const QString &text);
+    void match_activated(const QModelIndex &index);
+    void editing_finished();
+
+private:
+    std::shared_ptr<GkCategoryTree> gkCategoryTree;
+    GkRecords::MiscRecordType category_type;
+    QPointer<QComboBox> comboBox;
+    QPointer<QStandardItemModel> matches_model;
+
+    QString display_name(const std::uint32_t &node_idx);
+};
+
+#endif // GK_NAME_COMPLETER_HPP
@@ -0,0 +1,612 @@
+/**
+ **  _   _                 _
+ ** | | | |               | |
+ ** | |_| | ___ _ __ _ __ | |     ___   __ _
+ ** |  _  |/ _ \ '__| '_ \| |    / _ \ / _` |
+ ** | | | |  __/ |  | |_) | |___| (_) | (_| |
+ ** \_| |_/\___|_|  | .__/\_____/\___/ \__, |
+ **                 | |                 __/ |
+ **                 |_|                |___/
+ **
+ **   Thank you for using "HerpLog" for your herpetology management requirements!
+ **   Copyright (C) 2017-2018. GekkoFyre.
+ **
+ **
+ **   HerpLog is free software: you can redistribute it and/or modify
+ **   it under the terms of the GNU General Public License as published by
+ **   the Free Software Foundation, either version 3 of the License, or
+ **   (at your option) any later version.
+ **
+ **   HerpLog is distributed in the hope that it will be useful,
+ **   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **   GNU General Public License for more details.
+ **
+ **   You should have received a copy of the GNU General Public License
+ **   along with HerpLog.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ **
+ **   The latest source code updates can be obtained from [ 1 ] below at your
+ **   discretion. A web-browser or the 'git' application may be required.
+ **
+ **   [ 1 ] - https://github.com/GekkoFyre/HerpLog
+ **
+ ********************************************************************************/
+
+/**
+ * @file gk_record_model.cpp
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @brief A table model of every record within the database, which is read from the timestamp index a page at a time and
+ * only decodes the rows that are actually being looked at.
+ */
+
+#include "gk_record_model.hpp"
+#include <QDateTime>
+#include <algorithm>
+#include <exception>
+#include <utility>
+
+GkRecordModel::GkRecordModel(const std::shared_ptr<GkDbRead> &gk_db_read, const std::shared_ptr<GkChangeFeed> &gk_change_feed,
+                             GkDbAsync *gk_db_async, const std::shared_ptr<GkStringOp> &gk_str_op, QObject *parent)
+    : QAbstractTableModel(parent)
+{
+    gkDbRead = gk_db_read;
+    gkChangeFeed = gk_change_feed;
+    gkDbAsync = gk_db_async;
+    gkStrOp = gk_str_op;
+    fetching = false;
+    fetch_generation = 0;
+    feed_sequence = gkChangeFeed->last_sequence();
+    fetched_all = true; // Nothing is read from the database until `reload()` is called
+    descending = true;
+}
+
+GkRecordModel::~GkRecordModel()
+{}
+
+int GkRecordModel::rowCount(const QModelIndex &parent) const
+{
+    if (parent.isValid()) {
+        return 0;
+    }
+
+    return static_cast<int>(entries.size());
+}
+
+int GkRecordModel::columnCount(const QModelIndex &parent) const
+{
+    if (parent.isValid()) {
+        return 0;
+    }
+
+    return ColumnCount;
+}
+
+QVariant GkRecordModel::data(const QModelIndex &index, int role) const
+{
+    if (!index.isValid() || (index.row() >= rowCount())) {
+        return QVariant();
+    }
+
+    if (role == Qt::TextAlignmentRole) {
+        if (index.column() == WeightColumn) {
+            return QVariant(Qt::AlignRight | Qt::AlignVCenter);
+        }
+
+        return QVariant(Qt::AlignLeft | Qt::AlignVCenter);
+    }
+
+    if (role != Qt::DisplayRole) {
+        return QVariant();
+    }
+
+    if (index.column() == DateTimeColumn) {
+        // The Date/Time is already known from the index, so there's no need to decode the row just for this
+        return QDateTime::fromTime_t(static_cast<uint>(entries[index.row()].date_time)).toString(tr("dd/MM/yyyy hh:mm:ss AP"));
+    }
+
+    try {
+        const auto &row = decode_row(index.row());
+        switch (index.column()) {
+            case AnimalColumn:
+                return QString::fromStdString(row.identifier.identifier_str);
+            case SpeciesColumn:
+                return QString::fromStdString(row.species.species_name);
+            case LicenseeColumn:
+                return QString::fromStdString(row.licensee.licensee_name);
+            case WeightColumn:
+                return QString::number(row.weight, 'f', 3);
+            case ToiletColumn:
+                return row.went_toilet ? tr("Yes") : tr("No");
+            case HydrationColumn:
+                return row.had_hydration ? tr("Yes") : tr("No");
+            case VitaminsColumn:
+                return row.had_vitamins ? tr("Yes") : tr("No");
+            case NotesColumn:
+                return QString::fromStdString(row.further_notes).simplified();
+            default:
+                break;
+        }
+    } catch (const std::exception &e) {
+        Q_UNUSED(e); // The record has most likely been deleted from underneath us, and will be removed shortly
+    }
+
+    return QVariant();
+}
+
+QVariant GkRecordModel::headerData(int section, Qt::Orientation orientation, int role) const
+{
+    if ((orientation != Qt::Horizontal) || (role != Qt::DisplayRole)) {
+        return QVariant();
+    }
+
+    switch (section) {
+        case DateTimeColumn:
+            return tr("Date/Time");
+        case AnimalColumn:
+            return tr("Animal");
+        case SpeciesColumn:
+            return tr("Species");
+        case LicenseeColumn:
+            return tr("Licensee");
+        case WeightColumn:
+            return tr("Weight (g)");
+        case ToiletColumn:
+            return tr("Toilet");
+        case HydrationColumn:
+            return tr("Hydration");
+        case VitaminsColumn:
+            return tr("Vitamins");
+        case NotesColumn:
+            return tr("Further Notes");
+        default:
+            return QVariant();
+    }
+}
+
+bool GkRecordModel::canFetchMore(const QModelIndex &parent) const
+{
+    if (parent.isValid()) {
+        return false;
+    }
+
+    return !fetched_all && (entries.size() < static_cast<std::size_t>(HERPLOG_RECORD_MODEL_MAX_ROWS));
+}
+
+/**
+ * @brief GkRecordModel::fetchMore reads the next page of keys from the timestamp index. This is called upon by the view
+ * whenever the user scrolls towards the bottom of what has been fetched so far, up until `HERPLOG_RECORD_MODEL_MAX_ROWS`
+ * rows have been fetched. Sorting the other way around is what gets at the records beyond that.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ */
+void GkRecordModel::fetchMore(const QModelIndex &parent)
+{
+    if (!canFetchMore(parent)) {
+        return;
+    }
+
+    if (fetching) {
+        return; // The page is already on its way
+    }
+
+    // The page is read upon the database thread, and anything fetched before it arrives gets thrown away on reloading
+    using namespace GkRecords;
+    const std::size_t limit = std::min(static_cast<std::size_t>(HERPLOG_RECORD_MODEL_PAGE_SIZE),
+                                       static_cast<std::size_t>(HERPLOG_RECORD_MODEL_MAX_ROWS) - entries.size());
+    auto db_read = gkDbRead;
+    const std::string cursor = fetch_cursor;
+    const bool desc = descending;
+    const std::uint64_t generation = fetch_generation;
+    fetching = true;
+    gkDbAsync->dispatch([db_read, cursor, limit, desc]() {
+        std::pair<std::vector<GkIndexEntry>, std::string> page;
+        try {
+            page.first = db_read->scan_timestamp_index(cursor, limit, desc);
+        } catch (const std::exception &e) {
+            page.second = e.what();
+        }
+
+        return page;
+    }, [this, limit, generation](const std::pair<std::vector<GkIndexEntry>, std::string> &page) {
+        if (generation != fetch_generation) {
+            return;
+        }
+
+        fetching = false;
+        if (!page.second.empty()) {
+            fetched_all = true; // Don't keep on trying with every scroll of the view
+            emit fetch_failed(QString::fromStdString(page.second));
+            return;
+        }
+
+        if (page.first.size() < limit) {
+            fetched_all = true;
+        }
+
+        if (page.first.empty()) {
+            return;
+        }
+
+        fetch_cursor = gkStrOp->timestamp_index_key(page.first.back().date_time, page.first.back().record_id);
+
+        // Any record that was inserted whilst the page was on its way has been placed already
+        std::vector<GkIndexEntry> rows;
+        rows.reserve(page.first.size());
+        for (const auto &entry: page.first) {
+            if (entry_times.emplace(entry.record_id, entry.date_time).second) {
+                rows.push_back(entry);
+            }
+        }
+
+        if (rows.empty()) {
+            return;
+        }
+
+        const int first = static_cast<int>(entries.size());
+        beginInsertRows(QModelIndex(), first, first + static_cast<int>(rows.size()) - 1);
+        entries.insert(entries.end(), rows.begin(), rows.end());
+        endInsertRows();
+    });
+
+    return;
+}
+
+/**
+ * @brief GkRecordModel::sort only the Date/Time column can be sorted upon, as that is what the timestamp index is ordered
+ * by. The index is simply walked in the other direction, rather than anything being sorted in memory. The view puts
+ * the sort indicator back upon the Date/Time column should any other be clicked.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param column The column to sort by.
+ * @param order Whether the oldest or newest records should come first.
+ */
+void GkRecordModel::sort(int column, Qt::SortOrder order)
+{
+    if (column != DateTimeColumn) {
+        return;
+    }
+
+    descending = (order == Qt::DescendingOrder);
+    reload();
+
+    return;
+}
+
+/**
+ * @brief GkRecordModel::reload throws away everything that has been fetched and starts again from the first page.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ */
+void GkRecordModel::reload()
+{
+    feed_sequence = gkChangeFeed->last_sequence(); // Whatever was committed up until now gets read from the index
+    beginResetModel();
+    entries.clear();
+    entry_times.clear();
+    fetch_cursor.clear();
+    fetching = false;
+    ++fetch_generation;
+    row_cache.clear();
+    row_lru.clear();
+    cat_names.clear();
+    fetched_all = false;
+    endResetModel();
+
+    return;
+}
+
+/**
+ * @brief GkRecordModel::sort_order
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @return Whether the oldest or newest records are being presented first.
+ */
+Qt::SortOrder GkRecordModel::sort_order() const
+{
+    return descending ? Qt::DescendingOrder : Qt::AscendingOrder;
+}
+
+/**
+ * @brief GkRecordModel::record_id
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param row The row in question.
+ * @return The Record ID that is presented at the given row, or an empty string if there's no such row.
+ */
+std::string GkRecordModel::record_id(const int &row) const
+{
+    if ((row < 0) || (row >= rowCount())) {
+        return "";
+    }
+
+    return entries[row].record_id;
+}
+
+/**
+ * @brief GkRecordModel::record_at
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param row The row in question.
+ * @return The whole record that is presented at the given row, including the names of its categories.
+ */
+GkRecords::GkSubmit GkRecordModel::record_at(const int &row) const
+{
+    if ((row < 0) || (row >= rowCount())) {
+        throw std::out_of_range(tr("There is no such record!").toStdString());
+    }
+
+    return decode_row(row);
+}
+
+/**
+ * @brief GkRecordModel::changes_committed applies the changes published upon the change feed to whatever has been
+ * fetched so far, or starts again from the first page should some of them have been missed.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param changes The changes that have just been committed to the database.
+ * @see GkChangeFeed::changes_committed()
+ */
+void GkRecordModel::changes_committed(const std::vector<GkRecords::GkChange> &changes)
+{
+    using namespace GkRecords;
+    std::vector<GkChange> unseen;
+    if (!gkChangeFeed->follow(feed_sequence, changes, unseen)) {
+        reload();
+        return;
+    }
+
+    for (const auto &change: unseen) {
+        switch (change.type) {
+            case GkChangeType::RecordInserted:
+                record_inserted(change.id, change.record);
+                break;
+            case GkChangeType::RecordDeleted:
+                record_deleted(change.id);
+                break;
+            case GkChangeType::RecordUpdated:
+                record_updated(change.id, change.name);
+                break;
+            case GkChangeType::CategoryRenamed:
+                category_renamed(change.id, change.name);
+                break;
+            default:
+                break; // Categories only turn up within the table through the records filed under them
+        }
+    }
+
+    return;
+}
+
+/**
+ * @brief GkRecordModel::record_inserted places a newly inserted record at its sorted position, provided that position
+ * lies within what has been fetched so far. Otherwise it will turn up with a later call to `fetchMore()` anyway.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param record_id The Unique ID of the record that was inserted.
+ * @param submit The data of the record that was inserted.
+ */
+void GkRecordModel::record_inserted(const std::string &record_id, const GkRecords::GkSubmit &submit)
+{
+    cat_names[submit.licensee.licensee_id] = submit.licensee.licensee_name;
+    cat_names[submit.species.species_id] = submit.species.species_name;
+    cat_names[submit.identifier.name_id] = submit.identifier.identifier_str;
+
+    GkRecords::GkIndexEntry entry;
+    entry.date_time = static_cast<long int>(submit.date_time);
+    entry.record_id = record_id;
+
+    auto pos = std::lower_bound(entries.begin(), entries.end(), entry,
+                                [this](const GkRecords::GkIndexEntry &lhs, const GkRecords::GkIndexEntry &rhs) {
+        return entry_before(lhs, rhs);
+    });
+
+    if ((pos != entries.end()) && (pos->record_id == record_id)) {
+        return; // Already fetched
+    }
+
+    if ((pos == entries.end()) && !fetched_all) {
+        return;
+    }
+
+    const int row = static_cast<int>(std::distance(entries.begin(), pos));
+    beginInsertRows(QModelIndex(), row, row);
+    entries.insert(pos, entry);
+    entry_times.emplace(record_id, entry.date_time);
+    endInsertRows();
+
+    if (entries.size() > static_cast<std::size_t>(HERPLOG_RECORD_MODEL_MAX_ROWS)) {
+        // Make room by handing the last row back to the index, from where it can be fetched again
+        const int last = static_cast<int>(entries.size()) - 1;
+        beginRemoveRows(QModelIndex(), last, last);
+        entry_times.erase(entries.back().record_id);
+        entries.pop_back();
+        endRemoveRows();
+
+        fetch_cursor = gkStrOp->timestamp_index_key(entries.back().date_time, entries.back().record_id);
+        fetched_all = false;
+    }
+
+    return;
+}
+
+/**
+ * @brief GkRecordModel::record_deleted removes a deleted record from the table, if it has been fetched.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param record_id The Unique ID of the record that was deleted.
+ */
+void GkRecordModel::record_deleted(const std::string &record_id)
+{
+    auto cached = row_cache.find(record_id);
+    if (cached != row_cache.end()) {
+        row_lru.erase(cached->second.second);
+        row_cache.erase(cached);
+    }
+
+    const int row = row_of(record_id);
+    if (row >= 0) {
+        beginRemoveRows(QModelIndex(), row, row);
+        entries.erase(entries.begin() + row);
+        entry_times.erase(record_id);
+        endRemoveRows();
+    }
+
+    return;
+}
+
+/**
+ * @brief GkRecordModel::record_updated has a record that was edited read anew the next time that it's looked at. A
+ * record whose Date/Time was edited has moved within the index, so the table is started again from the first page.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param record_id The Unique ID of the record that was edited.
+ * @param key The field of the record that was edited.
+ */
+void GkRecordModel::record_updated(const std::string &record_id, const std::string &key)
+{
+    if (key == GkRecords::dateTime) {
+        reload();
+        return;
+    }
+
+    auto cached = row_cache.find(record_id);
+    if (cached != row_cache.end()) {
+        row_lru.erase(cached->second.second);
+        row_cache.erase(cached);
+    }
+
+    const int row = row_of(record_id);
+    if (row >= 0) {
+        emit dataChanged(index(row, AnimalColumn), index(row, ColumnCount - 1));
+    }
+
+    return;
+}
+
+/**
+ * @brief GkRecordModel::category_renamed shows the new name of a Licensee, Species, or Animal upon every row.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param cat_id The Unique ID of the category that was renamed.
+ * @param name The new name of the category.
+ */
+void GkRecordModel::category_renamed(const std::string &cat_id, const std::string &name)
+{
+    cat_names[cat_id] = name;
+    row_cache.clear();
+    row_lru.clear();
+    if (!entries.empty()) {
+        emit dataChanged(index(0, AnimalColumn), index(rowCount() - 1, LicenseeColumn));
+    }
+
+    return;
+}
+
+/**
+ * @brief GkRecordModel::row_of finds the row at which a record is presented, by way of a binary search upon its
+ * Date/Time.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param record_id The Unique ID of the record in question.
+ * @return The row of the record, or -1 if it hasn't been fetched.
+ */
+int GkRecordModel::row_of(const std::string &record_id) const
+{
+    auto time = entry_times.find(record_id);
+    if (time == entry_times.end()) {
+        return -1;
+    }
+
+    GkRecords::GkIndexEntry entry;
+    entry.date_time = time->second;
+    entry.record_id = record_id;
+    auto pos = std::lower_bound(entries.begin(), entries.end(), entry,
+                                [this](const GkRecords::GkIndexEntry &lhs, const GkRecords::GkIndexEntry &rhs) {
+        return entry_before(lhs, rhs);
+    });
+
+    if ((pos == entries.end()) || (pos->record_id != record_id)) {
+        return -1;
+    }
+
+    return static_cast<int>(std::distance(entries.begin(), pos));
+}
+
+/**
+ * @brief GkRecordModel::entry_before orders the entries in the same way as the timestamp index keys, taking the
+ * current sort order into account.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ */
+bool GkRecordModel::entry_before(const GkRecords::GkIndexEntry &lhs, const GkRecords::GkIndexEntry &rhs) const
+{
+    const GkRecords::GkIndexEntry &first = descending ? rhs : lhs;
+    const GkRecords::GkIndexEntry &second = descending ? lhs : rhs;
+    if (first.date_time != second.date_time) {
+        return first.date_time < second.date_time;
+    }
+
+    return first.record_id < second.record_id;
+}
+
+/**
+ * @brief GkRecordModel::decode_row reads a whole row from the database, unless it was recently read already. Only a
+ * limited amount of rows are kept around, with the least recently used ones being dropped first.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param row The row in question.
+ * @return The decoded row.
+ */
+const GkRecords::GkSubmit &GkRecordModel::decode_row(const int &row) const
+{
+    const std::string &record_id = entries[row].record_id;
+    auto cached = row_cache.find(record_id);
+    if (cached != row_cache.end()) {
+        row_lru.splice(row_lru.begin(), row_lru, cached->second.second);
+        return cached->second.first;
+    }
+
+    using namespace GkRecords;
+    GkSubmit submit = gkDbRead->read_log_entry(record_id);
+    MiscUniqueIds cat_ids;
+    if (gkDbRead->get_uuid(record_id, cat_ids)) {
+        submit.licensee.licensee_id = cat_ids.licensee_id;
+        submit.species.species_id = cat_ids.species_id;
+        submit.identifier.name_id = cat_ids.name_id;
+        submit.licensee.licensee_name = cat_name(MiscRecordType::gkLicensee, cat_ids.licensee_id);
+        submit.species.species_name = cat_name(MiscRecordType::gkSpecies, cat_ids.species_id);
+        submit.identifier.identifier_str = cat_name(MiscRecordType::gkId, cat_ids.name_id);
+    }
+
+    while (row_cache.size() >= static_cast<std::size_t>(HERPLOG_RECORD_MODEL_ROW_CACHE)) {
+        row_cache.erase(row_lru.back());
+        row_lru.pop_back();
+    }
+
+    row_lru.push_front(record_id);
+    auto inserted = row_cache.insert(std::make_pair(record_id, std::make_pair(std::move(submit), row_lru.begin())));
+    return inserted.first->second.first;
+}
+
+/**
+ * @brief GkRecordModel::cat_name looks up the name of a Licensee, Species, or Animal, which there are far fewer of than
+ * there are records, so every name that has been looked up is kept around until the table is reloaded.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param record_type Whether the category is a Licensee, Species, or Animal.
+ * @param cat_id The Unique ID of the category in question.
+ * @return The name of the category, or an empty string if it has none.
+ */
+const std::string &GkRecordModel::cat_name(const GkRecords::MiscRecordType &record_type, const std::string &cat_id) const
+{
+    auto cached = cat_names.find(cat_id);
+    if (cached != cat_names.end()) {
+        return cached->second;
+    }
+
+    std::string name;
+    gkDbRead->get_cat_name(record_type, cat_id, name);
+    return cat_names.emplace(cat_id, std::move(name)).first->second;
+}
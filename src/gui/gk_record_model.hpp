@@ -0,0 +1,136 @@
+/**
+ **  _   _                 _
+ ** | | | |               | |
+ ** | |_| | ___ _ __ _ __ | |     ___   __ _
+ ** |  _  |/ _ \ '__| '_ \| |    / _ \ / _` |
+ ** | | | |  __/ |  | |_) | |___| (_) | (_| |
+ ** \_| |_/\___|_|  | .__/\_____/\___/ \__, |
+ **                 | |                 __/ |
+ **                 |_|                |___/
+ **
+ **   Thank you for using "HerpLog" for your herpetology management requirements!
+ **   Copyright (C) 2017-2018. GekkoFyre.
+ **
+ **
+ **   HerpLog is free software: you can redistribute it and/or modify
+ **   it under the terms of the GNU General Public License as published by
+ **   the Free Software Foundation, either version 3 of the License, or
+ **   (at your option) any later version.
+ **
+ **   HerpLog is distributed in the hope that it will be useful,
+ **   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **   GNU General Public License for more details.
+ **
+ **   You should have received a copy of the GNU General Public License
+ **   along with HerpLog.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ **
+ **   The latest source code updates can be obtained from [ 1 ] below at your
+ **   discretion. A web-browser or the 'git' application may be required.
+ **
+ **   [ 1 ] - https://github.com/GekkoFyre/HerpLog
+ **
+ ********************************************************************************/
+
+/**
+ * @file gk_record_model.hpp
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @brief A table model of every record within the database, which is read from the timestamp index a page at a time and
+ * only decodes the rows that are actually being looked at.
+ */
+
+#ifndef GK_RECORD_MODEL_HPP
+#define GK_RECORD_MODEL_HPP
+
+#include "./../options.hpp"
+#include "./../gk_db_read.hpp"
+#include "./../gk_change_feed.hpp"
+#include "./../gk_db_async.hpp"
+#include "./../gk_string_op.hpp"
+#include <QAbstractTableModel>
+#include <QVariant>
+#include <unordered_map>
+#include <memory>
+#include <string>
+#include <vector>
+#include <list>
+
+using namespace GekkoFyre;
+
+class GkRecordModel : public QAbstractTableModel
+{
+    Q_OBJECT
+
+public:
+    enum Columns {
+        DateTimeColumn,
+        AnimalColumn,
+        SpeciesColumn,
+        LicenseeColumn,
+        WeightColumn,
+        ToiletColumn,
+        HydrationColumn,
+        VitaminsColumn,
+        NotesColumn,
+        ColumnCount
+    };
+
+    explicit GkRecordModel(const std::shared_ptr<GkDbRead> &gk_db_read, const std::shared_ptr<GkChangeFeed> &gk_change_feed,
+                           GkDbAsync *gk_db_async, const std::shared_ptr<GkStringOp> &gk_str_op,
+                           QObject *parent = nullptr);
+    ~GkRecordModel();
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    int columnCount(const QModelIndex &parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+    QVariant headerData(int section, Qt::Orientation orientation, int role = Qt::DisplayRole) const override;
+    bool canFetchMore(const QModelIndex &parent) const override;
+    void fetchMore(const QModelIndex &parent) override;
+    void sort(int column, Qt::SortOrder order = Qt::AscendingOrder) override;
+
+    void reload();
+    Qt::SortOrder sort_order() const;
+    std::string record_id(const int &row) const;
+    GkRecords::GkSubmit record_at(const int &row) const;
+
+public slots:
+    void changes_committed(const std::vector<GkRecords::GkChange> &changes);
+
+signals:
+    void fetch_failed(const QString &error_msg);
+
+private:
+    void record_inserted(const std::string &record_id, const GkRecords::GkSubmit &submit);
+    void record_deleted(const std::string &record_id);
+    void record_updated(const std::string &record_id, const std::string &key);
+    void category_renamed(const std::string &cat_id, const std::string &name);
+    int row_of(const std::string &record_id) const;
+    bool entry_before(const GkRecords::GkIndexEntry &lhs, const GkRecords::GkIndexEntry &rhs) const;
+    const GkRecords::GkSubmit &decode_row(const int &row) const;
+    const std::string &cat_name(const GkRecords::MiscRecordType &record_type, const std::string &cat_id) const;
+
+    std::shared_ptr<GkDbRead> gkDbRead;
+    std::shared_ptr<GkChangeFeed> gkChangeFeed;
+    GkDbAsync *gkDbAsync;
+    std::shared_ptr<GkStringOp> gkStrOp;
+
+    std::uint64_t feed_sequence;                  // The last change from the feed that has been applied
+
+    std::vector<GkRecords::GkIndexEntry> entries; // Only the keys of the rows fetched so far, in display order
+    std::unordered_map<std::string, long int> entry_times; // <Key: Record ID, Value: Date/Time> of the rows fetched so far
+    std::string fetch_cursor;                     // The index key of the last row that was fetched
+    bool fetched_all;
+    bool fetching;                                // Whether a page is being read upon the database thread
+    std::uint64_t fetch_generation;               // Bumped with every reload, so that a page read beforehand is dropped
+    bool descending;
+
+    // Decoded rows are kept around for a while, as the view asks for them again and again whilst scrolling
+    mutable std::unordered_map<std::string, std::pair<GkRecords::GkSubmit, std::list<std::string>::iterator>> row_cache;
+    mutable std::list<std::string> row_lru; // The most recently used rows are at the front
+
+    mutable std::unordered_map<std::string, std::string> cat_names; // <Key: Category ID, Value: Name>, as looked up
+};
+
+#endif // GK_RECORD_MODEL_HPP
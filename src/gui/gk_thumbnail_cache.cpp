@@ -0,0 +1,157 @@
+/**
+ **  _   _                 _
+ ** | | | |               | |
+ ** | |_| | ___ _ __ _ __ | |     ___   __ _
+ ** |  _  |/ _ \ '__| '_ \| |    / _ \ / _` |
+ ** | | | |  __/ |  | |_) | |___| (_) | (_| |
+ ** \_| |_/\___|_|  | .__/\_____/\___/ \__, |
+ **                 | |                 __/ |
+ **                 |_|                |___/
+ **
+ **   Thank you for using "HerpLog" for your herpetology management requirements!
+ **   Copyright (C) 2017-2018. GekkoFyre.
+ **
+ **
+ **   HerpLog is free software: you can redistribute it and/or modify
+ **   it under the terms of the GNU General Public License as published by
+ **   the Free Software Foundation, either version 3 of the License, or
+ **   (at your option) any later version.
+ **
+ **   HerpLog is distributed in the hope that it will be useful,
+ **   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **   GNU General Public License for more details.
+ **
+ **   You should have received a copy of the GNU General Public License
+ **   along with HerpLog.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ **
+ **   The latest source code updates can be obtained from [ 1 ] below at your
+ **   discretion. A web-browser or the 'git' application may be required.
+ **
+ **   [ 1 ] - https://github.com/GekkoFyre/HerpLog
+ **
+ ********************************************************************************/
+
+/**
+ * @file gk_thumbnail_cache.cpp
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @brief Scales the photos attached to log entries down to thumbnails upon a thread of its own, and holds onto them
+ * both in memory and upon the disk so that they only ever need to be made the once.
+ */
+
+#include "gk_thumbnail_cache.hpp"
+#include "./../gk_trace.hpp"
+#include <QDir>
+#include <QFileInfo>
+#include <QImageReader>
+#include <QSize>
+#include <QStandardPaths>
+#include <exception>
+
+GkThumbnailCache::GkThumbnailCache(const std::shared_ptr<GkAttachmentStore> &attachment_store, QObject *parent) :
+    QObject(parent), thumbnails(HERPLOG_THUMBNAIL_CACHE)
+{
+    gkAttachmentStore = attachment_store;
+    cache_dir = QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + QStringLiteral("/thumbnails");
+    QDir().mkpath(cache_dir);
+
+    // The thumbnails are made upon a thread of their own, so that they never hold up a write to the database
+    executor = std::make_unique<GkExecutor>(1);
+    QObject::connect(this, &GkThumbnailCache::thumbnail_loaded, this, &GkThumbnailCache::store_thumbnail,
+                     Qt::QueuedConnection);
+}
+
+GkThumbnailCache::~GkThumbnailCache()
+{
+    executor.reset(); // Finish off whatever is still being made, before anything it touches goes away
+}
+
+/**
+ * @brief GkThumbnailCache::thumbnail hands back the thumbnail of a photo straight away if it's been made already, or
+ * otherwise has it made in the background, whereupon GkThumbnailCache::thumbnail_ready() is emitted.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param hash The SHA-256 hash of the photo, in hexadecimal.
+ * @param image The thumbnail, if it was at hand.
+ * @return Whether the thumbnail was at hand or not.
+ */
+bool GkThumbnailCache::thumbnail(const std::string &hash, QImage &image)
+{
+    const QString key = QString::fromStdString(hash);
+    if (QImage *cached = thumbnails.object(key)) {
+        image = *cached;
+        return true;
+    }
+
+    if (!in_flight.contains(key)) {
+        in_flight.insert(key);
+        executor->submit([this, key]() {
+            emit thumbnail_loaded(key, load_thumbnail(key));
+        });
+    }
+
+    return false;
+}
+
+/**
+ * @brief GkThumbnailCache::store_thumbnail takes in a thumbnail that has been made in the background, upon the GUI
+ * thread, and lets whoever asked for it know.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param hash The SHA-256 hash of the photo, in hexadecimal.
+ * @param image The thumbnail, or a null QImage if the photo is missing or could not be read.
+ */
+void GkThumbnailCache::store_thumbnail(const QString &hash, const QImage &image)
+{
+    in_flight.remove(hash);
+    if (!image.isNull()) {
+        thumbnails.insert(hash, new QImage(image));
+    }
+
+    emit thumbnail_ready(hash, image);
+    return;
+}
+
+/**
+ * @brief GkThumbnailCache::load_thumbnail reads a thumbnail back from the disk, or else makes it from the photo itself.
+ * The photo is decoded at (about) the size of the thumbnail to begin with, rather than in full and then scaled down,
+ * which for a JPEG is a great deal quicker and needs only a fraction of the memory.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param hash The SHA-256 hash of the photo, in hexadecimal.
+ * @return The thumbnail, or a null QImage if the photo is missing or could not be read.
+ */
+QImage GkThumbnailCache::load_thumbnail(const QString &hash)
+{
+    GkTraceSpan span("GkThumbnailCache::load_thumbnail", "file");
+    const QString thumbnail_path = cache_dir + QStringLiteral("/") + hash + QStringLiteral(".jpg");
+    QImage image;
+    if (QFileInfo::exists(thumbnail_path) && image.load(thumbnail_path)) {
+        return image;
+    }
+
+    try {
+        if (!gkAttachmentStore->contains(hash.toStdString())) {
+            return QImage();
+        }
+
+        QImageReader reader(QString::fromStdString(gkAttachmentStore->blob_path(hash.toStdString()).string()));
+        reader.setAutoTransform(true); // Photos taken upon a phone are usually rotated by way of their EXIF data
+        QSize size = reader.size();
+        if (size.isValid()) {
+            size.scale(HERPLOG_THUMBNAIL_SIZE, HERPLOG_THUMBNAIL_SIZE, Qt::KeepAspectRatio);
+            reader.setScaledSize(size);
+        }
+
+        if (reader.read(&image)) {
+            image.save(thumbnail_path, "JPG", 85);
+        }
+    } catch (const std::exception &e) {
+        Q_UNUSED(e); // The photo is left without a thumbnail
+        return QImage();
+    }
+
+    return image;
+}
@@ -0,0 +1,87 @@
+/**
+ **  _   _                 _
+ ** | | | |               | |
+ ** | |_| | ___ _ __ _ __ | |     ___   __ _
+ ** |  _  |/ _ \ '__| '_ \| |    / _ \ / _` |
+ ** | | | |  __/ |  | |_) | |___| (_) | (_| |
+ ** \_| |_/\___|_|  | .__/\_____/\___/ \__, |
+ **                 | |                 __/ |
+ **                 |_|                |___/
+ **
+ **   Thank you for using "HerpLog" for your herpetology management requirements!
+ **   Copyright (C) 2017-2018. GekkoFyre.
+ **
+ **
+ **   HerpLog is free software: you can redistribute it and/or modify
+ **   it under the terms of the GNU General Public License as published by
+ **   the Free Software Foundation, either version 3 of the License, or
+ **   (at your option) any later version.
+ **
+ **   HerpLog is distributed in the hope that it will be useful,
+ **   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **   GNU General Public License for more details.
+ **
+ **   You should have received a copy of the GNU General Public License
+ **   along with HerpLog.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ **
+ **   The latest source code updates can be obtained from [ 1 ] below at your
+ **   discretion. A web-browser or the 'git' application may be required.
+ **
+ **   [ 1 ] - https://github.com/GekkoFyre/HerpLog
+ **
+ ********************************************************************************/
+
+/**
+ * @file gk_thumbnail_cache.hpp
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @brief Scales the photos attached to log entries down to thumbnails upon a thread of its own, and holds onto them
+ * both in memory and upon the disk so that they only ever need to be made the once.
+ */
+
+#ifndef GK_THUMBNAIL_CACHE_HPP
+#define GK_THUMBNAIL_CACHE_HPP
+
+#include "./../options.hpp"
+#include "./../gk_attachment_store.hpp"
+#include "./../gk_executor.hpp"
+#include <QObject>
+#include <QCache>
+#include <QImage>
+#include <QSet>
+#include <QString>
+#include <memory>
+#include <string>
+
+using namespace GekkoFyre;
+
+class GkThumbnailCache : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit GkThumbnailCache(const std::shared_ptr<GkAttachmentStore> &attachment_store, QObject *parent = nullptr);
+    ~GkThumbnailCache();
+
+    bool thumbnail(const std::string &hash, QImage &image);
+
+signals:
+    void thumbnail_ready(const QString &hash, const QImage &image);
+    void thumbnail_loaded(const QString &hash, const QImage &image);
+
+private slots:
+    void store_thumbnail(const QString &hash, const QImage &image);
+
+private:
+    QImage load_thumbnail(const QString &hash);
+
+    std::shared_ptr<GkAttachmentStore> gkAttachmentStore;
+    QString cache_dir;                  // Thumbnails are named after the hash of their photo, so they never go stale
+    QCache<QString, QImage> thumbnails; // The most recently shown thumbnails
+    QSet<QString> in_flight;            // Thumbnails that are being made, so they aren't asked for twice
+    std::unique_ptr<GkExecutor> executor;
+};
+
+#endif // GK_THUMBNAIL_CACHE_HPP
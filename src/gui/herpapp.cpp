@@ -43,22 +43,55 @@
 #include "herpapp.hpp"
 #include "ui_herpapp.h"
 #include "gk_about_dialog.hpp"
+#include "gk_diagnostics_dialog.hpp"
+#include "gk_attention_dialog.hpp"
+#include "gk_find_dialog.hpp"
+#include "gk_name_completer.hpp"
+#include "./../gk_downsample.hpp"
+#include "./../gk_trace.hpp"
 #include <boost/exception/all.hpp>
 #include <boost/lexical_cast.hpp>
 #include <QMessageBox>
 #include <QFileDialog>
+#include <QInputDialog>
 #include <QDateTime>
 #include <QString>
+#include <QStringList>
+#include <QSignalBlocker>
+#include <QHeaderView>
+#include <QTimer>
+#include <QDesktopServices>
+#include <QDir>
+#include <QIcon>
+#include <QImageReader>
+#include <QPixmap>
+#include <QUrl>
 #include <vector>
+#include <algorithm>
 #include <iostream>
+#include <limits>
 
 namespace sys = boost::system;
 HerpApp::HerpApp(const GkFile::FileDb &database, const std::string &temp_dir_path, const std::string &db_file_path,
                  const std::shared_ptr<GkFileIo> &file_io_ptr, QWidget *parent) : QMainWindow(parent), ui(new Ui::HerpApp)
 {
     ui->setupUi(this);
+    ui->actionRecord_Trace->setChecked(GkTrace::enabled());
+
+    // The watchdog can be switched on from the `Help` menu, or from the very start with HERPLOG_WATCHDOG=<report file>,
+    // in which case the stall report gets written out upon closing the database
+    gkWatchdog = new GkWatchdog(HERPLOG_WATCHDOG_THRESHOLD_MS, this);
+    ui->actionWatch_Stalls->setChecked(qEnvironmentVariableIsSet("HERPLOG_WATCHDOG"));
 
     caches_enabled = false;
+    charts_tab_enabled = false;
+    changes_queued = false;
+    pending_changes = GkRecords::GkChangeSet();
+    minDateTime = 0;
+    maxDateTime = 0;
+    chart_weight_min = 0;
+    chart_weight_max = 0;
+    chart_weight_stale = false;
     db_ptr = database;
     global_db_temp_dir = temp_dir_path; // The (base) temporary directory where the database has been extracted to
     global_db_file_path = db_file_path; // The file-path to the (currently opened/newly created) database
@@ -66,13 +99,104 @@ HerpApp::HerpApp(const GkFile::FileDb &database, const std::string &temp_dir_pat
 
     gkStrOp = std::make_shared<GkStringOp>(nullptr);
     gkDbRead = std::make_shared<GkDbRead>(db_ptr, gkStrOp, nullptr);
-    gkDbWrite = std::make_unique<GkDbWrite>(db_ptr, gkDbRead, gkStrOp, nullptr);
+    gkDbWrite = std::make_shared<GkDbWrite>(db_ptr, gkDbRead, gkStrOp, nullptr);
+    gkCategoryTree = std::make_shared<GkCategoryTree>(gkDbRead, nullptr);
+    gkDbAsync = std::make_unique<GkDbAsync>(gkDbRead, gkDbWrite, nullptr);
+    gkTextIndex = std::make_shared<GkTextIndex>(db_ptr, nullptr);
+    gkAggregator = std::make_shared<GkAggregator>(db_ptr, gkDbRead, gkStrOp, nullptr);
+
+    // Photos are kept alongside the database files themselves, which a database shared by the service doesn't have
+    if (!global_db_temp_dir.empty()) {
+        gkAttachmentStore = std::make_shared<GkAttachmentStore>(db_ptr, global_db_temp_dir, gkStrOp, nullptr);
+        gkThumbnailCache = std::make_unique<GkThumbnailCache>(gkAttachmentStore, nullptr);
+        QObject::connect(gkThumbnailCache.get(), &GkThumbnailCache::thumbnail_ready, this, &HerpApp::thumbnail_ready);
+    } else {
+        ui->pushButton_attach_photos->setEnabled(false);
+        ui->pushButton_remove_photo->setEnabled(false);
+        ui->listWidget_attachments->setEnabled(false);
+        ui->listWidget_records_attachments->setEnabled(false);
+        ui->pushButton_attach_photos->setToolTip(tr("Photos can't be attached to a database that's being shared by the "
+                                                    "HerpLog service."));
+    }
+
+    // Every change committed to the database is applied to the caches and charts as it happens, and as these are
+    // published from the database thread, they get queued up for the GUI thread.
+    feed_sequence = gkDbWrite->change_feed()->last_sequence();
+    QObject::connect(gkDbWrite->change_feed().get(), &GkChangeFeed::changes_committed, this, &HerpApp::db_changes_committed);
+    QObject::connect(gkDbWrite.get(), &GkDbWrite::alerts_raised, this, &HerpApp::db_alerts_raised);
+    QObject::connect(gkDbAsync.get(), &GkDbAsync::db_error, this, &HerpApp::db_error_raised);
 
     ui->interface_tabWidget->setCurrentIndex(0);
     ui->interface_tabWidget->setTabEnabled(2, false);
     ui->interface_tabWidget->setTabEnabled(3, false);
 
-    refresh_caches();
+    // The table within the `viewRecords` tab is read straight from the timestamp index, a page at a time
+    gkRecordModel = new GkRecordModel(gkDbRead, gkDbWrite->change_feed(), gkDbAsync.get(), gkStrOp, this);
+    ui->tableView_archive_records->setModel(gkRecordModel);
+    ui->tableView_archive_records->sortByColumn(GkRecordModel::DateTimeColumn, Qt::DescendingOrder);
+    QObject::connect(gkDbWrite->change_feed().get(), &GkChangeFeed::changes_committed, gkRecordModel.data(),
+                     &GkRecordModel::changes_committed);
+    QObject::connect(gkRecordModel.data(), &GkRecordModel::fetch_failed, this, [this](const QString &error_msg) {
+        QMessageBox::warning(ui->tableView_archive_records, tr("Error!"), error_msg, QMessageBox::Ok);
+    }, Qt::QueuedConnection); // Not from within `fetchMore()` itself, whilst the view is still laying itself out
+
+    // Only the Date/Time can be sorted upon, so the indicator is put straight back should another column be clicked
+    QObject::connect(ui->tableView_archive_records->horizontalHeader(), &QHeaderView::sortIndicatorChanged, this,
+                     [this](int column, Qt::SortOrder order) {
+        Q_UNUSED(order);
+        if (column != GkRecordModel::DateTimeColumn) {
+            QHeaderView *header = ui->tableView_archive_records->horizontalHeader();
+            const QSignalBlocker blocker(header);
+            header->setSortIndicator(GkRecordModel::DateTimeColumn, gkRecordModel->sort_order());
+        }
+    });
+    QObject::connect(ui->tableView_archive_records->selectionModel(), &QItemSelectionModel::currentRowChanged,
+                     this, &HerpApp::archive_table_row_changed);
+
+    // Databases written by older versions of HerpLog lack the index, so it gets built the first time they are opened.
+    // Their lists of Unique IDs are split up at the same time, hence why the category tree is built over again.
+    auto db_write = gkDbWrite;
+    auto category_tree = gkCategoryTree;
+    gkDbAsync->dispatch([db_write, category_tree]() {
+        const bool rebuilt = db_write->rebuild_indexes();
+        if (rebuilt) {
+            category_tree->build();
+        }
+
+        return rebuilt;
+    }, [this](bool rebuilt) {
+        if (rebuilt) {
+            gkRecordModel->reload();
+            {
+                std::lock_guard<std::mutex> locker(r_cache_mtx);
+                fill_licensee_comboBoxes();
+            }
+
+            update_views_enabled();
+            refresh_date_range();
+        }
+
+        if (gkRecordModel->rowCount() > 0) {
+            ui->interface_tabWidget->setTabEnabled(2, true);
+        }
+    });
+
+    repair_summaries(); // Lest the last session ended before it could get around to them
+
+    // Each of the category QComboBoxes can be typed into, which pops up the closest matching names from the whole tree
+    for (const auto &comboBox_type: { GkRecords::comboBoxType::AddRecord, GkRecords::comboBoxType::ViewRecords,
+                                      GkRecords::comboBoxType::ViewCharts }) {
+        for (const auto &record_type: { GkRecords::MiscRecordType::gkLicensee, GkRecords::MiscRecordType::gkSpecies,
+                                        GkRecords::MiscRecordType::gkId }) {
+            GkNameCompleter *completer = new GkNameCompleter(gkCategoryTree, record_type,
+                                                             category_comboBox(record_type, comboBox_type));
+            QObject::connect(completer, &GkNameCompleter::category_chosen, this,
+                             [this, record_type, comboBox_type](const std::uint32_t &node_idx) {
+                jump_to_category(record_type, comboBox_type, node_idx);
+            });
+        }
+    }
+
     ui->lineEdit_new_id->setText(QString::fromStdString(gkStrOp->random_hash()));
     ui->dateTime_add_record->setMinimumDateTime(QDateTime::fromTime_t(1));
     ui->dateTime_add_record->setDate(QDate::currentDate());
@@ -89,14 +213,26 @@ HerpApp::HerpApp(const GkFile::FileDb &database, const std::string &temp_dir_pat
         ui->actionSave_As->setText(tr("Save \"...\" As").arg(db_file_name));
     }
 
-    charts_tab_enabled = false;
     ui->action_File_1->setEnabled(false);
-    update_all();
     insert_charts();
+    refresh_caches(); // Any writes from here on out are applied by way of `apply_changes()` instead
+    update_all();
 }
 
 HerpApp::~HerpApp()
 {
+    const QString stall_report_file = QString::fromLocal8Bit(qgetenv("HERPLOG_WATCHDOG"));
+    if (!stall_report_file.isEmpty() && gkWatchdog->running()) {
+        try {
+            gkWatchdog->stop();
+            gkWatchdog->write_report(stall_report_file.toStdString());
+        } catch (const std::exception &e) {
+            std::cerr << e.what() << std::endl;
+        }
+    }
+
+    gkDbAsync.reset(); // Any outstanding database operations must finish before the files are removed
+    gkThumbnailCache.reset();
     remove_files(global_db_temp_dir);
     delete ui;
 }
@@ -143,21 +279,17 @@ void HerpApp::on_action_Open_Database_triggered()
 
 void HerpApp::on_action_Save_triggered()
 {
+    GkTraceSpan span("HerpApp::on_action_Save_triggered", "ui");
+    if (global_db_temp_dir.empty()) {
+        QMessageBox::information(this, tr("Notice"), tr("This database is being shared by the HerpLog service, which "
+                                                        "saves it by itself once it's shut down."), QMessageBox::Ok);
+        return;
+    }
+
     try {
         sys::error_code ec;
         if (fs::exists(global_db_file_path, ec)) { // Check that the database does exist, otherwise perform a "Save As"
-            std::string temp_file_name = std::string(global_db_file_path + "." + gkStrOp->random_hash()); // Give the new, temporary file a random extension
-            gkFileIo->compress_files(global_db_temp_dir.string(), temp_file_name); // Compress it
-            if (!fs::remove(global_db_file_path, ec)) { // Remove the old database file
-                QMessageBox::warning(this, tr("Error!"), QString::fromStdString(ec.message()), QMessageBox::Ok);
-                return;
-            } else {
-                fs::rename(temp_file_name, global_db_file_path, ec); // Rename the temporary database back so it's as if nothing changed, except for the contents of course :)
-                if (ec.value() > 0) {
-                    QMessageBox::warning(this, tr("Error!"), QString::fromStdString(ec.message()), QMessageBox::Ok);
-                    return;
-                }
-            }
+            save_database(global_db_file_path);
         } else {
             on_actionSave_As_triggered();
         }
@@ -172,6 +304,13 @@ void HerpApp::on_action_Save_triggered()
 
 void HerpApp::on_actionSave_As_triggered()
 {
+    GkTraceSpan span("HerpApp::on_actionSave_As_triggered", "ui");
+    if (global_db_temp_dir.empty()) {
+        QMessageBox::information(this, tr("Notice"), tr("This database is being shared by the HerpLog service, which "
+                                                        "saves it by itself once it's shut down."), QMessageBox::Ok);
+        return;
+    }
+
     try {
         QString save_dest = QFileDialog::getSaveFileName(this, tr("Save As"), QString::fromStdString(global_db_file_path), tr("HerpLog Database Files (*.hdb)"));
 
@@ -182,7 +321,7 @@ void HerpApp::on_actionSave_As_triggered()
                 QMessageBox::warning(this, tr("Error!"), QString::fromStdString(ec.message()), QMessageBox::Ok);
                 return;
             } else {
-                gkFileIo->compress_files(global_db_temp_dir.string(), save_dest_str);
+                save_database(save_dest_str);
             }
         }
     } catch (const std::exception &e) {
@@ -193,6 +332,48 @@ void HerpApp::on_actionSave_As_triggered()
     return;
 }
 
+/**
+ * @brief HerpApp::save_database compresses the database into the given file upon the database thread, having first left
+ * behind any photos that no record refers to any longer. The file is written under a temporary name and only then
+ * put in place of the old one, so it's as if nothing changed, except for the contents of course :)
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param dest_path Where the database is to be saved to.
+ */
+void HerpApp::save_database(const std::string &dest_path)
+{
+    gkDbAsync->wait_for_idle(); // Make sure that every outstanding write has made it to the disk first
+
+    auto attachment_store = gkAttachmentStore;
+    auto file_io = gkFileIo;
+    const std::string temp_dir = global_db_temp_dir.string();
+    const std::string temp_file_name = std::string(dest_path + "." + gkStrOp->random_hash()); // Give the new, temporary file a random extension
+    gkDbAsync->dispatch([attachment_store, file_io, temp_dir, temp_file_name, dest_path]() {
+        if (attachment_store) {
+            attachment_store->sweep();
+        }
+
+        sys::error_code ec;
+        file_io->compress_files(temp_dir, temp_file_name);
+        if (fs::exists(dest_path, ec) && !fs::remove(dest_path, ec)) { // Remove the old database file
+            return ec.message();
+        }
+
+        fs::rename(temp_file_name, dest_path, ec);
+        if (ec.value() > 0) {
+            return ec.message();
+        }
+
+        return std::string();
+    }, [this](const std::string &error_msg) {
+        if (!error_msg.empty()) {
+            QMessageBox::warning(this, tr("Error!"), QString::fromStdString(error_msg), QMessageBox::Ok);
+        }
+    });
+
+    return;
+}
+
 void HerpApp::on_action_Print_triggered()
 {
     // https://doc.qt.io/qt-5.10/qtprintsupport-index.html
@@ -206,9 +387,46 @@ void HerpApp::on_actionE_xit_triggered()
     return;
 }
 
+/**
+ * @brief HerpApp::on_actionF_ind_triggered brings up the `Find` dialog, for searching through the notes of every log
+ * entry. There is only ever the one, so asking again just brings it back to the front.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ */
 void HerpApp::on_actionF_ind_triggered()
 {
-    QMessageBox::information(this, tr("Notice"), tr("This feature is not available yet, so check back soon!"), QMessageBox::Ok);
+    if (gkFindDialog.isNull()) {
+        gkFindDialog = new GkFindDialog(gkTextIndex, gkDbRead, gkDbAsync.get(), this);
+        gkFindDialog->setWindowFlags(Qt::Window);
+        gkFindDialog->setAttribute(Qt::WA_DeleteOnClose, true); // Delete itself on closing
+        QObject::connect(gkFindDialog.data(), &GkFindDialog::record_selected, this, &HerpApp::find_record_selected);
+    }
+
+    gkFindDialog->show();
+    gkFindDialog->raise();
+    gkFindDialog->activateWindow();
+    return;
+}
+
+/**
+ * @brief HerpApp::on_actionAttention_Needed_triggered brings up the dashboard of every animal's rolling statistics,
+ * with those needing attention at the top. As with the `Find` dialog, there is only ever the one.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ */
+void HerpApp::on_actionAttention_Needed_triggered()
+{
+    if (gkAttentionDialog.isNull()) {
+        gkAttentionDialog = new GkAttentionDialog(gkDbRead, gkCategoryTree, gkDbAsync.get(), this);
+        gkAttentionDialog->setWindowFlags(Qt::Window);
+        gkAttentionDialog->setAttribute(Qt::WA_DeleteOnClose, true); // Delete itself on closing
+        QObject::connect(gkAttentionDialog.data(), &GkAttentionDialog::alerts_acknowledged,
+                         this, &HerpApp::acknowledge_alerts);
+    }
+
+    gkAttentionDialog->show();
+    gkAttentionDialog->raise();
+    gkAttentionDialog->activateWindow();
     return;
 }
 
@@ -240,6 +458,156 @@ void HerpApp::on_actionIm_port_CSV_triggered()
     return;
 }
 
+/**
+ * @brief HerpApp::on_actionExport_Report_triggered saves the weekly counts, mean weights and husbandry flag rates of
+ * every Licensee, Species or Animal towards a CSV file, which is summed up upon the database thread.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @see GkAggregator::aggregate()
+ */
+void HerpApp::on_actionExport_Report_triggered()
+{
+    try {
+        using namespace GkRecords;
+        const QStringList groupings = { tr("Licensee"), tr("Species"), tr("Animal") };
+        bool ok = false;
+        const QString grouping = QInputDialog::getItem(this, tr("Export Report"), tr("Sum up each week by:"), groupings,
+                                                       1, false, &ok);
+        if (!ok) {
+            return;
+        }
+
+        QString save_dest = QFileDialog::getSaveFileName(this, tr("Export Report"), QString("herplog-report.csv"),
+                                                         tr("CSV Files (*.csv)"));
+        if (save_dest.isEmpty()) {
+            return;
+        }
+
+        const auto group_by = static_cast<GkReport::GkGroupBy>(groupings.indexOf(grouping));
+        const MiscRecordType record_type = (group_by == GkReport::GkGroupBy::Licensee) ? MiscRecordType::gkLicensee :
+                                           ((group_by == GkReport::GkGroupBy::Species) ? MiscRecordType::gkSpecies :
+                                                                                          MiscRecordType::gkId);
+        const std::string csv_file = save_dest.toStdString();
+        auto aggregator = gkAggregator;
+        gkDbAsync->dispatch([aggregator, group_by]() {
+            return aggregator->aggregate(std::numeric_limits<long int>::min(), std::numeric_limits<long int>::max(),
+                                         GkReport::GkBucketSize::Week, group_by);
+        }, [this, record_type, csv_file](const GkReport::GkAggregateTable &table) {
+            try {
+                std::vector<std::string> group_names;
+                group_names.reserve(table.group_ids.size());
+                for (const auto &group_id: table.group_ids) {
+                    group_names.push_back(gkCategoryTree->name(record_type, gkCategoryTree->find(record_type, group_id)));
+                }
+
+                GkAggregator::write_csv(table, group_names, csv_file);
+            } catch (const std::exception &e) {
+                QMessageBox::warning(this, tr("Error!"), e.what(), QMessageBox::Ok);
+            }
+        });
+    } catch (const std::exception &e) {
+        QMessageBox::warning(this, tr("Error!"), e.what(), QMessageBox::Ok);
+    }
+
+    return;
+}
+
+/**
+ * @brief HerpApp::on_actionRecord_Trace_toggled switches the tracing of HerpLog's hot paths on or off, for whenever a
+ * user needs to show us just where HerpLog is being slow.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param checked Whether to start tracing.
+ * @see GkTrace
+ */
+void HerpApp::on_actionRecord_Trace_toggled(bool checked)
+{
+    GkTrace::set_enabled(checked);
+    return;
+}
+
+/**
+ * @brief HerpApp::on_actionSave_Trace_triggered saves whatever has been traced so far as a Chrome trace, which can be
+ * opened up with `chrome://tracing` or Perfetto.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ */
+void HerpApp::on_actionSave_Trace_triggered()
+{
+    try {
+        QString save_dest = QFileDialog::getSaveFileName(this, tr("Save Trace"), QString("herplog-trace.json"),
+                                                         tr("Chrome Trace Files (*.json)"));
+        if (!save_dest.isEmpty()) {
+            GkTrace::write_chrome_trace(save_dest.toStdString());
+        }
+    } catch (const std::exception &e) {
+        QMessageBox::warning(this, tr("Error!"), e.what(), QMessageBox::Ok);
+    }
+
+    return;
+}
+
+/**
+ * @brief HerpApp::on_actionWatch_Stalls_toggled starts or stops watching for whenever the GUI freezes up, and what it
+ * was busy with at the time.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param checked Whether to start watching.
+ * @see GkWatchdog
+ */
+void HerpApp::on_actionWatch_Stalls_toggled(bool checked)
+{
+    if (checked) {
+        gkWatchdog->start();
+    } else {
+        gkWatchdog->stop();
+    }
+
+    return;
+}
+
+/**
+ * @brief HerpApp::on_actionSave_Stall_Report_triggered saves a histogram of the stalls seen so far, along with what
+ * was to blame for them.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ */
+void HerpApp::on_actionSave_Stall_Report_triggered()
+{
+    try {
+        QString save_dest = QFileDialog::getSaveFileName(this, tr("Save Stall Report"), QString("herplog-stalls.txt"),
+                                                         tr("Text Files (*.txt)"));
+        if (!save_dest.isEmpty()) {
+            gkWatchdog->write_report(save_dest.toStdString());
+        }
+    } catch (const std::exception &e) {
+        QMessageBox::warning(this, tr("Error!"), e.what(), QMessageBox::Ok);
+    }
+
+    return;
+}
+
+/**
+ * @brief HerpApp::on_action_Diagnostics_triggered shows how LevelDB is faring underneath HerpLog, from the hit rate of
+ * its block cache through to how much room each family of keys is taking up.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ */
+void HerpApp::on_action_Diagnostics_triggered()
+{
+    try {
+        QPointer<GkDiagnosticsDialog> diagnosticsDialog = new GkDiagnosticsDialog(db_ptr, global_db_temp_dir,
+                                                                                  global_db_file_path, this);
+        diagnosticsDialog->setWindowFlags(Qt::Window);
+        diagnosticsDialog->setAttribute(Qt::WA_DeleteOnClose, true); // Delete itself on closing
+        diagnosticsDialog->show();
+    } catch (const std::exception &e) {
+        QMessageBox::warning(this, tr("Error!"), e.what(), QMessageBox::Ok);
+    }
+
+    return;
+}
+
 void HerpApp::on_pushButton_archive_next_clicked()
 {
     // Go to `Next Record`
@@ -262,15 +630,24 @@ void HerpApp::on_pushButton_archive_delete_clicked()
 {
     // `Delete Record`
     if (!archive_curr_sel_record.empty()) {
-        int ret = gkDbWrite->del_log_entry(archive_curr_sel_record, true);
-        if (ret) {
+        QMessageBox msgBox;
+        msgBox.setWindowTitle(tr("Delete Record..."));
+        msgBox.setText(tr("Are you really sure about deleting this record?"));
+        msgBox.setStandardButtons(QMessageBox::Yes | QMessageBox::No | QMessageBox::Cancel);
+        msgBox.setDefaultButton(QMessageBox::Yes);
+        if (msgBox.exec() != QMessageBox::Yes) {
+            return;
+        }
+
+        const std::string record_id = archive_curr_sel_record;
+        auto db_write = gkDbWrite;
+        gkDbAsync->dispatch([db_write, record_id]() { return db_write->del_log_entry(record_id); }, [this](bool) {
             archive_curr_sel_record.clear();
-            update_all();
             archive_clear_forms();
             std::string prev_record = browse_records(archive_records, false);
             archive_curr_sel_record = prev_record;
             archive_fill_form_data(prev_record);
-        }
+        });
     }
 
     return;
@@ -282,29 +659,33 @@ void HerpApp::on_pushButton_browse_submit_clicked()
         int dateTimeStart = ui->dateTimeEdit_browse_start->dateTime().toTime_t();
         int dateTimeEnd = ui->dateTimeEdit_browse_end->dateTime().toTime_t();
 
-        archive_records.clear();
-        archive_records = gkDbRead->extract_records(dateTimeStart, dateTimeEnd);
-
-        if (!archive_records.empty()) {
-            if (!ui->interface_tabWidget->isTabEnabled(2)) {
-                ui->interface_tabWidget->setTabEnabled(2, true);
-            }
+        // Only the records of the animal being browsed are ever shown, so only those are read from the index
+        const std::string animal_id = find_comboBox_id(GkRecords::MiscRecordType::gkId,
+                                                       GkRecords::comboBoxType::ViewRecords,
+                                                       comboBox_view_records_animals_sel);
+
+        auto db_read = gkDbRead;
+        gkDbAsync->dispatch([db_read, animal_id, dateTimeStart, dateTimeEnd]() {
+            return db_read->extract_animal_records(animal_id, dateTimeStart, dateTimeEnd);
+        }, [this](const std::list<std::string> &records) {
+            archive_records = records;
+            if (!archive_records.empty()) {
+                if (!ui->interface_tabWidget->isTabEnabled(2)) {
+                    ui->interface_tabWidget->setTabEnabled(2, true);
+                }
 
-            emit on_comboBox_view_charts_select_licensee_currentIndexChanged(0);
-            emit on_comboBox_existing_license_id_currentIndexChanged(0);
-            emit on_comboBox_view_records_licensee_currentIndexChanged(0);
+                ui->interface_tabWidget->setCurrentIndex(2);
 
-            ui->interface_tabWidget->setCurrentIndex(2);
+                viewed_records.clear();
+                std::string next_record = browse_records(archive_records, true);
+                archive_curr_sel_record = next_record;
+                archive_fill_form_data(next_record);
+            } else {
+                QMessageBox::information(this, tr("Info"), tr("There is no data to display!"), QMessageBox::Ok);
+            }
+        });
 
-            viewed_records.clear();
-            std::string next_record = browse_records(archive_records, true);
-            archive_curr_sel_record = next_record;
-            archive_fill_form_data(next_record);
-            return;
-        } else {
-            QMessageBox::information(this, tr("Info"), tr("There is no data to display!"), QMessageBox::Ok);
-            return;
-        }
+        return;
     } catch (const std::exception &e) {
         QMessageBox::warning(this, tr("Error!"), e.what(), QMessageBox::Ok);
         return;
@@ -334,102 +715,85 @@ void HerpApp::on_toolButton_view_records_cal_popup_clicked()
                                                             "calendar for your perusal."), QMessageBox::Ok);
 }
 
-void HerpApp::on_comboBox_view_charts_select_licensee_currentIndexChanged(int index)
+void HerpApp::on_pushButton_view_charts_prev_page_clicked()
+{
+    const int page = ui->stackedWidget_view_charts->currentIndex();
+    if (page > 0) {
+        ui->stackedWidget_view_charts->setCurrentIndex(page - 1);
+    }
+
+    if (ui->stackedWidget_view_charts->currentWidget() == ui->view_charts_page_2) {
+        update_summary_chart();
+    }
+}
+
+void HerpApp::on_pushButton_view_charts_next_page_clicked()
 {
-    if (!licensee_cache.empty()) {
-        std::string license_id = find_comboBox_id(GkRecords::MiscRecordType::gkLicensee, GkRecords::comboBoxType::ViewCharts, index);
-        auto species_index = find_species_names(GkRecords::comboBoxType::ViewCharts, license_id);
-        record_species_index(species_index, GkRecords::comboBoxType::ViewCharts);
-        comboBox_view_graphs_licensee_sel = index;
-        emit on_comboBox_view_charts_select_species_currentIndexChanged(index);
+    const int page = ui->stackedWidget_view_charts->currentIndex();
+    if ((page + 1) < ui->stackedWidget_view_charts->count()) {
+        ui->stackedWidget_view_charts->setCurrentIndex(page + 1);
     }
+
+    if (ui->stackedWidget_view_charts->currentWidget() == ui->view_charts_page_2) {
+        update_summary_chart(); // Any log entries added since it was last shown are taken into account
+    }
+}
+
+void HerpApp::on_comboBox_view_charts_select_licensee_currentIndexChanged(int index)
+{
+    comboBox_view_graphs_licensee_sel = index;
+    select_licensee(GkRecords::comboBoxType::ViewCharts, index);
 }
 
 void HerpApp::on_comboBox_view_charts_select_species_currentIndexChanged(int index)
 {
-    if (!comboBox_species.empty()) {
-        comboBox_view_graphs_species_sel = index;
-        for (const auto &species: comboBox_species) {
-            if (species.comboBox.comboBox_type == GkRecords::ViewCharts) {
-                if (species.comboBox.index_no == index) {
-                    auto animals_index = find_animal_names(GkRecords::comboBoxType::ViewCharts, species.species_id);
-                    record_animals_index(animals_index, GkRecords::comboBoxType::ViewCharts);
-                    break;
-                }
-            }
-        }
+    comboBox_view_graphs_species_sel = index;
+    select_species(GkRecords::comboBoxType::ViewCharts, index);
+    if (ui->stackedWidget_view_charts->currentWidget() == ui->view_charts_page_2) {
+        update_summary_chart();
     }
 }
 
 void HerpApp::on_comboBox_view_charts_select_id_currentIndexChanged(int index)
 {
-    if (!comboBox_animals.empty()) {
+    if (!comboBox_index[GkRecords::comboBoxType::ViewCharts].animals.empty()) {
         comboBox_view_graphs_animals_sel = index;
+        update_charts();
     }
 }
 
 void HerpApp::on_comboBox_existing_license_id_currentIndexChanged(int index)
 {
-    if (!licensee_cache.empty()) {
-        std::string license_id = find_comboBox_id(GkRecords::MiscRecordType::gkLicensee, GkRecords::comboBoxType::AddRecord, index);
-        auto species_index = find_species_names(GkRecords::comboBoxType::AddRecord, license_id);
-        record_species_index(species_index, GkRecords::comboBoxType::AddRecord);
-        comboBox_add_records_licensee_sel = index;
-        emit on_comboBox_existing_species_currentIndexChanged(index);
-    }
+    comboBox_add_records_licensee_sel = index;
+    select_licensee(GkRecords::comboBoxType::AddRecord, index);
 }
 
 void HerpApp::on_comboBox_existing_species_currentIndexChanged(int index)
 {
-    if (!comboBox_species.empty()) {
-        comboBox_add_records_species_sel = index;
-        for (const auto &species: comboBox_species) {
-            if (species.comboBox.comboBox_type == GkRecords::AddRecord) {
-                if (species.comboBox.index_no == index) {
-                    auto animals_index = find_animal_names(GkRecords::comboBoxType::AddRecord, species.species_id);
-                    record_animals_index(animals_index, GkRecords::comboBoxType::AddRecord);
-                    break;
-                }
-            }
-        }
-    }
+    comboBox_add_records_species_sel = index;
+    select_species(GkRecords::comboBoxType::AddRecord, index);
 }
 
 void HerpApp::on_comboBox_existing_id_currentIndexChanged(int index)
 {
-    if (!comboBox_animals.empty()) {
+    if (!comboBox_index[GkRecords::comboBoxType::AddRecord].animals.empty()) {
         comboBox_add_records_animals_sel = index;
     }
 }
 
 void HerpApp::on_comboBox_view_records_licensee_currentIndexChanged(int index)
 {
-    if (!licensee_cache.empty()) {
-        std::string license_id = find_comboBox_id(GkRecords::MiscRecordType::gkLicensee, GkRecords::comboBoxType::ViewRecords, index);
-        auto species_index = find_species_names(GkRecords::comboBoxType::ViewRecords, license_id);
-        record_species_index(species_index, GkRecords::comboBoxType::ViewRecords);
-        emit on_comboBox_view_records_species_currentIndexChanged(index);
-    }
+    select_licensee(GkRecords::comboBoxType::ViewRecords, index);
 }
 
 void HerpApp::on_comboBox_view_records_species_currentIndexChanged(int index)
 {
-    if (!comboBox_species.empty()) {
-        for (const auto &species: comboBox_species) {
-            if (species.comboBox.comboBox_type == GkRecords::ViewRecords) {
-                if (species.comboBox.index_no == index) {
-                    auto animals_index = find_animal_names(GkRecords::comboBoxType::ViewRecords, species.species_id);
-                    record_animals_index(animals_index, GkRecords::comboBoxType::ViewRecords);
-                    break;
-                }
-            }
-        }
-    }
+    select_species(GkRecords::comboBoxType::ViewRecords, index);
 }
 
 void HerpApp::on_comboBox_view_records_animal_name_currentIndexChanged(int index)
 {
-    if (!comboBox_animals.empty()) {
+    if (!comboBox_index[GkRecords::comboBoxType::ViewRecords].animals.empty()) {
         comboBox_view_records_animals_sel = index;
     }
 }
@@ -438,34 +802,12 @@ void HerpApp::on_toolButton_view_records_licensee_clicked()
 {
     try {
         // Delete `Licensee` entry
-        if ((!licensee_cache.empty()) && (!archive_records.empty())) {
+        if ((!comboBox_index[GkRecords::comboBoxType::ViewRecords].licensees.empty()) && (!archive_records.empty())) {
             if (caches_enabled) {
-                int curr_sel = ui->comboBox_view_records_licensee->currentIndex();
-                std::string licensee_id;
-                for (auto it = licensee_cache.begin(); it != licensee_cache.end(); ++it) {
-                    if (it.value().second == curr_sel) {
-                        licensee_id = it.key();
-                        break;
-                    }
-                }
-
-                comboBox_species.clear();
-                comboBox_animals.clear();
-                gkDbWrite->mass_del_cat(GkRecords::MiscRecordType::gkLicensee, licensee_id);
-                update_all(true, licensee_id);
-
-                if (!licensee_cache.empty()) {
-                    emit on_comboBox_view_charts_select_licensee_currentIndexChanged(0);
-                    emit on_comboBox_existing_license_id_currentIndexChanged(0);
-                    emit on_comboBox_view_records_licensee_currentIndexChanged(0);
-                } else {
-                    comboboxes_clear(true);
-                }
-
-                comboBox_add_records_licensee_sel = 0;
-                comboBox_add_records_species_sel = 0;
-                comboBox_add_records_animals_sel = 0;
-                comboBox_view_records_animals_sel = 0;
+                std::string licensee_id = find_comboBox_id(GkRecords::MiscRecordType::gkLicensee,
+                                                           GkRecords::comboBoxType::ViewRecords,
+                                                           ui->comboBox_view_records_licensee->currentIndex());
+                delete_category(GkRecords::MiscRecordType::gkLicensee, licensee_id);
             }
         }
     } catch (const std::exception &e) {
@@ -479,36 +821,12 @@ void HerpApp::on_toolButton_view_records_species_clicked()
 {
     try {
         // Delete `Species` entry
-        if ((!comboBox_species.empty()) && (!archive_records.empty())) {
+        if ((!comboBox_index[GkRecords::comboBoxType::ViewRecords].species.empty()) && (!archive_records.empty())) {
             if (caches_enabled) {
-                int curr_sel = ui->comboBox_view_records_species->currentIndex();
-                std::string species_id;
-                for (auto it = comboBox_species.begin(); it != comboBox_species.end(); ++it) {
-                    if (it.value().comboBox.comboBox_type == GkRecords::comboBoxType::ViewRecords) {
-                        if (it.value().comboBox.index_no == curr_sel) {
-                            species_id = it.value().species_id;
-                            break;
-                        }
-                    }
-                }
-
-                comboBox_species.clear();
-                comboBox_animals.clear();
-                gkDbWrite->mass_del_cat(GkRecords::MiscRecordType::gkSpecies, species_id);
-                update_all(true, species_id);
-
-                if (!species_cache.empty()) {
-                    emit on_comboBox_view_charts_select_licensee_currentIndexChanged(0);
-                    emit on_comboBox_existing_license_id_currentIndexChanged(0);
-                    emit on_comboBox_view_records_licensee_currentIndexChanged(0);
-                } else {
-                    comboboxes_clear(true);
-                }
-
-                comboBox_add_records_licensee_sel = 0;
-                comboBox_add_records_species_sel = 0;
-                comboBox_add_records_animals_sel = 0;
-                comboBox_view_records_animals_sel = 0;
+                std::string species_id = find_comboBox_id(GkRecords::MiscRecordType::gkSpecies,
+                                                          GkRecords::comboBoxType::ViewRecords,
+                                                          ui->comboBox_view_records_species->currentIndex());
+                delete_category(GkRecords::MiscRecordType::gkSpecies, species_id);
             }
         }
     } catch (const std::exception &e) {
@@ -522,47 +840,109 @@ void HerpApp::on_toolButton_view_records_animal_clicked()
 {
     try {
         // Delete `Animals` entry
-        if ((!comboBox_animals.empty()) && (!archive_records.empty())) {
+        if ((!comboBox_index[GkRecords::comboBoxType::ViewRecords].animals.empty()) && (!archive_records.empty())) {
             if (caches_enabled) {
-                int curr_sel = ui->comboBox_view_records_animal_name->currentIndex();
-                std::string animal_id;
-                for (auto it = comboBox_animals.begin(); it != comboBox_animals.end(); ++it) {
-                    if (it.value().comboBox.comboBox_type == GkRecords::comboBoxType::ViewRecords) {
-                        if (it.value().comboBox.index_no == curr_sel) {
-                            animal_id = it.value().name_id;
-                            break;
-                        }
-                    }
-                }
+                std::string animal_id = find_comboBox_id(GkRecords::MiscRecordType::gkId,
+                                                         GkRecords::comboBoxType::ViewRecords,
+                                                         ui->comboBox_view_records_animal_name->currentIndex());
+                delete_category(GkRecords::MiscRecordType::gkId, animal_id);
+            }
+        }
+    } catch (const std::exception &e) {
+        QMessageBox::warning(this, tr("Error!"), e.what(), QMessageBox::Ok);
+    }
 
-                comboBox_species.clear();
-                comboBox_animals.clear();
-                gkDbWrite->mass_del_cat(GkRecords::MiscRecordType::gkId, animal_id);
-                update_all(true, animal_id);
+    return;
+}
 
-                if (!animal_cache.empty()) {
-                    emit on_comboBox_view_charts_select_licensee_currentIndexChanged(0);
-                    emit on_comboBox_existing_license_id_currentIndexChanged(0);
-                    emit on_comboBox_view_records_licensee_currentIndexChanged(0);
-                } else {
-                    comboboxes_clear(true);
-                }
+/**
+ * @brief HerpApp::delete_category looks up everything that is associated with the given Licensee, Species, or Animal
+ * upon the database thread, asks the user whether they really wish to delete all of it, and if so, carries out the
+ * deletion before refreshing the user interface.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param record_type Whether the given Unique ID is for a Licensee, Species, or Animal.
+ * @param record_id The Unique ID of the category in question.
+ */
+void HerpApp::delete_category(const GkRecords::MiscRecordType &record_type, const std::string &record_id)
+{
+    auto db_write = gkDbWrite;
+    gkDbAsync->dispatch([db_write, record_type, record_id]() {
+        return db_write->find_cat_dependants(record_type, record_id);
+    }, [this, db_write, record_type](const GkRecords::GkCategories &categories) {
+        if (!del_cat_msg_box(categories, record_type)) {
+            return;
+        }
 
-                comboBox_add_records_licensee_sel = 0;
-                comboBox_add_records_species_sel = 0;
-                comboBox_add_records_animals_sel = 0;
-                comboBox_view_records_animals_sel = 0;
+        gkDbAsync->dispatch([db_write, record_type, categories]() {
+            return db_write->mass_del_cat(record_type, categories);
+        }, [this](bool) {
+            // The deleted records have already been pruned from the caches by this point, and the QComboBoxes get
+            // refilled once the change-set is applied
+            if (gkCategoryTree->licensees().empty()) {
+                comboboxes_clear(true);
             }
+
+            viewed_records.clear();
+            std::string next_record = browse_records(archive_records, true);
+            archive_curr_sel_record = next_record;
+            archive_fill_form_data(next_record);
+        });
+    });
+
+    return;
+}
+
+/**
+ * @brief HerpApp::del_cat_msg_box will pose a QMessageBox to the user of HerpLog and ask them if they want to proceed
+ * with the action of deleting the specified categories in question (`Licensee`, `Species`, or `Animal ID`) from
+ * the Google LevelDB database.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2018-03-21
+ * @param cat_struct The dependants of the category in question, as found by GkDbWrite::find_cat_dependants().
+ * @param record_type The type of category we are dealing with in this instance (`Licensee`, `Species`, or `Animal ID`).
+ * @return Whether the user wants to delete the specified categories in question (TRUE) or not (FALSE).
+ * @see GekkoFyre::GkStringOp::tally_cat_deletions()
+ */
+bool HerpApp::del_cat_msg_box(const GkRecords::GkCategories &cat_struct, const GkRecords::MiscRecordType &record_type)
+{
+    try {
+        GkRecords::GkCatDeletionTally tally = gkStrOp->tally_cat_deletions(cat_struct, record_type);
+
+        QMessageBox msgBox;
+        msgBox.setWindowTitle(tr("Proceed?"));
+        msgBox.setText(tr("Are you sure about deleting all of the specified `categories` and `log entries`?"));
+        msgBox.setStandardButtons(QMessageBox::YesToAll | QMessageBox::No | QMessageBox::Cancel);
+        msgBox.setDefaultButton(QMessageBox::No);
+        msgBox.setParent(nullptr);
+        msgBox.setDetailedText(tr("Total number of deletions include...\n\n%1 x Licensees\n%2 x Species\n%3 x Animal IDs\n\n%4 x Log entries")
+                                       .arg(QString::number(tally.licensees))
+                                       .arg(QString::number(tally.species))
+                                       .arg(QString::number(tally.animal_ids))
+                                       .arg(QString::number(tally.log_entries)));
+
+        int ret = msgBox.exec();
+        switch (ret) {
+            case QMessageBox::YesToAll:
+                return true;
+            case QMessageBox::No:
+                return false;
+            case QMessageBox::Cancel:
+                return false;
+            default:
+                // Should never be reached!
+                throw std::invalid_argument(tr("Unable to read Unique Identifier from database!").toStdString());
         }
     } catch (const std::exception &e) {
         QMessageBox::warning(this, tr("Error!"), e.what(), QMessageBox::Ok);
     }
 
-    return;
+    return false;
 }
 
 bool HerpApp::submit_log_entry()
 {
+    GkTraceSpan span("HerpApp::submit_log_entry", "ui");
     try {
         if (!ui->comboBox_existing_license_id->currentText().isEmpty() || !ui->lineEdit_new_license_id->text().isEmpty()) {
             if (!ui->comboBox_existing_species->currentText().isEmpty() || !ui->lineEdit_new_species->text().isEmpty()) {
@@ -624,64 +1004,68 @@ bool HerpApp::submit_log_entry()
                     submit.had_hydration = ui->checkBox_hydration->isChecked();
                     submit.had_vitamins = ui->checkBox_vitamins->isChecked();
                     submit.weight = ui->spinBox_weight->value();
+                    for (int i = 0; i < ui->listWidget_attachments->count(); ++i) {
+                        submit.attachments.push_back(ui->listWidget_attachments->item(i)->data(Qt::UserRole).toString().toStdString());
+                    }
 
                     if ((!unique_id.empty()) && (!submit.licensee.licensee_id.empty()) && (!submit.species.species_id.empty()) &&
                             (!submit.identifier.name_id.empty()) && (submit.date_time > 0)) {
                         // Make sure at least one field regarding notes is filled in!
                         if ((!submit.further_notes.empty()) || (!submit.vitamin_notes.empty()) || (!submit.toilet_notes.empty()) ||
                                 (!submit.temp_notes.empty()) || (!submit.weight_notes.empty()) || (!submit.hydration_notes.empty())) {
-                            gkDbWrite->add_uuid(unique_id, submit.licensee, submit.species, submit.identifier);
-                            gkDbWrite->add_item_db(unique_id, dateTime, std::to_string(submit.date_time));
-                            gkDbWrite->add_item_db(unique_id, furtherNotes, submit.further_notes);
-                            gkDbWrite->add_item_db(unique_id, vitaminNotes, submit.vitamin_notes);
-                            gkDbWrite->add_item_db(unique_id, toiletNotes, submit.toilet_notes);
-                            gkDbWrite->add_item_db(unique_id, tempNotes, submit.temp_notes);
-                            gkDbWrite->add_item_db(unique_id, weightNotes, submit.weight_notes);
-                            gkDbWrite->add_item_db(unique_id, hydrationNotes, submit.hydration_notes);
-                            gkDbWrite->add_item_db(unique_id, boolWentToilet, std::to_string(submit.went_toilet));
-                            gkDbWrite->add_item_db(unique_id, boolHadHydration, std::to_string(submit.had_hydration));
-                            gkDbWrite->add_item_db(unique_id, boolHadVitamins, std::to_string(submit.had_vitamins));
-                            gkDbWrite->add_item_db(unique_id, weightMeasure, std::to_string(submit.weight));
-
-                            // Reset all the input fields
-                            ui->dateTime_add_record->setDate(QDate::currentDate());
-                            ui->dateTime_add_record->setTime(QTime::currentTime());
-                            ui->lineEdit_new_license_id->clear();
-                            ui->lineEdit_new_species->clear();
-                            ui->lineEdit_new_id->clear();
-                            ui->lineEdit_toilet_notes->clear();
-                            ui->lineEdit_hydration_notes->clear();
-                            ui->lineEdit_vitamins_notes->clear();
-                            ui->lineEdit_temperature_notes->clear();
-                            ui->lineEdit_weight_notes->clear();
-                            ui->checkBox_toilet->setChecked(false);
-                            ui->checkBox_hydration->setChecked(false);
-                            ui->checkBox_vitamins->setChecked(false);
-                            ui->spinBox_weight->setValue(0.000);
-                            ui->plainTextEdit_furtherNotes->clear();
-
-                            ui->comboBox_existing_license_id->setCurrentIndex(0);
-                            ui->comboBox_existing_species->setCurrentIndex(0);
-                            ui->comboBox_existing_id->setCurrentIndex(0);
-                            ui->comboBox_view_records_licensee->setCurrentIndex(0);
-                            ui->comboBox_view_records_species->setCurrentIndex(0);
-                            ui->comboBox_view_records_animal_name->setCurrentIndex(0);
-                            ui->comboBox_view_charts_select_licensee->setCurrentIndex(0);
-                            ui->comboBox_view_charts_select_species->setCurrentIndex(0);
-                            ui->comboBox_view_charts_select_id->setCurrentIndex(0);
-
-                            emit on_comboBox_existing_license_id_currentIndexChanged(0);
-                            emit on_comboBox_existing_species_currentIndexChanged(0);
-                            emit on_comboBox_existing_id_currentIndexChanged(0);
-                            emit on_comboBox_view_records_licensee_currentIndexChanged(0);
-                            emit on_comboBox_view_records_species_currentIndexChanged(0);
-                            emit on_comboBox_view_records_animal_name_currentIndexChanged(0);
-                            emit on_comboBox_view_charts_select_licensee_currentIndexChanged(0);
-                            emit on_comboBox_view_charts_select_species_currentIndexChanged(0);
-                            emit on_comboBox_view_charts_select_id_currentIndexChanged(0);
-
-                            on_toolButton_new_hash_clicked();
-                            update_all();
+                            submit.record_id = unique_id;
+                            auto db_write = gkDbWrite;
+                            gkDbAsync->dispatch([db_write, unique_id, submit]() {
+                                return db_write->add_log_entry(unique_id, submit);
+                            }, [this](bool written) {
+                                if (!written) {
+                                    // Nothing was written, so leave the form be for the user to try again
+                                    QMessageBox::warning(this, tr("Error!"),
+                                                         tr("A record with the same Unique ID already exists!"),
+                                                         QMessageBox::Ok);
+                                    return;
+                                }
+
+                                // Reset all the input fields
+                                ui->dateTime_add_record->setDate(QDate::currentDate());
+                                ui->dateTime_add_record->setTime(QTime::currentTime());
+                                ui->lineEdit_new_license_id->clear();
+                                ui->lineEdit_new_species->clear();
+                                ui->lineEdit_new_id->clear();
+                                ui->lineEdit_toilet_notes->clear();
+                                ui->lineEdit_hydration_notes->clear();
+                                ui->lineEdit_vitamins_notes->clear();
+                                ui->lineEdit_temperature_notes->clear();
+                                ui->lineEdit_weight_notes->clear();
+                                ui->checkBox_toilet->setChecked(false);
+                                ui->checkBox_hydration->setChecked(false);
+                                ui->checkBox_vitamins->setChecked(false);
+                                ui->spinBox_weight->setValue(0.000);
+                                ui->plainTextEdit_furtherNotes->clear();
+                                ui->listWidget_attachments->clear();
+
+                                ui->comboBox_existing_license_id->setCurrentIndex(0);
+                                ui->comboBox_existing_species->setCurrentIndex(0);
+                                ui->comboBox_existing_id->setCurrentIndex(0);
+                                ui->comboBox_view_records_licensee->setCurrentIndex(0);
+                                ui->comboBox_view_records_species->setCurrentIndex(0);
+                                ui->comboBox_view_records_animal_name->setCurrentIndex(0);
+                                ui->comboBox_view_charts_select_licensee->setCurrentIndex(0);
+                                ui->comboBox_view_charts_select_species->setCurrentIndex(0);
+                                ui->comboBox_view_charts_select_id->setCurrentIndex(0);
+
+                                emit on_comboBox_existing_license_id_currentIndexChanged(0);
+                                emit on_comboBox_existing_species_currentIndexChanged(0);
+                                emit on_comboBox_existing_id_currentIndexChanged(0);
+                                emit on_comboBox_view_records_licensee_currentIndexChanged(0);
+                                emit on_comboBox_view_records_species_currentIndexChanged(0);
+                                emit on_comboBox_view_records_animal_name_currentIndexChanged(0);
+                                emit on_comboBox_view_charts_select_licensee_currentIndexChanged(0);
+                                emit on_comboBox_view_charts_select_species_currentIndexChanged(0);
+                                emit on_comboBox_view_charts_select_id_currentIndexChanged(0);
+
+                                on_toolButton_new_hash_clicked();
+                            });
 
                             return true;
                         } else {
@@ -708,92 +1092,107 @@ bool HerpApp::submit_log_entry()
     return false;
 }
 
+/**
+ * @brief HerpApp::refresh_caches builds the category tree if it has not been already, and then brings every cache and
+ * widget that derives from it up to date. Once this has been done, any writes to the database are applied by way of
+ * `apply_changes()` instead.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2018-03-09
+ */
 void HerpApp::refresh_caches()
 {
+    GkTraceSpan span("HerpApp::refresh_caches", "ui");
     try {
         std::lock_guard<std::mutex> locker(r_cache_mtx);
 
-        unique_id_map.clear();
-        unique_id_map = gkDbRead->get_uuids();
-
-        licensee_cache.clear();
-        auto licensee_temp_cache = gkDbRead->get_cat_key_vals(GkRecords::MiscRecordType::gkLicensee);
-        if (!licensee_temp_cache.empty()) {
-            ui->comboBox_existing_license_id->clear();
-            ui->comboBox_view_records_licensee->clear();
-            ui->comboBox_view_charts_select_licensee->clear();
-            int counter = 0;
-            for (auto it = licensee_temp_cache.begin(); it != licensee_temp_cache.end(); ++it) {
-                licensee_cache.insertMulti(it.key(), std::make_pair(it.value(), counter));
-                ui->comboBox_existing_license_id->insertItem(counter, QString::fromStdString(it.value()));
-                ui->comboBox_view_records_licensee->insertItem(counter, QString::fromStdString(it.value()));
-                ui->comboBox_view_charts_select_licensee->insertItem(counter, QString::fromStdString(it.value()));
-                ++counter;
-            }
+        // The tree is patched as records are inserted/deleted, so the database only needs to be read the once
+        if (!gkCategoryTree->is_built()) {
+            gkCategoryTree->build();
         }
 
-        species_cache.clear();
-        animal_cache.clear();
-        if (!unique_id_map.empty()) {
-            std::vector<std::string> record_ids;
-            auto animal_temp_cache = gkDbRead->get_cat_key_vals(GkRecords::MiscRecordType::gkId);
+        fill_licensee_comboBoxes();
+        refresh_date_range();
+        update_views_enabled();
+    } catch (const std::exception &e) {
+        QMessageBox::warning(this, tr("Error!"), e.what(), QMessageBox::Ok);
+    }
 
-            for (const auto &ids: unique_id_map) {
-                if (!ids.first.empty()) {
-                    record_ids.push_back(ids.first);
-                }
+    return;
+}
 
-                if (!species_cache.contains(ids.second.licensee_id, ids.second.species_id)) {
-                    auto species_temp_cache = gkDbRead->get_cat_key_vals(GkRecords::MiscRecordType::gkSpecies);
-                    if (!species_temp_cache.empty()) {
-                        for (auto it = species_temp_cache.begin(); it != species_temp_cache.end(); ++it) {
-                            if (it.key() == ids.second.species_id) {
-                                species_cache.insertMulti(ids.second.licensee_id, ids.second.species_id);
-                                break;
-                            }
-                        }
-                    }
-                }
+/**
+ * @brief HerpApp::fill_licensee_comboBoxes fills the Licensee QComboBoxes of every tab from the category tree, which in
+ * turn cascade down to the Species and Animals.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ */
+void HerpApp::fill_licensee_comboBoxes()
+{
+    const auto licensees = gkCategoryTree->licensees();
+    fill_category_comboBox(GkRecords::MiscRecordType::gkLicensee, GkRecords::comboBoxType::AddRecord, licensees);
+    fill_category_comboBox(GkRecords::MiscRecordType::gkLicensee, GkRecords::comboBoxType::ViewRecords, licensees);
+    fill_category_comboBox(GkRecords::MiscRecordType::gkLicensee, GkRecords::comboBoxType::ViewCharts, licensees);
 
-                if (!animal_cache.contains(ids.second.species_id, ids.second.name_id)) {
-                    if (!animal_temp_cache.empty()) {
-                        for (auto it = animal_temp_cache.begin(); it != animal_temp_cache.end(); ++it) {
-                            if (it.key() == ids.second.name_id) {
-                                animal_cache.insertMulti(ids.second.species_id, ids.second.name_id);
-                                break;
-                            }
-                        }
-                    }
-                }
-            }
+    return;
+}
+
+/**
+ * @brief HerpApp::refresh_date_range reads the oldest and newest records off either end of the timestamp index, rather
+ * than going through every record within the database, and resets the date ranges of the UI should either have moved.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ */
+void HerpApp::refresh_date_range()
+{
+    auto db_read = gkDbRead;
+    gkDbAsync->dispatch([db_read]() {
+        const auto oldest = db_read->scan_timestamp_index("", 1, false);
+        const auto newest = db_read->scan_timestamp_index("", 1, true);
+        if (oldest.empty() || newest.empty()) {
+            return std::make_pair(0L, 0L);
+        }
 
-            if (!record_ids.empty()) {
-                minDateTime = gkDbRead->determine_min_date_time(record_ids);
-                maxDateTime = gkDbRead->determine_max_date_time(record_ids);
+        return std::make_pair(oldest.front().date_time, newest.front().date_time);
+    }, [this](const std::pair<long int, long int> &date_range) {
+        if ((date_range.first != minDateTime) || (date_range.second != maxDateTime)) {
+            minDateTime = date_range.first;
+            maxDateTime = date_range.second;
+            set_date_ranges();
+            if (caches_enabled) {
+                update_charts();
             }
+        }
+    });
 
-            if (!caches_enabled) {
-                caches_enabled = true;
+    return;
+}
 
-                if (!ui->viewRecords->isEnabled()) {
-                    ui->viewRecords->setEnabled(true);
-                }
+/**
+ * @brief HerpApp::update_views_enabled enables the `viewRecords` and `viewCharts` tabs for as long as there are any
+ * records to view.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ */
+void HerpApp::update_views_enabled()
+{
+    if (gkCategoryTree->record_count() > 0) {
+        if (!caches_enabled) {
+            caches_enabled = true;
 
-                if (!ui->viewCharts->isEnabled()) {
-                    ui->viewCharts->setEnabled(true);
-                }
+            if (!ui->viewRecords->isEnabled()) {
+                ui->viewRecords->setEnabled(true);
             }
 
-            return;
-        } else {
-            caches_enabled = false;
-
-            ui->viewRecords->setEnabled(false);
-            ui->viewCharts->setEnabled(false);
-            ui->interface_tabWidget->setCurrentIndex(0);
+            if (!ui->viewCharts->isEnabled()) {
+                ui->viewCharts->setEnabled(true);
+            }
         }
-    } catch (const std::exception &e) {
-        QMessageBox::warning(this, tr("Error!"), e.what(), QMessageBox::Ok);
+    } else {
+        caches_enabled = false;
+
+        ui->viewRecords->setEnabled(false);
+        ui->viewCharts->setEnabled(false);
+        ui->interface_tabWidget->setCurrentIndex(0);
     }
 
     return;
@@ -807,8 +1206,7 @@ void HerpApp::refresh_caches()
  */
 void HerpApp::set_date_ranges()
 {
-    refresh_caches();
-    if (!unique_id_map.empty()) {
+    if (gkCategoryTree->record_count() > 0) {
         if ((minDateTime > 0) && (maxDateTime > 0)) {
             if (!ui->dateTimeEdit_browse_start->isEnabled() && !ui->dateTimeEdit_browse_end->isEnabled()) {
                 ui->dateTimeEdit_browse_start->setEnabled(true);
@@ -879,34 +1277,16 @@ std::string HerpApp::browse_records(const std::list<std::string> &records, const
  * @param record_type Whether we are dealing with Licensee, Species, or Animal values.
  * @param comboBox_type Whether the QComboBoxes we are dealing with in question are located in the AddRecords, ViewRecords,
  * or ViewCharts tab.
- * @param index_no An integer relating to where the specific entry within the QMultiMap lies, and thus its position in
- * the displayed QComboBox(es).
+ * @param index_no The position of the entry within the displayed QComboBox(es).
  * @return If found, the discovered Unique ID relating to the Licensee, Species, or Animal value for the given index number.
  */
 std::string HerpApp::find_comboBox_id(const GkRecords::MiscRecordType &record_type, const GkRecords::comboBoxType &comboBox_type,
                                       const int &index_no)
 {
     try {
-        if (record_type == GkRecords::MiscRecordType::gkSpecies) {
-            auto i = comboBox_species.find(comboBox_type);
-            while (i != comboBox_species.end() && i.key() == comboBox_type) {
-                if (index_no == i.value().comboBox.index_no) {
-                    return i.value().species_id;
-                }
-            }
-        } else if (record_type == GkRecords::MiscRecordType::gkId) {
-            auto i = comboBox_animals.find(comboBox_type);
-            while (i != comboBox_animals.end() && i.key() == comboBox_type) {
-                if (index_no == i.value().comboBox.index_no) {
-                    return i.value().name_id;
-                }
-            }
-        } else {
-            for (auto it = licensee_cache.begin(); it != licensee_cache.end(); ++it) {
-                if (it.value().second == index_no) {
-                    return it.key();
-                }
-            }
+        const auto node = find_comboBox_node(record_type, comboBox_type, index_no);
+        if (node != GkCategoryTree::npos) {
+            return gkCategoryTree->id(record_type, node);
         }
     } catch (const std::exception &e) {
         QMessageBox::warning(this, tr("Error!"), e.what(), QMessageBox::Ok);
@@ -916,227 +1296,241 @@ std::string HerpApp::find_comboBox_id(const GkRecords::MiscRecordType &record_ty
 }
 
 /**
- * @brief HerpApp::find_species_names will fill out the specified comboBox(es) with the found `Species` for the
- * given `Licensee`.
+ * @brief HerpApp::find_comboBox_node maps a row of one of the category QComboBoxes back onto its node within the
+ * category tree.
  * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
- * @date 2018-03-09
- * @param dropbox_type Whether to insert data to the `Species` comboBox within the `Add Record` section, `View Records`
- * area, or in the `View Charts` bit.
- * @param licensee_id The unique Licensee ID that is attached to the Species Names in question.
- * @return A list of Species IDs that correspond to the given licensee.
+ * @date 2026-10-18
+ * @return The node in question, or `GkCategoryTree::npos` if nothing is selected.
  */
-std::list<GkRecords::GkSpecies> HerpApp::find_species_names(const GkRecords::comboBoxType &dropbox_type, const std::string &licensee_id)
+std::uint32_t HerpApp::find_comboBox_node(const GkRecords::MiscRecordType &record_type,
+                                          const GkRecords::comboBoxType &comboBox_type, const int &index_no)
 {
-    try {
-        switch (dropbox_type) {
-            case GkRecords::comboBoxType::AddRecord:
-                ui->comboBox_existing_species->clear();
-                break;
-            case GkRecords::comboBoxType::ViewRecords:
-                ui->comboBox_view_records_species->clear();
-                break;
-            case GkRecords::comboBoxType::ViewCharts:
-                ui->comboBox_view_charts_select_species->clear();
-                break;
-            default:
-                throw std::runtime_error(tr("An error occurred whilst filling a comboBox with info from the database!").toStdString());
-        }
-
-        auto tmp_species_db = gkDbRead->get_cat_key_vals(GkRecords::MiscRecordType::gkSpecies);
-        std::list<GkRecords::GkSpecies> output; // A list of Species Data that correspond to the given licensee.
-        int counter = 0;
-        if ((!licensee_id.empty()) && (!species_cache.empty())) {
-            for (auto it_ca = species_cache.begin(); it_ca != species_cache.end(); ++it_ca) {
-                if (it_ca.key() == licensee_id) {
-                    std::string species_id = it_ca.value();
-                    GkRecords::GkSpecies species;
-                    species.species_id = species_id;
-
-                    for (auto it_tmp = tmp_species_db.begin(); it_tmp != tmp_species_db.end(); ++it_tmp) {
-                        if (it_tmp.key() == species_id) {
-                            switch (dropbox_type) {
-                                case GkRecords::comboBoxType::AddRecord:
-                                    ui->comboBox_existing_species->insertItem(counter, QString::fromStdString(it_tmp.value()));
-                                    species.species_name = it_tmp.value();
-                                    species.comboBox.index_no = counter;
-                                    species.comboBox.comboBox_type = GkRecords::comboBoxType::AddRecord;
-                                    output.push_back(species);
-                                    ++counter;
-                                    break;
-                                case GkRecords::comboBoxType::ViewRecords:
-                                    ui->comboBox_view_records_species->insertItem(counter, QString::fromStdString(it_tmp.value()));
-                                    species.species_name = it_tmp.value();
-                                    species.comboBox.index_no = counter;
-                                    species.comboBox.comboBox_type = GkRecords::comboBoxType::ViewRecords;
-                                    output.push_back(species);
-                                    ++counter;
-                                    break;
-                                case GkRecords::comboBoxType::ViewCharts:
-                                    ui->comboBox_view_charts_select_species->insertItem(counter, QString::fromStdString(it_tmp.value()));
-                                    species.species_name = it_tmp.value();
-                                    species.comboBox.index_no = counter;
-                                    species.comboBox.comboBox_type = GkRecords::comboBoxType::ViewCharts;
-                                    output.push_back(species);
-                                    ++counter;
-                                    break;
-                            }
+    const auto &rows = comboBox_rows(record_type, comboBox_type);
+    if ((index_no < 0) || (static_cast<std::size_t>(index_no) >= rows.size())) {
+        return GkCategoryTree::npos;
+    }
 
-                            break;
-                        }
-                    }
-                }
+    return rows[static_cast<std::size_t>(index_no)];
+}
+
+std::vector<std::uint32_t> &HerpApp::comboBox_rows(const GkRecords::MiscRecordType &record_type,
+                                                   const GkRecords::comboBoxType &comboBox_type)
+{
+    auto &combo_index = comboBox_index.at(static_cast<std::size_t>(comboBox_type));
+    switch (record_type) {
+        case GkRecords::MiscRecordType::gkLicensee:
+            return combo_index.licensees;
+        case GkRecords::MiscRecordType::gkSpecies:
+            return combo_index.species;
+        case GkRecords::MiscRecordType::gkId:
+            return combo_index.animals;
+        default:
+            throw std::runtime_error(tr("An error had occurred whilst filling a QComboBox with information!").toStdString());
+    }
+}
+
+QComboBox *HerpApp::category_comboBox(const GkRecords::MiscRecordType &record_type,
+                                      const GkRecords::comboBoxType &comboBox_type)
+{
+    using namespace GkRecords;
+    switch (comboBox_type) {
+        case comboBoxType::AddRecord:
+            if (record_type == MiscRecordType::gkLicensee) {
+                return ui->comboBox_existing_license_id;
+            } else if (record_type == MiscRecordType::gkSpecies) {
+                return ui->comboBox_existing_species;
+            } else if (record_type == MiscRecordType::gkId) {
+                return ui->comboBox_existing_id;
+            }
+
+            break;
+        case comboBoxType::ViewRecords:
+            if (record_type == MiscRecordType::gkLicensee) {
+                return ui->comboBox_view_records_licensee;
+            } else if (record_type == MiscRecordType::gkSpecies) {
+                return ui->comboBox_view_records_species;
+            } else if (record_type == MiscRecordType::gkId) {
+                return ui->comboBox_view_records_animal_name;
             }
 
-            return output;
+            break;
+        case comboBoxType::ViewCharts:
+            if (record_type == MiscRecordType::gkLicensee) {
+                return ui->comboBox_view_charts_select_licensee;
+            } else if (record_type == MiscRecordType::gkSpecies) {
+                return ui->comboBox_view_charts_select_species;
+            } else if (record_type == MiscRecordType::gkId) {
+                return ui->comboBox_view_charts_select_id;
+            }
+
+            break;
+    }
+
+    throw std::runtime_error(tr("An error occurred whilst filling a comboBox with info from the database!").toStdString());
+}
+
+/**
+ * @brief HerpApp::fill_category_comboBox will fill out the specified comboBox with the given nodes of the category tree,
+ * and remember which node lies at which row.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param record_type Whether to fill the Licensee, Species, or `Name / ID#` comboBox.
+ * @param comboBox_type Whether to fill the comboBox within the `Add Record` section, `View Records` area, or in the
+ * `View Charts` bit.
+ * @param nodes The nodes of the category tree, in the order they are to be displayed.
+ */
+void HerpApp::fill_category_comboBox(const GkRecords::MiscRecordType &record_type,
+                                     const GkRecords::comboBoxType &comboBox_type,
+                                     const std::vector<std::uint32_t> &nodes)
+{
+    QComboBox *comboBox = category_comboBox(record_type, comboBox_type);
+    const auto previous = find_comboBox_node(record_type, comboBox_type, comboBox->currentIndex());
+
+    QStringList names;
+    names.reserve(static_cast<int>(nodes.size()));
+    int selected = nodes.empty() ? -1 : 0;
+    for (std::size_t i = 0; i < nodes.size(); ++i) {
+        names << QString::fromStdString(gkCategoryTree->name(record_type, nodes[i]));
+        if (nodes[i] == previous) {
+            selected = static_cast<int>(i); // Keep whatever the user had selected, should it still be around
         }
-    } catch (const std::exception &e) {
-        QMessageBox::warning(this, tr("Error!"), e.what(), QMessageBox::Ok);
     }
 
-    return std::list<GkRecords::GkSpecies>();
+    {
+        // Otherwise, both the clearing and the refilling would cascade down the tree
+        const QSignalBlocker blocker(comboBox);
+        comboBox->clear();
+        comboBox_rows(record_type, comboBox_type) = nodes;
+        comboBox->addItems(names);
+        comboBox->setCurrentIndex(selected);
+    }
+
+    cascade_comboBox(record_type, comboBox_type, selected);
+    return;
 }
 
 /**
- * @brief HerpApp::find_animal_names will fill out the specified comboBox(es) with the found `Name / ID#`'s for the
- * given species.
+ * @brief HerpApp::cascade_comboBox passes the selection of a category QComboBox on to its handler, as if the user had
+ * made it themselves.
  * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
- * @date 2018-03-09
- * @param dropbox_type Whether to insert data to the `Name / ID#` comboBox in the `Add Record` section, the
- * `View Records` area, or `View Charts` bit.
- * @param species_id The unique Species ID that is attached to the Animal Names in question.
- * @return A list of Animal IDs that correspond to the given species.
+ * @date 2026-10-18
  */
-std::list<GkRecords::GkId> HerpApp::find_animal_names(const GkRecords::comboBoxType &dropbox_type, const std::string &species_id)
+void HerpApp::cascade_comboBox(const GkRecords::MiscRecordType &record_type, const GkRecords::comboBoxType &comboBox_type,
+                               const int &index)
 {
-    try {
-        switch (dropbox_type) {
-            case GkRecords::comboBoxType::AddRecord:
-                ui->comboBox_existing_id->clear();
-                break;
-            case GkRecords::comboBoxType::ViewRecords:
-                ui->comboBox_view_records_animal_name->clear();
-                break;
-            case GkRecords::comboBoxType::ViewCharts:
-                ui->comboBox_view_charts_select_id->clear();
-                break;
-            default:
-                throw std::runtime_error(tr("An error occurred whilst filling a comboBox with info from the database!").toStdString());
-        }
-
-        std::list<GkRecords::GkId> output; // A list of Animal IDs that correspond to the given species.
-        int counter = 0;
-        if ((!species_id.empty()) && (!animal_cache.empty())) {
-            for (auto it_ca = animal_cache.begin(); it_ca != animal_cache.end(); ++it_ca) {
-                if (it_ca.key() == species_id) {
-                    std::string animal_id = it_ca.value();
-                    GkRecords::GkId animal;
-                    animal.name_id = animal_id;
-
-                    auto tmp_animals_db = gkDbRead->get_cat_key_vals(GkRecords::MiscRecordType::gkId);
-                    for (auto it_tmp = tmp_animals_db.begin(); it_tmp != tmp_animals_db.end(); ++it_tmp) {
-                        if (it_tmp.key() == animal_id) {
-                            switch (dropbox_type) {
-                                case GkRecords::comboBoxType::AddRecord:
-                                    ui->comboBox_existing_id->insertItem(counter, QString::fromStdString(it_tmp.value()));
-                                    animal.identifier_str = it_tmp.value();
-                                    animal.comboBox.index_no = counter;
-                                    animal.comboBox.comboBox_type = GkRecords::comboBoxType::AddRecord;
-                                    output.push_back(animal);
-                                    ++counter;
-                                    break;
-                                case GkRecords::comboBoxType::ViewRecords:
-                                    ui->comboBox_view_records_animal_name->insertItem(counter, QString::fromStdString(it_tmp.value()));
-                                    animal.identifier_str = it_tmp.value();
-                                    animal.comboBox.index_no = counter;
-                                    animal.comboBox.comboBox_type = GkRecords::comboBoxType::ViewRecords;
-                                    output.push_back(animal);
-                                    ++counter;
-                                    break;
-                                case GkRecords::comboBoxType::ViewCharts:
-                                    ui->comboBox_view_charts_select_id->insertItem(counter, QString::fromStdString(it_tmp.value()));
-                                    animal.identifier_str = it_tmp.value();
-                                    animal.comboBox.index_no = counter;
-                                    animal.comboBox.comboBox_type = GkRecords::comboBoxType::ViewCharts;
-                                    output.push_back(animal);
-                                    ++counter;
-                                    break;
-                            }
+    GkTraceSpan span("HerpApp::cascade_comboBox", "ui");
+    using namespace GkRecords;
+    switch (comboBox_type) {
+        case comboBoxType::AddRecord:
+            if (record_type == MiscRecordType::gkLicensee) {
+                on_comboBox_existing_license_id_currentIndexChanged(index);
+            } else if (record_type == MiscRecordType::gkSpecies) {
+                on_comboBox_existing_species_currentIndexChanged(index);
+            } else {
+                on_comboBox_existing_id_currentIndexChanged(index);
+            }
 
-                            break;
-                        }
-                    }
-                }
+            break;
+        case comboBoxType::ViewRecords:
+            if (record_type == MiscRecordType::gkLicensee) {
+                on_comboBox_view_records_licensee_currentIndexChanged(index);
+            } else if (record_type == MiscRecordType::gkSpecies) {
+                on_comboBox_view_records_species_currentIndexChanged(index);
+            } else {
+                on_comboBox_view_records_animal_name_currentIndexChanged(index);
             }
 
-            return output;
-        }
+            break;
+        case comboBoxType::ViewCharts:
+            if (record_type == MiscRecordType::gkLicensee) {
+                on_comboBox_view_charts_select_licensee_currentIndexChanged(index);
+            } else if (record_type == MiscRecordType::gkSpecies) {
+                on_comboBox_view_charts_select_species_currentIndexChanged(index);
+            } else {
+                on_comboBox_view_charts_select_id_currentIndexChanged(index);
+            }
+
+            break;
+    }
+
+    return;
+}
+
+/**
+ * @brief HerpApp::select_licensee fills the Species comboBox of the given tab with those of the selected Licensee.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ */
+void HerpApp::select_licensee(const GkRecords::comboBoxType &comboBox_type, const int &index)
+{
+    try {
+        const auto licensee_idx = find_comboBox_node(GkRecords::MiscRecordType::gkLicensee, comboBox_type, index);
+        fill_category_comboBox(GkRecords::MiscRecordType::gkSpecies, comboBox_type,
+                               gkCategoryTree->species_of(licensee_idx));
     } catch (const std::exception &e) {
         QMessageBox::warning(this, tr("Error!"), e.what(), QMessageBox::Ok);
     }
 
-    return std::list<GkRecords::GkId>();
+    return;
 }
 
-void HerpApp::record_species_index(const std::list<GkRecords::GkSpecies> &species_list, const GkRecords::comboBoxType &comboBox_type)
+/**
+ * @brief HerpApp::select_species fills the `Name / ID#` comboBox of the given tab with the Animals of the selected
+ * Species.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ */
+void HerpApp::select_species(const GkRecords::comboBoxType &comboBox_type, const int &index)
 {
     try {
-        if (!species_list.empty()) {
-            using namespace GkRecords;
-            if (!comboBox_species.empty()) {
-                switch (comboBox_type) {
-                    case comboBoxType::AddRecord:
-                        comboBox_species.remove(comboBoxType::AddRecord);
-                        break;
-                    case comboBoxType::ViewRecords:
-                        comboBox_species.remove(comboBoxType::ViewRecords);
-                        break;
-                    case comboBoxType::ViewCharts:
-                        comboBox_species.remove(comboBoxType::ViewCharts);
-                        break;
-                    default:
-                        throw std::runtime_error(tr("An error had occurred whilst filling a QComboBox with information!").toStdString());
-                }
-            }
-
-            for (const auto &species: species_list) {
-                comboBox_species.insertMulti(comboBox_type, species);
-            }
-        }
+        const auto species_idx = find_comboBox_node(GkRecords::MiscRecordType::gkSpecies, comboBox_type, index);
+        fill_category_comboBox(GkRecords::MiscRecordType::gkId, comboBox_type, gkCategoryTree->animals_of(species_idx));
     } catch (const std::exception &e) {
         QMessageBox::warning(this, tr("Error!"), e.what(), QMessageBox::Ok);
-        return;
     }
 
     return;
 }
 
-void HerpApp::record_animals_index(const std::list<GkRecords::GkId> &animals_list, const GkRecords::comboBoxType &comboBox_type)
+/**
+ * @brief HerpApp::jump_to_category selects a category that was picked out by name within the given tab, by selecting
+ * its Licensee and Species first so that the QComboBoxes cascade down towards it.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param record_type Whether a Licensee, Species, or Animal was picked out.
+ * @param comboBox_type Which tab the QComboBoxes belong to.
+ * @param node_idx The node of the category within the category tree.
+ * @see GkNameCompleter::category_chosen()
+ */
+void HerpApp::jump_to_category(const GkRecords::MiscRecordType &record_type, const GkRecords::comboBoxType &comboBox_type,
+                               const std::uint32_t &node_idx)
 {
+    GkTraceSpan span("HerpApp::jump_to_category", "ui");
+    using namespace GkRecords;
     try {
-        if (!animals_list.empty()) {
-            if (!comboBox_animals.empty()) {
-                switch (comboBox_type) {
-                    case GkRecords::comboBoxType::AddRecord:
-                        comboBox_animals.remove(GkRecords::comboBoxType::AddRecord);
-                        break;
-                    case GkRecords::comboBoxType::ViewRecords:
-                        comboBox_animals.remove(GkRecords::comboBoxType::ViewRecords);
-                        break;
-                    case GkRecords::comboBoxType::ViewCharts:
-                        comboBox_animals.remove(GkRecords::comboBoxType::ViewCharts);
-                        break;
-                    default:
-                        throw std::runtime_error(tr("An error had occurred whilst filling a QComboBox with information!").toStdString());
-                }
-            }
+        std::vector<std::pair<MiscRecordType, std::uint32_t>> lineage;
+        lineage.emplace_back(record_type, node_idx);
+        if (record_type == MiscRecordType::gkId) {
+            lineage.emplace_back(MiscRecordType::gkSpecies, gkCategoryTree->parent(record_type, node_idx));
+        }
+
+        if (lineage.back().first == MiscRecordType::gkSpecies) {
+            lineage.emplace_back(MiscRecordType::gkLicensee, gkCategoryTree->parent(MiscRecordType::gkSpecies,
+                                                                                     lineage.back().second));
+        }
 
-            for (const auto &animals: animals_list) {
-                comboBox_animals.insertMulti(comboBox_type, animals);
+        // Each selection refills the QComboBox beneath it, so the rows have to be looked up afresh every time
+        for (auto it = lineage.rbegin(); it != lineage.rend(); ++it) {
+            const auto &rows = comboBox_rows(it->first, comboBox_type);
+            const auto row = std::find(rows.begin(), rows.end(), it->second);
+            if (row == rows.end()) {
+                return;
             }
+
+            category_comboBox(it->first, comboBox_type)->setCurrentIndex(static_cast<int>(std::distance(rows.begin(), row)));
         }
     } catch (const std::exception &e) {
         QMessageBox::warning(this, tr("Error!"), e.what(), QMessageBox::Ok);
-        return;
     }
 
     return;
@@ -1157,6 +1551,7 @@ void HerpApp::archive_clear_forms()
     ui->checkBox_records_had_vitamins->setChecked(false);
 
     ui->doubleSpinBox_records_weight->setValue(0.000);
+    ui->listWidget_records_attachments->clear();
     return;
 }
 
@@ -1179,92 +1574,45 @@ void HerpApp::archive_fill_form_data(const std::string &record_id)
                                                               GkRecords::comboBoxType::ViewRecords,
                                                               comboBox_view_records_animals_sel);
 
-            for (const auto &cached_record: unique_id_map) {
-                if (cached_record.first == record_id) {
-                    submit_data.record_id = record_id;
-                    if (cached_record.second.name_id == submit_data.identifier.name_id) {
-                        submit_data.licensee.licensee_id = cached_record.second.licensee_id;
-                        submit_data.species.species_id = cached_record.second.species_id;
-                        break;
-                    }
-                }
+            GkRecords::MiscUniqueIds ids;
+            if (gkCategoryTree->record_categories(record_id, ids) && (ids.name_id == submit_data.identifier.name_id)) {
+                submit_data.record_id = record_id;
+                submit_data.licensee.licensee_id = ids.licensee_id;
+                submit_data.species.species_id = ids.species_id;
             }
 
             if ((!submit_data.licensee.licensee_id.empty()) && (!submit_data.species.species_id.empty())) {
-                auto licensee_data = gkDbRead->get_cat_key_vals(GkRecords::MiscRecordType::gkLicensee);
-                auto species_data = gkDbRead->get_cat_key_vals(GkRecords::MiscRecordType::gkSpecies);
-                auto ident_data = gkDbRead->get_cat_key_vals(GkRecords::MiscRecordType::gkId);
-
-                for (auto it = licensee_data.begin(); it != licensee_data.end(); ++it) {
-                    if (it.key() == submit_data.licensee.licensee_id) {
-                        submit_data.licensee.licensee_name = it.value();
-                        break;
-                    }
-                }
-
-                for (auto it = species_data.begin(); it != species_data.end(); ++it) {
-                    if (it.key() == submit_data.species.species_id) {
-                        submit_data.species.species_name = it.value();
-                        break;
-                    }
-                }
-
-                for (auto it = ident_data.begin(); it != ident_data.end(); ++it) {
-                    if (it.key() == submit_data.identifier.name_id) {
-                        submit_data.identifier.identifier_str = it.value();
-                        break;
-                    }
-                }
-
-                submit_data.date_time = std::stoi(gkDbRead->read_item_db(submit_data.record_id, GkRecords::dateTime));
-                submit_data.further_notes = gkDbRead->read_item_db(submit_data.record_id, GkRecords::furtherNotes);
-                submit_data.vitamin_notes = gkDbRead->read_item_db(submit_data.record_id, GkRecords::vitaminNotes);
-                submit_data.toilet_notes = gkDbRead->read_item_db(submit_data.record_id, GkRecords::toiletNotes);
-                submit_data.temp_notes = gkDbRead->read_item_db(submit_data.record_id, GkRecords::tempNotes);
-                submit_data.weight_notes = gkDbRead->read_item_db(submit_data.record_id, GkRecords::weightNotes);
-                submit_data.hydration_notes = gkDbRead->read_item_db(submit_data.record_id, GkRecords::hydrationNotes);
-                submit_data.went_toilet = boost::lexical_cast<bool>(gkDbRead->read_item_db(submit_data.record_id, GkRecords::boolWentToilet));
-                submit_data.had_hydration = boost::lexical_cast<bool>(gkDbRead->read_item_db(submit_data.record_id, GkRecords::boolHadHydration));
-                submit_data.had_vitamins = boost::lexical_cast<bool>(gkDbRead->read_item_db(submit_data.record_id, GkRecords::boolHadVitamins));
-                submit_data.weight = std::stod(gkDbRead->read_item_db(submit_data.record_id, GkRecords::weightMeasure));
-
-                if ((submit_data.date_time > 0) && (!submit_data.licensee.licensee_name.empty()) &&
-                        (!submit_data.species.species_name.empty()) && (!submit_data.identifier.identifier_str.empty())) {
-                    archive_clear_forms();
-
-                    QDateTime qdt;
-                    qdt.setTime_t(submit_data.date_time);
-                    ui->lineEdit_records_dateTime->setText(qdt.toString(tr("dd/MM/yyyy hh:mm:ss AP")));
-
-                    if (!submit_data.toilet_notes.empty()) {
-                        ui->lineEdit_records_toilet_notes->setText(QString::fromStdString(submit_data.toilet_notes));
-                    }
-
-                    if (!submit_data.hydration_notes.empty()) {
-                        ui->lineEdit_records_hydration_notes->setText(QString::fromStdString(submit_data.hydration_notes));
-                    }
-
-                    if (!submit_data.vitamin_notes.empty()) {
-                        ui->lineEdit_records_vitamins_notes->setText(QString::fromStdString(submit_data.vitamin_notes));
-                    }
-
-                    if (!submit_data.temp_notes.empty()) {
-                        ui->lineEdit_records_temperature->setText(QString::fromStdString(submit_data.temp_notes));
+                using namespace GkRecords;
+                submit_data.licensee.licensee_name = gkCategoryTree->name(MiscRecordType::gkLicensee,
+                        gkCategoryTree->find(MiscRecordType::gkLicensee, submit_data.licensee.licensee_id));
+                submit_data.species.species_name = gkCategoryTree->name(MiscRecordType::gkSpecies,
+                        gkCategoryTree->find(MiscRecordType::gkSpecies, submit_data.species.species_id));
+                submit_data.identifier.identifier_str = gkCategoryTree->name(MiscRecordType::gkId,
+                        gkCategoryTree->find(MiscRecordType::gkId, submit_data.identifier.name_id));
+
+                // The fields themselves are read upon the database thread, and only the names filled in from here
+                auto db_read = gkDbRead;
+                const std::string read_record_id = submit_data.record_id;
+                gkDbAsync->dispatch([db_read, read_record_id]() { return db_read->read_log_entry(read_record_id); },
+                                    [this, submit_data](const GkRecords::GkSubmit &log_entry) {
+                    if (log_entry.record_id != archive_curr_sel_record) {
+                        return; // Another record has been selected in the meantime
                     }
 
-                    if (!submit_data.weight_notes.empty()) {
-                        ui->lineEdit_records_weight_notes->setText(QString::fromStdString(submit_data.weight_notes));
+                    GkRecords::GkSubmit entry = log_entry;
+                    entry.licensee = submit_data.licensee;
+                    entry.species = submit_data.species;
+                    entry.identifier = submit_data.identifier;
+                    if ((entry.date_time > 0) && (!entry.licensee.licensee_name.empty()) &&
+                            (!entry.species.species_name.empty()) && (!entry.identifier.identifier_str.empty())) {
+                        archive_show_record(entry);
+                    } else {
+                        QMessageBox::warning(this, tr("Error!"), tr("Was unable to retrieve information from the database!"),
+                                             QMessageBox::Ok);
                     }
+                });
 
-                    ui->checkBox_records_went_toilet->setChecked(submit_data.went_toilet);
-                    ui->checkBox_records_had_hydration->setChecked(submit_data.had_hydration);
-                    ui->checkBox_records_had_vitamins->setChecked(submit_data.had_vitamins);
-
-                    ui->doubleSpinBox_records_weight->setValue(submit_data.weight);
-                    return;
-                } else {
-                    throw std::runtime_error(tr("Was unable to retrieve information from the database!").toStdString());
-                }
+                return;
             } else {
                 QMessageBox::information(this, tr("No data!"), tr("There is no information to present with the given variables. Please try another selection."),
                                          QMessageBox::Ok);
@@ -1281,6 +1629,198 @@ void HerpApp::archive_fill_form_data(const std::string &record_id)
     return;
 }
 
+/**
+ * @brief HerpApp::archive_show_record presents a single record within the forms of the `viewRecords` tab.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param submit_data The record in question.
+ */
+void HerpApp::archive_show_record(const GkRecords::GkSubmit &submit_data)
+{
+    archive_clear_forms();
+
+    QDateTime qdt;
+    qdt.setTime_t(submit_data.date_time);
+    ui->lineEdit_records_dateTime->setText(qdt.toString(tr("dd/MM/yyyy hh:mm:ss AP")));
+
+    if (!submit_data.toilet_notes.empty()) {
+        ui->lineEdit_records_toilet_notes->setText(QString::fromStdString(submit_data.toilet_notes));
+    }
+
+    if (!submit_data.hydration_notes.empty()) {
+        ui->lineEdit_records_hydration_notes->setText(QString::fromStdString(submit_data.hydration_notes));
+    }
+
+    if (!submit_data.vitamin_notes.empty()) {
+        ui->lineEdit_records_vitamins_notes->setText(QString::fromStdString(submit_data.vitamin_notes));
+    }
+
+    if (!submit_data.temp_notes.empty()) {
+        ui->lineEdit_records_temperature->setText(QString::fromStdString(submit_data.temp_notes));
+    }
+
+    if (!submit_data.weight_notes.empty()) {
+        ui->lineEdit_records_weight_notes->setText(QString::fromStdString(submit_data.weight_notes));
+    }
+
+    ui->checkBox_records_went_toilet->setChecked(submit_data.went_toilet);
+    ui->checkBox_records_had_hydration->setChecked(submit_data.had_hydration);
+    ui->checkBox_records_had_vitamins->setChecked(submit_data.had_vitamins);
+
+    if (!submit_data.further_notes.empty()) {
+        ui->plainTextEdit_records_further_notes->setPlainText(QString::fromStdString(submit_data.further_notes));
+    }
+
+    ui->doubleSpinBox_records_weight->setValue(submit_data.weight);
+
+    for (std::size_t i = 0; i < submit_data.attachments.size(); ++i) {
+        add_attachment_item(ui->listWidget_records_attachments, submit_data.attachments[i],
+                            tr("Photo %1").arg(QString::number(i + 1)));
+    }
+
+    return;
+}
+
+/**
+ * @brief HerpApp::add_attachment_item adds a photo to one of the lists of photos, whereby its thumbnail is filled in
+ * once it's been made, if it isn't at hand already.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param list_widget The list in question.
+ * @param hash The SHA-256 hash of the photo, in hexadecimal.
+ * @param label The text to be shown beneath the thumbnail.
+ * @see HerpApp::thumbnail_ready()
+ */
+void HerpApp::add_attachment_item(QListWidget *list_widget, const std::string &hash, const QString &label)
+{
+    QListWidgetItem *item = new QListWidgetItem(label, list_widget);
+    item->setData(Qt::UserRole, QString::fromStdString(hash));
+    item->setToolTip(QString::fromStdString(hash));
+
+    QImage thumbnail;
+    if (gkThumbnailCache && gkThumbnailCache->thumbnail(hash, thumbnail)) {
+        item->setIcon(QIcon(QPixmap::fromImage(thumbnail)));
+    }
+
+    return;
+}
+
+/**
+ * @brief HerpApp::thumbnail_ready fills in the thumbnail of a photo, wherever it's shown, once it's been made.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param hash The SHA-256 hash of the photo, in hexadecimal.
+ * @param image The thumbnail, or a null QImage if the photo is missing or could not be read.
+ * @see GkThumbnailCache::thumbnail_ready()
+ */
+void HerpApp::thumbnail_ready(const QString &hash, const QImage &image)
+{
+    for (QListWidget *list_widget: { ui->listWidget_attachments, ui->listWidget_records_attachments }) {
+        for (int i = 0; i < list_widget->count(); ++i) {
+            QListWidgetItem *item = list_widget->item(i);
+            if (item->data(Qt::UserRole).toString() != hash) {
+                continue;
+            }
+
+            if (!image.isNull()) {
+                item->setIcon(QIcon(QPixmap::fromImage(image)));
+            } else {
+                item->setToolTip(tr("This photo is missing from the database, or could not be read."));
+            }
+        }
+    }
+
+    return;
+}
+
+/**
+ * @brief HerpApp::open_attachment copies a photo out of the database, upon the database thread, and then opens it with
+ * whichever application the desktop uses for photos. The copies are kept within the temporary directory of the
+ * database, so they're cleaned up once it's closed, but aren't saved along with it.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param hash The SHA-256 hash of the photo, in hexadecimal.
+ * @see GkAttachmentStore::export_file()
+ */
+void HerpApp::open_attachment(const std::string &hash)
+{
+    if (!gkAttachmentStore) {
+        return;
+    }
+
+    auto attachment_store = gkAttachmentStore;
+    const fs::path export_dir = global_db_temp_dir / "opened_photos";
+    gkDbAsync->dispatch([attachment_store, export_dir, hash]() {
+        // The photos are kept without a file extension, so it's worked out from their contents instead
+        const QByteArray format = QImageReader(QString::fromStdString(attachment_store->blob_path(hash).string())).format();
+        fs::path dest_path = export_dir / hash;
+        dest_path += "." + (format.isEmpty() ? std::string("bin") : format.toStdString());
+
+        fs::create_directories(export_dir);
+        if (!fs::exists(dest_path)) {
+            attachment_store->export_file(hash, dest_path);
+        }
+
+        return dest_path.string();
+    }, [this](std::string dest_path) {
+        if (!QDesktopServices::openUrl(QUrl::fromLocalFile(QString::fromStdString(dest_path)))) {
+            QMessageBox::warning(this, tr("Error!"), tr("Unable to open the photo, \"%1\"!").arg(QString::fromStdString(dest_path)),
+                                 QMessageBox::Ok);
+        }
+    });
+
+    return;
+}
+
+/**
+ * @brief HerpApp::on_pushButton_attach_photos_clicked copies the chosen photos into the database, upon the database
+ * thread, and lists them against the log entry that's being written. Only their hashes go into the record itself.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @see GkAttachmentStore::add_file()
+ */
+void HerpApp::on_pushButton_attach_photos_clicked()
+{
+    if (!gkAttachmentStore) {
+        return;
+    }
+
+    const QStringList file_paths = QFileDialog::getOpenFileNames(this, tr("Attach Photos"), QDir::homePath(),
+                                                                 tr("Photos (*.jpg *.jpeg *.png *.bmp *.gif *.tif *.tiff);;All Files (*)"));
+    auto attachment_store = gkAttachmentStore;
+    for (const auto &file_path: file_paths) {
+        const std::string file_path_str = file_path.toStdString();
+        gkDbAsync->dispatch([attachment_store, file_path_str]() { return attachment_store->add_file(file_path_str); },
+                            [this, file_path_str](std::string hash) {
+            add_attachment_item(ui->listWidget_attachments, hash,
+                                QString::fromStdString(fs::path(file_path_str).filename().string()));
+        });
+    }
+
+    return;
+}
+
+void HerpApp::on_pushButton_remove_photo_clicked()
+{
+    for (QListWidgetItem *item: ui->listWidget_attachments->selectedItems()) {
+        delete item; // The photo itself gets swept away in time, should no record ever come to refer to it
+    }
+
+    return;
+}
+
+void HerpApp::on_listWidget_attachments_itemDoubleClicked(QListWidgetItem *item)
+{
+    open_attachment(item->data(Qt::UserRole).toString().toStdString());
+    return;
+}
+
+void HerpApp::on_listWidget_records_attachments_itemDoubleClicked(QListWidgetItem *item)
+{
+    open_attachment(item->data(Qt::UserRole).toString().toStdString());
+    return;
+}
+
 void HerpApp::comboboxes_clear(const bool &disable)
 {
     ui->comboBox_view_records_licensee->clear();
@@ -1318,15 +1858,85 @@ void HerpApp::insert_charts()
     std::lock_guard<std::mutex> locker(r_charts_mtx);
     chart_weight = new QChart();
     chart_weight->legend()->show();
-    // chart_weight->addSeries(line_series_weight);
-    chart_weight->createDefaultAxes();
     chart_weight->setTitle(tr("Weight vs. Time"));
-    chart_weight->setAnimationOptions(QChart::AllAnimations);
-
-    QPointer<QChartView> chart_view_weight = new QChartView(chart_weight);
+    // Animating the series itself would redo the tweening upon every zoom/pan, so only animate the grid and axes
+    chart_weight->setAnimationOptions(QChart::GridAxisAnimations);
+
+    line_series_weight = new QLineSeries(this);
+    line_series_weight->setName(tr("Weight"));
+    chart_weight->addSeries(line_series_weight);
+
+    axis_weight_time = new QDateTimeAxis(this);
+    axis_weight_time->setFormat(tr("dd/MM/yyyy"));
+    axis_weight_time->setTitleText(tr("Date"));
+    chart_weight->addAxis(axis_weight_time, Qt::AlignBottom);
+    line_series_weight->attachAxis(axis_weight_time);
+
+    axis_weight_value = new QValueAxis(this);
+    axis_weight_value->setLabelFormat("%.3f");
+    axis_weight_value->setTitleText(tr("Weight (g)"));
+    chart_weight->addAxis(axis_weight_value, Qt::AlignLeft);
+    line_series_weight->attachAxis(axis_weight_value);
+
+    // Only the visible window gets re-sampled upon any zooming or panning
+    QObject::connect(axis_weight_time, SIGNAL(rangeChanged(QDateTime, QDateTime)),
+                     this, SLOT(weight_chart_range_changed(QDateTime, QDateTime)));
+
+    chart_view_weight = new QChartView(chart_weight);
     chart_view_weight->setRenderHint(QPainter::Antialiasing);
+    chart_view_weight->setRubberBand(QChartView::HorizontalRubberBand);
 
     ui->vertLayout_chart_1->addWidget(chart_view_weight);
+
+    // The weekly averages of the selected species, as summed up by the GkAggregator
+    chart_summary = new QChart();
+    chart_summary->legend()->show();
+    chart_summary->setTitle(tr("Weekly Averages"));
+
+    axis_summary_time = new QDateTimeAxis(this);
+    axis_summary_time->setFormat(tr("dd/MM/yyyy"));
+    axis_summary_time->setTitleText(tr("Week"));
+    chart_summary->addAxis(axis_summary_time, Qt::AlignBottom);
+
+    axis_summary_weight = new QValueAxis(this);
+    axis_summary_weight->setLabelFormat("%.3f");
+    axis_summary_weight->setTitleText(tr("Mean Weight (g)"));
+    chart_summary->addAxis(axis_summary_weight, Qt::AlignLeft);
+
+    axis_summary_rate = new QValueAxis(this);
+    axis_summary_rate->setLabelFormat("%.0f%%");
+    axis_summary_rate->setTitleText(tr("Log Entries (%)"));
+    axis_summary_rate->setRange(0.0, 100.0);
+    chart_summary->addAxis(axis_summary_rate, Qt::AlignRight);
+
+    line_series_summary_p10 = new QLineSeries(this);
+    line_series_summary_p90 = new QLineSeries(this);
+    area_series_summary_band = new QAreaSeries(line_series_summary_p90, line_series_summary_p10);
+    area_series_summary_band->setName(tr("Weight (10th-90th Percentile)"));
+    area_series_summary_band->setOpacity(0.3);
+    chart_summary->addSeries(area_series_summary_band);
+    area_series_summary_band->attachAxis(axis_summary_time);
+    area_series_summary_band->attachAxis(axis_summary_weight);
+
+    line_series_summary_weight = new QLineSeries(this);
+    line_series_summary_weight->setName(tr("Mean Weight"));
+    line_series_summary_toilet = new QLineSeries(this);
+    line_series_summary_toilet->setName(tr("Went Toilet"));
+    line_series_summary_hydration = new QLineSeries(this);
+    line_series_summary_hydration->setName(tr("Had Hydration"));
+    line_series_summary_vitamins = new QLineSeries(this);
+    line_series_summary_vitamins->setName(tr("Had Vitamins"));
+    for (QLineSeries *series: { line_series_summary_weight.data(), line_series_summary_toilet.data(),
+                                line_series_summary_hydration.data(), line_series_summary_vitamins.data() }) {
+        chart_summary->addSeries(series);
+        series->attachAxis(axis_summary_time);
+        series->attachAxis((series == line_series_summary_weight) ? axis_summary_weight : axis_summary_rate);
+    }
+
+    chart_view_summary = new QChartView(chart_summary);
+    chart_view_summary->setRenderHint(QPainter::Antialiasing);
+
+    ui->vertLayout_chart_2->addWidget(chart_view_summary);
 }
 
 /**
@@ -1336,74 +1946,720 @@ void HerpApp::insert_charts()
  */
 void HerpApp::update_charts(const bool &update_caches)
 {
+    GkTraceSpan span("HerpApp::update_charts", "ui");
     try {
         std::lock_guard<std::mutex> locker(r_charts_mtx);
-        line_series_weight = new QLineSeries(this);
 
         if (update_caches) {
             refresh_caches();
         }
 
-        if (!unique_id_map.empty()) {
-            using namespace GkRecords;
-            auto dated_record_ids = gkDbRead->extract_records(minDateTime, maxDateTime);
-            long int date_time;
-
-            if ((!dated_record_ids.empty()) && (!species_cache.empty()) && (!animal_cache.empty())) { // Check that the values we're using aren't empty
-                for (const auto &dated_id: dated_record_ids) {
-                    date_time = std::stol(gkDbRead->read_item_db(dated_id, dateTime)); // Extract dateTime values from the database
-                    if (!weight_measurements.contains(date_time)) { // Check that the key does not already exist in the cache!
-                        for (const auto &mapped_id: unique_id_map) {
-                            GkSpecies species_struct;
-                            GkId ident_struct;
-                            double weight_in_loop;
-
-                            if (dated_id == mapped_id.first) {
-                                weight_in_loop = std::stod(gkDbRead->read_item_db(dated_id, weightMeasure));
-                                species_struct.species_id = mapped_id.second.species_id;
-                                ident_struct.name_id = mapped_id.second.name_id;
-
-                                for (auto it = species_cache.begin(); it != species_cache.end(); ++it) {
-                                    if (species_struct.species_id == it.key()) {
-                                        species_struct.species_name = it.value();
-                                    }
-                                }
+        if ((gkCategoryTree->record_count() > 0) && (!line_series_weight.isNull())) {
+            // Plot the animal that is currently selected within the `View Charts` tab
+            const std::string animal_id = find_comboBox_id(GkRecords::MiscRecordType::gkId,
+                                                           GkRecords::comboBoxType::ViewCharts,
+                                                           comboBox_view_graphs_animals_sel);
 
-                                for (auto it = animal_cache.begin(); it != animal_cache.end(); ++it) {
-                                    if (ident_struct.name_id == it.key()) {
-                                        ident_struct.identifier_str = it.value();
-                                    }
-                                }
+            // The index is read between the minimum and maximum Date/Time, so it needs to be read anew if those move
+            const bool rebuild = ((animal_id != chart_weight_animal) || (minDateTime != chart_weight_min) ||
+                                  (maxDateTime != chart_weight_max));
 
-                                GkGraph::WeightVsTime weight_struct;
-                                weight_struct.record_id = dated_id;
-                                weight_struct.species = species_struct;
-                                weight_struct.identifier = ident_struct;
-                                weight_struct.weight = weight_in_loop;
+            if (gkCategoryTree->record_count() >= 2) { // Therefore there are at least two plot points for the graph(s)
+                if (!charts_tab_enabled) {
+                    ui->interface_tabWidget->setTabEnabled(3, true);
+                    charts_tab_enabled = true;
+                }
+            }
 
-                                weight_measurements.insertMulti(date_time, weight_struct);
+            if (!rebuild) {
+                // Any records inserted/deleted since the last rebuild have already been applied incrementally
+                return;
+            }
 
-                                break;
-                            }
-                        }
-                    }
+            // A single seek into the (Animal, Date/Time) index, which carries the weights along with it, rather than
+            // reading every record within the database and keeping only those of the animal
+            chart_weight_animal = animal_id;
+            chart_weight_min = minDateTime;
+            chart_weight_max = maxDateTime;
+            clear_weight_chart();
+
+            auto db_read = gkDbRead;
+            const long int dateStart = minDateTime;
+            const long int dateEnd = maxDateTime;
+            gkDbAsync->dispatch([db_read, animal_id, dateStart, dateEnd]() {
+                return db_read->scan_animal_index(animal_id, dateStart, dateEnd, std::numeric_limits<std::size_t>::max());
+            }, [this, animal_id, dateStart, dateEnd](const std::vector<GkRecords::GkAnimalIndexEntry> &entries) {
+                std::lock_guard<std::mutex> locker(r_charts_mtx);
+                if ((animal_id != chart_weight_animal) || (dateStart != chart_weight_min) || (dateEnd != chart_weight_max)) {
+                    return; // Another animal or date range has been sent off for in the meantime
                 }
 
-                if (dated_record_ids.size() >= 2) { // Therefore there are at least two plot points for the graph(s)
-                    if (!charts_tab_enabled) {
-                        ui->interface_tabWidget->setTabEnabled(3, true);
-                        charts_tab_enabled = true;
-                    }
+                // Anything inserted while the index was being read is part of `entries` already
+                clear_weight_chart();
+                chart_weight_index.reserve(entries.size());
+                double weight_min = std::numeric_limits<double>::max();
+                double weight_max = std::numeric_limits<double>::lowest();
+                for (const auto &entry: entries) {
+                    const double x = static_cast<double>(entry.date_time) * 1000.0; // QDateTimeAxis works in ms
+                    chart_weight_time.push_back(x);
+                    chart_weight_values.push_back(entry.weight);
+                    chart_weight_ids.push_back(entry.record_id);
+                    chart_weight_index.emplace(entry.record_id, x);
+                    weight_min = std::min(weight_min, entry.weight);
+                    weight_max = std::max(weight_max, entry.weight);
                 }
-            }
-        }
-    } catch (const std::exception &e) {
+
+                if (!chart_weight_time.empty()) {
+                    const QSignalBlocker blocker(axis_weight_time); // The resampling is done just below
+                    axis_weight_time->setRange(QDateTime::fromMSecsSinceEpoch(static_cast<qint64>(chart_weight_time.front())),
+                                               QDateTime::fromMSecsSinceEpoch(static_cast<qint64>(chart_weight_time.back())));
+                    axis_weight_value->setRange(weight_min, weight_max);
+                    resample_weight_chart(chart_weight_time.front(), chart_weight_time.back());
+                } else {
+                    line_series_weight->clear();
+                }
+            });
+        }
+    } catch (const std::exception &e) {
+        QMessageBox::warning(this, tr("Error!"), e.what(), QMessageBox::Ok);
+    }
+
+    return;
+}
+
+/**
+ * @brief HerpApp::update_summary_chart sums up the log entries of the species that is selected within the `View Charts`
+ * tab by the week, upon the database thread, and then plots the mean weight and the rate of each husbandry flag.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @see GkAggregator::aggregate()
+ */
+void HerpApp::update_summary_chart()
+{
+    GkTraceSpan span("HerpApp::update_summary_chart", "ui");
+    if (line_series_summary_weight.isNull() || (gkCategoryTree->record_count() == 0)) {
+        return;
+    }
+
+    const std::string species_id = find_comboBox_id(GkRecords::MiscRecordType::gkSpecies,
+                                                    GkRecords::comboBoxType::ViewCharts, comboBox_view_graphs_species_sel);
+    if (species_id.empty()) {
+        return;
+    }
+
+    auto aggregator = gkAggregator;
+    auto db_read = gkDbRead;
+    const long int dateStart = minDateTime;
+    const long int dateEnd = maxDateTime;
+    gkDbAsync->dispatch([aggregator, db_read, species_id, dateStart, dateEnd]() {
+        return std::make_pair(aggregator->aggregate(dateStart, dateEnd, GkReport::GkBucketSize::Week,
+                                                    GkReport::GkGroupBy::Species, species_id),
+                              db_read->weight_bands(species_id, dateStart, dateEnd));
+    }, [this, species_id](const std::pair<GkReport::GkAggregateTable, std::vector<GkRecords::GkWeightBand>> &result) {
+        const GkReport::GkAggregateTable &table = result.first;
+        if (species_id != find_comboBox_id(GkRecords::MiscRecordType::gkSpecies, GkRecords::comboBoxType::ViewCharts,
+                                           comboBox_view_graphs_species_sel)) {
+            return; // Another species has been selected in the meantime, which will have been sent off for too
+        }
+
+        QVector<QPointF> weight_points, toilet_points, hydration_points, vitamins_points;
+        double weight_min = std::numeric_limits<double>::max();
+        double weight_max = std::numeric_limits<double>::lowest();
+        for (const auto &cell: table.cells) {
+            const double x = static_cast<double>(cell.bucket) * 1000.0; // QDateTimeAxis works in ms
+            const double count = static_cast<double>(cell.count);
+            weight_points.append(QPointF(x, cell.weight_sum / count));
+            toilet_points.append(QPointF(x, (cell.went_toilet * 100.0) / count));
+            hydration_points.append(QPointF(x, (cell.had_hydration * 100.0) / count));
+            vitamins_points.append(QPointF(x, (cell.had_vitamins * 100.0) / count));
+            weight_min = std::min(weight_min, cell.weight_sum / count);
+            weight_max = std::max(weight_max, cell.weight_sum / count);
+        }
+
+        // The spread of the species' weights, from the 10th through to the 90th percentile
+        QVector<QPointF> lower_points, upper_points;
+        for (const auto &band: result.second) {
+            const double x = static_cast<double>(band.band_start) * 1000.0;
+            lower_points.append(QPointF(x, band.p10));
+            upper_points.append(QPointF(x, band.p90));
+            weight_min = std::min(weight_min, band.p10);
+            weight_max = std::max(weight_max, band.p90);
+        }
+
+        line_series_summary_p10->replace(lower_points);
+        line_series_summary_p90->replace(upper_points);
+        line_series_summary_weight->replace(weight_points);
+        line_series_summary_toilet->replace(toilet_points);
+        line_series_summary_hydration->replace(hydration_points);
+        line_series_summary_vitamins->replace(vitamins_points);
+        if (!table.cells.empty()) {
+            axis_summary_time->setRange(QDateTime::fromMSecsSinceEpoch(static_cast<qint64>(table.cells.front().bucket) * 1000),
+                                        QDateTime::fromMSecsSinceEpoch(static_cast<qint64>(table.cells.back().bucket) * 1000));
+            axis_summary_weight->setRange(weight_min, weight_max);
+        }
+    });
+
+    return;
+}
+
+/**
+ * @brief HerpApp::resample_weight_chart downsamples the plot points that lay within the visible window of the Weight vs.
+ * Time chart to roughly the width of the chart in pixels, and then hands them over to the series in one go.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param min_msecs The left-most edge of the visible window, in milliseconds since the epoch.
+ * @param max_msecs The right-most edge of the visible window, in milliseconds since the epoch.
+ */
+void HerpApp::resample_weight_chart(const double &min_msecs, const double &max_msecs)
+{
+    GkTraceSpan span("HerpApp::resample_weight_chart", "ui");
+    compact_weight_chart();
+    if (line_series_weight.isNull() || chart_weight_time.empty()) {
+        return;
+    }
+
+    // Include one plot point either side of the window, so the line carries on past the edges of the chart
+    auto first = std::lower_bound(chart_weight_time.begin(), chart_weight_time.end(), min_msecs);
+    auto last = std::upper_bound(first, chart_weight_time.end(), max_msecs);
+    if (first != chart_weight_time.begin()) {
+        --first;
+    }
+
+    if (last != chart_weight_time.end()) {
+        ++last;
+    }
+
+    const auto offset = static_cast<std::size_t>(std::distance(chart_weight_time.begin(), first));
+    const auto count = static_cast<std::size_t>(std::distance(first, last));
+
+    int threshold = static_cast<int>(chart_weight->plotArea().width());
+    if (threshold <= 0) {
+        threshold = HERPLOG_CHART_FALLBACK_WIDTH;
+    }
+
+    std::vector<std::size_t> chosen;
+    GkDownsample::lttb(chart_weight_time.data() + offset, chart_weight_values.data() + offset, count,
+                       static_cast<std::size_t>(threshold), chosen);
+
+    QVector<QPointF> points;
+    points.reserve(static_cast<int>(chosen.size()));
+    for (const auto &idx: chosen) {
+        points.append(QPointF(chart_weight_time[offset + idx], chart_weight_values[offset + idx]));
+    }
+
+    line_series_weight->replace(points);
+    return;
+}
+
+/**
+ * @brief HerpApp::compact_weight_chart merges the plot points that were inserted out of order into the sorted ones, and
+ * drops those that were deleted, in a single pass. Doing so only when the chart is about to be resampled means that a
+ * whole run of inserts/deletes costs the one pass, rather than shuffling the plot points along with each of them.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ */
+void HerpApp::compact_weight_chart()
+{
+    if (chart_weight_late.empty() && chart_weight_removed.empty()) {
+        return;
+    }
+
+    std::vector<double> time;
+    std::vector<double> values;
+    std::vector<std::string> ids;
+    time.reserve(chart_weight_index.size());
+    values.reserve(chart_weight_index.size());
+    ids.reserve(chart_weight_index.size());
+
+    auto late = chart_weight_late.begin();
+    for (std::size_t i = 0; i < chart_weight_time.size(); ++i) {
+        for (; (late != chart_weight_late.end()) && (late->first.first < chart_weight_time[i]); ++late) {
+            time.push_back(late->first.first);
+            values.push_back(late->second);
+            ids.push_back(late->first.second);
+        }
+
+        if (chart_weight_removed.find(chart_weight_ids[i]) == chart_weight_removed.end()) {
+            time.push_back(chart_weight_time[i]);
+            values.push_back(chart_weight_values[i]);
+            ids.push_back(std::move(chart_weight_ids[i]));
+        }
+    }
+
+    for (; late != chart_weight_late.end(); ++late) {
+        time.push_back(late->first.first);
+        values.push_back(late->second);
+        ids.push_back(late->first.second);
+    }
+
+    chart_weight_time.swap(time);
+    chart_weight_values.swap(values);
+    chart_weight_ids.swap(ids);
+    chart_weight_late.clear();
+    chart_weight_removed.clear();
+
+    return;
+}
+
+/**
+ * @brief HerpApp::clear_weight_chart forgets every plot point of the Weight vs. Time chart, ahead of them being read
+ * anew from the index.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ */
+void HerpApp::clear_weight_chart()
+{
+    chart_weight_time.clear();
+    chart_weight_values.clear();
+    chart_weight_ids.clear();
+    chart_weight_index.clear();
+    chart_weight_late.clear();
+    chart_weight_removed.clear();
+    chart_weight_stale = false;
+
+    return;
+}
+
+/**
+ * @brief HerpApp::weight_chart_range_changed is called whenever the user zooms or pans the Weight vs. Time chart.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ */
+void HerpApp::weight_chart_range_changed(const QDateTime &min, const QDateTime &max)
+{
+    resample_weight_chart(static_cast<double>(min.toMSecsSinceEpoch()), static_cast<double>(max.toMSecsSinceEpoch()));
+    return;
+}
+
+/**
+ * @brief HerpApp::db_changes_committed applies the changes published upon the change feed to the category tree, caches
+ * and charts, or rescans the database should some of them have been missed.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param changes The changes that have just been committed to the database.
+ * @see GkChangeFeed::changes_committed()
+ */
+void HerpApp::db_changes_committed(const std::vector<GkRecords::GkChange> &changes)
+{
+    GkTraceSpan span("HerpApp::db_changes_committed", "ui");
+    using namespace GkRecords;
+
+    std::vector<GkChange> unseen;
+    if (!gkDbWrite->change_feed()->follow(feed_sequence, changes, unseen)) {
+        resync_changes();
+        return;
+    }
+
+    bool renamed = false;
+    for (const auto &change: unseen) {
+        switch (change.type) {
+            case GkChangeType::RecordInserted:
+                db_record_inserted(change.id, change.record);
+                break;
+            case GkChangeType::RecordDeleted:
+                db_record_deleted(change.id);
+                break;
+            case GkChangeType::RecordUpdated:
+                db_record_updated(change.id, change.name);
+                break;
+            case GkChangeType::CategoryRenamed:
+                renamed = true;
+                break;
+            case GkChangeType::CategoryRemoved:
+                pending_changes.categories_touched = true;
+                queue_changes();
+                break;
+            default:
+                break; // A new category only turns up within the tree once a record is filed under it
+        }
+    }
+
+    if (renamed) {
+        // The siblings of a category are kept sorted by name, so the tree is built over again rather than patched
+        resync_changes();
+    }
+
+    return;
+}
+
+/**
+ * @brief HerpApp::resync_changes builds the category tree anew upon the database thread, and then refreshes everything
+ * that is fed from it, for when the change feed can't account for what has changed.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ */
+void HerpApp::resync_changes()
+{
+    auto category_tree = gkCategoryTree;
+    gkDbAsync->dispatch([category_tree]() {
+        category_tree->build();
+        return true;
+    }, [this](bool) {
+        {
+            std::lock_guard<std::mutex> locker(r_cache_mtx);
+            fill_licensee_comboBoxes();
+        }
+
+        update_views_enabled();
+        refresh_date_range();
+
+        {
+            std::lock_guard<std::mutex> locker(r_charts_mtx);
+            chart_weight_animal.clear(); // Have the plotted animal read anew from the index
+        }
+
+        if (caches_enabled) {
+            update_charts();
+        }
+    });
+
+    return;
+}
+
+/**
+ * @brief HerpApp::db_record_inserted applies a newly inserted record to the caches and, if it belongs to the animal that
+ * is being plotted, appends it to the Weight vs. Time chart without having to rebuild it.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param record_id The Unique ID of the record that was inserted.
+ * @param submit The data of the record that was inserted.
+ */
+void HerpApp::db_record_inserted(const std::string &record_id, const GkRecords::GkSubmit &submit)
+{
+    GkTraceSpan span("HerpApp::db_record_inserted", "ui");
+
+    const auto revision = gkCategoryTree->revision();
+    if (gkCategoryTree->insert(record_id, submit)) {
+        pending_changes.records_added.push_back(record_id);
+        pending_changes.categories_touched |= (gkCategoryTree->revision() != revision);
+        pending_changes.date_range_moved |= ((gkCategoryTree->record_count() == 1) || (submit.date_time < minDateTime) ||
+                                             (submit.date_time > maxDateTime));
+        queue_changes();
+    }
+
+    ui->interface_tabWidget->setTabEnabled(2, true);
+
+    std::lock_guard<std::mutex> locker(r_charts_mtx);
+    if (line_series_weight.isNull() || chart_weight_animal.empty() || (submit.identifier.name_id != chart_weight_animal)) {
+        return;
+    }
+
+    const double x = static_cast<double>(submit.date_time) * 1000.0;
+    const double y = submit.weight;
+    const bool was_empty = chart_weight_index.empty();
+    if (!chart_weight_index.emplace(record_id, x).second) {
+        return; // Already plotted
+    }
+
+    const double view_min = static_cast<double>(axis_weight_time->min().toMSecsSinceEpoch());
+    const double view_max = static_cast<double>(axis_weight_time->max().toMSecsSinceEpoch());
+    const bool at_end = chart_weight_late.empty() && (chart_weight_time.empty() || (x >= chart_weight_time.back()));
+    if (!at_end) {
+        // Merged in along with any others the next time that the chart is resampled
+        chart_weight_late.emplace(std::make_pair(x, record_id), y);
+        if ((x >= view_min) && (x <= view_max)) {
+            chart_weight_stale = true;
+            queue_changes();
+        }
+
+        return;
+    }
+
+    const double prev_last = chart_weight_time.empty() ? x : chart_weight_time.back();
+    chart_weight_time.push_back(x);
+    chart_weight_values.push_back(y);
+    chart_weight_ids.push_back(record_id);
+
+    if (was_empty || (view_max >= prev_last)) {
+        // The user is following the most recent data, so the window grows to take in the new plot point
+        const QSignalBlocker blocker(axis_weight_time);
+        if (was_empty) {
+            axis_weight_time->setMin(QDateTime::fromMSecsSinceEpoch(static_cast<qint64>(x)));
+            axis_weight_value->setRange(y, y);
+        }
+
+        axis_weight_time->setMax(QDateTime::fromMSecsSinceEpoch(static_cast<qint64>(x)));
+        axis_weight_value->setRange(std::min(axis_weight_value->min(), y), std::max(axis_weight_value->max(), y));
+        line_series_weight->append(x, y);
+    }
+
+    return;
+}
+
+/**
+ * @brief HerpApp::db_record_deleted removes a deleted record from the caches and, if it was being plotted, from the
+ * Weight vs. Time chart.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param record_id The Unique ID of the record that was deleted.
+ */
+void HerpApp::db_record_deleted(const std::string &record_id)
+{
+    GkTraceSpan span("HerpApp::db_record_deleted", "ui");
+
+    const auto revision = gkCategoryTree->revision();
+    if (gkCategoryTree->remove(record_id)) {
+        pending_changes.records_removed.push_back(record_id);
+        pending_changes.categories_touched |= (gkCategoryTree->revision() != revision);
+        pending_changes.date_range_moved = true; // Only the timestamp index knows what lies either side of the record
+        queue_changes();
+    }
+
+    archive_records.remove(record_id);
+    viewed_records.remove(record_id);
+
+
+    std::lock_guard<std::mutex> locker(r_charts_mtx);
+    auto it = chart_weight_index.find(record_id);
+    if (line_series_weight.isNull() || (it == chart_weight_index.end())) {
+        return;
+    }
+
+    // Compacted away along with any others the next time that the chart is resampled
+    const double x = it->second;
+    chart_weight_index.erase(it);
+    if (chart_weight_late.erase(std::make_pair(x, record_id)) == 0) {
+        chart_weight_removed.insert(record_id);
+    }
+
+    const double view_min = static_cast<double>(axis_weight_time->min().toMSecsSinceEpoch());
+    const double view_max = static_cast<double>(axis_weight_time->max().toMSecsSinceEpoch());
+    if (chart_weight_index.empty()) {
+        clear_weight_chart();
+        line_series_weight->clear();
+    } else if ((x >= view_min) && (x <= view_max)) {
+        chart_weight_stale = true;
+        queue_changes();
+    }
+
+    return;
+}
+
+/**
+ * @brief HerpApp::db_record_updated has the Weight vs. Time chart read anew should a record that's being plotted have
+ * had its Date/Time or weight edited.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param record_id The Unique ID of the record that was edited.
+ * @param key The field of the record that was edited.
+ */
+void HerpApp::db_record_updated(const std::string &record_id, const std::string &key)
+{
+    if ((key != GkRecords::dateTime) && (key != GkRecords::weightMeasure)) {
+        return;
+    }
+
+    pending_changes.date_range_moved |= (key == GkRecords::dateTime);
+    {
+        std::lock_guard<std::mutex> locker(r_charts_mtx);
+        if (chart_weight_index.find(record_id) != chart_weight_index.end()) {
+            chart_weight_animal.clear(); // Have the plotted animal read anew from the index
+            pending_changes.records_updated.push_back(record_id);
+        }
+    }
+
+    queue_changes();
+    return;
+}
+
+/**
+ * @brief HerpApp::archive_table_row_changed presents whichever record has been selected within the table of the
+ * `viewRecords` tab.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param current The newly selected row.
+ * @param previous The previously selected row.
+ */
+void HerpApp::archive_table_row_changed(const QModelIndex &current, const QModelIndex &previous)
+{
+    Q_UNUSED(previous);
+    GkTraceSpan span("HerpApp::archive_table_row_changed", "ui");
+
+    try {
+        if (!current.isValid()) {
+            return;
+        }
+
+        archive_curr_sel_record = gkRecordModel->record_id(current.row());
+        archive_show_record(gkRecordModel->record_at(current.row()));
+    } catch (const std::exception &e) {
         QMessageBox::warning(this, tr("Error!"), e.what(), QMessageBox::Ok);
     }
 
     return;
 }
 
+/**
+ * @brief HerpApp::find_record_selected presents whichever log entry was picked out from the results of the `Find`
+ * dialog, within the `viewRecords` tab.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param record_id The Unique ID of the log entry.
+ */
+void HerpApp::find_record_selected(const std::string &record_id)
+{
+    GkTraceSpan span("HerpApp::find_record_selected", "ui");
+
+    auto db_read = gkDbRead;
+    archive_curr_sel_record = record_id;
+    gkDbAsync->dispatch([db_read, record_id]() { return db_read->read_log_entry(record_id); },
+                        [this](const GkRecords::GkSubmit &submit) {
+        if (submit.record_id != archive_curr_sel_record) {
+            return; // Another record has been selected in the meantime
+        }
+
+        ui->interface_tabWidget->setTabEnabled(2, true);
+        ui->interface_tabWidget->setCurrentIndex(2);
+        archive_show_record(submit);
+    });
+
+    return;
+}
+
+/**
+ * @brief HerpApp::queue_changes posts `apply_changes()` to the event loop, unless it has been already, so that every
+ * write which lands within the same turn of the event loop gets folded into the one refresh.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ */
+void HerpApp::queue_changes()
+{
+    if (!changes_queued) {
+        changes_queued = true;
+        QTimer::singleShot(0, this, &HerpApp::apply_changes);
+    }
+
+    return;
+}
+
+/**
+ * @brief HerpApp::apply_changes refreshes only those caches and widgets that are affected by the writes made since it
+ * was last run. The charts and table of the `viewRecords` tab have already been patched by this point.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @see HerpApp::db_changes_committed()
+ */
+void HerpApp::apply_changes()
+{
+    GkTraceSpan span("HerpApp::apply_changes", "ui");
+    GkRecords::GkChangeSet changes = std::move(pending_changes);
+    pending_changes = GkRecords::GkChangeSet();
+    changes_queued = false;
+
+    try {
+        {
+            // Every plot point inserted/deleted within the visible window since the last time is resampled in one go
+            std::lock_guard<std::mutex> locker(r_charts_mtx);
+            if (chart_weight_stale && !axis_weight_time.isNull()) {
+                chart_weight_stale = false;
+                resample_weight_chart(static_cast<double>(axis_weight_time->min().toMSecsSinceEpoch()),
+                                      static_cast<double>(axis_weight_time->max().toMSecsSinceEpoch()));
+            }
+        }
+
+        if (changes.categories_touched) {
+            std::lock_guard<std::mutex> locker(r_cache_mtx);
+            fill_licensee_comboBoxes();
+        }
+
+        if (changes.date_range_moved) {
+            refresh_date_range();
+        }
+
+        if ((!changes.records_added.empty()) || (!changes.records_removed.empty())) {
+            update_views_enabled();
+            if (caches_enabled) {
+                update_charts(); // Nothing gets redrawn, but the `viewCharts` tab may now have enough data to enable
+            }
+
+            repair_summaries();
+        } else if (!changes.records_updated.empty() && caches_enabled) {
+            update_charts();
+        }
+    } catch (const std::exception &e) {
+        QMessageBox::warning(this, tr("Error!"), e.what(), QMessageBox::Ok);
+    }
+
+    return;
+}
+
+/**
+ * @brief HerpApp::repair_summaries works out anew, upon the database thread, the rolling statistics of any animal that
+ * had a log entry deleted or added out of order, along with the weight sketches of any bucket that had a log entry
+ * deleted, and then refreshes the `Attention Needed` dashboard if it's open.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @see GkDbWrite::repair_animal_summaries(), GkDbWrite::repair_weight_sketches()
+ */
+void HerpApp::repair_summaries()
+{
+    auto db_write = gkDbWrite;
+    gkDbAsync->dispatch([db_write]() {
+        db_write->repair_weight_sketches();
+        return db_write->repair_animal_summaries();
+    }, [this](std::size_t repaired) {
+        Q_UNUSED(repaired);
+        if (!gkAttentionDialog.isNull()) {
+            gkAttentionDialog->refresh(); // Records may well have been added, even if nothing needed repairing
+        }
+    });
+
+    return;
+}
+
+/**
+ * @brief HerpApp::db_alerts_raised lets the user know, upon the status bar, of any alerts that were raised by a log
+ * entry as it was written, and refreshes the `Attention Needed` dashboard if it's open.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param alerts The alerts that were raised.
+ * @see GkDbWrite::alerts_raised()
+ */
+void HerpApp::db_alerts_raised(const std::vector<GkRecords::GkAlert> &alerts)
+{
+    ui->statusbar->showMessage(tr("%1 new alert(s) were raised; see Tools > Attention Needed.").arg(alerts.size()));
+    if (!gkAttentionDialog.isNull()) {
+        gkAttentionDialog->refresh();
+    }
+
+    return;
+}
+
+/**
+ * @brief HerpApp::acknowledge_alerts takes the given alerts off the queue, upon the database thread, and then refreshes
+ * the `Attention Needed` dashboard.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-19
+ * @param sequences The sequence numbers of the alerts to be acknowledged.
+ * @see GkDbWrite::acknowledge_alerts()
+ */
+void HerpApp::acknowledge_alerts(const std::vector<std::uint64_t> &sequences)
+{
+    auto db_write = gkDbWrite;
+    gkDbAsync->dispatch([db_write, sequences]() { db_write->acknowledge_alerts(sequences); return sequences.size(); },
+                        [this](std::size_t acknowledged) {
+        Q_UNUSED(acknowledged);
+        if (!gkAttentionDialog.isNull()) {
+            gkAttentionDialog->refresh();
+        }
+    });
+
+    return;
+}
+
+/**
+ * @brief HerpApp::db_error_raised shows any errors that were encountered upon the database thread to the user.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param error_msg The error message itself.
+ * @see GkDbAsync::db_error()
+ */
+void HerpApp::db_error_raised(const QString &error_msg)
+{
+    QMessageBox::warning(this, tr("Error!"), error_msg, QMessageBox::Ok);
+    return;
+}
+
 /**
  * @brief HerpApp::update_all is a convenience function that updates the most widely used caches.
  * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
@@ -1412,15 +2668,8 @@ void HerpApp::update_charts(const bool &update_caches)
  */
 void HerpApp::update_all(const bool &view_records, const std::string &del_uuid, const bool &update_comboBoxes)
 {
+    GkTraceSpan span("HerpApp::update_all", "ui");
     try {
-        if (view_records) {
-            // Charts related data
-            weight_measurements.clear();
-        }
-
-        // General caches
-        set_date_ranges();
-
         if (caches_enabled) {
             update_charts();
         }
@@ -1429,43 +2678,49 @@ void HerpApp::update_all(const bool &view_records, const std::string &del_uuid,
         if (view_records) {
             int dateTimeStart = ui->dateTimeEdit_browse_start->dateTime().toTime_t();
             int dateTimeEnd = ui->dateTimeEdit_browse_end->dateTime().toTime_t();
-            archive_records.clear();
-            archive_records = gkDbRead->extract_records(dateTimeStart, dateTimeEnd);
-            viewed_records.clear();
-
-            if (!archive_records.empty()) { // Update the tab `viewRecords`!
-                if (!del_uuid.empty()) {
-                    if (!ui->interface_tabWidget->isTabEnabled(2)) {
-                        ui->interface_tabWidget->setTabEnabled(2, true);
-                    }
+            const std::string animal_id = find_comboBox_id(GkRecords::MiscRecordType::gkId,
+                                                           GkRecords::comboBoxType::ViewRecords,
+                                                           comboBox_view_records_animals_sel);
+            auto db_read = gkDbRead;
+            gkDbAsync->dispatch([db_read, animal_id, dateTimeStart, dateTimeEnd]() {
+                return db_read->extract_animal_records(animal_id, dateTimeStart, dateTimeEnd);
+            }, [this, del_uuid, update_comboBoxes](const std::list<std::string> &records) {
+                archive_records = records;
+                viewed_records.clear();
+
+                if (!archive_records.empty()) { // Update the tab `viewRecords`!
+                    if (!del_uuid.empty()) {
+                        if (!ui->interface_tabWidget->isTabEnabled(2)) {
+                            ui->interface_tabWidget->setTabEnabled(2, true);
+                        }
 
-                    // Delete the now gone `Log Entry` from the variable, `viewed_records`S
-                    if (viewed_records.size() > 1) {
-                        std::list<std::string> tmp_viewed_records;
-                        for (const auto &id: viewed_records) {
-                            if (id != del_uuid) {
-                                tmp_viewed_records.push_back(id);
+                        // Delete the now gone `Log Entry` from the variable, `viewed_records`S
+                        if (viewed_records.size() > 1) {
+                            std::list<std::string> tmp_viewed_records;
+                            for (const auto &id: viewed_records) {
+                                if (id != del_uuid) {
+                                    tmp_viewed_records.push_back(id);
+                                }
                             }
-                        }
 
-                        viewed_records = tmp_viewed_records;
+                            viewed_records = tmp_viewed_records;
+                        } else {
+                            viewed_records.clear();
+                        }
                     } else {
-                        viewed_records.clear();
+                        QMessageBox::warning(this, tr("Error!"), tr("One of the given UUIDs are empty!"), QMessageBox::Ok);
+                        return;
                     }
-                } else {
-                    throw std::invalid_argument(tr("One of the given UUIDs are empty!").toStdString());
-                }
 
-                std::string next_record = browse_records(archive_records, true);
-                archive_curr_sel_record = next_record;
-                archive_fill_form_data(next_record);
+                    std::string next_record = browse_records(archive_records, true);
+                    archive_curr_sel_record = next_record;
+                    archive_fill_form_data(next_record);
 
-                if (update_comboBoxes) { // Update the contents of the QComboBoxes containing the categories!
+                    if (update_comboBoxes) { // Update the contents of the QComboBoxes containing the categories!
 
+                    }
                 }
-
-                return;
-            }
+            });
         }
     } catch (const std::exception &e) {
         QMessageBox::warning(this, tr("Error!"), e.what(), QMessageBox::Ok);
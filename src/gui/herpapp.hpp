@@ -46,20 +46,35 @@
 #include "./../options.hpp"
 #include "./../gk_db_write.hpp"
 #include "./../gk_db_read.hpp"
+#include "./../gk_db_async.hpp"
 #include "./../gk_string_op.hpp"
 #include "./../gk_file_io.hpp"
+#include "./../gk_category_tree.hpp"
+#include "./../gk_watchdog.hpp"
+#include "./../gk_text_index.hpp"
+#include "./../gk_aggregator.hpp"
+#include "./../gk_attachment_store.hpp"
+#include "gk_record_model.hpp"
+#include "gk_thumbnail_cache.hpp"
 #include <boost/filesystem.hpp>
 #include <QObject>
 #include <QMainWindow>
 #include <QPointer>
 #include <QtCharts>
+#include <QComboBox>
+#include <QImage>
+#include <QListWidget>
 #include <QMultiMap>
 #include <memory>
 #include <mutex>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
+#include <map>
 #include <utility>
 #include <list>
+#include <vector>
+#include <array>
 
 using namespace GekkoFyre;
 namespace fs = boost::filesystem;
@@ -67,6 +82,9 @@ namespace Ui {
 class HerpApp;
 }
 
+class GkFindDialog;
+class GkAttentionDialog;
+
 class HerpApp : public QMainWindow
 {
     Q_OBJECT
@@ -84,10 +102,17 @@ private slots:
     void on_action_Print_triggered();
     void on_actionE_xit_triggered();
     void on_actionF_ind_triggered();
+    void on_actionAttention_Needed_triggered();
     void on_action_Settings_triggered();
     void on_action_Documentation_triggered();
     void on_action_About_triggered();
     void on_actionIm_port_CSV_triggered();
+    void on_actionExport_Report_triggered();
+    void on_actionRecord_Trace_toggled(bool checked);
+    void on_actionSave_Trace_triggered();
+    void on_actionWatch_Stalls_toggled(bool checked);
+    void on_actionSave_Stall_Report_triggered();
+    void on_action_Diagnostics_triggered();
     void on_pushButton_archive_next_clicked();
     void on_pushButton_archive_prev_clicked();
     void on_pushButton_archive_delete_clicked();
@@ -96,6 +121,8 @@ private slots:
     void on_toolButton_new_hash_clicked();
     void on_toolButton_add_record_update_datetime_clicked();
     void on_toolButton_view_records_cal_popup_clicked();
+    void on_pushButton_view_charts_prev_page_clicked();
+    void on_pushButton_view_charts_next_page_clicked();
     void on_comboBox_view_charts_select_licensee_currentIndexChanged(int index);
     void on_comboBox_view_charts_select_species_currentIndexChanged(int index);
     void on_comboBox_view_charts_select_id_currentIndexChanged(int index);
@@ -108,41 +135,89 @@ private slots:
     void on_toolButton_view_records_licensee_clicked();
     void on_toolButton_view_records_species_clicked();
     void on_toolButton_view_records_animal_clicked();
+    void on_pushButton_attach_photos_clicked();
+    void on_pushButton_remove_photo_clicked();
+    void on_listWidget_attachments_itemDoubleClicked(QListWidgetItem *item);
+    void on_listWidget_records_attachments_itemDoubleClicked(QListWidgetItem *item);
+    void thumbnail_ready(const QString &hash, const QImage &image);
+    void weight_chart_range_changed(const QDateTime &min, const QDateTime &max);
+    void db_changes_committed(const std::vector<GkRecords::GkChange> &changes);
+    void db_alerts_raised(const std::vector<GkRecords::GkAlert> &alerts);
+    void acknowledge_alerts(const std::vector<std::uint64_t> &sequences);
+    void db_error_raised(const QString &error_msg);
+    void archive_table_row_changed(const QModelIndex &current, const QModelIndex &previous);
+    void find_record_selected(const std::string &record_id);
+    void apply_changes();
 
 private:
     Ui::HerpApp *ui;
 
     bool remove_files(const fs::path &tmpDirLoc);
+    void save_database(const std::string &dest_path);
     void refresh_caches();
+    void fill_licensee_comboBoxes();
+    void refresh_date_range();
+    void update_views_enabled();
     void set_date_ranges();
+    void queue_changes();
+    void resync_changes();
+    void db_record_inserted(const std::string &record_id, const GkRecords::GkSubmit &submit);
+    void db_record_deleted(const std::string &record_id);
+    void db_record_updated(const std::string &record_id, const std::string &key);
 
     std::string find_comboBox_id(const GkRecords::MiscRecordType &record_type,
                                  const GkRecords::comboBoxType &comboBox_type, const int &index_no);
-    std::list<GkRecords::GkSpecies> find_species_names(const GkRecords::comboBoxType &dropbox_type,
-                                                       const std::string &licensee_id);
-    std::list<GkRecords::GkId> find_animal_names(const GkRecords::comboBoxType &dropbox_type,
-                                                 const std::string &species_id);
-    void record_species_index(const std::list<GkRecords::GkSpecies> &species_list,
-                              const GkRecords::comboBoxType &comboBox_type);
-    void record_animals_index(const std::list<GkRecords::GkId> &animals_list,
-                              const GkRecords::comboBoxType &comboBox_type);
+    std::uint32_t find_comboBox_node(const GkRecords::MiscRecordType &record_type,
+                                     const GkRecords::comboBoxType &comboBox_type, const int &index_no);
+    std::vector<std::uint32_t> &comboBox_rows(const GkRecords::MiscRecordType &record_type,
+                                              const GkRecords::comboBoxType &comboBox_type);
+    QComboBox *category_comboBox(const GkRecords::MiscRecordType &record_type,
+                                 const GkRecords::comboBoxType &comboBox_type);
+    void fill_category_comboBox(const GkRecords::MiscRecordType &record_type,
+                                const GkRecords::comboBoxType &comboBox_type, const std::vector<std::uint32_t> &nodes);
+    void select_licensee(const GkRecords::comboBoxType &comboBox_type, const int &index);
+    void select_species(const GkRecords::comboBoxType &comboBox_type, const int &index);
+    void cascade_comboBox(const GkRecords::MiscRecordType &record_type, const GkRecords::comboBoxType &comboBox_type,
+                          const int &index);
+    void jump_to_category(const GkRecords::MiscRecordType &record_type, const GkRecords::comboBoxType &comboBox_type,
+                          const std::uint32_t &node_idx);
 
     bool submit_log_entry();
+    void delete_category(const GkRecords::MiscRecordType &record_type, const std::string &record_id);
+    bool del_cat_msg_box(const GkRecords::GkCategories &cat_struct, const GkRecords::MiscRecordType &record_type);
     std::string browse_records(const std::list<std::string> &records, const bool &forward);
     void archive_clear_forms();
     void archive_fill_form_data(const std::string &record_id);
+    void archive_show_record(const GkRecords::GkSubmit &submit_data);
+    void add_attachment_item(QListWidget *list_widget, const std::string &hash, const QString &label);
+    void open_attachment(const std::string &hash);
     void comboboxes_clear(const bool &disable = false);
 
     void insert_charts();
     void update_charts(const bool &update_caches = false);
+    void resample_weight_chart(const double &min_msecs, const double &max_msecs);
+    void compact_weight_chart();
+    void clear_weight_chart();
+    void update_summary_chart();
+    void repair_summaries();
     inline void update_all(const bool &view_records = false, const std::string &del_uuid = "",
                            const bool &update_comboBoxes = false);
 
     GkFile::FileDb db_ptr;
-    std::unique_ptr<GkDbWrite> gkDbWrite;
+    std::shared_ptr<GkDbWrite> gkDbWrite;
     std::shared_ptr<GkDbRead> gkDbRead;
     std::shared_ptr<GkStringOp> gkStrOp;
     std::shared_ptr<GkFileIo> gkFileIo;
+    std::shared_ptr<GkCategoryTree> gkCategoryTree;
+    std::unique_ptr<GkDbAsync> gkDbAsync;
+    std::shared_ptr<GkTextIndex> gkTextIndex;
+    std::shared_ptr<GkAggregator> gkAggregator;
+    std::shared_ptr<GkAttachmentStore> gkAttachmentStore; // Only for a database that's been opened from a file
+    std::unique_ptr<GkThumbnailCache> gkThumbnailCache;
+    QPointer<GkRecordModel> gkRecordModel;
+    QPointer<GkWatchdog> gkWatchdog;
+    QPointer<GkFindDialog> gkFindDialog;
+    QPointer<GkAttentionDialog> gkAttentionDialog;
 
     fs::path global_db_temp_dir;
     std::string global_db_file_path;
@@ -153,11 +228,11 @@ private:
     long int minDateTime;
     long int maxDateTime;
 
-    std::unordered_map<std::string, GkRecords::MiscUniqueIds> unique_id_map; // A unordered map of all the Unique IDs
+    GkRecords::GkChangeSet pending_changes; // Every write since the caches and widgets were last brought up to date
+    bool changes_queued;                    // Whether `apply_changes()` has been posted to the event loop already
+    std::uint64_t feed_sequence;            // The last change from the feed that has been applied
+
     std::list<std::string> archive_records; // A cache of records that have been determined to be within the specified minimum/maximum date/time range.
-    QMultiMap<std::string, std::pair<std::string, int>> licensee_cache; // <Key: Licensee ID, Value: <Licensee Name, Index No.>>
-    QMultiMap<std::string, std::string> species_cache; // <Key: Licensee ID, Value: Species ID>
-    QMultiMap<std::string, std::string> animal_cache; // <Key: Species ID, Value: Animal ID>
     // Records are added to `viewed_records` as the `Next Record` button is pressed, and removed as
     // the `Previous Record` button is pressed.
     std::list<std::string> viewed_records; // The `Log Entries` that have been already viewed under the `viewRecords` tab
@@ -171,12 +246,35 @@ private:
     int comboBox_add_records_animals_sel;
     int comboBox_view_records_animals_sel;
     int comboBox_view_graphs_animals_sel;
-    QMultiMap<GkRecords::comboBoxType, GkRecords::GkSpecies> comboBox_species;
-    QMultiMap<GkRecords::comboBoxType, GkRecords::GkId> comboBox_animals;
+    std::array<GkRecords::GkComboIndex, 3> comboBox_index; // <Index: GkRecords::comboBoxType, Value: QComboBox row -> Tree node>
 
-    QMultiMap<long int, GkRecords::GkGraph::WeightVsTime> weight_measurements; // The key is QDateTime
+    std::vector<double> chart_weight_time;   // Every plot point of the selected animal, in milliseconds since the epoch
+    std::vector<double> chart_weight_values; // Every plot point of the selected animal, in grams
+    std::vector<std::string> chart_weight_ids; // The Record ID behind each plot point of the selected animal
+    std::unordered_map<std::string, double> chart_weight_index;           // <Key: Record ID, Value: Plot point's time>
+    std::map<std::pair<double, std::string>, double> chart_weight_late;   // Points inserted out of order, yet to be merged
+    std::unordered_set<std::string> chart_weight_removed;                 // Points deleted, yet to be compacted away
+    bool chart_weight_stale;                   // Whether the visible window needs resampling once the changes are applied
+    std::string chart_weight_animal;           // The Animal ID that is currently being plotted
+    long int chart_weight_min;                 // The minimum Date/Time that the plotted animal was read from
+    long int chart_weight_max;                 // The maximum Date/Time that the plotted animal was read up to
+    QPointer<QChartView> chart_view_weight;
     QPointer<QLineSeries> line_series_weight;
+    QPointer<QDateTimeAxis> axis_weight_time;
+    QPointer<QValueAxis> axis_weight_value;
     QPointer<QChart> chart_weight;
+    QPointer<QChartView> chart_view_summary;    // The weekly averages of the selected species
+    QPointer<QLineSeries> line_series_summary_weight;
+    QPointer<QLineSeries> line_series_summary_toilet;
+    QPointer<QLineSeries> line_series_summary_hydration;
+    QPointer<QLineSeries> line_series_summary_vitamins;
+    QPointer<QLineSeries> line_series_summary_p10;
+    QPointer<QLineSeries> line_series_summary_p90;
+    QPointer<QAreaSeries> area_series_summary_band; // Shades in the middle 80% of the species' weights, as per their sketches
+    QPointer<QDateTimeAxis> axis_summary_time;
+    QPointer<QValueAxis> axis_summary_weight;
+    QPointer<QValueAxis> axis_summary_rate;
+    QPointer<QChart> chart_summary;
     bool charts_tab_enabled;
     bool caches_enabled;
 };
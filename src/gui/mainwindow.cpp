@@ -43,6 +43,8 @@
 #include "mainwindow.hpp"
 #include "ui_mainwindow.h"
 #include "herpapp.hpp"
+#include "./../gk_db_server.hpp"
+#include "./../gk_remote_db.hpp"
 #include <boost/exception/all.hpp>
 #include <QString>
 #include <QFileDialog>
@@ -108,6 +110,24 @@ void MainWindow::on_button_open_db_clicked()
             QString fileName = QFileDialog::getOpenFileName(this, tr("Open Database"), QString::fromStdString(home_dir.string()), tr("HerpLog Database Files (*.hdb);;Any files (*.*)"));
             std::string fileName_str = fileName.toStdString();
 
+            if (!fileName.isEmpty()) {
+                // If the HerpLog service is already sharing this database, then connect to it as one of its clients
+                std::shared_ptr<leveldb::DB> remote_db = GkRemoteDb::connect(GkDbServer::socket_path_for(fileName_str));
+                if (remote_db != nullptr) {
+                    db_ptr = GkFile::FileDb();
+                    db_ptr.db = remote_db;
+
+                    this->close();
+                    QPointer<HerpApp> herpAppWin = new HerpApp(db_ptr, "", fileName_str, gkFileIo, nullptr);
+                    herpAppWin->setWindowFlags(Qt::Window);
+                    herpAppWin->setAttribute(Qt::WA_DeleteOnClose, true); // Delete itself on closing
+                    QObject::connect(herpAppWin, SIGNAL(destroyed(QObject*)), this, SLOT(show()));
+                    herpAppWin->show();
+
+                    return;
+                }
+            }
+
             if (!fileName.isEmpty() && fs::exists(fileName_str, ec)) {
                 std::string tmp_extraction_loc = gkFileIo->decompress_file(fileName_str);
                 if (!tmp_extraction_loc.empty() && fs::is_directory(tmp_extraction_loc, ec)) {
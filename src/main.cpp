@@ -42,8 +42,20 @@
 
 #include "gui/mainwindow.hpp"
 #include "options.hpp"
+#include "gk_trace.hpp"
+#include "gk_db_conn.hpp"
+#include "gk_db_diagnostics.hpp"
+#include "gk_db_server.hpp"
+#include "gk_file_io.hpp"
+#include "gk_remote_db.hpp"
 #include <QApplication>
+#include <QCoreApplication>
+#include <boost/filesystem.hpp>
+#include <cstring>
+#include <exception>
+#include <iostream>
 #include <memory>
+#include <string>
 
 #ifdef Q_OS_LINUX
 extern "C" {
@@ -52,8 +64,54 @@ extern "C" {
 
 #endif
 
+/**
+ * @brief print_diagnostics dumps the same report as `Help -> Diagnostics...` to `stdout`, without ever needing a display,
+ * so that it can be asked of somebody over e-mail or gathered up from a headless machine.
+ * @author Phobos Aryn'dythyrn D'thorga <phobos.gekko@gmail.com>
+ * @date 2026-10-18
+ * @param hdb_file The HerpLog Database File to be diagnosed.
+ * @return The exit code for the process.
+ */
+static int print_diagnostics(const std::string &hdb_file)
+{
+    using namespace GekkoFyre;
+    fs::path temp_dir;
+    int ret = 1;
+    try {
+        GkFile::FileDb db_conn;
+        db_conn.db = GkRemoteDb::connect(GkDbServer::socket_path_for(hdb_file));
+        if (db_conn.db == nullptr) {
+            // Not being served, so extract a copy of our own to look at, like the GUI does upon opening a database
+            GkFileIo file_io(nullptr);
+            GkDbConn db_open(nullptr);
+            temp_dir = file_io.decompress_file(hdb_file);
+            db_conn = db_open.open_database(temp_dir.string());
+        }
+
+        GkDbDiagnostics diagnostics(db_conn);
+        std::cout << diagnostics.to_text(diagnostics.collect(temp_dir, hdb_file)).toStdString() << std::endl;
+        ret = 0;
+    } catch (const std::exception &e) {
+        std::cerr << QCoreApplication::translate("main", "Error: %1").arg(e.what()).toStdString() << std::endl;
+    }
+
+    if (!temp_dir.empty()) {
+        boost::system::error_code ec;
+        fs::remove_all(temp_dir, ec);
+    }
+
+    return ret;
+}
+
 int main(int argc, char *argv[])
 {
+    for (int i = 1; i + 1 < argc; ++i) {
+        if (std::strcmp(argv[i], "--diagnostics") == 0) {
+            QCoreApplication a(argc, argv);
+            return print_diagnostics(argv[i + 1]);
+        }
+    }
+
     // https://github.com/notepadqq/notepadqq/issues/323
     #ifdef __linux__
     Display *d = XOpenDisplay(nullptr);
@@ -70,6 +128,11 @@ int main(int argc, char *argv[])
     #endif
 
     QApplication a(argc, argv);
+
+    // Tracing can be switched on from the `Help` menu, or from the very start with HERPLOG_TRACE=1
+    GekkoFyre::GkTrace::set_thread_name("GUI");
+    GekkoFyre::GkTrace::set_enabled(qEnvironmentVariableIsSet("HERPLOG_TRACE"));
+
     MainWindow w;
     w.show();
 
@@ -52,11 +52,55 @@
 #include <memory>
 #include <string>
 #include <chrono>
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
 
 namespace fs = boost::filesystem;
 namespace GekkoFyre {
+    class GkCountingCache;
+
     constexpr double HERPLOG_DEFAULT_RESOLUTION_WIDTH = 1920.0;
+    constexpr int HERPLOG_CHART_FALLBACK_WIDTH = 1024; // The amount of plot points to aim for, if a chart has not been laid out yet
     constexpr unsigned long LEVELDB_CFG_CACHE_SIZE = 32UL * 1024UL * 1024UL;
+    constexpr int HERPLOG_RECORD_MODEL_PAGE_SIZE = 256;   // How many rows the record table fetches from the database at a time
+    constexpr int HERPLOG_RECORD_MODEL_ROW_CACHE = 1024;  // How many decoded rows the record table keeps around at most
+    constexpr int HERPLOG_RECORD_MODEL_MAX_ROWS = 65536;  // How many rows the record table fetches at most, from either end
+    constexpr std::size_t HERPLOG_CHANGE_FEED_BACKLOG = 4096; // How many changes a subscriber can fall behind by and still catch up
+    constexpr std::uint32_t HERPLOG_SERVICE_PROTOCOL_VERSION = 2;
+    constexpr std::uint32_t HERPLOG_SERVICE_MAX_FRAME = 64U * 1024U * 1024U; // The largest request/response that will be accepted
+    constexpr std::size_t HERPLOG_SERVICE_SCAN_PAGE_MIN = 16;      // How many entries a remote iterator first asks for
+    constexpr std::size_t HERPLOG_SERVICE_SCAN_PAGE_MAX = 1024;    // ...doubling with every page, up to this many
+    constexpr std::size_t HERPLOG_SERVICE_GROUP_COMMIT_MAX = 64;   // How many client writes get merged into one synced write
+    constexpr int HERPLOG_SERVICE_FEED_WAIT_MS = 1000;             // How long a client waits upon the service for changes at most
+    constexpr std::size_t HERPLOG_TRACE_BUFFER_EVENTS = 8192; // How many of the latest trace events each thread holds onto
+    constexpr int HERPLOG_WATCHDOG_HEARTBEAT_MS = 20;        // How often the GUI thread is asked to check in
+    constexpr int HERPLOG_WATCHDOG_POLL_MS = 5;              // How often the watchdog looks at whether it has
+    constexpr int HERPLOG_WATCHDOG_THRESHOLD_MS = 150;       // How late a heartbeat can be before it counts as a stall
+    constexpr int HERPLOG_WATCHDOG_MARKER_DEPTH = 32;        // How deeply nested the stall markers of the GUI thread are tracked
+    constexpr std::size_t HERPLOG_TEXT_TERM_MAX_BYTES = 64;  // Anything longer is unlikely to be a word, so isn't indexed
+    constexpr std::size_t HERPLOG_TEXT_SEEK_LIMIT = 4096;    // Below this many candidates, a term is checked by seeking instead of scanning
+    constexpr int HERPLOG_FIND_RESULTS_SHOWN = 500;          // How many of the matches are read back and shown by the `Find` dialog
+    constexpr double HERPLOG_TRIGRAM_MIN_COVERAGE = 0.4;     // The share of a query's trigrams a name must have to count as a match
+    constexpr std::size_t HERPLOG_COMPLETER_MATCHES = 12;    // How many of the best matching names the completers pop up with
+    constexpr std::uint32_t HERPLOG_BITMAP_ARRAY_MAX = 4096; // Beyond this many values, a bitmap container becomes a bitset
+    constexpr std::size_t HERPLOG_FLAG_INDEX_TAIL_MAX = 1024; // Out-of-order records tolerated before the ordinals are redone
+    constexpr std::size_t HERPLOG_AGGREGATE_TASKS_PER_THREAD = 4; // So that a busy partition doesn't hold up the others
+    constexpr std::uint32_t HERPLOG_QUANTILE_SKETCH_K = 200;  // The size of the smallest compactor of a weight sketch, i.e. its accuracy
+    constexpr long int HERPLOG_SUMMARY_WINDOW_SECONDS = 30L * 24L * 60L * 60L; // How far back the weight trend of an animal looks
+    constexpr double HERPLOG_SUMMARY_EWMA_ALPHA = 0.3;       // How much each new weight counts towards an animal's moving average
+    constexpr long int HERPLOG_ATTENTION_LAPSE_SECONDS = 7L * 24L * 60L * 60L; // Going this long without a husbandry flag needs attention
+    constexpr double HERPLOG_ATTENTION_WEIGHT_LOSS = 0.05;   // Losing this share of the average weight over the window needs attention
+    constexpr double HERPLOG_ANOMALY_BASELINE_ALPHA = 0.1;   // How much each weight change counts towards an animal's baseline
+    constexpr std::uint64_t HERPLOG_ANOMALY_MIN_DELTAS = 5;  // How many weight changes make for a baseline worth scoring against
+    constexpr double HERPLOG_ANOMALY_Z_THRESHOLD = 3.0;      // How many standard deviations from the baseline raise an alert
+    constexpr double HERPLOG_ANOMALY_MIN_SD_FRACTION = 0.01; // The least spread assumed, as a share of the average weight
+    constexpr std::uint32_t HERPLOG_SERIES_CHUNK_POINTS = 256; // How many readings make up a single compressed chunk of a time-series
+    constexpr std::size_t HERPLOG_SERIES_IMPORT_BATCH = 1U << 20; // How many readings an import holds onto before writing them out
+    constexpr std::size_t HERPLOG_ATTACHMENT_CHUNK_BYTES = 1U << 20; // How much of an attachment is read or written at a time
+    constexpr int HERPLOG_THUMBNAIL_SIZE = 160;              // The longest side of a thumbnail of a photo, in pixels
+    constexpr int HERPLOG_THUMBNAIL_CACHE = 64;              // How many thumbnails are held onto in memory at most
+    constexpr long int HERPLOG_MERGE_BUCKET_SECONDS = 7L * 24L * 60L * 60L; // How much time each digest of records covers
 
     namespace GkFile {
         struct path_leaf_string {
@@ -66,6 +110,7 @@ namespace GekkoFyre {
         };
 
         struct FileDb {
+            std::shared_ptr<GkCountingCache> block_cache; // Counts the hits and misses of `options.block_cache`, if any
             std::shared_ptr<leveldb::DB> db;
             leveldb::Options options;
         };
@@ -74,6 +119,9 @@ namespace GekkoFyre {
             constexpr char zip_contents_csv[] = "zip_contents.csv";
         }
 
+        constexpr char attachment_dir[] = "attachments";       // Where the photos live, alongside the database itself
+        constexpr char attachment_incoming[] = ".incoming-";   // A photo that is still being copied in, before it is named
+
         enum HashTypes {
             CRC32
         };
@@ -91,12 +139,42 @@ namespace GekkoFyre {
         constexpr char boolHadHydration[] = "bool_had_hydration";
         constexpr char boolHadVitamins[] = "bool_had_vitamins";
         constexpr char weightMeasure[] = "weight_measurement";
+        constexpr char attachmentRefs[] = "attachments";
+
+        // Every Unique ID is kept under a key of its own, so that one can be looked up, added or deleted on its own
+        constexpr char LEVELDB_STORE_RECORD_PREFIX[] = "store_rid_";   // <Prefix><Record ID> -> Licensee ID,Species ID,Name ID
+        constexpr char LEVELDB_STORE_LICENSEE_PREFIX[] = "store_lid_"; // <Prefix><Licensee ID> -> Name of the licensee
+        constexpr char LEVELDB_STORE_SPECIES_PREFIX[] = "store_sid_";  // <Prefix><Species ID> -> Name of the species
+        constexpr char LEVELDB_STORE_NAME_PREFIX[] = "store_nid_";     // <Prefix><Name ID> -> Name/ID# of the animal
 
+        // Older versions of HerpLog kept each list of Unique IDs as one comma-separated value, which is split up into
+        // the keys above the first time that such a database is opened
         constexpr char LEVELDB_STORE_RECORD_ID[] = "store_unique_id";
         constexpr char LEVELDB_STORE_LICENSEE_ID[] = "store_licensee_id";
         constexpr char LEVELDB_STORE_SPECIES_ID[] = "store_species_id";
         constexpr char LEVELDB_STORE_NAME_ID[] = "store_name_id";
 
+        // Secondary indexes live under lowercase prefixes, so they can never collide with the (uppercase) Record UUIDs
+        constexpr char LEVELDB_INDEX_VERSION[] = "idx_version";
+        constexpr char LEVELDB_INDEX_TIMESTAMP[] = "idx_ts_";   // <Prefix><Big-endian Date/Time><Record ID>
+        constexpr char LEVELDB_INDEX_RECORD_HASH[] = "idx_rh_"; // <Prefix><Big-endian Bucket><Record ID> -> Leaf hash
+        constexpr char LEVELDB_INDEX_BUCKET_DIGEST[] = "idx_bd_"; // <Prefix><Big-endian Bucket> -> Digest, Count
+        constexpr char LEVELDB_INDEX_TEXT[] = "idx_ft_";        // <Prefix><Term><NUL><Record ID> -> Positions of the term
+        constexpr char LEVELDB_INDEX_ANIMAL[] = "idx_at_";      // <Prefix><Animal ID><NUL><Big-endian Date/Time><Record ID> -> Weight
+        constexpr char LEVELDB_INDEX_WEIGHT_SKETCH[] = "idx_wq_"; // <Prefix><Species ID><NUL><Big-endian Bucket> -> Quantile sketch
+        constexpr char LEVELDB_INDEX_WEIGHT_STALE[] = "idx_wx_"; // <Prefix><Species ID><NUL><Big-endian Bucket>, if it needs making anew
+        constexpr char LEVELDB_INDEX_ANIMAL_SUMMARY[] = "idx_as_"; // <Prefix><Animal ID> -> Rolling statistics of the animal
+        constexpr char LEVELDB_INDEX_ATTACHMENT_REF[] = "idx_ar_"; // <Prefix><Hash of the photo> -> How many records refer to it
+        constexpr char LEVELDB_INDEX_FLAG_ROW[] = "idx_fo_";    // <Prefix><Big-endian Ordinal> -> Date/Time, flags and IDs of the record
+        constexpr char LEVELDB_INDEX_FLAG_RECORD[] = "idx_fr_"; // <Prefix><Record ID> -> Big-endian Ordinal
+        constexpr char LEVELDB_INDEX_FLAG_BITMAP[] = "idx_fb_"; // <Prefix><Bitmap><NUL><Big-endian upper 16-bits> -> Container
+        constexpr char LEVELDB_INDEX_FLAG_META[] = "idx_fm";    // The next ordinal, and how many of the ordinals are in order
+        constexpr int LEVELDB_INDEX_CURRENT_VERSION = 11;      // Bump this whenever the layout of an index changes
+        constexpr char LEVELDB_FEED_SEQUENCE[] = "feed_seq";   // The sequence number of the last change to be committed
+        constexpr char LEVELDB_ALERT_QUEUE[] = "alert_q_";     // <Prefix><Big-endian Sequence> -> Alert, until acknowledged
+        constexpr char LEVELDB_ALERT_SEQUENCE[] = "alert_seq"; // The sequence number of the last alert to be raised
+        constexpr char LEVELDB_SERIES_CHUNK[] = "series_";     // <Prefix><Series>\0<Ordered Date/Time> -> Compressed chunk
+
         enum comboBoxType {
             AddRecord,
             ViewRecords,
@@ -125,6 +203,35 @@ namespace GekkoFyre {
             GkComboBox comboBox;
         };
 
+        struct GkIndexEntry {
+            long int date_time;             // The Date/Time of the record, as UNIX Epoch Time
+            std::string record_id;          // The Unique Identifier of the record
+        };
+
+        // A single entry within the (Animal, Date/Time) index, which carries the weight so charts needn't read the record
+        struct GkAnimalIndexEntry {
+            long int date_time;             // The Date/Time of the record, as UNIX Epoch Time
+            std::string record_id;          // The Unique Identifier of the record
+            double weight;                  // The weight of the lizard, as measured in this record
+        };
+
+        // The XOR of the leaf hashes of every record within a bucket of time, alongside how many records there are
+        struct GkBucketDigest {
+            std::uint64_t digest;
+            std::uint64_t count;
+        };
+
+        // What a merge of one database into another has had to look at and what it changed, as told to the user
+        struct GkMergeStats {
+            std::size_t buckets_compared = 0;       // How many buckets the source database has
+            std::size_t buckets_differing = 0;      // ...of which the destination does not have an identical copy
+            std::size_t records_compared = 0;       // How many records within those buckets had their hashes compared
+            std::size_t records_imported = 0;       // Records that the destination did not have at all
+            std::size_t records_replaced = 0;       // Conflicting records where the source's copy was the newer one
+            std::size_t records_kept = 0;           // Conflicting records where the destination's copy was kept
+            std::size_t categories_created = 0;     // Licensees, Species and Animals that had no match by name
+        };
+
         struct GkSubmit {
             std::string record_id;          // The Unique Identifier for the entire record in question, for database purposes
             std::time_t date_time;          // The epoch at the time of submitting/modifying this record
@@ -141,6 +248,7 @@ namespace GekkoFyre {
             bool had_hydration;             // Whether the lizard had any hydration or not
             bool had_vitamins;              // Whether the lizard had any vitamins or not
             double weight;                  // The weight of the lizard in question
+            std::vector<std::string> attachments; // The SHA-256 hashes of any photos, as kept by the `GkAttachmentStore`
         };
 
         struct MiscUniqueIds {
@@ -156,6 +264,13 @@ namespace GekkoFyre {
             QMap<std::string, std::pair<std::string, std::string>> animals_cache;
         };
 
+        struct GkCatDeletionTally {
+            int licensees = 0;
+            int species = 0;
+            int animal_ids = 0;
+            int log_entries = 0;
+        };
+
         enum MiscRecordType {
             gkLicensee,
             gkSpecies,
@@ -163,14 +278,334 @@ namespace GekkoFyre {
             None
         };
 
-        namespace GkGraph {
-            struct WeightVsTime {
-                std::string record_id;
-                GkSpecies species;
-                GkId identifier;
-                double weight;
-            };
-        }
+        enum GkChangeType {
+            RecordInserted,
+            RecordUpdated,
+            RecordDeleted,
+            CategoryAdded,
+            CategoryRemoved,
+            CategoryRenamed
+        };
+
+        // A single change that has been committed to the database, as published by the `GkChangeFeed`
+        struct GkChange {
+            std::uint64_t sequence;         // Increases by at least one with every change, and persists across sessions
+            GkChangeType type;              // What sort of change this is
+            std::string id;                 // The Record ID, or the Unique ID of the Licensee/Species/Animal
+            MiscRecordType category;        // Which sort of category was changed, or `None` when it's a record
+            std::string name;               // The (new) name of the category, or the key of the field that was updated
+            GkSubmit record;                // The record itself, but only upon `RecordInserted`
+        };
+
+        // What a run of writes to the database has changed, so that only the affected caches and widgets get refreshed
+        struct GkChangeSet {
+            std::vector<std::string> records_added;     // The Record IDs that have been inserted
+            std::vector<std::string> records_removed;   // The Record IDs that have been deleted
+            std::vector<std::string> records_updated;   // The Record IDs that have had a field edited
+            bool categories_touched;                    // Whether a Licensee, Species, or Animal has come or gone
+            bool date_range_moved;                      // Whether the minimum/maximum Date/Time may have moved
+        };
+
+        // A single Licensee, Species, or Animal within the `GkCategoryTree`
+        struct GkCategoryNode {
+            std::string id;                         // The Unique ID of the category, for database purposes
+            std::string name;                       // The name of the category, as shown within the QComboBoxes
+            std::vector<std::uint32_t> children;    // The Species of a Licensee, or the Animals of a Species, by name
+            std::uint32_t parent;                   // The Licensee of a Species, or the Species of an Animal, if linked
+            std::uint32_t record_count;             // How many records are filed under this category
+        };
+
+        // One tier of the `GkCategoryTree`, whereby the nodes are never moved so their indices stay valid
+        struct GkCategoryLevel {
+            std::vector<GkCategoryNode> nodes;                      // Index -> Node
+            std::unordered_map<std::string, std::uint32_t> lookup;  // Unique ID -> Index
+        };
+
+        // A category whose name resembles what was typed, as found by the `GkTrigramIndex`
+        struct GkNameMatch {
+            std::uint32_t idx;      // The node of the category within its tier of the `GkCategoryTree`
+            double score;           // How closely the name resembles the query, with higher being better
+        };
+
+        // The longest stretch of time over which an animal's records went without a given husbandry flag being set
+        struct GkFlagLapse {
+            std::string name_id;            // The Unique ID of the animal
+            long int lapse_start;           // The last time the flag was set, or the animal's first record otherwise
+            long int lapse_end;             // The next time the flag was set, or the animal's last record otherwise
+            std::size_t records;            // How many records were logged for the animal over the course of the lapse
+        };
+
+        // A record's row within the flag index, whose ordinal is the bit that it sets within each of the bitmaps
+        struct GkFlagRow {
+            std::uint32_t ordinal;          // Handed out in order of Date/Time, for as long as the records arrive that way
+            std::string record_id;          // The Unique ID of the record
+            std::string name_id;            // The Unique ID of the animal that the record is filed under
+            long int date_time;             // The Date/Time of the record, as UNIX Epoch Time
+            std::uint8_t flags;             // A bitmask made up of `GkRecords::GkFlagBits`
+        };
+
+        // How far along the flag index is with handing out its ordinals
+        struct GkFlagIndexMeta {
+            std::uint64_t next_ordinal;     // The ordinal to be given to the next record that's written
+            std::uint64_t sorted_count;     // The ordinals below this one are in order of their Date/Time
+            long int last_sorted;           // The Date/Time of the last of the ordinals that are in order
+        };
+
+        // The spread of the weights of a species over a stretch of time, as read from its quantile sketches
+        struct GkWeightBand {
+            long int band_start;            // The beginning of the first bucket within the band, as UNIX Epoch Time
+            long int band_end;              // The end of the last bucket within the band, as UNIX Epoch Time
+            std::uint64_t count;            // How many weights were measured over the course of the band
+            double p10;                     // The tenth percentile of the weights
+            double p50;                     // The median weight
+            double p90;                     // The ninetieth percentile of the weights
+            double rank_error;              // How far off the percentiles can be, as a fraction of `count`
+        };
+
+        // The rolling statistics of a single animal, kept up-to-date as its log entries come in, so that they needn't be
+        // worked out from the records themselves every time that they're looked at
+        struct GkAnimalSummary {
+            std::string name_id;            // The Unique ID of the animal
+            std::uint64_t record_count;     // How many records were logged for the animal
+            long int first_seen;            // The Date/Time of the animal's oldest record, as UNIX Epoch Time
+            long int last_seen;             // The Date/Time of the animal's newest record, as UNIX Epoch Time
+            double last_weight;             // The weight of the animal, as measured by its newest record
+            double weight_ewma;             // The exponentially weighted moving average of the animal's weight
+            long int last_toilet;           // The last time the animal went to the toilet, or zero if never
+            long int last_hydration;        // The last time the animal had hydration, or zero if never
+            long int last_vitamins;         // The last time the animal had vitamins, or zero if never
+            long int window_start;          // Records before this have been taken back out of the sums below
+            std::uint64_t window_count;     // How many records lie within the window
+            double window_sum_t;            // The sums of the (days since `first_seen`, weight) pairs within the window, for
+            double window_sum_w;            // working out the slope of a least-squares line through them
+            double window_sum_tt;
+            double window_sum_tw;
+            std::uint64_t delta_count;      // How many changes in weight from one record to the next have been seen
+            double delta_mean;              // The exponentially weighted mean of those changes
+            double delta_var;               // ...and their exponentially weighted variance
+            bool stale;                     // Whether a record was deleted or came in out of order, so a rebuild is due
+        };
+
+        enum GkAttention : std::uint8_t {
+            AttentionNone = 0x00,
+            AttentionWeightLoss = 0x01,     // The weight trend is falling faster than `HERPLOG_ATTENTION_WEIGHT_LOSS`
+            AttentionToilet = 0x02,         // No toilet for longer than `HERPLOG_ATTENTION_LAPSE_SECONDS`
+            AttentionHydration = 0x04,      // Likewise, for hydration
+            AttentionVitamins = 0x08,       // Likewise, for vitamins
+            AttentionNotLogged = 0x10       // Nothing has been logged for the animal at all in that time
+        };
+
+        enum GkAlertKind : std::uint8_t {
+            AlertWeightDrop = 1,            // The weight fell by far more than it usually changes from one record to the next
+            AlertWeightGain,                // Likewise, but rose
+            AlertMissedToilet,              // The animal has now gone longer than `HERPLOG_ATTENTION_LAPSE_SECONDS` without
+            AlertMissedHydration,           // ...going to the toilet, having hydration or having vitamins
+            AlertMissedVitamins
+        };
+
+        // A problem spotted with a record as it was written, which waits within the database until acknowledged
+        struct GkAlert {
+            std::uint64_t sequence;         // The order in which the alerts were raised, which also keys them
+            std::string name_id;            // The Unique ID of the animal
+            std::string record_id;          // The Unique ID of the record that raised the alert
+            long int date_time;             // The Date/Time of that record, as UNIX Epoch Time
+            GkAlertKind kind;
+            double score;                   // The z-score of the change in weight, or the days since the flag was set
+        };
+
+        // Maps each row of the category QComboBoxes within a tab back onto a node of the `GkCategoryTree`
+        struct GkComboIndex {
+            std::vector<std::uint32_t> licensees;
+            std::vector<std::uint32_t> species;
+            std::vector<std::uint32_t> animals;
+        };
+
+        enum GkFlagBits : std::uint8_t {
+            WentToilet = 0x01,
+            HadHydration = 0x02,
+            HadVitamins = 0x04
+        };
+    }
+
+    namespace GkTracing {
+        enum GkTracePhase : char {
+            Complete = 'X',     // A span, with both a start and a duration
+            Counter = 'C'       // A value at a point in time
+        };
+
+        // A single entry within a thread's ring buffer, whereby the names must be string literals as only the pointers are kept
+        struct GkTraceEvent {
+            const char *name;
+            const char *category;
+            std::int64_t ts_ns;             // Since the first event was ever traced
+            std::int64_t dur_ns;            // Only for `Complete`
+            double value;                   // Only for `Counter`
+            GkTracePhase phase;
+        };
+    }
+
+    namespace GkStalls {
+        // A single freeze of the event loop, blamed upon whichever scope marker was seen the most whilst it lasted
+        struct GkStall {
+            std::int64_t start_ms;      // Since the watchdog was started
+            std::int64_t duration_ms;
+            std::string culprit;        // e.g. "HerpApp::update_charts > GkDbRead::extract_records"
+        };
+
+        struct GkStallOffender {
+            std::string culprit;
+            std::size_t count;
+            std::int64_t total_ms;
+            std::int64_t max_ms;
+        };
+
+        struct GkStallReport {
+            std::int64_t watched_ms;
+            std::uint64_t heartbeats;
+            std::int64_t max_latency_ms;
+            std::vector<std::pair<std::string, std::size_t>> histogram;    // <Range of durations, Count of stalls>
+            std::vector<GkStallOffender> offenders;                         // The worst first, by the total time stalled
+            std::vector<GkStall> stalls;
+        };
+    }
+
+    namespace GkBenchmark {
+        // The shape of the synthetic database that `herplog_bench` generates, which is the same for any given seed
+        struct GkBenchParams {
+            std::size_t licensees = 4;
+            std::size_t species = 12;       // Spread evenly across the Licensees
+            std::size_t animals = 60;       // Spread evenly across the Species
+            std::size_t records = 5000;     // Spread across two years' worth of Date/Times
+            std::size_t iterations = 5;     // How many times each of the read-only benchmarks is repeated
+            std::uint64_t seed = 1;
+        };
+
+        // The timings of a single benchmark, in milliseconds
+        struct GkBenchResult {
+            std::string name;
+            std::size_t iterations;         // How many times the benchmark was run
+            std::size_t operations;         // How many operations (e.g. records inserted) make up each run
+            double min_ms;
+            double median_ms;
+            double mean_ms;
+            double max_ms;
+        };
+    }
+
+    namespace GkService {
+        // Every request starts with one of these, and is answered with a `GkStatus` followed by the results (if any)
+        enum GkOpcode : std::uint8_t {
+            Hello = 1,
+            Get,
+            Write,
+            Scan,
+            SnapshotAcquire,
+            SnapshotRelease,
+            LeaseAcquire,
+            LeaseRelease,
+            Property,
+            ApproximateSizes,
+            Compact,
+            Publish,
+            FeedSince
+        };
+
+        enum GkScanMode : std::uint8_t {
+            First,      // Forwards, from the very first key
+            Last,       // Backwards, from the very last key
+            AtOrAfter,  // Forwards, from the given key onwards
+            After,      // Forwards, from just after the given key
+            Before      // Backwards, from just before the given key
+        };
+
+        enum GkStatus : std::uint8_t {
+            Ok,
+            NotFound,
+            Failed
+        };
+    }
+
+    namespace GkDiagnostics {
+        // The approximate amount of disk space taken up by one family of keys, as per `leveldb::DB::GetApproximateSizes()`
+        struct GkKeyFamily {
+            std::string name;
+            std::string start;
+            std::string limit;
+            std::uint64_t approx_bytes;
+        };
+
+        // One of the lists of Unique IDs kept under a prefix, such as `store_rid_`
+        struct GkBlobSize {
+            std::string key;
+            std::size_t bytes;
+            std::size_t entries;
+        };
+
+        struct GkDbReport {
+            bool remote;                        // Whether the database is being shared via `--serve`, and not opened within this process
+            std::string leveldb_stats;          // `leveldb.stats`
+            std::string leveldb_sstables;       // `leveldb.sstables`
+            std::vector<GkKeyFamily> families;
+            std::vector<GkBlobSize> blobs;
+            bool cache_counted;                 // False whenever there is no `GkCountingCache` to ask, such as with a remote database
+            std::uint64_t cache_hits;
+            std::uint64_t cache_misses;
+            std::size_t cache_capacity;
+            std::uint64_t temp_dir_bytes;
+            std::size_t temp_dir_files;
+            std::uint64_t archive_bytes;        // Zero if the database has not been saved as an archive yet
+        };
+    }
+
+    namespace GkSeries {
+        // A single reading from an enclosure's probe, such as its temperature or humidity
+        struct GkSeriesPoint {
+            long int date_time;             // As UNIX Epoch Time
+            double value;
+        };
+
+        // The readings of a series that fall within a single downsampling bucket
+        struct GkSeriesBucket {
+            long int bucket;                // The start of the bucket, as UNIX Epoch Time
+            std::uint64_t count;
+            double minimum;
+            double maximum;
+            double mean;
+        };
+    }
+
+    namespace GkReport {
+        enum GkBucketSize {
+            Day,
+            Week,                   // Starting upon a Monday
+            Month
+        };
+
+        enum GkGroupBy {
+            Licensee,
+            Species,
+            Animal
+        };
+
+        // The running totals of a single (bucket, group) cell, which can be merged with those from another partition
+        struct GkAggregateCell {
+            long int bucket;                // The start of the bucket, as UNIX Epoch Time
+            std::uint32_t group;            // Index into `GkAggregateTable::group_ids`
+            std::uint64_t count;
+            double weight_sum;
+            double weight_min;
+            double weight_max;
+            std::uint64_t went_toilet;      // How many of the records had the flag set, for working out the rate
+            std::uint64_t had_hydration;
+            std::uint64_t had_vitamins;
+        };
+
+        struct GkAggregateTable {
+            GkBucketSize bucket_size;
+            GkGroupBy group_by;
+            std::vector<std::string> group_ids;     // The Unique ID of each Licensee, Species or Animal
+            std::vector<GkAggregateCell> cells;     // Only those with any records, ordered by bucket and then by group
+        };
     }
 }
 